@@ -2,23 +2,39 @@
 #define BPTREE_H
 
 #include <cassert>
+#include <climits>
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+#include <stdint.h>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
-#include "bptree.h"
+#include <bufmanager/BufPageManager.h>
+#include <fileio/FileManager.h>
+#include "rc.h"
 #include "type.h"
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace bptree
 {
 
-/* predefined B+ info */
-const int BP_ORDER = 20;
-/* offsets */
+/* offsets, every node occupies one buffer page and the meta block owns page 0 */
 const int OFFSET_META = 0;
-#define OFFSET_BLOCK OFFSET_META + sizeof(meta_t)
-#define SIZE_NO_CHILDREN sizeof(leaf_node_t) - BP_ORDER * sizeof(record_t)
+#define OFFSET_BLOCK OFFSET_META + PAGE_SIZE
+#define SIZE_NO_CHILDREN NODE_HEAD_SIZE
+
+/* internal nodes a tree keeps pinned in memory, a page each, taken from
+ * the root down as searches first reach them */
+#ifndef BP_PIN_NODES
+#define BP_PIN_NODES 64
+#endif
 
 #define OPERATOR_KEYCMP(Key, Value, type) \
     bool operator< (const Key &l, const bplus_tree<Key, Value>::type &r) {\
@@ -28,31 +44,351 @@ const int OFFSET_META = 0;
         return bplus_tree<Key, Value>::keycmp(l.key, r) < 0;\
     }
 
-/* key/value type */
-//typedef int value_t;
-//struct key_str
-//{
-//    char k[16];
+/* index key paired with the rid of its row, so duplicate keys are
+ * distinct entries that sit next to each other in the leafs */
+template<typename key_t>
+struct rid_key
+{
+    key_t key;
+    RID rid;
+
+    rid_key() {}
+    rid_key(const key_t &k, const RID &r) : key(k), rid(r) {}
+
+    /* bounds of all the entries of one key */
+    static rid_key lowest(const key_t &k)
+    {
+        return rid_key(k, RID(INT_MIN, INT_MIN));
+    }
+    static rid_key highest(const key_t &k)
+    {
+        return rid_key(k, RID(INT_MAX, INT_MAX));
+    }
+
+    bool operator < (const rid_key &t) const
+    {
+        if (key < t.key)return true;
+
+        if (t.key < key)return false;
+
+        return rid < t.rid;
+    }
+    bool operator == (const rid_key &t) const
+    {
+        return !(*this < t) && !(t < *this);
+    }
+};
+
+/* a 64 bit integer key, NULL sorting last as in Type_int */
+struct int64_key
+{
+    bool null;
+    int64_t value;
+
+    int64_key(bool _null = true, int64_t v = 0) : null(_null), value(v) {}
+
+    bool operator < (const int64_key &t) const
+    {
+        if (null || t.null)return !null && t.null;
+
+        return value < t.value;
+    }
+    bool operator == (const int64_key &t) const
+    {
+        if (null || t.null)return null == t.null;
+
+        return value == t.value;
+    }
+};
+
+/* a CHAR(n) key of at most `size` bytes, zero padded so that memcmp
+ * orders it as strcmp orders the string */
+template<int size>
+struct char_key
+{
+    bool null;
+    char str[size];
+
+    char_key(bool _null = true, const char *s = "", size_t length = 0) : null(_null)
+    {
+        memset(str, 0, size);
+        memcpy(str, s, std::min(length, (size_t)size));
+    }
+
+    bool operator < (const char_key &t) const
+    {
+        if (null || t.null)return !null && t.null;
+
+        return memcmp(str, t.str, size) < 0;
+    }
+    bool operator == (const char_key &t) const
+    {
+        if (null || t.null)return null == t.null;
+
+        return memcmp(str, t.str, size) == 0;
+    }
+};
+
+/* the key of a column value: the value itself, or one built from it.
+ * truncated is true for a value longer than any key, which no stored
+ * value can equal */
+template<class K>
+struct key_of
+{
+    static K get(Type *data)
+    {
+        return *static_cast<K *>(data);
+    }
+    static bool truncated(Type *)
+    {
+        return false;
+    }
+};
+template<>
+struct key_of<int64_key>
+{
+    static int64_key get(Type *data)
+    {
+        return int64_key(data->null, static_cast<Type_bigint *>(data)->getLong());
+    }
+    static bool truncated(Type *)
+    {
+        return false;
+    }
+};
+template<int size>
+struct key_of<char_key<size> >
+{
+    static char_key<size> get(Type *data)
+    {
+        return char_key<size>(data->null, data->getStr(), strlen(data->getStr()));
+    }
+    static bool truncated(Type *data)
+    {
+        return !data->null && strlen(data->getStr()) > (size_t)size;
+    }
+};
+
+/* how many of the 8 values of a block are less than c, or not greater */
+inline size_t block_rank(const int32_t *block, int32_t c, bool or_equal)
+{
+#if defined(__AVX2__)
+    __m256i key = _mm256_set1_epi32(c), v = _mm256_loadu_si256((const __m256i *)block);
+    __m256i mask = or_equal ? _mm256_cmpgt_epi32(v, key) : _mm256_cmpgt_epi32(key, v);
+    size_t n = __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+#elif defined(__SSE2__)
+    __m128i key = _mm_set1_epi32(c);
+    __m128i v0 = _mm_loadu_si128((const __m128i *)block), v1 = _mm_loadu_si128((const __m128i *)(block + 4));
+    __m128i m0 = or_equal ? _mm_cmpgt_epi32(v0, key) : _mm_cmpgt_epi32(key, v0);
+    __m128i m1 = or_equal ? _mm_cmpgt_epi32(v1, key) : _mm_cmpgt_epi32(key, v1);
+    size_t n = __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(m0)) | _mm_movemask_ps(_mm_castsi128_ps(m1)) << 4);
+#else
+    size_t n = 0;
+
+    for (int i = 0; i < 8; ++i)
+        n += or_equal ? block[i] > c : c > block[i];
+
+#endif
+    return or_equal ? 8 - n : n;
+}
+
+/* how many of the first `count` values of a sorted column are less than c
+ * and how many are not greater, the column being padded with INT_MAX to a
+ * multiple of 8. a branchless binary search over the last value of each
+ * block of 8 finds the block where each count ends, and that block is
+ * compared all at once */
+inline void column_rank(const int32_t *column, size_t count, int32_t c,
+                        size_t &less, size_t &not_greater)
+{
+    size_t blocks = (count + 7) / 8, low = 0, high = 0;
+
+    if (blocks == 0)
+    {
+        less = not_greater = 0;
+        return;
+    }
+
+    for (size_t n = blocks; n > 1; n -= n / 2)
+    {
+        low += column[8 * (low + n / 2) + 7] < c ? n / 2 : 0;
+        high += column[8 * (high + n / 2) + 7] <= c ? n / 2 : 0;
+    }
+
+    low += column[8 * low + 7] < c;
+    high += column[8 * high + 7] <= c;
+    less = 8 * low + (low < blocks ? block_rank(column + 8 * low, c, false) : 0);
+    not_greater = std::min(8 * high + (high < blocks ? block_rank(column + 8 * high, c, true) : 0), count);
+}
+
+/* the column a node keeps beside its keys to search them fast, none by
+ * default; `rank` narrows a search to the keys that compare equal in it */
+template<typename key_t>
+struct key_column
+{
+    typedef char column_t;
+    static const size_t WIDTH = 0;
+
+    static void fill(column_t *, const key_t *, size_t, size_t, size_t) {}
+
+    static void rank(const column_t *, size_t count, const key_t &, size_t &less, size_t &not_greater)
+    {
+        less = 0;
+        not_greater = count;
+    }
+};
+
+/* key values of an integer index, contiguous, so they are compared eight
+ * at a time instead of one by one through Type_int; NULL and INT_MAX share
+ * the largest value and rids tell equal values apart */
+template<>
+struct key_column<rid_key<Type_int> >
+{
+    typedef int32_t column_t;
+    static const size_t WIDTH = sizeof(column_t);
+
+    static column_t of(const rid_key<Type_int> &k)
+    {
+        return k.key.null ? INT_MAX : k.key.getValue();
+    }
+
+    /* keys are `stride` bytes apart, as they sit in the node's children */
+    static void fill(column_t *column, const rid_key<Type_int> *key, size_t stride, size_t count, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+            column[i] = i < count ? of(*(const rid_key<Type_int> *)((const char *)key + i * stride)) : INT_MAX;
+    }
+
+    static void rank(const column_t *column, size_t count, const rid_key<Type_int> &key, size_t &less, size_t &not_greater)
+    {
+        column_rank(column, count, of(key), less, not_greater);
+    }
+};
+
+/* 64 bit values clamped into the column, the clamped ones tie */
+template<>
+struct key_column<rid_key<int64_key> >
+{
+    typedef int32_t column_t;
+    static const size_t WIDTH = sizeof(column_t);
+
+    static column_t of(const rid_key<int64_key> &k)
+    {
+        return k.key.null ? INT_MAX : (column_t)std::max<int64_t>(INT_MIN, std::min<int64_t>(INT_MAX, k.key.value));
+    }
+
+    static void fill(column_t *column, const rid_key<int64_key> *key, size_t stride, size_t count, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+            column[i] = i < count ? of(*(const rid_key<int64_key> *)((const char *)key + i * stride)) : INT_MAX;
+    }
+
+    static void rank(const column_t *column, size_t count, const rid_key<int64_key> &key, size_t &less, size_t &not_greater)
+    {
+        column_rank(column, count, of(key), less, not_greater);
+    }
+};
+
+/* the first 4 bytes of a CHAR key, as a signed value ordered like them */
+template<int size>
+struct key_column<rid_key<char_key<size> > >
+{
+    typedef int32_t column_t;
+    static const size_t WIDTH = sizeof(column_t);
+
+    static column_t of(const rid_key<char_key<size> > &k)
+    {
+        if (k.key.null)return INT_MAX;
+
+        const unsigned char *s = (const unsigned char *)k.key.str;
+        uint32_t v = (uint32_t)s[0] << 24 | (uint32_t)s[1] << 16 | (uint32_t)s[2] << 8 | s[3];
+        return (column_t)(v ^ 0x80000000u);
+    }
+
+    static void fill(column_t *column, const rid_key<char_key<size> > *key, size_t stride, size_t count, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+            column[i] = i < count ? of(*(const rid_key<char_key<size> > *)((const char *)key + i * stride)) : INT_MAX;
+    }
+
+    static void rank(const column_t *column, size_t count, const rid_key<char_key<size> > &key, size_t &less, size_t &not_greater)
+    {
+        column_rank(column, count, of(key), less, not_greater);
+    }
+};
+
+/* version locks over node pages, for a tree shared between threads.
+ * writers take turns; a writer locks each node before it first changes
+ * it and unlocks them all once done, so a reader that finds a node's
+ * version unchanged after reading it saw no half done operation. pages
+ * are pinned in the buffer while in use, see BufPageManager::pinPage */
+class node_latch
+{
+public:
+    /* pages share versions modulo this, costing only spurious retries */
+    static const size_t SLOTS = 1 << 12;
+
+    std::mutex writer;
+
+    node_latch()
+    {
+        for (size_t i = 0; i < SLOTS; ++i)
+        {
+            versions[i] = 0;
+            locked[i] = false;
+        }
+    }
+
+    /* version of the node, waiting while a writer holds it */
+    uint64_t read(off_t offset) const
+    {
+        uint64_t v;
+
+        while ((v = versions[slot(offset)].load()) & 1)
+            std::this_thread::yield();
+
+        return v;
+    }
+
+    /* true if the node didn't change since read() gave v */
+    bool validate(off_t offset, uint64_t v) const
+    {
+        return versions[slot(offset)].load() == v;
+    }
+
+    /* called by the writer before it changes the node */
+    void lock(off_t offset)
+    {
+        size_t s = slot(offset);
 
-//    key_str(const char *str = "")
-//    {
-//        bzero(k, sizeof(k));
-//        strcpy(k, str);
-//    }
-//    bool operator < (const key_str &t) const
-//    {
-//        int x = strlen(k) - strlen(t.k);
+        if (locked[s])return;
 
-//        if (!x)return strcmp(k, t.k) < 0;
-//        else return x < 0;
-//    }
+        locked[s] = true;
+        versions[s]++;
+        held.push_back(s);
+    }
 
-//    bool operator == (const key_str &t) const
-//    {
-//        return strcmp(k, t.k) == 0;
-//    }
-//};
+    /* end of a write, every node it changed gets a new version */
+    void unlock()
+    {
+        for (size_t s : held)
+        {
+            versions[s]++;
+            locked[s] = false;
+        }
 
+        held.clear();
+    }
+
+private:
+    std::atomic<uint64_t> versions[SLOTS];
+    bool locked[SLOTS];
+    std::vector<size_t> held;
+
+    static size_t slot(off_t offset)
+    {
+        return (offset >> PAGE_SIZE_IDX) % SLOTS;
+    }
+};
 
 /* the encapulated B+ tree */
 template<typename key_t, typename value_t>
@@ -78,6 +414,8 @@ public:
         off_t slot;        /* where to store new block */
         off_t root_offset; /* where is the root of internal nodes */
         off_t leaf_offset; /* where is the first leaf */
+        off_t free_offset; /* first freed block to reuse, 0 if none */
+        size_t free_node_num; /* how many freed blocks */
     } meta_t;
 
     /* internal nodes' index segment */
@@ -87,6 +425,27 @@ public:
         off_t child; /* child's offset */
     };
 
+    /* the final record of value */
+    struct record_t
+    {
+        key_t key;
+        value_t value;
+    };
+
+    typedef key_column<key_t> column_of;
+    typedef typename column_of::column_t column_t;
+
+    /* node header: parent, next, prev and n, then the children, then the
+     * column; room is kept for padding the column to a multiple of 8 */
+    static const size_t NODE_HEAD_SIZE = 3 * sizeof(off_t) + sizeof(size_t);
+    static const size_t NODE_ROOM = PAGE_SIZE - NODE_HEAD_SIZE - 8 * sizeof(column_t) - 8;
+    static const size_t LEAF_ORDER = NODE_ROOM / (sizeof(record_t) + column_of::WIDTH);
+    static const size_t INTERNAL_ORDER = NODE_ROOM / (sizeof(index_t) + column_of::WIDTH);
+
+    /* `order` of B+ tree, as many entries as fill one page for this key type */
+    static const size_t BP_ORDER = LEAF_ORDER < INTERNAL_ORDER ? LEAF_ORDER : INTERNAL_ORDER;
+    static const size_t COLUMN_SIZE = column_of::WIDTH ? (BP_ORDER + 7) / 8 * 8 : 1;
+
     /***
      * internal node block
      ***/
@@ -99,13 +458,7 @@ public:
         off_t prev;
         size_t n; /* how many children */
         index_t children[BP_ORDER];
-    };
-
-    /* the final record of value */
-    struct record_t
-    {
-        key_t key;
-        value_t value;
+        column_t column[COLUMN_SIZE]; /* the keys but the last, see key_column */
     };
 
     /* leaf node block */
@@ -118,49 +471,161 @@ public:
         off_t prev;
         size_t n;
         record_t children[BP_ORDER];
+        column_t column[COLUMN_SIZE];
+    };
+
+    static_assert(BP_ORDER >= 4, "key is too wide for a page sized node");
+    static_assert(sizeof(leaf_node_t) <= PAGE_SIZE, "leaf node must fit in a page");
+    static_assert(sizeof(internal_node_t) <= PAGE_SIZE, "internal node must fit in a page");
+
+    /* position in the leaf chain, moving one record at a time; it holds a
+     * copy of the records of the current leaf, so the tree must not change
+     * while in use */
+    class cursor
+    {
+    public:
+        cursor() : tree(NULL), offset(0), pos(0) {}
+
+        bool valid() const
+        {
+            return offset != 0 && pos < leaf.n;
+        }
+        const key_t &key() const
+        {
+            return leaf.children[pos].key;
+        }
+        const value_t &value() const
+        {
+            return leaf.children[pos].value;
+        }
+
+        /* step forward, false past the last record */
+        bool next()
+        {
+            if (offset == 0)
+                return false;
+
+            if (++pos < leaf.n)
+                return true;
+
+            return settle();
+        }
+
+        /* step backward, false before the first record */
+        bool prev()
+        {
+            if (offset == 0)
+                return false;
+
+            if (pos > 0)
+            {
+                --pos;
+                return true;
+            }
+
+            while (leaf.prev != 0)
+            {
+                offset = leaf.prev;
+                tree->map_records(&leaf, offset);
+
+                if (leaf.n > 0)
+                {
+                    pos = leaf.n - 1;
+                    return true;
+                }
+            }
+
+            offset = 0;
+            return false;
+        }
+
+    private:
+        friend class bplus_tree;
+
+        const bplus_tree *tree;
+        off_t offset;
+        size_t pos;
+        leaf_node_t leaf;
+
+        /* move past the end of a leaf onto the next record */
+        bool settle()
+        {
+            while (pos >= leaf.n && leaf.next != 0)
+            {
+                offset = leaf.next;
+                tree->map_records(&leaf, offset);
+                pos = 0;
+            }
+
+            if (pos < leaf.n)
+                return true;
+
+            offset = 0;
+            return false;
+        }
     };
 
-    bplus_tree(const char *p, bool force_empty = false)
-        : fp(NULL), fp_level(0)
+    bplus_tree(FileManager *_fm, BufPageManager *_bpm, const char *p,
+               bool force_empty = false)
+        : fm(_fm), bpm(_bpm), fileId(-1), empty_init(false), latch(NULL), root_pin(NULL)
     {
         bzero(path, sizeof(path));
         strcpy(path, p);
 
-        if (!force_empty)
+        struct stat st;
+
+        // a file without a whole meta page can't hold a tree
+        if (stat(path, &st) != 0 || st.st_size < PAGE_SIZE)
+            force_empty = true;
+
+        if (force_empty)
+            truncate(path, 0);
 
+        open_file();
+
+        if (!force_empty)
+        {
             // read tree from file
-            if (map(&meta, OFFSET_META) != 0)
+            map(&meta, OFFSET_META);
+
+            if (meta.order != BP_ORDER || meta.key_size != sizeof(key_t) ||
+                    meta.value_size != sizeof(value_t))
                 force_empty = true;
+        }
 
         if (force_empty)
         {
-            open_file("w+"); // truncate file
-
-            // create empty tree if file doesn't exist
+            // create empty tree if file doesn't exist or has another layout
             init_from_empty();
-            close_file();
+            empty_init = true;
         }
     }
+
+    ~bplus_tree()
+    {
+        unpin_all();
+        close_file();
+    }
+
     /* abstract operations */
     int search(const key_t &key, value_t *value) const
     {
-        leaf_node_t leaf;
-        map(&leaf, search_leaf(key));
+        int found = -1;
 
-        // finding the record
-        record_t *record = find(leaf, key);
-
-        if (record != leaf.children + leaf.n)
+        visit<leaf_node_t>(search_leaf(key), [&](leaf_node_t & leaf)
         {
-            // always return the lower bound
-            *value = record->value;
+            // finding the record
+            record_t *record = find(leaf, key);
 
-            return keycmp(record->key, key);
-        }
-        else
-        {
-            return -1;
-        }
+            if (record != leaf.children + leaf.n)
+            {
+                // always return the lower bound
+                *value = record->value;
+                found = keycmp(record->key, key);
+            }
+        });
+
+        return found;
     }
 
     int search_range(key_t *left, const key_t &right,
@@ -173,48 +638,52 @@ public:
         off_t off_right = search_leaf(right);
         off_t off = off_left;
         size_t i = 0;
-        record_t *b, *e;
-
-        leaf_node_t leaf;
+        bool more = false;
+        key_t resume;
 
         while (off != off_right && off != 0 && i < max)
         {
-            map(&leaf, off);
+            visit<leaf_node_t>(off, [&](leaf_node_t & leaf)
+            {
+                // start point
+                record_t *b = off_left == off ? find(leaf, *left) : begin(leaf);
+                record_t *e = end(leaf);
 
-            // start point
-            if (off_left == off)
-                b = find(leaf, *left);
-            else
-                b = begin(leaf);
+                for (; b != e && i < max; ++b, ++i)
+                    values[i] = b->value;
 
-            // copy
-            e = leaf.children + leaf.n;
+                more = b != e;
 
-            for (; b != e && i < max; ++b, ++i)
-                values[i] = b->value;
+                if (more)resume = b->key;
 
-            off = leaf.next;
+                off = leaf.next;
+            });
         }
 
         // the last leaf
         if (i < max)
         {
-            map(&leaf, off_right);
+            visit<leaf_node_t>(off_right, [&](leaf_node_t & leaf)
+            {
+                record_t *b = find(leaf, *left);
+                record_t *e = std::upper_bound(begin(leaf), end(leaf), right);
 
-            b = find(leaf, *left);
-            e = std::upper_bound(begin(leaf), end(leaf), right);
+                for (; b != e && i < max; ++b, ++i)
+                    values[i] = b->value;
 
-            for (; b != e && i < max; ++b, ++i)
-                values[i] = b->value;
+                more = b != e;
+
+                if (more)resume = b->key;
+            });
         }
 
         // mark for next iteration
         if (next != NULL)
         {
-            if (i == max && b != e)
+            if (i == max && more)
             {
                 *next = true;
-                *left = b->key;
+                *left = resume;
             }
             else
             {
@@ -235,144 +704,221 @@ public:
         off_t off_left = search_leaf(left);
         off_t off_right = search_leaf(right);
         off_t off = off_left;
-        size_t i = 0;
-        record_t *b, *e;
-
-        leaf_node_t leaf;
 
         while (off != off_right && off != 0)
         {
-            map(&leaf, off);
-
-            // start point
-            if (off_left == off)
-                b = find(leaf, left);
-            else
-                b = begin(leaf);
-
-            // copy
-            e = leaf.children + leaf.n;
+            visit<leaf_node_t>(off, [&](leaf_node_t & leaf)
+            {
+                // start point
+                record_t *b = off_left == off ? find(leaf, left) : begin(leaf);
+                record_t *e = end(leaf);
 
-            for (; b != e; ++b)
-                values.push_back(b->value);
+                for (; b != e; ++b)
+                    values.push_back(b->value);
 
-            off = leaf.next;
+                off = leaf.next;
+            });
         }
 
         // the last leaf
-        if (true)
+        visit<leaf_node_t>(off_right, [&](leaf_node_t & leaf)
         {
-            map(&leaf, off_right);
-
-            b = find(leaf, left);
-            e = std::upper_bound(begin(leaf), end(leaf), right);
+            record_t *b = find(leaf, left);
+            record_t *e = std::upper_bound(begin(leaf), end(leaf), right);
 
             for (; b != e; ++b)values.push_back(b->value);
-        }
+        });
 
         return values;
     }
 
-    int remove(const key_t &key)
+    /* cursor at the first record not less than `key` */
+    cursor lower_bound(const key_t &key) const
     {
-        internal_node_t parent;
-        leaf_node_t leaf;
+        cursor c;
+        c.tree = this;
+        c.offset = search_leaf(key);
+        c.pos = map_records(&c.leaf, c.offset, &key);
+        c.settle();
+        return c;
+    }
+
+    /* cursor at the smallest record */
+    cursor first() const
+    {
+        cursor c;
+        c.tree = this;
+        c.offset = meta.leaf_offset;
+        map_records(&c.leaf, c.offset);
+        c.pos = 0;
+        c.settle();
+        return c;
+    }
+
+    /* cursor at the largest record */
+    cursor last() const
+    {
+        cursor c;
+        c.tree = this;
+        c.offset = meta.root_offset;
 
+        for (size_t height = meta.height; height > 0; --height)
+        {
+            visit<internal_node_t>(c.offset, [&](internal_node_t & node)
+            {
+                c.offset = (end(node) - 1)->child;
+            });
+        }
+
+        map_records(&c.leaf, c.offset);
+        c.pos = c.leaf.n;
+
+        if (!c.prev())
+            c.offset = 0;
+
+        return c;
+    }
+
+    int remove(const key_t &key)
+    {
         // find parent node
         off_t parent_off = search_index(key);
-        map(&parent, parent_off);
+        off_t offset = search_leaf(parent_off, key);
+        size_t min_n = meta.leaf_node_num == 1 ? 0 : meta.order / 2;
+        bool found, spare;
 
-        // find current node
-        index_t *where = find(parent, key);
-        off_t offset = where->child;
-        map(&leaf, offset);
+        visit<leaf_node_t>(offset, [&](leaf_node_t & leaf)
+        {
+            found = std::binary_search(begin(leaf), end(leaf), key);
+            spare = leaf.n > min_n;
+        });
 
         // verify
-        if (!std::binary_search(begin(leaf), end(leaf), key))
+        if (!found)
             return -1;
 
-        size_t min_n = meta.leaf_node_num == 1 ? 0 : meta.order / 2;
-        assert(leaf.n >= min_n && leaf.n <= meta.order);
+        // the leaf keeps enough records, delete the key where it is
+        if (spare)
+        {
+            modify<leaf_node_t>(offset, [&](leaf_node_t & leaf)
+            {
+                record_t *to_delete = find(leaf, key);
+                std::copy(to_delete + 1, end(leaf), to_delete);
+                leaf.n--;
+                refresh(&leaf);
+            });
+            return 0;
+        }
+
+        internal_node_t parent;
+        leaf_node_t leaf;
+        map(&parent, parent_off);
+        map(&leaf, offset);
+        index_t *where = find(parent, key);
+        assert(where->child == offset);
+        assert(leaf.n == min_n);
 
         // delete the key
         record_t *to_delete = find(leaf, key);
         std::copy(to_delete + 1, end(leaf), to_delete);
         leaf.n--;
 
-        // merge or borrow
-        if (leaf.n < min_n)
-        {
-            // first borrow from left
-            bool borrowed = false;
+        // borrow from or merge with a sibling under the same parent, so the
+        // separator between the two is always the one stored in `parent`
+        leaf_node_t sibling;
 
-            if (leaf.prev != 0)
-                borrowed = borrow_key(false, leaf);
-
-            // then borrow from right
-            if (!borrowed && leaf.next != 0)
-                borrowed = borrow_key(true, leaf);
+        if (where != begin(parent))
+        {
+            // borrow the last record of | prev | leaf |
+            off_t prev_off = (where - 1)->child;
+            map(&sibling, prev_off);
 
-            // finally we merge
-            if (!borrowed)
+            if (sibling.n > min_n)
             {
-                assert(leaf.next != 0 || leaf.prev != 0);
+                std::copy_backward(begin(leaf), end(leaf), end(leaf) + 1);
+                leaf.children[0] = *(end(sibling) - 1);
+                leaf.n++;
+                sibling.n--;
+                (where - 1)->key = begin(leaf)->key;
 
-                key_t index_key;
+                unmap(&sibling, prev_off);
+                unmap(&leaf, offset);
+                unmap(&parent, parent_off);
+                return 0;
+            }
+        }
 
-                if (where == end(parent) - 1)
-                {
-                    // if leaf is last element then merge | prev | leaf |
-                    assert(leaf.prev != 0);
-                    leaf_node_t prev;
-                    map(&prev, leaf.prev);
-                    index_key = begin(prev)->key;
-
-                    merge_leafs(&prev, &leaf);
-                    node_remove(&prev, &leaf);
-                    unmap(&prev, leaf.prev);
-                }
-                else
-                {
-                    // else merge | leaf | next |
-                    assert(leaf.next != 0);
-                    leaf_node_t next;
-                    map(&next, leaf.next);
-                    index_key = begin(leaf)->key;
-
-                    merge_leafs(&leaf, &next);
-                    node_remove(&leaf, &next);
-                    unmap(&leaf, offset);
-                }
+        if (where != end(parent) - 1)
+        {
+            // borrow the first record of | leaf | next |
+            off_t next_off = (where + 1)->child;
+            map(&sibling, next_off);
 
-                // remove parent's key
-                remove_from_index(parent_off, parent, index_key);
-            }
-            else
+            if (sibling.n > min_n)
             {
+                *end(leaf) = *begin(sibling);
+                leaf.n++;
+                std::copy(begin(sibling) + 1, end(sibling), begin(sibling));
+                sibling.n--;
+                where->key = begin(sibling)->key;
+
+                unmap(&sibling, next_off);
                 unmap(&leaf, offset);
+                unmap(&parent, parent_off);
+                return 0;
             }
         }
+
+        if (where != begin(parent))
+        {
+            // merge | prev | leaf |
+            off_t prev_off = (where - 1)->child;
+            map(&sibling, prev_off);
+
+            merge_leafs(&sibling, &leaf);
+            node_remove(&sibling, &leaf);
+            unmap(&sibling, prev_off);
+            merge_index(parent, where - 1);
+        }
         else
         {
+            // merge | leaf | next |
+            assert(where != end(parent) - 1);
+            map(&sibling, (where + 1)->child);
+
+            merge_leafs(&leaf, &sibling);
+            node_remove(&leaf, &sibling);
             unmap(&leaf, offset);
+            merge_index(parent, where);
         }
 
+        // parent lost a child
+        remove_from_index(parent_off, parent);
+
         return 0;
     }
 
     int insert(const key_t &key, value_t value)
     {
         off_t parent = search_index(key);
-        off_t offset = search_leaf(parent, key);
-        leaf_node_t leaf;
-        map(&leaf, offset);
+        off_t offset = search_leaf(parent, key);
+        bool found, full;
+
+        visit<leaf_node_t>(offset, [&](leaf_node_t & leaf)
+        {
+            found = std::binary_search(begin(leaf), end(leaf), key);
+            full = leaf.n == meta.order;
+        });
 
         // check if we have the same key
-        if (std::binary_search(begin(leaf), end(leaf), key))
+        if (found)
             return 1;
 
-        if (leaf.n == meta.order)
+        if (full)
         {
+            leaf_node_t leaf;
+            map(&leaf, offset);
+
             // split when full
 
             // new sibling leaf
@@ -408,8 +954,11 @@ public:
         }
         else
         {
-            insert_record_no_split(&leaf, key, value);
-            unmap(&leaf, offset);
+            modify<leaf_node_t>(offset, [&](leaf_node_t & leaf)
+            {
+                insert_record_no_split(&leaf, key, value);
+                refresh(&leaf);
+            });
         }
 
         return 0;
@@ -418,264 +967,479 @@ public:
     int update(const key_t &key, value_t value)
     {
         off_t offset = search_leaf(key);
-        leaf_node_t leaf;
-        map(&leaf, offset);
+        int found = -1;
+        size_t pos;
 
-        record_t *record = find(leaf, key);
+        visit<leaf_node_t>(offset, [&](leaf_node_t & leaf)
+        {
+            record_t *record = find(leaf, key);
 
-        if (record != leaf.children + leaf.n)
-            if (keycmp(key, record->key) == 0)
+            if (record != leaf.children + leaf.n)
             {
-                record->value = value;
-                unmap(&leaf, offset);
-
-                return 0;
+                found = keycmp(key, record->key) == 0 ? 0 : 1;
+                pos = record - begin(leaf);
             }
-            else
+        });
+
+        // only the value changes, the keys and their column stay
+        if (found == 0)
+        {
+            modify<leaf_node_t>(offset, [&](leaf_node_t & leaf)
             {
-                return 1;
-            }
-        else
-            return -1;
+                leaf.children[pos].value = value;
+            });
+        }
+
+        return found;
     }
     meta_t get_meta() const
     {
         return meta;
     };
 
-private:
-    char path[512];
-    meta_t meta;
-
-    /* helper iterating function */
-    template<class T>
-    typename T::child_t begin(T &node) const
-    {
-        return node.children;
-    }
-    template<class T>
-    typename T::child_t end(T &node) const
+    /* true if the tree was created empty instead of read from file */
+    bool initialized_empty() const
     {
-        return node.children + node.n;
+        return empty_init;
     }
 
-    /* helper searching function */
-    index_t *find(internal_node_t &node, const key_t &key) const
-    {
-        return std::upper_bound(begin(node), end(node) - 1, key);
-    }
-    record_t *find(leaf_node_t &node, const key_t &key) const
+    /* replace the whole tree by one built bottom-up from records sorted by
+     * key, nodes are filled to `fill` and leafs are laid out in key order */
+    void build(const std::vector<record_t> &records, double fill = 0.9)
     {
-        return std::lower_bound(begin(node), end(node), key);
+        size_t i = 0;
+        build([&](record_t &record)
+        {
+            if (i == records.size())return false;
+
+            record = records[i++];
+            return true;
+        }, records.size(), fill);
     }
 
-    void remove_from_index(off_t offset, internal_node_t &node,
-                           const key_t &key)
+    /* same, pulling the n sorted records one at a time from next(record),
+     * so they never have to be in memory all at once */
+    template<class Source>
+    void build(Source next, size_t n, double fill)
     {
-        size_t min_n = meta.root_offset == offset ? 1 : meta.order / 2;
-        assert(node.n >= min_n && node.n <= meta.order);
+        size_t per = std::max(meta.order / 2, (size_t)(meta.order * fill));
+        per = std::min(per, (size_t)meta.order);
+
+        // drop every block but the meta one
+        unpin_all();
+        meta.internal_node_num = meta.leaf_node_num = 0;
+        meta.free_offset = 0;
+        meta.free_node_num = 0;
+        meta.slot = OFFSET_BLOCK;
 
-        // remove key
-        key_t index_key = begin(node)->key;
-        index_t *to_delete = find(node, key);
+        // leafs, remember each one's first key for the level above
+        std::vector<index_t> level;
+        size_t count = node_count(n, per);
+        off_t prev = 0;
 
-        if (to_delete != end(node))
+        for (size_t i = 0, from = 0; i < count; ++i)
         {
-            (to_delete + 1)->child = to_delete->child;
-            std::copy(to_delete + 1, end(node), to_delete);
-        }
+            size_t to = n * (i + 1) / count;
 
-        node.n--;
+            leaf_node_t leaf;
+            off_t offset = alloc(&leaf);
+            leaf.parent = 0;
+            leaf.prev = prev;
+            leaf.next = 0;
+            leaf.n = 0;
 
-        // remove to only one key
-        if (node.n == 1 && meta.root_offset == offset &&
-                meta.internal_node_num != 1)
-        {
-            unalloc(&node, meta.root_offset);
-            meta.height--;
-            meta.root_offset = node.children[0].child;
-            unmap(&meta, OFFSET_META);
-            return;
-        }
+            while (from + leaf.n < to && next(leaf.children[leaf.n]))
+                leaf.n++;
 
-        // merge or borrow
-        if (node.n < min_n)
-        {
-            internal_node_t parent;
-            map(&parent, node.parent);
+            unmap(&leaf, offset);
+
+            if (prev != 0)
+                link_next<leaf_node_t>(prev, offset);
+            else
+                meta.leaf_offset = offset;
+
+            index_t entry;
+            entry.key = leaf.n > 0 ? begin(leaf)->key : key_t();
+            entry.child = offset;
+            level.push_back(entry);
 
-            // first borrow from left
-            bool borrowed = false;
+            prev = offset;
+            from = to;
+        }
 
-            if (offset != begin(parent)->child)
-                borrowed = borrow_key(false, node, offset);
+        // internal levels until a single root is left
+        meta.height = 0;
 
-            // then borrow from right
-            if (!borrowed && offset != (end(parent) - 1)->child)
-                borrowed = borrow_key(true, node, offset);
+        do
+        {
+            std::vector<index_t> upper;
+            count = node_count(level.size(), per);
+            prev = 0;
 
-            // finally we merge
-            if (!borrowed)
+            for (size_t i = 0, from = 0; i < count; ++i)
             {
-                assert(node.next != 0 || node.prev != 0);
+                size_t to = level.size() * (i + 1) / count;
 
-                if (offset == (end(parent) - 1)->child)
-                {
-                    // if leaf is last element then merge | prev | leaf |
-                    assert(node.prev != 0);
-                    internal_node_t prev;
-                    map(&prev, node.prev);
-
-                    // merge
-                    index_t *where = find(parent, begin(prev)->key);
-                    reset_index_children_parent(begin(node), end(node), node.prev);
-                    merge_keys(where, prev, node);
-                    unmap(&prev, node.prev);
-                }
-                else
+                internal_node_t node;
+                off_t offset = alloc(&node);
+                node.parent = 0;
+                node.prev = prev;
+                node.next = 0;
+                node.n = to - from;
+
+                // each key is the first key of the next child
+                for (size_t j = from; j < to; ++j)
                 {
-                    // else merge | leaf | next |
-                    assert(node.next != 0);
-                    internal_node_t next;
-                    map(&next, node.next);
-
-                    // merge
-                    index_t *where = find(parent, index_key);
-                    reset_index_children_parent(begin(next), end(next), offset);
-                    merge_keys(where, node, next);
-                    unmap(&node, offset);
+                    node.children[j - from].child = level[j].child;
+                    node.children[j - from].key = level[j + 1 < to ? j + 1 : j].key;
                 }
 
-                // remove parent's key
-                remove_from_index(node.parent, parent, index_key);
-            }
-            else
-            {
                 unmap(&node, offset);
+                reset_index_children_parent(begin(node), end(node), offset);
+
+                if (prev != 0)
+                    link_next<internal_node_t>(prev, offset);
+
+                index_t entry;
+                entry.key = level[from].key;
+                entry.child = offset;
+                upper.push_back(entry);
+
+                prev = offset;
+                from = to;
             }
+
+            level.swap(upper);
+            meta.height++;
         }
-        else
+        while (level.size() > 1);
+
+        meta.root_offset = level[0].child;
+        unmap(&meta, OFFSET_META);
+    }
+
+    /* write a compact copy of the tree and switch over to it, the leafs
+     * are already sorted so they stream straight into the copy */
+    void rebuild(double fill = 0.9)
+    {
+        leaf_node_t leaf;
+        size_t n = 0;
+
+        for (off_t off = meta.leaf_offset; off != 0; off = leaf.next)
         {
-            unmap(&node, offset);
+            map(&leaf, off, SIZE_NO_CHILDREN);
+            n += leaf.n;
+        }
+
+        char tmp[sizeof(path) + 8];
+        sprintf(tmp, "%s.tmp", path);
+
+        {
+            bplus_tree copy(fm, bpm, tmp, true);
+            off_t off = meta.leaf_offset;
+            size_t pos = 0;
+            leaf.n = 0;
+
+            copy.build([&](record_t &record)
+            {
+                while (pos == leaf.n)
+                {
+                    if (off == 0)return false;
+
+                    map_records(&leaf, off);
+                    off = leaf.next;
+                    pos = 0;
+                }
+
+                record = leaf.children[pos++];
+                return true;
+            }, n, fill);
         }
+
+        unpin_all();
+        close_file();
+        rename(tmp, path);
+        open_file();
+        map(&meta, OFFSET_META);
     }
 
-    bool borrow_key(bool from_right, internal_node_t &borrower,
-                    off_t offset)
+protected:
+    char path[512];
+    meta_t meta;
+    FileManager *fm;
+    BufPageManager *bpm;
+    int fileId;
+    bool empty_init;
+    /* set when threads share the tree, see olc_tree */
+    node_latch *latch;
+
+    /* an internal node pinned in memory. its children that are pinned
+     * too are swizzled to pointers, so a search goes from node to node
+     * without the buffer; a NULL child is read by its offset. a node is
+     * unpinned before it is written, and its parent's pointer to it and
+     * its children's back pointers are undone with it */
+    struct pinned_t
     {
-        typedef typename internal_node_t::child_t child_t;
+        off_t offset;
+        internal_node_t node;
+        std::vector<pinned_t *> child;
+        pinned_t *parent; /* the pinned node pointing here, NULL if none */
+        size_t slot;      /* which of the parent's children this is */
+    };
 
-        off_t lender_off = from_right ? borrower.next : borrower.prev;
-        internal_node_t lender;
-        map(&lender, lender_off);
+    mutable std::unordered_map<off_t, pinned_t *> pins;
+    mutable pinned_t *root_pin;
 
-        assert(lender.n >= meta.order / 2);
+    /* the node at offset pinned, as child `slot` of `parent` if given,
+     * NULL once BP_PIN_NODES are; a child left pinned when its parent
+     * was unpinned is swizzled again instead of read anew */
+    pinned_t *pin(off_t offset, pinned_t *parent, size_t slot) const
+    {
+        pinned_t *p;
+        auto it = pins.find(offset);
 
-        if (lender.n != meta.order / 2)
+        if (it != pins.end())
+        {
+            p = it->second;
+        }
+        else
         {
-            child_t where_to_lend, where_to_put;
+            if (pins.size() >= BP_PIN_NODES)return NULL;
 
-            internal_node_t parent;
+            p = new pinned_t;
+            p->offset = offset;
+            map(&p->node, offset);
+            p->child.assign(p->node.n, NULL);
+            pins[offset] = p;
+        }
 
-            // swap keys, draw on paper to see why
-            if (from_right)
-            {
-                where_to_lend = begin(lender);
-                where_to_put = end(borrower);
-
-                map(&parent, borrower.parent);
-                child_t where = std::lower_bound(begin(parent), end(parent) - 1,
-                                                 (end(borrower) - 1)->key);
-                where->key = where_to_lend->key;
-                unmap(&parent, borrower.parent);
-            }
-            else
+        p->parent = parent;
+        p->slot = slot;
+
+        if (parent)parent->child[slot] = p;
+
+        return p;
+    }
+
+    void unpin(off_t offset) const
+    {
+        auto it = pins.find(offset);
+
+        if (it == pins.end())return;
+
+        pinned_t *p = it->second;
+
+        if (p->parent)p->parent->child[p->slot] = NULL;
+
+        for (auto c : p->child)
+            if (c)c->parent = NULL;
+
+        if (p == root_pin)root_pin = NULL;
+
+        pins.erase(it);
+        delete p;
+    }
+
+    void unpin_all() const
+    {
+        for (auto it : pins)
+            delete it.second;
+
+        pins.clear();
+        root_pin = NULL;
+    }
+
+    /* the node `levels` below the root on the way to key, following
+     * swizzled pointers while the nodes are pinned */
+    off_t descend(const key_t &key, size_t levels) const
+    {
+        off_t offset = meta.root_offset;
+
+        if (!root_pin || root_pin->offset != offset)
+            root_pin = pin(offset, NULL, 0);
+
+        pinned_t *at = root_pin;
+
+        for (size_t depth = 1; depth <= levels; ++depth)
+        {
+            if (!at)
             {
-                where_to_lend = end(lender) - 1;
-                where_to_put = begin(borrower);
-
-                map(&parent, lender.parent);
-                child_t where = find(parent, begin(lender)->key);
-                where_to_put->key = where->key;
-                where->key = (where_to_lend - 1)->key;
-                unmap(&parent, lender.parent);
+                offset = search_leaf(offset, key);
+                continue;
             }
 
-            // store
-            std::copy_backward(where_to_put, end(borrower), end(borrower) + 1);
-            *where_to_put = *where_to_lend;
-            borrower.n++;
+            index_t *i = find(at->node, key);
+            size_t slot = i - begin(at->node);
+            offset = i->child;
 
-            // erase
-            reset_index_children_parent(where_to_lend, where_to_lend + 1, offset);
-            std::copy(where_to_lend + 1, end(lender), where_to_lend);
-            lender.n--;
-            unmap(&lender, lender_off);
-            return true;
+            // leafs are never pinned
+            if (depth < meta.height)
+                at = at->child[slot] ? at->child[slot] : pin(offset, at, slot);
         }
 
-        return false;
+        return offset;
+    }
+
+    /* helper iterating function */
+    template<class T>
+    typename T::child_t begin(T &node) const
+    {
+        return node.children;
+    }
+    template<class T>
+    typename T::child_t end(T &node) const
+    {
+        return node.children + node.n;
     }
 
-    bool borrow_key(bool from_right, leaf_node_t &borrower)
+    /* helper searching function, the column narrows the search to the
+     * keys it can't tell from `key`; the node must be as read from its page */
+    index_t *find(internal_node_t &node, const key_t &key) const
+    {
+        size_t less, not_greater;
+        column_of::rank(node.column, node.n - 1, key, less, not_greater);
+        return std::upper_bound(begin(node) + less, begin(node) + not_greater, key);
+    }
+    record_t *find(leaf_node_t &node, const key_t &key) const
     {
-        off_t lender_off = from_right ? borrower.next : borrower.prev;
-        leaf_node_t lender;
-        map(&lender, lender_off);
+        size_t less, not_greater;
+        column_of::rank(node.column, node.n, key, less, not_greater);
+        return std::lower_bound(begin(node) + less, begin(node) + not_greater, key);
+    }
 
-        assert(lender.n >= meta.order / 2);
+    /* bring the column up to date before the node is written */
+    void refresh(internal_node_t *node) const
+    {
+        column_of::fill(node->column, &node->children[0].key, sizeof(index_t), node->n ? node->n - 1 : 0, COLUMN_SIZE);
+    }
+    void refresh(leaf_node_t *leaf) const
+    {
+        column_of::fill(leaf->column, &leaf->children[0].key, sizeof(record_t), leaf->n, COLUMN_SIZE);
+    }
+    void refresh(void *) const
+    {
+    }
 
-        if (lender.n != meta.order / 2)
+    /* rebalance `node` after it lost a child */
+    void remove_from_index(off_t offset, internal_node_t &node)
+    {
+        if (offset == meta.root_offset)
         {
-            typename leaf_node_t::child_t where_to_lend, where_to_put;
-
-            // decide offset and update parent's index key
-            if (from_right)
+            // remove to only one key
+            if (node.n == 1 && meta.height > 1)
             {
-                where_to_lend = begin(lender);
-                where_to_put = end(borrower);
-                change_parent_child(borrower.parent, begin(borrower)->key,
-                                    lender.children[1].key);
+                unalloc(&node, offset);
+                meta.height--;
+                meta.root_offset = node.children[0].child;
+                unmap(&meta, OFFSET_META);
+
+                // the only child becomes root
+                reset_index_children_parent(begin(node), end(node), 0);
             }
             else
             {
-                where_to_lend = end(lender) - 1;
-                where_to_put = begin(borrower);
-                change_parent_child(lender.parent, begin(lender)->key,
-                                    where_to_lend->key);
+                unmap(&node, offset);
             }
 
-            // store
-            std::copy_backward(where_to_put, end(borrower), end(borrower) + 1);
-            *where_to_put = *where_to_lend;
-            borrower.n++;
+            return;
+        }
 
-            // erase
-            std::copy(where_to_lend + 1, end(lender), where_to_lend);
-            lender.n--;
-            unmap(&lender, lender_off);
-            return true;
+        size_t min_n = meta.order / 2;
+        assert(node.n + 1 >= min_n && node.n <= meta.order);
+
+        if (node.n >= min_n)
+        {
+            unmap(&node, offset);
+            return;
         }
 
-        return false;
-    }
+        off_t parent_off = node.parent;
+        internal_node_t parent;
+        map(&parent, parent_off);
 
-    void change_parent_child(off_t parent, const key_t &o,
-                             const key_t &n)
-    {
-        internal_node_t node;
-        map(&node, parent);
+        index_t *where = begin(parent);
+
+        while (where->child != offset)
+            ++where;
+
+        assert(where != end(parent));
+
+        // same as leafs: only siblings under the same parent, and the keys
+        // rotate through the separator held by `parent`
+        internal_node_t sibling;
 
-        index_t *w = find(node, o);
-        assert(w != node.children + node.n);
+        if (where != begin(parent))
+        {
+            // borrow the last child of | prev | node |
+            off_t prev_off = (where - 1)->child;
+            map(&sibling, prev_off);
+
+            if (sibling.n > min_n)
+            {
+                std::copy_backward(begin(node), end(node), end(node) + 1);
+                node.children[0].key = (where - 1)->key;
+                node.children[0].child = (end(sibling) - 1)->child;
+                node.n++;
+                (where - 1)->key = (end(sibling) - 2)->key;
+                sibling.n--;
+
+                reset_index_children_parent(begin(node), begin(node) + 1, offset);
+                unmap(&sibling, prev_off);
+                unmap(&node, offset);
+                unmap(&parent, parent_off);
+                return;
+            }
+        }
+
+        if (where != end(parent) - 1)
+        {
+            // borrow the first child of | node | next |
+            off_t next_off = (where + 1)->child;
+            map(&sibling, next_off);
 
-        w->key = n;
-        unmap(&node, parent);
+            if (sibling.n > min_n)
+            {
+                (end(node) - 1)->key = where->key;
+                *end(node) = *begin(sibling);
+                node.n++;
+                where->key = begin(sibling)->key;
+                std::copy(begin(sibling) + 1, end(sibling), begin(sibling));
+                sibling.n--;
+
+                reset_index_children_parent(end(node) - 1, end(node), offset);
+                unmap(&sibling, next_off);
+                unmap(&node, offset);
+                unmap(&parent, parent_off);
+                return;
+            }
+        }
 
-        if (w == node.children + node.n - 1)
+        if (where != begin(parent))
         {
-            change_parent_child(node.parent, o, n);
+            // merge | prev | node |
+            off_t prev_off = (where - 1)->child;
+            map(&sibling, prev_off);
+
+            reset_index_children_parent(begin(node), end(node), prev_off);
+            merge_keys((where - 1)->key, sibling, node);
+            node_remove(&sibling, &node);
+            unmap(&sibling, prev_off);
+            merge_index(parent, where - 1);
+        }
+        else
+        {
+            // merge | node | next |
+            assert(where != end(parent) - 1);
+            map(&sibling, (where + 1)->child);
+
+            reset_index_children_parent(begin(sibling), end(sibling), offset);
+            merge_keys(where->key, node, sibling);
+            node_remove(&node, &sibling);
+            unmap(&node, offset);
+            merge_index(parent, where);
         }
+
+        remove_from_index(parent_off, parent);
     }
 
     void merge_leafs(leaf_node_t *left, leaf_node_t *right)
@@ -684,14 +1448,21 @@ private:
         left->n += right->n;
     }
 
-    void merge_keys(index_t *where,
+    void merge_keys(const key_t &separator,
                     internal_node_t &node, internal_node_t &next)
     {
-        //(end(node) - 1)->key = where->key;
-        //where->key = (end(next) - 1)->key;
+        // node's last key was unused, it now splits node and next
+        (end(node) - 1)->key = separator;
         std::copy(begin(next), end(next), end(node));
         node.n += next.n;
-        node_remove(&node, &next);
+    }
+
+    /* the child after `where` was merged into where->child */
+    void merge_index(internal_node_t &node, index_t *where)
+    {
+        where->key = (where + 1)->key;
+        std::copy(where + 2, end(node), where + 1);
+        node.n--;
     }
 
     void insert_record_no_split(leaf_node_t *leaf,
@@ -820,29 +1591,19 @@ private:
 
     off_t search_index(const key_t &key) const
     {
-        off_t org = meta.root_offset;
-        int height = meta.height;
-
-        while (height > 1)
-        {
-            internal_node_t node;
-            map(&node, org);
-
-            index_t *i = std::upper_bound(begin(node), end(node) - 1, key);
-            org = i->child;
-            --height;
-        }
-
-        return org;
+        return descend(key, meta.height - 1);
     }
 
     off_t search_leaf(off_t index, const key_t &key) const
     {
-        internal_node_t node;
-        map(&node, index);
+        off_t child;
 
-        index_t *i = std::upper_bound(begin(node), end(node) - 1, key);
-        return i->child;
+        visit<internal_node_t>(index, [&](internal_node_t & node)
+        {
+            child = find(node, key)->child;
+        });
+
+        return child;
     }
 
     template<class T>
@@ -866,6 +1627,23 @@ private:
         unmap(&meta, OFFSET_META);
     }
 
+    template<class T>
+    void link_next(off_t offset, off_t next)
+    {
+        T node;
+        map(&node, offset, SIZE_NO_CHILDREN);
+        node.next = next;
+        unmap(&node, offset, SIZE_NO_CHILDREN);
+    }
+
+    /* enough nodes to hold n entries at `per` each, never more than
+     * a full node or less than half of one */
+    size_t node_count(size_t n, size_t per) const
+    {
+        size_t count = std::max(n / per, (n + meta.order - 1) / meta.order);
+        return std::max(count, (size_t)1);
+    }
+
     template<class T>
     void node_remove(T *prev, T *node)
     {
@@ -912,35 +1690,49 @@ private:
 
     off_t search_leaf(const key_t &key) const
     {
-        return search_leaf(search_index(key), key);
+        return descend(key, meta.height);
     }
 
 
-    /* multi-level file open/close */
-    mutable FILE *fp;
-    mutable int fp_level;
-    void open_file(const char *mode = "rb+") const
+    /* index files are paged through the shared buffer manager */
+    void open_file()
     {
-        // `rb+` will make sure we can write everywhere without truncating file
-        if (fp_level == 0)
-            fp = fopen(path, mode);
-
-        ++fp_level;
+        fm->createFile(path);
+        fm->openFile(path, fileId);
     }
 
-    void close_file() const
+    void close_file()
     {
-        if (fp_level == 1)
-            fclose(fp);
-
-        --fp_level;
+        bpm->closeFile(fileId);
+        fm->closeFile(fileId);
     }
 
-    /* alloc from disk */
-    off_t alloc(size_t size)
+    /* alloc from disk, freed blocks are reused before the file grows */
+    off_t alloc(size_t)
     {
-        off_t slot = meta.slot;
-        meta.slot += size;
+        off_t slot;
+
+        if (meta.free_offset != 0)
+        {
+            // pop the free list, the link is kept in the block's first word
+            slot = meta.free_offset;
+            map(&meta.free_offset, slot, sizeof(off_t));
+            meta.free_node_num--;
+        }
+        else
+        {
+            slot = meta.slot;
+            meta.slot += PAGE_SIZE;
+        }
+
+        unpin(slot);
+
+        if (latch)latch->lock(slot);
+
+        int index;
+        BufType b = page(slot, index);
+        memset(b, 0, PAGE_SIZE);
+        written(index);
         return slot;
     }
 
@@ -958,25 +1750,62 @@ private:
         return alloc(sizeof(internal_node_t));
     }
 
-    void unalloc(leaf_node_t *leaf, off_t offset)
+    void unalloc(leaf_node_t *, off_t offset)
     {
         --meta.leaf_node_num;
+        unalloc(offset);
     }
 
-    void unalloc(internal_node_t *node, off_t offset)
+    void unalloc(internal_node_t *, off_t offset)
     {
         --meta.internal_node_num;
+        unalloc(offset);
+    }
+
+    /* push the block onto the free list */
+    void unalloc(off_t offset)
+    {
+        unmap(&meta.free_offset, offset, sizeof(off_t));
+        meta.free_offset = offset;
+        meta.free_node_num++;
+    }
+
+    /* the buffer page holding offset; while the tree is shared the page is
+     * pinned, so no other thread's read replaces it, until release */
+    BufType page(off_t offset, int &index) const
+    {
+        if (latch)return bpm->pinPage(fileId, offset >> PAGE_SIZE_IDX, index);
+
+        return bpm->getPage(fileId, offset >> PAGE_SIZE_IDX, index);
+    }
+
+    void release(int index) const
+    {
+        if (latch)bpm->unpinPage(index);
+    }
+
+    /* a page from page() was changed, it is released */
+    void written(int index) const
+    {
+        if (!latch)
+        {
+            bpm->markDirty(index);
+            return;
+        }
+
+        bpm->markDirtyPinned(index);
+        bpm->unpinPage(index);
     }
 
-    /* read block from disk */
+    /* read block from buffer */
     int map(void *block, off_t offset, size_t size) const
     {
-        open_file();
-        fseek(fp, offset, SEEK_SET);
-        size_t rd = fread(block, size, 1, fp);
-        close_file();
+        int index;
+        BufType b = page(offset, index);
+        memcpy(block, (char *)b + (offset & (PAGE_SIZE - 1)), size);
+        release(index);
 
-        return rd - 1;
+        return 0;
     }
 
     template<class T>
@@ -985,41 +1814,100 @@ private:
         return map(block, offset, sizeof(T));
     }
 
-    /* write block to disk */
+    /* write block to buffer */
     int unmap(void *block, off_t offset, size_t size) const
     {
-        open_file();
-        fseek(fp, offset, SEEK_SET);
-        size_t wd = fwrite(block, size, 1, fp);
-        close_file();
+        unpin(offset);
+
+        if (latch)latch->lock(offset);
+
+        int index;
+        BufType b = page(offset, index);
+        memcpy((char *)b + (offset & (PAGE_SIZE - 1)), block, size);
+        written(index);
 
-        return wd - 1;
+        return 0;
     }
 
     template<class T>
     int unmap(T *block, off_t offset) const
     {
+        refresh(block);
         return unmap(block, offset, sizeof(T));
     }
+
+    /* the header and records of a leaf, without the unused room and the
+     * column; a search of the copy must not use find. gives the position
+     * of the first record not less than key if one is given */
+    size_t map_records(leaf_node_t *leaf, off_t offset, const key_t *key = NULL) const
+    {
+        size_t pos = 0;
+
+        visit<leaf_node_t>(offset, [&](leaf_node_t & node)
+        {
+            leaf->parent = node.parent;
+            leaf->next = node.next;
+            leaf->prev = node.prev;
+            leaf->n = node.n;
+            std::copy(node.children, node.children + node.n, leaf->children);
+
+            if (key)pos = find(node, *key) - begin(node);
+        });
+
+        return pos;
+    }
+
+    /* run f on the node where it sits in the buffer, so the node is searched
+     * in place instead of copied; f must not read other pages, which may
+     * take the node's place in an unshared tree */
+    template<class T, class F>
+    void visit(off_t offset, F f) const
+    {
+        int index;
+        BufType b = page(offset, index);
+        f(*(T *)((char *)b + (offset & (PAGE_SIZE - 1))));
+        release(index);
+    }
+
+    /* as visit for f changing the node, only its page is written back;
+     * f keeps the column up to date if it moves keys */
+    template<class T, class F>
+    void modify(off_t offset, F f)
+    {
+        unpin(offset);
+
+        if (latch)latch->lock(offset);
+
+        int index;
+        BufType b = page(offset, index);
+        f(*(T *)((char *)b + (offset & (PAGE_SIZE - 1))));
+        written(index);
+    }
 };
 typedef Type_varchar<32> str32;
 typedef Type_varchar<64> str64;
 typedef Type_varchar<128> str128;
 typedef Type_varchar<256> str256;
-typedef std::pair<RID, RID> pair_rid;
+typedef rid_key<Type_int> int_rid;
+typedef rid_key<str32> str32_rid;
+typedef rid_key<str64> str64_rid;
+typedef rid_key<str128> str128_rid;
+typedef rid_key<str256> str256_rid;
+typedef rid_key<int64_key> int64_rid;
+typedef rid_key<char_key<8> > char8_rid;
+typedef rid_key<char_key<16> > char16_rid;
+typedef rid_key<char_key<32> > char32_rid;
 /* custom compare operator for STL algorithms */
-OPERATOR_KEYCMP(Type_int, RID, index_t)
-OPERATOR_KEYCMP(Type_int, RID, record_t)
-OPERATOR_KEYCMP(str32, RID, index_t)
-OPERATOR_KEYCMP(str32, RID, record_t)
-OPERATOR_KEYCMP(str64, RID, index_t)
-OPERATOR_KEYCMP(str64, RID, record_t)
-OPERATOR_KEYCMP(str128, RID, index_t)
-OPERATOR_KEYCMP(str128, RID, record_t)
-OPERATOR_KEYCMP(str256, RID, index_t)
-OPERATOR_KEYCMP(str256, RID, record_t)
-OPERATOR_KEYCMP(RID, pair_rid, index_t)
-OPERATOR_KEYCMP(RID, pair_rid, record_t)
+OPERATOR_KEYCMP(int_rid, RID, index_t)
+OPERATOR_KEYCMP(int_rid, RID, record_t)
+OPERATOR_KEYCMP(int64_rid, RID, index_t)
+OPERATOR_KEYCMP(int64_rid, RID, record_t)
+OPERATOR_KEYCMP(char8_rid, RID, index_t)
+OPERATOR_KEYCMP(char8_rid, RID, record_t)
+OPERATOR_KEYCMP(char16_rid, RID, index_t)
+OPERATOR_KEYCMP(char16_rid, RID, record_t)
+OPERATOR_KEYCMP(char32_rid, RID, index_t)
+OPERATOR_KEYCMP(char32_rid, RID, record_t)
 
 }
 
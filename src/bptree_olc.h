@@ -0,0 +1,204 @@
+#ifndef BPTREE_OLC_H
+#define BPTREE_OLC_H
+
+#include "bptree.h"
+
+namespace bptree
+{
+
+/* a B+ tree many threads can use at once, by optimistic lock coupling:
+ * readers take no node locks, they read a node's version, search it where
+ * it sits pinned in the buffer and check the version again, and restart
+ * from the root if a writer got in between. pinning a page that is in the
+ * buffer only takes the buffer's lock shared, so readers don't queue.
+ * a child's version is read before its parent's is checked, so a reader
+ * never follows a pointer out of a node that changed under it. writers
+ * take turns and lock only the nodes they change, leaving readers free
+ * to go on through the rest of the tree. build and rebuild replace the
+ * whole tree, so they must not run while others read it */
+template<typename key_t, typename value_t>
+class olc_tree : public bplus_tree<key_t, value_t>
+{
+public:
+    typedef bplus_tree<key_t, value_t> base;
+    typedef typename base::meta_t meta_t;
+    typedef typename base::index_t index_t;
+    typedef typename base::record_t record_t;
+    typedef typename base::internal_node_t internal_node_t;
+    typedef typename base::leaf_node_t leaf_node_t;
+
+    olc_tree(FileManager *_fm, BufPageManager *_bpm, const char *p,
+             bool force_empty = false)
+        : base(_fm, _bpm, p, force_empty)
+    {
+        this->latch = &versions;
+    }
+
+    /* as bplus_tree::search */
+    int search(const key_t &key, value_t *value) const
+    {
+        for (;;)
+        {
+            uint64_t version;
+            off_t offset;
+
+            if (!descend(key, offset, version))continue;
+
+            int found = -1;
+
+            this->template visit<leaf_node_t>(offset, [&](leaf_node_t & leaf)
+            {
+                if (leaf.n > base::BP_ORDER)return;
+
+                record_t *record = this->find(leaf, key);
+
+                if (record != this->end(leaf))
+                {
+                    *value = record->value;
+                    found = base::keycmp(record->key, key);
+                }
+            });
+
+            if (versions.validate(offset, version))return found;
+        }
+    }
+
+    /* values of the keys from left to right, both included */
+    std::vector<value_t> search_range(const key_t &left, const key_t &right) const
+    {
+        std::vector<value_t> values;
+
+        if (base::keycmp(left, right) > 0)
+            return values;
+
+        for (;;)
+        {
+            uint64_t version;
+            off_t offset;
+            bool done = false, valid = true;
+            values.clear();
+
+            if (!descend(left, offset, version))continue;
+
+            // along the leaf chain, coupling each leaf with the next
+            while (!done && valid)
+            {
+                off_t next = 0;
+
+                this->template visit<leaf_node_t>(offset, [&](leaf_node_t & leaf)
+                {
+                    if (leaf.n > base::BP_ORDER)return;
+
+                    record_t *b = this->find(leaf, left);
+                    record_t *e = std::upper_bound(b, this->end(leaf), right);
+
+                    for (; b != e; ++b)
+                        values.push_back(b->value);
+
+                    done = e != this->end(leaf) || leaf.next == 0;
+                    next = leaf.next;
+                });
+
+                uint64_t next_version = done ? 0 : versions.read(next);
+                valid = versions.validate(offset, version);
+                offset = next;
+                version = next_version;
+            }
+
+            if (valid)return values;
+        }
+    }
+
+    /* as bplus_tree::insert, remove and update, one writer at a time */
+    int insert(const key_t &key, value_t value)
+    {
+        std::lock_guard<std::mutex> guard(versions.writer);
+        int result = base::insert(key, value);
+        versions.unlock();
+        return result;
+    }
+
+    int remove(const key_t &key)
+    {
+        std::lock_guard<std::mutex> guard(versions.writer);
+        int result = base::remove(key);
+        versions.unlock();
+        return result;
+    }
+
+    int update(const key_t &key, value_t value)
+    {
+        std::lock_guard<std::mutex> guard(versions.writer);
+        int result = base::update(key, value);
+        versions.unlock();
+        return result;
+    }
+
+    /* as bplus_tree::build and rebuild */
+    void build(const std::vector<record_t> &records, double fill = 0.9)
+    {
+        std::lock_guard<std::mutex> guard(versions.writer);
+        base::build(records, fill);
+        versions.unlock();
+    }
+
+    template<class Source>
+    void build(Source next, size_t n, double fill)
+    {
+        std::lock_guard<std::mutex> guard(versions.writer);
+        base::build(next, n, fill);
+        versions.unlock();
+    }
+
+    void rebuild(double fill = 0.9)
+    {
+        std::lock_guard<std::mutex> guard(versions.writer);
+        base::rebuild(fill);
+        versions.unlock();
+    }
+
+private:
+    mutable node_latch versions;
+
+    /* the leaf that may hold key and its version, false to restart */
+    bool descend(const key_t &key, off_t &offset, uint64_t &version) const
+    {
+        meta_t meta;
+        uint64_t parent = versions.read(OFFSET_META);
+        this->map(&meta, OFFSET_META);
+
+        offset = meta.root_offset;
+        version = versions.read(offset);
+
+        if (!versions.validate(OFFSET_META, parent))return false;
+
+        for (size_t height = meta.height; height > 0; --height)
+        {
+            off_t child;
+
+            this->template visit<internal_node_t>(offset, [&](internal_node_t & node)
+            {
+                // a node freed or reused meanwhile may hold anything
+                if (node.n == 0 || node.n > base::BP_ORDER)
+                    child = 0;
+                else
+                    child = this->find(node, key)->child;
+            });
+
+            if (child == 0)return false;
+
+            uint64_t child_version = versions.read(child);
+
+            if (!versions.validate(offset, version))return false;
+
+            offset = child;
+            version = child_version;
+        }
+
+        return true;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,1213 @@
+#ifndef BPTREE_STR_H
+#define BPTREE_STR_H
+
+#include <stdint.h>
+#include <string>
+
+#include "bptree.h"
+
+namespace bptree
+{
+
+/* marks an index file laid out by byte_tree */
+const size_t STRING_TREE_MAGIC = 0x53545231;
+
+/* turns index entries into bytes whose memcmp order is the index order:
+ * every column is a NULL flag followed by its value, a string ends with a
+ * terminator, and the rid takes the last 8 bytes */
+struct entry_codec
+{
+    /* big endian with the sign bit flipped */
+    static void put(std::string &s, int value)
+    {
+        uint32_t u = (uint32_t)value ^ 0x80000000u;
+
+        for (int i = 3; i >= 0; --i)
+            s.push_back((char)(u >> (8 * i)));
+    }
+
+    static int get(const std::string &s, size_t at)
+    {
+        uint32_t u = 0;
+
+        for (int i = 0; i < 4; ++i)
+            u = (u << 8) | (unsigned char)s[at + i];
+
+        return (int)(u ^ 0x80000000u);
+    }
+
+    /* NULL sorts after every value */
+    static void put_null(std::string &s)
+    {
+        s.push_back('\1');
+    }
+
+    static void put_int(std::string &s, int value)
+    {
+        s.push_back('\0');
+        put(s, value);
+    }
+
+    static void put_str(std::string &s, const char *str, size_t size)
+    {
+        s.push_back('\0');
+        s.append(str, strnlen(str, size));
+        s.push_back('\0');
+    }
+
+    static void put_rid(std::string &s, const RID &rid)
+    {
+        put(s, rid.pageId);
+        put(s, rid.rowId);
+    }
+
+    static RID rid_of(const std::string &s)
+    {
+        return RID(get(s, s.size() - 8), get(s, s.size() - 4));
+    }
+};
+
+/* (string, rid) entries of a single column */
+template<int size>
+struct string_codec : entry_codec
+{
+    typedef rid_key<Type_varchar<size> > key_t;
+
+    /* kept in the meta block, a file of another width is rebuilt */
+    static const size_t key_size = size;
+    static const size_t KEY_MAX = size + 10;
+
+    static std::string encode(const key_t &key)
+    {
+        std::string s;
+
+        if (key.key.null)
+            put_null(s);
+        else
+            put_str(s, key.key.getStr(), size);
+
+        put_rid(s, key.rid);
+        return s;
+    }
+
+    static key_t decode(const std::string &s)
+    {
+        key_t key;
+
+        if (s[0] == '\1')
+            key.key = Type_varchar<size>(true, "", 0);
+        else
+            key.key = Type_varchar<size>(false, s.data() + 1, s.size() - 10);
+
+        key.rid = rid_of(s);
+        return key;
+    }
+};
+
+/* an entry of several columns, encoded one after another by the
+ * entry_codec put functions, and its rid; a covering index keeps its
+ * included columns after the ones it is ordered by */
+struct tuple_key
+{
+    std::string key;
+    RID rid;
+
+    tuple_key() {}
+    tuple_key(const std::string &_key, const RID &_rid) : key(_key), rid(_rid) {}
+};
+
+struct tuple_codec : entry_codec
+{
+    typedef tuple_key key_t;
+
+    /* columns are checked by whoever opens the file */
+    static const size_t key_size = 0;
+    static const size_t KEY_MAX = 1024;
+
+    static std::string encode(const key_t &key)
+    {
+        std::string s = key.key;
+        put_rid(s, key.rid);
+        return s;
+    }
+
+    static key_t decode(const std::string &s)
+    {
+        return key_t(s.substr(0, s.size() - 8), rid_of(s));
+    }
+
+    /* append one column of a key */
+    static void put_type(std::string &s, const Type *data)
+    {
+        if (data->null)
+            put_null(s);
+        else if (data->isInt())
+            put_int(s, data->getValue());
+        else
+            put_str(s, data->getStr(), strlen(data->getStr()));
+    }
+
+    /* read back the column at `at` into data and move past it */
+    static void get_type(const std::string &s, size_t &at, Type *data)
+    {
+        if (s[at++] == '\1')
+        {
+            data->setnull();
+            return;
+        }
+
+        data->null = false;
+
+        if (data->isInt())
+        {
+            data->set(get(s, at));
+            at += 4;
+        }
+        else
+        {
+            size_t end = s.find('\0', at);
+            data->set(s.data() + at, end - at);
+            at = end + 1;
+        }
+    }
+
+    /* most bytes one column takes, len is the longest string */
+    static size_t width(bool integer, int len)
+    {
+        return integer ? 5 : len + 2;
+    }
+};
+
+/* B+ tree of entries stored by their real length: a node keeps the
+ * prefix shared by all its keys once and only the rest of each key, and
+ * internal nodes keep just enough of a separator to tell two children
+ * apart. Codec turns an entry into bytes whose memcmp order is the
+ * order of the entries */
+template<class Codec>
+class byte_tree
+{
+public:
+    typedef typename Codec::key_t key_t;
+
+    struct record_t
+    {
+        key_t key;
+        RID value;
+    };
+
+    /* meta information of the tree */
+    typedef struct
+    {
+        size_t magic;     /* STRING_TREE_MAGIC */
+        size_t key_size;  /* Codec::key_size */
+        size_t internal_node_num; /* how many internal nodes */
+        size_t leaf_node_num;     /* how many leafs */
+        size_t height;            /* levels above the leafs, 0 if the root is a leaf */
+        off_t slot;        /* where to store new block */
+        off_t root_offset;
+        off_t leaf_offset; /* where is the first leaf */
+        off_t free_offset; /* first freed block to reuse, 0 if none */
+        size_t free_node_num; /* how many freed blocks */
+    } meta_t;
+
+    /* a node read out of its page; an internal node has one more child
+     * than keys and child i holds the entries from keys[i - 1] up to,
+     * but not including, keys[i] */
+    struct node_t
+    {
+        off_t parent;
+        off_t next;
+        off_t prev;
+        bool leaf;
+        std::vector<std::string> keys;
+        std::vector<off_t> children;
+    };
+
+    /* page layout: head, shared prefix, n slots with the page offset of
+     * each key's suffix, the children of an internal node, then the
+     * suffixes as length and bytes */
+    struct head_t
+    {
+        off_t parent;
+        off_t next;
+        off_t prev;
+        uint16_t n;
+        uint16_t leaf;
+        uint16_t prefix;
+        uint16_t pad;
+    };
+
+    /* longest encoded entry */
+    static const size_t KEY_MAX = Codec::KEY_MAX;
+
+    static_assert(sizeof(head_t) + 3 * (KEY_MAX + 4 + sizeof(off_t)) < PAGE_SIZE / 2,
+                  "key is too wide for a page sized node");
+
+    /* position in the leaf chain, moving one entry at a time; it holds a
+     * copy of the current leaf, so the tree must not change while in use */
+    class cursor
+    {
+    public:
+        cursor() : tree(NULL), offset(0), pos(0) {}
+
+        bool valid() const
+        {
+            return offset != 0 && pos < leaf.keys.size();
+        }
+        key_t key() const
+        {
+            return decode(leaf.keys[pos]);
+        }
+        RID value() const
+        {
+            return rid_of(leaf.keys[pos]);
+        }
+
+        /* step forward, false past the last entry */
+        bool next()
+        {
+            if (offset == 0)
+                return false;
+
+            ++pos;
+            return settle();
+        }
+
+        /* step backward, false before the first entry */
+        bool prev()
+        {
+            if (offset == 0)
+                return false;
+
+            if (pos > 0)
+            {
+                --pos;
+                return true;
+            }
+
+            while (leaf.prev != 0)
+            {
+                offset = leaf.prev;
+                tree->read(offset, leaf);
+
+                if (!leaf.keys.empty())
+                {
+                    pos = leaf.keys.size() - 1;
+                    return true;
+                }
+            }
+
+            offset = 0;
+            return false;
+        }
+
+    private:
+        friend class byte_tree;
+
+        const byte_tree *tree;
+        off_t offset;
+        size_t pos;
+        node_t leaf;
+
+        /* move past the end of a leaf onto the next entry */
+        bool settle()
+        {
+            while (pos >= leaf.keys.size() && leaf.next != 0)
+            {
+                offset = leaf.next;
+                tree->read(offset, leaf);
+                pos = 0;
+            }
+
+            if (pos < leaf.keys.size())
+                return true;
+
+            offset = 0;
+            return false;
+        }
+    };
+
+    byte_tree(FileManager *_fm, BufPageManager *_bpm, const char *p,
+                bool force_empty = false)
+        : fm(_fm), bpm(_bpm), fileId(-1), empty_init(false)
+    {
+        bzero(path, sizeof(path));
+        strcpy(path, p);
+
+        struct stat st;
+
+        // a file without a whole meta page can't hold a tree
+        if (stat(path, &st) != 0 || st.st_size < PAGE_SIZE)
+            force_empty = true;
+
+        if (force_empty)
+            truncate(path, 0);
+
+        open_file();
+
+        if (!force_empty)
+        {
+            // read tree from file, an older fixed size layout is dropped
+            memcpy(&meta, page(OFFSET_META), sizeof(meta_t));
+
+            if (meta.magic != STRING_TREE_MAGIC || meta.key_size != Codec::key_size)
+                force_empty = true;
+        }
+
+        if (force_empty)
+        {
+            init_from_empty();
+            empty_init = true;
+        }
+    }
+
+    ~byte_tree()
+    {
+        close_file();
+    }
+
+    meta_t get_meta() const
+    {
+        return meta;
+    }
+
+    /* true if the tree was created empty instead of read from file */
+    bool initialized_empty() const
+    {
+        return empty_init;
+    }
+
+    /* 0 on success, 1 if the entry is already there */
+    int insert(const key_t &key, const RID &)
+    {
+        std::string s = encode(key);
+        off_t offset = search_leaf(s);
+        node_t leaf;
+        read(offset, leaf);
+
+        std::vector<std::string>::iterator where =
+            std::lower_bound(leaf.keys.begin(), leaf.keys.end(), s);
+
+        if (where != leaf.keys.end() && *where == s)
+            return 1;
+
+        leaf.keys.insert(where, s);
+        store(leaf, offset);
+        write_meta();
+        return 0;
+    }
+
+    /* 0 on success, -1 if the entry isn't there */
+    int remove(const key_t &key)
+    {
+        std::string s = encode(key);
+        off_t offset = search_leaf(s);
+        node_t leaf;
+        read(offset, leaf);
+
+        std::vector<std::string>::iterator where =
+            std::lower_bound(leaf.keys.begin(), leaf.keys.end(), s);
+
+        if (where == leaf.keys.end() || *where != s)
+            return -1;
+
+        leaf.keys.erase(where);
+        fix(leaf, offset);
+        write_meta();
+        return 0;
+    }
+
+    /* rids of the entries from left to right, both included */
+    std::vector<RID> search_range(const key_t &left, const key_t &right) const
+    {
+        std::vector<RID> values;
+        std::string high = encode(right);
+
+        for (cursor c = lower_bound(left); c.valid() && !(high < c.leaf.keys[c.pos]); c.next())
+            values.push_back(c.value());
+
+        return values;
+    }
+
+    /* cursor at the first entry not less than `key` */
+    cursor lower_bound(const key_t &key) const
+    {
+        std::string s = encode(key);
+        cursor c;
+        c.tree = this;
+        c.offset = search_leaf(s);
+        read(c.offset, c.leaf);
+        c.pos = std::lower_bound(c.leaf.keys.begin(), c.leaf.keys.end(), s) - c.leaf.keys.begin();
+        c.settle();
+        return c;
+    }
+
+    /* cursor at the smallest entry */
+    cursor first() const
+    {
+        cursor c;
+        c.tree = this;
+        c.offset = meta.leaf_offset;
+        read(c.offset, c.leaf);
+        c.pos = 0;
+        c.settle();
+        return c;
+    }
+
+    /* cursor at the largest entry */
+    cursor last() const
+    {
+        cursor c;
+        c.tree = this;
+        c.offset = meta.root_offset;
+
+        for (size_t height = meta.height; height > 0; --height)
+        {
+            node_t node;
+            read(c.offset, node);
+            c.offset = node.children.back();
+        }
+
+        read(c.offset, c.leaf);
+        c.pos = c.leaf.keys.size();
+
+        if (!c.prev())
+            c.offset = 0;
+
+        return c;
+    }
+
+    /* replace the whole tree by one built bottom-up from the n records
+     * pulled in key order from next(record), each node filled to `fill` */
+    template<class Source>
+    void build(Source next, size_t, double fill)
+    {
+        size_t limit = std::max((size_t)PAGE_SIZE / 2, (size_t)(PAGE_SIZE * fill));
+        limit = std::min(limit, (size_t)PAGE_SIZE);
+
+        // drop every block but the meta one
+        meta.internal_node_num = meta.leaf_node_num = 0;
+        meta.free_offset = 0;
+        meta.free_node_num = 0;
+        meta.slot = OFFSET_BLOCK;
+        meta.height = 0;
+
+        // leafs, each with the separator in front of it for the level above
+        std::vector<std::pair<std::string, off_t> > level;
+        level_builder leafs(this, true, limit, level);
+        record_t record;
+
+        while (next(record))
+            leafs.add(encode(record.key), 0);
+
+        leafs.finish();
+        meta.leaf_offset = level[0].second;
+
+        // internal levels until a single root is left
+        while (level.size() > 1)
+        {
+            std::vector<std::pair<std::string, off_t> > upper;
+            level_builder nodes(this, false, limit, upper);
+
+            for (size_t i = 0; i < level.size(); ++i)
+                nodes.add(level[i].first, level[i].second);
+
+            nodes.finish();
+            level.swap(upper);
+            meta.height++;
+        }
+
+        meta.root_offset = level[0].second;
+        write_meta();
+    }
+
+    /* write a compact copy of the tree and switch over to it, the leafs
+     * are already sorted so they stream straight into the copy */
+    void rebuild(double fill = 0.9)
+    {
+        char tmp[sizeof(path) + 8];
+        sprintf(tmp, "%s.tmp", path);
+
+        {
+            byte_tree copy(fm, bpm, tmp, true);
+            cursor c = first();
+
+            copy.build([&](record_t &record)
+            {
+                if (!c.valid())return false;
+
+                record.key = c.key();
+                record.value = c.value();
+                c.next();
+                return true;
+            }, 0, fill);
+        }
+
+        close_file();
+        rename(tmp, path);
+        open_file();
+        memcpy(&meta, page(OFFSET_META), sizeof(meta_t));
+    }
+
+private:
+    char path[512];
+    meta_t meta;
+    FileManager *fm;
+    BufPageManager *bpm;
+    int fileId;
+    bool empty_init;
+
+    static std::string encode(const key_t &key)
+    {
+        return Codec::encode(key);
+    }
+
+    static key_t decode(const std::string &s)
+    {
+        return Codec::decode(s);
+    }
+
+    static RID rid_of(const std::string &s)
+    {
+        return Codec::rid_of(s);
+    }
+
+    static size_t common(const std::string &a, const std::string &b)
+    {
+        size_t n = std::min(a.size(), b.size()), i = 0;
+
+        while (i < n && a[i] == b[i])
+            ++i;
+
+        return i;
+    }
+
+    /* shortest string s with left < s <= right */
+    static std::string shortest(const std::string &left, const std::string &right)
+    {
+        return right.substr(0, common(left, right) + 1);
+    }
+
+    /* bytes taken by a node of n keys of `bytes` total length sharing `prefix` */
+    static size_t node_size(bool leaf, size_t n, size_t bytes, size_t prefix)
+    {
+        return sizeof(head_t) + prefix + n * 4 + bytes - n * prefix +
+               (leaf ? 0 : (n + 1) * sizeof(off_t));
+    }
+
+    static size_t node_size(const node_t &node)
+    {
+        size_t bytes = 0;
+
+        for (size_t i = 0; i < node.keys.size(); ++i)
+            bytes += node.keys[i].size();
+
+        size_t prefix = node.keys.empty() ? 0 : common(node.keys.front(), node.keys.back());
+        return node_size(node.leaf, node.keys.size(), bytes, prefix);
+    }
+
+    /* move the upper part of node into right so that both take about the
+     * same bytes, and return the separator between them */
+    std::string divide(node_t &node, node_t &right) const
+    {
+        const std::vector<std::string> &keys = node.keys;
+        size_t n = keys.size();
+        std::vector<size_t> sum(n + 1, 0);
+
+        for (size_t i = 0; i < n; ++i)
+            sum[i + 1] = sum[i] + keys[i].size();
+
+        // the left part gets keys [0, a), the right part [m, n); an
+        // internal node's key m - 1 moves up instead
+        size_t lo = 1, hi = node.leaf ? n - 1 : n;
+        size_t shift = node.leaf ? 0 : 1;
+
+        auto left_size = [&](size_t m)
+        {
+            size_t a = m - shift;
+            size_t prefix = a ? common(keys[0], keys[a - 1]) : 0;
+            return node_size(node.leaf, a, sum[a], prefix);
+        };
+        auto right_size = [&](size_t m)
+        {
+            size_t prefix = common(keys[m], keys[n - 1]);
+            return node_size(node.leaf, n - m, sum[n] - sum[m], prefix);
+        };
+
+        // left grows and right shrinks with m, find where they cross
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+
+            if (left_size(mid) >= right_size(mid))
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+
+        size_t m = lo;
+
+        if (m > 1 && std::max(left_size(m - 1), right_size(m - 1)) < std::max(left_size(m), right_size(m)))
+            --m;
+
+        assert(left_size(m) <= PAGE_SIZE && right_size(m) <= PAGE_SIZE);
+
+        right.leaf = node.leaf;
+        right.keys.assign(node.keys.begin() + m, node.keys.end());
+        std::string separator;
+
+        if (node.leaf)
+        {
+            node.keys.resize(m);
+            separator = shortest(node.keys.back(), right.keys.front());
+        }
+        else
+        {
+            separator = node.keys[m - 1];
+            node.keys.resize(m - 1);
+            right.children.assign(node.children.begin() + m, node.children.end());
+            node.children.resize(m);
+        }
+
+        return separator;
+    }
+
+    /* where the child at offset sits in its parent */
+    static size_t position(const node_t &parent, off_t offset)
+    {
+        return std::find(parent.children.begin(), parent.children.end(), offset) - parent.children.begin();
+    }
+
+    /* write node at offset, splitting it first if it outgrew its page */
+    void store(node_t &node, off_t offset)
+    {
+        if (node_size(node) <= PAGE_SIZE)
+        {
+            write(node, offset);
+            return;
+        }
+
+        node_t right;
+        std::string separator = divide(node, right);
+        off_t right_offset = alloc(right.leaf);
+
+        right.prev = offset;
+        right.next = node.next;
+
+        if (node.next != 0)
+            set_head(node.next, &head_t::prev, right_offset);
+
+        node.next = right_offset;
+
+        for (size_t i = 0; i < right.children.size(); ++i)
+            set_head(right.children[i], &head_t::parent, right_offset);
+
+        if (node.parent == 0)
+        {
+            // the root splits, the tree grows a level
+            node_t root;
+            root.parent = root.next = root.prev = 0;
+            root.leaf = false;
+            root.keys.push_back(separator);
+            root.children.push_back(offset);
+            root.children.push_back(right_offset);
+
+            off_t root_offset = alloc(false);
+            node.parent = right.parent = root_offset;
+            meta.root_offset = root_offset;
+            meta.height++;
+
+            write(node, offset);
+            write(right, right_offset);
+            write(root, root_offset);
+            return;
+        }
+
+        right.parent = node.parent;
+        write(node, offset);
+        write(right, right_offset);
+
+        node_t parent;
+        off_t parent_offset = node.parent;
+        read(parent_offset, parent);
+        size_t where = position(parent, offset);
+        parent.keys.insert(parent.keys.begin() + where, separator);
+        parent.children.insert(parent.children.begin() + where + 1, right_offset);
+        store(parent, parent_offset);
+    }
+
+    /* write node at offset after it lost entries or its keys changed;
+     * below a quarter page it is merged with or refilled from a sibling
+     * under the same parent */
+    void fix(node_t &node, off_t offset)
+    {
+        if (node_size(node) > PAGE_SIZE)
+        {
+            store(node, offset);
+            return;
+        }
+
+        if (node.parent == 0)
+        {
+            if (!node.leaf && node.children.size() == 1)
+            {
+                // a root with a single child left, the child becomes the root
+                off_t child = node.children[0];
+                set_head(child, &head_t::parent, (off_t)0);
+                unalloc(offset, false);
+                meta.root_offset = child;
+                meta.height--;
+                return;
+            }
+
+            write(node, offset);
+            return;
+        }
+
+        if (node_size(node) >= PAGE_SIZE / 4)
+        {
+            write(node, offset);
+            return;
+        }
+
+        off_t parent_offset = node.parent;
+        node_t parent;
+        read(parent_offset, parent);
+
+        // pair the node with its left sibling, or its right one if first
+        size_t where = position(parent, offset);
+        size_t k = where > 0 ? where - 1 : where;
+        assert(parent.children.size() > 1);
+        off_t left_offset = parent.children[k];
+        off_t right_offset = parent.children[k + 1];
+        node_t left, right;
+
+        if (where > 0)
+        {
+            read(left_offset, left);
+            right.keys.swap(node.keys);
+            right.children.swap(node.children);
+            right.parent = node.parent;
+            right.next = node.next;
+            right.prev = node.prev;
+            right.leaf = node.leaf;
+        }
+        else
+        {
+            left.keys.swap(node.keys);
+            left.children.swap(node.children);
+            left.parent = node.parent;
+            left.next = node.next;
+            left.prev = node.prev;
+            left.leaf = node.leaf;
+            read(right_offset, right);
+        }
+
+        size_t left_children = left.children.size();
+
+        // the separator comes down between the children of internal nodes
+        if (!left.leaf)
+            left.keys.push_back(parent.keys[k]);
+
+        left.keys.insert(left.keys.end(), right.keys.begin(), right.keys.end());
+        left.children.insert(left.children.end(), right.children.begin(), right.children.end());
+
+        if (node_size(left) <= PAGE_SIZE)
+        {
+            // merge right into left
+            for (size_t i = 0; i < right.children.size(); ++i)
+                set_head(right.children[i], &head_t::parent, left_offset);
+
+            left.next = right.next;
+
+            if (right.next != 0)
+                set_head(right.next, &head_t::prev, left_offset);
+
+            unalloc(right_offset, right.leaf);
+            write(left, left_offset);
+
+            parent.keys.erase(parent.keys.begin() + k);
+            parent.children.erase(parent.children.begin() + k + 1);
+            fix(parent, parent_offset);
+            return;
+        }
+
+        // too much for one page, split the pair evenly again
+        node_t upper;
+        parent.keys[k] = divide(left, upper);
+        right.keys.swap(upper.keys);
+        right.children.swap(upper.children);
+
+        // children that changed sides
+        for (size_t i = left_children; i < left.children.size(); ++i)
+            set_head(left.children[i], &head_t::parent, left_offset);
+
+        for (size_t i = 0; left.children.size() + i < left_children; ++i)
+            set_head(right.children[i], &head_t::parent, right_offset);
+
+        write(left, left_offset);
+        write(right, right_offset);
+        fix(parent, parent_offset);
+    }
+
+    /* lays out one level of a bottom-up build left to right, holding back
+     * the last node so a short tail can be evened out with it */
+    struct level_builder
+    {
+        byte_tree *tree;
+        bool leaf;
+        size_t limit;
+        std::vector<std::pair<std::string, off_t> > &upper;
+
+        node_t node, held;
+        off_t offset, held_offset;
+        std::string separator, last;
+        size_t bytes;
+
+        level_builder(byte_tree *_tree, bool _leaf, size_t _limit,
+                      std::vector<std::pair<std::string, off_t> > &_upper)
+            : tree(_tree), leaf(_leaf), limit(_limit), upper(_upper),
+              offset(0), held_offset(0), bytes(0)
+        {
+        }
+
+        /* next entry: a leaf key, or the separator in front of child */
+        void add(const std::string &key, off_t child)
+        {
+            if (offset != 0)
+            {
+                size_t prefix = common(node.keys.empty() ? key : node.keys.front(), key);
+
+                if (node_size(leaf, node.keys.size() + 1, bytes + key.size(), prefix) > limit)
+                    close();
+            }
+
+            if (offset == 0)
+            {
+                open(leaf && !last.empty() ? shortest(last, key) : key);
+
+                // the first child's separator only goes up a level
+                if (!leaf)
+                {
+                    node.children.push_back(child);
+                    return;
+                }
+            }
+
+            if (!leaf)
+                node.children.push_back(child);
+
+            node.keys.push_back(key);
+            bytes += key.size();
+            last = key;
+        }
+
+        void open(const std::string &_separator)
+        {
+            offset = tree->alloc(leaf);
+            node.parent = node.next = 0;
+            node.prev = held_offset;
+            node.leaf = leaf;
+            node.keys.clear();
+            node.children.clear();
+            bytes = 0;
+            separator = _separator;
+
+            if (held_offset != 0)
+                held.next = offset;
+        }
+
+        /* the node is full, hold it and write the one held before */
+        void close()
+        {
+            if (held_offset != 0)
+                put(held, held_offset);
+
+            held = node;
+            held_offset = offset;
+            upper.push_back(make_pair(separator, offset));
+            offset = 0;
+        }
+
+        void finish()
+        {
+            // an empty tree is a single empty leaf
+            if (offset == 0)
+                open(std::string());
+
+            upper.push_back(make_pair(separator, offset));
+
+            // a short last node takes entries from the one before it
+            if (held_offset != 0 && node_size(node) < PAGE_SIZE / 4)
+            {
+                if (!leaf)
+                    held.keys.push_back(separator);
+
+                held.keys.insert(held.keys.end(), node.keys.begin(), node.keys.end());
+                held.children.insert(held.children.end(), node.children.begin(), node.children.end());
+                node.keys.clear();
+                node.children.clear();
+
+                if (node_size(held) <= PAGE_SIZE)
+                {
+                    held.next = 0;
+                    tree->unalloc(offset, leaf);
+                    upper.pop_back();
+                    put(held, held_offset);
+                    return;
+                }
+
+                node_t right;
+                upper.back().first = tree->divide(held, right);
+                node.keys.swap(right.keys);
+                node.children.swap(right.children);
+            }
+
+            if (held_offset != 0)
+                put(held, held_offset);
+
+            put(node, offset);
+        }
+
+        /* write a finished node and point its children at it */
+        void put(node_t &n, off_t at)
+        {
+            tree->write(n, at);
+
+            for (size_t i = 0; i < n.children.size(); ++i)
+                tree->set_head(n.children[i], &head_t::parent, at);
+        }
+    };
+
+    void init_from_empty()
+    {
+        bzero(&meta, sizeof(meta_t));
+        meta.magic = STRING_TREE_MAGIC;
+        meta.key_size = Codec::key_size;
+        meta.height = 0;
+        meta.slot = OFFSET_BLOCK;
+
+        // the root starts as a single empty leaf
+        node_t leaf;
+        leaf.parent = leaf.next = leaf.prev = 0;
+        leaf.leaf = true;
+        meta.root_offset = meta.leaf_offset = alloc(true);
+        write(leaf, meta.root_offset);
+        write_meta();
+    }
+
+    off_t search_leaf(const std::string &key) const
+    {
+        off_t offset = meta.root_offset;
+
+        for (size_t height = meta.height; height > 0; --height)
+            offset = child_of(offset, key);
+
+        return offset;
+    }
+
+    /* child of an internal node whose range holds key, searched in place
+     * in the page without reading the node out */
+    off_t child_of(off_t offset, const std::string &key) const
+    {
+        const char *p = page(offset);
+        head_t head;
+        memcpy(&head, p, sizeof(head_t));
+
+        const char *prefix = p + sizeof(head_t);
+        const char *slots = prefix + head.prefix;
+        const char *children = slots + head.n * sizeof(uint16_t);
+        size_t lo = 0, hi = head.n;
+
+        // the shared prefix alone may already order key against every key
+        int c = memcmp(key.data(), prefix, std::min(key.size(), (size_t)head.prefix));
+
+        if (c < 0 || (c == 0 && key.size() < head.prefix))
+            hi = 0;
+        else if (c > 0)
+            lo = head.n;
+
+        const char *rest = key.data() + std::min(key.size(), (size_t)head.prefix);
+        size_t rest_size = key.size() - std::min(key.size(), (size_t)head.prefix);
+
+        // first key greater than `key`
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            uint16_t at, length;
+            memcpy(&at, slots + mid * sizeof(uint16_t), sizeof(uint16_t));
+            memcpy(&length, p + at, sizeof(uint16_t));
+
+            int d = memcmp(rest, p + at + sizeof(uint16_t), std::min(rest_size, (size_t)length));
+
+            if (d < 0 || (d == 0 && rest_size < length))
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+
+        off_t child;
+        memcpy(&child, children + lo * sizeof(off_t), sizeof(off_t));
+        return child;
+    }
+
+    void read(off_t offset, node_t &node) const
+    {
+        const char *p = page(offset);
+        head_t head;
+        memcpy(&head, p, sizeof(head_t));
+
+        node.parent = head.parent;
+        node.next = head.next;
+        node.prev = head.prev;
+        node.leaf = head.leaf;
+
+        const char *prefix = p + sizeof(head_t);
+        const char *slots = prefix + head.prefix;
+        node.keys.resize(head.n);
+
+        for (size_t i = 0; i < head.n; ++i)
+        {
+            uint16_t at, length;
+            memcpy(&at, slots + i * sizeof(uint16_t), sizeof(uint16_t));
+            memcpy(&length, p + at, sizeof(uint16_t));
+            node.keys[i].assign(prefix, head.prefix);
+            node.keys[i].append(p + at + sizeof(uint16_t), length);
+        }
+
+        node.children.clear();
+
+        if (!head.leaf)
+        {
+            node.children.resize(head.n + 1);
+            memcpy(node.children.data(), slots + head.n * sizeof(uint16_t), (head.n + 1) * sizeof(off_t));
+        }
+    }
+
+    void write(const node_t &node, off_t offset)
+    {
+        assert(node_size(node) <= PAGE_SIZE);
+
+        char *p = page(offset, true);
+        head_t head;
+        head.parent = node.parent;
+        head.next = node.next;
+        head.prev = node.prev;
+        head.n = node.keys.size();
+        head.leaf = node.leaf;
+        head.prefix = node.keys.empty() ? 0 : common(node.keys.front(), node.keys.back());
+        head.pad = 0;
+        memcpy(p, &head, sizeof(head_t));
+
+        char *prefix = p + sizeof(head_t);
+        char *slots = prefix + head.prefix;
+        char *children = slots + head.n * sizeof(uint16_t);
+
+        if (head.n > 0)
+            memcpy(prefix, node.keys[0].data(), head.prefix);
+
+        if (!node.leaf)
+            memcpy(children, node.children.data(), node.children.size() * sizeof(off_t));
+
+        uint16_t at = children + node.children.size() * sizeof(off_t) - p;
+
+        for (size_t i = 0; i < head.n; ++i)
+        {
+            uint16_t length = node.keys[i].size() - head.prefix;
+            memcpy(slots + i * sizeof(uint16_t), &at, sizeof(uint16_t));
+            memcpy(p + at, &length, sizeof(uint16_t));
+            memcpy(p + at + sizeof(uint16_t), node.keys[i].data() + head.prefix, length);
+            at += sizeof(uint16_t) + length;
+        }
+    }
+
+    /* change one field of a node's head in place */
+    void set_head(off_t offset, off_t head_t::*field, off_t value)
+    {
+        char *p = page(offset, true);
+        head_t head;
+        memcpy(&head, p, sizeof(head_t));
+        head.*field = value;
+        memcpy(p, &head, sizeof(head_t));
+    }
+
+    void write_meta()
+    {
+        memcpy(page(OFFSET_META, true), &meta, sizeof(meta_t));
+    }
+
+    /* index files are paged through the shared buffer manager */
+    void open_file()
+    {
+        fm->createFile(path);
+        fm->openFile(path, fileId);
+    }
+
+    void close_file()
+    {
+        bpm->closeFile(fileId);
+        fm->closeFile(fileId);
+    }
+
+    /* the buffered page of a block, valid until the next page is fetched */
+    char *page(off_t offset, bool dirty = false) const
+    {
+        int index;
+        BufType b = bpm->getPage(fileId, offset >> PAGE_SIZE_IDX, index);
+
+        if (dirty)
+            bpm->markDirty(index);
+
+        return (char *)b;
+    }
+
+    /* alloc from disk, freed blocks are reused before the file grows */
+    off_t alloc(bool leaf)
+    {
+        off_t slot;
+
+        if (leaf)
+            meta.leaf_node_num++;
+        else
+            meta.internal_node_num++;
+
+        if (meta.free_offset != 0)
+        {
+            // pop the free list, the link is kept in the block's first word
+            slot = meta.free_offset;
+            memcpy(&meta.free_offset, page(slot), sizeof(off_t));
+            meta.free_node_num--;
+        }
+        else
+        {
+            slot = meta.slot;
+            meta.slot += PAGE_SIZE;
+        }
+
+        memset(page(slot, true), 0, PAGE_SIZE);
+        return slot;
+    }
+
+    /* push the block onto the free list */
+    void unalloc(off_t offset, bool leaf)
+    {
+        if (leaf)
+            meta.leaf_node_num--;
+        else
+            meta.internal_node_num--;
+
+        memcpy(page(offset, true), &meta.free_offset, sizeof(off_t));
+        meta.free_offset = offset;
+        meta.free_node_num++;
+    }
+};
+
+template<int size>
+using string_tree = byte_tree<string_codec<size> >;
+
+/* composite keys over several columns */
+typedef byte_tree<tuple_codec> tuple_tree;
+
+}
+
+#endif
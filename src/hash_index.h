@@ -0,0 +1,509 @@
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "bptree_str.h"
+
+namespace hashidx
+{
+
+/* marks an index file laid out by linear_hash */
+const size_t HASH_INDEX_MAGIC = 0x48534831;
+
+const int OFFSET_META = 0;
+#define HASH_OFFSET_BLOCK (OFFSET_META + PAGE_SIZE)
+
+/* buckets when the table is created, a power of two */
+const size_t HASH_BUCKETS = 4;
+/* share of the bucket pages filled before the next bucket is split */
+#define HASH_FILL 0.75
+
+/* linear hashing over buffer managed pages: a key is hashed to one
+ * bucket, a chain of pages holding (key, rid) entries. buckets are split
+ * one at a time in order as the table fills, so a probe reads a single
+ * chain that stays about one page long. keys and rids are stored as
+ * bptree::entry_codec bytes, the rid being the last 8 of them */
+class linear_hash
+{
+public:
+    /* meta information of the table */
+    typedef struct
+    {
+        size_t magic;     /* HASH_INDEX_MAGIC */
+        size_t level;     /* 2^level * HASH_BUCKETS buckets before this round of splits */
+        size_t split;     /* next bucket to split */
+        size_t buckets;   /* how many buckets */
+        size_t entries;   /* how many entries */
+        size_t bytes;     /* bytes the entries take in pages */
+        size_t page_num;  /* how many pages hold entries */
+        off_t slot;       /* where to store new block */
+        off_t free_offset; /* first freed block to reuse, 0 if none */
+        size_t free_page_num; /* how many freed blocks */
+    } meta_t;
+
+    /* page layout: head, then entries as length and bytes */
+    struct head_t
+    {
+        off_t next;       /* overflow page of the same bucket, 0 if last */
+        uint16_t n;
+        uint16_t used;    /* bytes in use, head included */
+        uint32_t pad;
+    };
+
+    linear_hash(FileManager *_fm, BufPageManager *_bpm, const char *p,
+                bool force_empty = false)
+        : fm(_fm), bpm(_bpm), fileId(-1), empty_init(false)
+    {
+        bzero(path, sizeof(path));
+        strcpy(path, p);
+
+        struct stat st;
+
+        // a file without a whole meta page can't hold a table
+        if (stat(path, &st) != 0 || st.st_size < PAGE_SIZE)
+            force_empty = true;
+
+        if (force_empty)
+            truncate(path, 0);
+
+        open_file();
+
+        if (!force_empty)
+        {
+            memcpy(&meta, page(OFFSET_META), sizeof(meta_t));
+
+            if (meta.magic != HASH_INDEX_MAGIC)
+                force_empty = true;
+        }
+
+        if (force_empty)
+        {
+            init_from_empty();
+            empty_init = true;
+        }
+    }
+
+    ~linear_hash()
+    {
+        close_file();
+    }
+
+    meta_t get_meta() const
+    {
+        return meta;
+    }
+
+    /* true if the table was created empty instead of read from file */
+    bool initialized_empty() const
+    {
+        return empty_init;
+    }
+
+    /* 0 on success, 1 if the entry is already there */
+    int insert(const std::string &key, const RID &rid)
+    {
+        std::string entry = key;
+        bptree::entry_codec::put_rid(entry, rid);
+        size_t bucket = bucket_of(key);
+
+        for (off_t offset = bucket_page(bucket); offset != 0; offset = head_of(offset).next)
+            if (find(offset, entry) >= 0)
+                return 1;
+
+        append(bucket, entry);
+        meta.entries++;
+        meta.bytes += sizeof(uint16_t) + entry.size();
+
+        while (meta.bytes > HASH_FILL * meta.buckets * (PAGE_SIZE - sizeof(head_t)))
+            split();
+
+        write_meta();
+        return 0;
+    }
+
+    /* 0 on success, -1 if the entry isn't there */
+    int remove(const std::string &key, const RID &rid)
+    {
+        std::string entry = key;
+        bptree::entry_codec::put_rid(entry, rid);
+        size_t bucket = bucket_of(key);
+        off_t prev = 0;
+
+        for (off_t offset = bucket_page(bucket); offset != 0; prev = offset, offset = head_of(offset).next)
+        {
+            int at = find(offset, entry);
+
+            if (at < 0)
+                continue;
+
+            char *p = page(offset, true);
+            head_t head;
+            memcpy(&head, p, sizeof(head_t));
+            size_t size = sizeof(uint16_t) + entry.size();
+            memmove(p + at, p + at + size, head.used - at - size);
+            head.used -= size;
+            head.n--;
+            memcpy(p, &head, sizeof(head_t));
+
+            // an empty overflow page leaves the chain
+            if (head.n == 0 && prev != 0)
+            {
+                set_next(prev, head.next);
+                unalloc(offset);
+            }
+
+            meta.entries--;
+            meta.bytes -= size;
+            write_meta();
+            return 0;
+        }
+
+        return -1;
+    }
+
+    /* rids of every entry of the key */
+    std::vector<RID> search(const std::string &key) const
+    {
+        std::vector<RID> values;
+
+        for (off_t offset = bucket_page(bucket_of(key)); offset != 0; offset = head_of(offset).next)
+        {
+            std::vector<std::string> entries;
+            read(offset, entries);
+
+            for (size_t i = 0; i < entries.size(); ++i)
+                if (entries[i].size() == key.size() + 8 && entries[i].compare(0, key.size(), key) == 0)
+                    values.push_back(bptree::entry_codec::rid_of(entries[i]));
+        }
+
+        return values;
+    }
+
+    /* call visit(entry) for every entry, in no particular order */
+    template<class F>
+    void scan(F visit) const
+    {
+        for (size_t bucket = 0; bucket < meta.buckets; ++bucket)
+            for (off_t offset = bucket_page(bucket); offset != 0; offset = head_of(offset).next)
+            {
+                std::vector<std::string> entries;
+                read(offset, entries);
+
+                for (size_t i = 0; i < entries.size(); ++i)
+                    visit(entries[i]);
+            }
+    }
+
+    /* drop every entry */
+    void clear()
+    {
+        close_file();
+        truncate(path, 0);
+        open_file();
+        init_from_empty();
+    }
+
+    /* write a compact copy of the table and switch over to it */
+    void rebuild()
+    {
+        char tmp[sizeof(path) + 8];
+        sprintf(tmp, "%s.tmp", path);
+
+        {
+            linear_hash copy(fm, bpm, tmp, true);
+
+            scan([&](const std::string & entry)
+            {
+                copy.insert(entry.substr(0, entry.size() - 8), bptree::entry_codec::rid_of(entry));
+            });
+        }
+
+        close_file();
+        rename(tmp, path);
+        open_file();
+        memcpy(&meta, page(OFFSET_META), sizeof(meta_t));
+    }
+
+private:
+    /* bucket pages are found through directory blocks, whose offsets
+     * follow the meta in its block */
+    static const size_t PER_DIRECTORY = PAGE_SIZE / sizeof(off_t);
+
+    char path[512];
+    meta_t meta;
+    FileManager *fm;
+    BufPageManager *bpm;
+    int fileId;
+    bool empty_init;
+
+    /* FNV-1a over the key bytes, the rid is left out so that every
+     * entry of a key lands in the same bucket */
+    static uint64_t hash(const std::string &key)
+    {
+        uint64_t h = 14695981039346656037ull;
+
+        for (size_t i = 0; i < key.size(); ++i)
+        {
+            h ^= (unsigned char)key[i];
+            h *= 1099511628211ull;
+        }
+
+        return h;
+    }
+
+    size_t bucket_of(const std::string &key) const
+    {
+        size_t round = HASH_BUCKETS << meta.level;
+        uint64_t h = hash(key);
+        size_t bucket = h % round;
+
+        // buckets before the split pointer were already split this round
+        if (bucket < meta.split)
+            bucket = h % (2 * round);
+
+        return bucket;
+    }
+
+    off_t bucket_page(size_t bucket) const
+    {
+        off_t block, offset;
+        memcpy(&block, page(OFFSET_META) + sizeof(meta_t) + bucket / PER_DIRECTORY * sizeof(off_t), sizeof(off_t));
+        memcpy(&offset, page(block) + bucket % PER_DIRECTORY * sizeof(off_t), sizeof(off_t));
+        return offset;
+    }
+
+    /* give a new bucket its first page */
+    void add_bucket(size_t bucket)
+    {
+        off_t block;
+        size_t at = sizeof(meta_t) + bucket / PER_DIRECTORY * sizeof(off_t);
+
+        assert(at + sizeof(off_t) <= PAGE_SIZE);
+
+        if (bucket % PER_DIRECTORY == 0)
+        {
+            block = alloc();
+            memcpy(page(OFFSET_META, true) + at, &block, sizeof(off_t));
+        }
+        else
+        {
+            memcpy(&block, page(OFFSET_META) + at, sizeof(off_t));
+        }
+
+        off_t offset = alloc_bucket_page();
+        memcpy(page(block, true) + bucket % PER_DIRECTORY * sizeof(off_t), &offset, sizeof(off_t));
+    }
+
+    off_t alloc_bucket_page()
+    {
+        off_t offset = alloc();
+        head_t head;
+        bzero(&head, sizeof(head_t));
+        head.used = sizeof(head_t);
+        memcpy(page(offset, true), &head, sizeof(head_t));
+        meta.page_num++;
+        return offset;
+    }
+
+    head_t head_of(off_t offset) const
+    {
+        head_t head;
+        memcpy(&head, page(offset), sizeof(head_t));
+        return head;
+    }
+
+    void set_next(off_t offset, off_t next)
+    {
+        head_t head = head_of(offset);
+        head.next = next;
+        memcpy(page(offset, true), &head, sizeof(head_t));
+    }
+
+    /* where the entry sits in the page, -1 if it isn't there */
+    int find(off_t offset, const std::string &entry) const
+    {
+        const char *p = page(offset);
+        head_t head;
+        memcpy(&head, p, sizeof(head_t));
+
+        for (size_t at = sizeof(head_t), i = 0; i < head.n; ++i)
+        {
+            uint16_t length;
+            memcpy(&length, p + at, sizeof(uint16_t));
+
+            if (length == entry.size() && memcmp(p + at + sizeof(uint16_t), entry.data(), length) == 0)
+                return at;
+
+            at += sizeof(uint16_t) + length;
+        }
+
+        return -1;
+    }
+
+    void read(off_t offset, std::vector<std::string> &entries) const
+    {
+        const char *p = page(offset);
+        head_t head;
+        memcpy(&head, p, sizeof(head_t));
+        entries.resize(head.n);
+
+        for (size_t at = sizeof(head_t), i = 0; i < head.n; ++i)
+        {
+            uint16_t length;
+            memcpy(&length, p + at, sizeof(uint16_t));
+            entries[i].assign(p + at + sizeof(uint16_t), length);
+            at += sizeof(uint16_t) + length;
+        }
+    }
+
+    /* add an entry to the first page of the bucket with room for it,
+     * chaining a new page if all are full */
+    void append(size_t bucket, const std::string &entry)
+    {
+        size_t size = sizeof(uint16_t) + entry.size();
+        off_t offset = bucket_page(bucket);
+        head_t head = head_of(offset);
+
+        while (head.used + size > PAGE_SIZE && head.next != 0)
+        {
+            offset = head.next;
+            head = head_of(offset);
+        }
+
+        if (head.used + size > PAGE_SIZE)
+        {
+            off_t next = alloc_bucket_page();
+            set_next(offset, next);
+            offset = next;
+            head = head_of(offset);
+        }
+
+        char *p = page(offset, true);
+        uint16_t length = entry.size();
+        memcpy(p + head.used, &length, sizeof(uint16_t));
+        memcpy(p + head.used + sizeof(uint16_t), entry.data(), length);
+        head.used += size;
+        head.n++;
+        memcpy(p, &head, sizeof(head_t));
+    }
+
+    /* split the bucket at the split pointer into itself and a new bucket
+     * at the end, by the next bit of the hash */
+    void split()
+    {
+        size_t bucket = meta.split;
+        off_t first = bucket_page(bucket);
+        std::vector<std::string> entries, part;
+
+        for (off_t offset = first; offset != 0;)
+        {
+            read(offset, part);
+            entries.insert(entries.end(), part.begin(), part.end());
+            off_t next = head_of(offset).next;
+
+            if (offset != first)
+                unalloc(offset);
+
+            offset = next;
+        }
+
+        head_t head;
+        bzero(&head, sizeof(head_t));
+        head.used = sizeof(head_t);
+        memcpy(page(first, true), &head, sizeof(head_t));
+
+        add_bucket(meta.buckets);
+        meta.buckets++;
+
+        if (++meta.split == HASH_BUCKETS << meta.level)
+        {
+            meta.level++;
+            meta.split = 0;
+        }
+
+        for (size_t i = 0; i < entries.size(); ++i)
+            append(bucket_of(entries[i].substr(0, entries[i].size() - 8)), entries[i]);
+    }
+
+    void init_from_empty()
+    {
+        bzero(&meta, sizeof(meta_t));
+        meta.magic = HASH_INDEX_MAGIC;
+        meta.slot = HASH_OFFSET_BLOCK;
+        memset(page(OFFSET_META, true), 0, PAGE_SIZE);
+
+        for (size_t i = 0; i < HASH_BUCKETS; ++i)
+            add_bucket(i);
+
+        meta.buckets = HASH_BUCKETS;
+        write_meta();
+    }
+
+    void write_meta()
+    {
+        memcpy(page(OFFSET_META, true), &meta, sizeof(meta_t));
+    }
+
+    /* index files are paged through the shared buffer manager */
+    void open_file()
+    {
+        fm->createFile(path);
+        fm->openFile(path, fileId);
+    }
+
+    void close_file()
+    {
+        bpm->closeFile(fileId);
+        fm->closeFile(fileId);
+    }
+
+    /* the buffered page of a block, valid until the next page is fetched */
+    char *page(off_t offset, bool dirty = false) const
+    {
+        int index;
+        BufType b = bpm->getPage(fileId, offset >> PAGE_SIZE_IDX, index);
+
+        if (dirty)
+            bpm->markDirty(index);
+
+        return (char *)b;
+    }
+
+    /* alloc from disk, freed blocks are reused before the file grows */
+    off_t alloc()
+    {
+        off_t slot;
+
+        if (meta.free_offset != 0)
+        {
+            // pop the free list, the link is kept in the block's first word
+            slot = meta.free_offset;
+            memcpy(&meta.free_offset, page(slot), sizeof(off_t));
+            meta.free_page_num--;
+        }
+        else
+        {
+            slot = meta.slot;
+            meta.slot += PAGE_SIZE;
+        }
+
+        memset(page(slot, true), 0, PAGE_SIZE);
+        return slot;
+    }
+
+    /* push an entry page onto the free list */
+    void unalloc(off_t offset)
+    {
+        meta.page_num--;
+        memcpy(page(offset, true), &meta.free_offset, sizeof(off_t));
+        meta.free_offset = offset;
+        meta.free_page_num++;
+    }
+};
+
+}
+
+#endif
@@ -6,6 +6,9 @@
 #include "../utils/pagedef.h"
 #include "../fileio/FileManager.h"
 #include "../utils/MyLinkList.h"
+#include <atomic>
+#include <thread>
+#include <pthread.h>
 /*
  * BufPageManager
  * 实现了一个缓存的管理器
@@ -23,6 +26,14 @@ public:
      * 缓存页面数组
      */
     BufType *addr;
+    /*
+     * 多个线程共享缓存时使用：frames保护hash表和替换算法，命中时只加共享锁
+     * pins记录每个缓存页面被钉住的次数，被钉住的页面不会被替换
+     * touched记录加共享锁时的访问，替换时给这些页面第二次机会
+     */
+    pthread_rwlock_t frames;
+    std::atomic<int> *pins;
+    std::atomic<bool> *touched;
     BufType allocMem()
     {
         return new unsigned int[(PAGE_SIZE >> 2)];
@@ -30,7 +41,7 @@ public:
     BufType fetchPage(int typeID, int pageID, int &index)
     {
         BufType b;
-        index = replace->find();
+        index = victim();
         b = addr[index];
 
         if (b == NULL)
@@ -52,6 +63,30 @@ public:
         hash->replace(index, typeID, pageID);
         return b;
     }
+    /*
+     * 功能:按替换算法找到要被替换的页面，跳过被钉住的页面，
+     *           加共享锁时访问过的页面被移到最近访问的位置
+     *           所有页面都被钉住时，让出处理器等待其他线程调用unpinPage
+     */
+    int victim()
+    {
+        for (int i = 0; ; ++ i)
+        {
+            int index = replace->find();
+
+            if (pins[index] == 0 && (!touched[index] || i >= 2 * CAP))
+            {
+                return index;
+            }
+
+            touched[index] = false;
+
+            if (i >= 2 * CAP && i % CAP == CAP - 1)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
 public:
     /*
      * @函数名allocPage
@@ -106,6 +141,61 @@ public:
             return b;
         }
     }
+    /*
+     * @函数名pinPage
+     * @参数fileID:文件id
+     * @参数pageID:文件页号
+     * @参数index:函数返回时，用来记录缓存页面数组中的下标
+     * 返回:缓存页面的首地址
+     * 功能:与getPage相同，但可以被多个线程同时调用
+     *           返回的页面被钉住，在调用unpinPage之前不会被替换
+     *           页面在缓存中时只加共享锁，不在时加互斥锁读入页面
+     * 注意:同一缓存的其他函数不能与它同时调用
+     */
+    BufType pinPage(int fileID, int pageID, int &index)
+    {
+        pthread_rwlock_rdlock(&frames);
+        index = hash->findIndex(fileID, pageID);
+
+        if (index != -1)
+        {
+            pins[index]++;
+
+            if (!touched[index])
+            {
+                touched[index] = true;
+            }
+
+            pthread_rwlock_unlock(&frames);
+            return addr[index];
+        }
+
+        pthread_rwlock_unlock(&frames);
+        pthread_rwlock_wrlock(&frames);
+        BufType b = getPage(fileID, pageID, index);
+        pins[index]++;
+        pthread_rwlock_unlock(&frames);
+        return b;
+    }
+    /*
+     * @函数名unpinPage
+     * @参数index:pinPage返回的缓存页面数组下标
+     * 功能:取消一次pinPage对页面的钉住
+     */
+    void unpinPage(int index)
+    {
+        pins[index]--;
+    }
+    /*
+     * @函数名markDirtyPinned
+     * @参数index:pinPage返回的缓存页面数组下标
+     * 功能:与markDirty相同，用于被钉住的页面，可以被多个线程同时调用
+     */
+    void markDirtyPinned(int index)
+    {
+        dirty[index] = true;
+        touched[index] = true;
+    }
     /*
      * @函数名access
      * @参数index:缓存页面数组中的下标，用来表示一个缓存页面
@@ -172,6 +262,25 @@ public:
             writeBack(i);
         }
     }
+    /*
+     * @函数名closeFile
+     * @参数fileID:文件id
+     * 功能:将fileID指定文件的所有缓存页面归还给缓存管理器，归还前需要根据脏页标记决定是否写到对应的文件页面中
+     *           在FileManager关闭文件之前调用，避免文件id被复用后命中旧文件的缓存页面
+     */
+    void closeFile(int fileID)
+    {
+        for (int i = 0; i < CAP; ++ i)
+        {
+            int f, p;
+            hash->getKeys(i, f, p);
+
+            if (f == fileID)
+            {
+                writeBack(i);
+            }
+        }
+    }
     /*
      * @函数名getKey
      * @参数index:缓存页面数组中的下标，用来指定一个缓存页面
@@ -197,11 +306,16 @@ public:
         addr = new BufType[CAP];
         hash = new MyHashMap(c, m);
         replace = new FindReplace(c);
+        pins = new std::atomic<int>[CAP];
+        touched = new std::atomic<bool>[CAP];
+        pthread_rwlock_init(&frames, NULL);
 
         for (int i = 0; i < CAP; ++ i)
         {
             dirty[i] = false;
             addr[i] = NULL;
+            pins[i] = 0;
+            touched[i] = false;
         }
     }
 };
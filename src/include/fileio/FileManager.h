@@ -1,6 +1,7 @@
 #ifndef FILE_MANAGER
 #define FILE_MANAGER
 #include <string>
+#include <cstring>
 #include <stdio.h>
 #include <iostream>
 #include <sys/types.h>
@@ -82,6 +83,7 @@ public:
      * @参数buf:存储信息的缓存(4字节无符号整数数组)
      * @参数off:偏移量
      * 功能:将fileID和pageID指定的文件页中2048个四字节整数(8kb)读入到buf+off开始的内存中
+     *           文件末尾之后的部分以0填充，未写过的页面读出来总是全0
      * 返回:成功操作返回0
      */
     int readPage(int fileID, int pageID, BufType buf, int off)
@@ -99,6 +101,12 @@ public:
 
         BufType b = buf + off;
         error = read(f, (void *) b, PAGE_SIZE);
+
+        if (error < PAGE_SIZE)
+        {
+            memset((char *) b + (error > 0 ? error : 0), 0, PAGE_SIZE - (error > 0 ? error : 0));
+        }
+
         return 0;
     }
     /*
@@ -0,0 +1,220 @@
+#ifndef IX_BLOOM_H
+#define IX_BLOOM_H
+
+#include "type.h"
+#include "rc.h"
+#include "bptree_str.h"
+#include "ix_build.h"
+#include <stdint.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/* marks a file written by IX_Bloom */
+#define IX_BLOOM_MAGIC 0x424c4d31
+/* keys the first filter is sized for, each next one is twice as large */
+#define IX_BLOOM_FIRST 1024
+/* bits per key of the first filter, each next one gets two more so the
+ * false positive rates of all of them add up to about one percent */
+#define IX_BLOOM_BITS 10
+
+/* the keys ever added to an index, so that a key the filter doesn't hold
+ * is known to be missing without reading the index. a key is hashed to a
+ * few bits that are all set once it is added; deleted keys keep their bits
+ * until the next build. when a filter is full a larger one is started, a
+ * key being held if any of them holds it. the filters are kept in a file
+ * next to the index, marked in use while open, so one left behind by a
+ * crash is not trusted and the index is built anew */
+class IX_Bloom
+{
+private:
+    struct filter
+    {
+        uint64_t capacity, count, hashes;
+        std::vector<uint64_t> bits;
+
+        filter(uint64_t _capacity, uint64_t bits_per_key)
+            : capacity(_capacity), count(0), hashes(bits_per_key * 69 / 100)
+        {
+            bits.assign((capacity * bits_per_key + 63) / 64, 0);
+        }
+
+        /* the i-th bit of a key, by double hashing its two halves */
+        uint64_t bit(uint64_t h, uint64_t i) const
+        {
+            return ((h & 0xffffffff) + i * ((h >> 32) | 1)) % (bits.size() * 64);
+        }
+
+        void add(uint64_t h)
+        {
+            for (uint64_t i = 0; i < hashes; i++)
+            {
+                uint64_t b = bit(h, i);
+                bits[b / 64] |= 1ull << (b % 64);
+            }
+
+            count++;
+        }
+
+        bool has(uint64_t h) const
+        {
+            for (uint64_t i = 0; i < hashes; i++)
+            {
+                uint64_t b = bit(h, i);
+
+                if (!(bits[b / 64] >> (b % 64) & 1))return false;
+            }
+
+            return true;
+        }
+    };
+
+    std::string path;
+    std::vector<filter> filters;
+    bool valid;
+
+    /* FNV-1a of the encoded key, as the hash index */
+    static uint64_t hash(Type *data)
+    {
+        std::string key;
+        bptree::tuple_codec::put_type(key, data);
+        uint64_t h = 14695981039346656037ull;
+
+        for (size_t i = 0; i < key.size(); ++i)
+        {
+            h ^= (unsigned char)key[i];
+            h *= 1099511628211ull;
+        }
+
+        return h;
+    }
+
+    bool load()
+    {
+        FILE *f = fopen(path.c_str(), "rb");
+
+        if (!f)return false;
+
+        uint64_t head[3];
+        bool ok = fread(head, sizeof(head), 1, f) == 1 && head[0] == IX_BLOOM_MAGIC && head[1] == 1;
+
+        for (uint64_t i = 0; ok && i < head[2]; i++)
+        {
+            uint64_t meta[4];
+            ok = fread(meta, sizeof(meta), 1, f) == 1 && meta[3] < (1ull << 32);
+
+            if (!ok)break;
+
+            filter one(meta[0], 0);
+            one.count = meta[1];
+            one.hashes = meta[2];
+            one.bits.resize(meta[3]);
+            ok = one.bits.empty() || fread(&one.bits[0], sizeof(uint64_t), one.bits.size(), f) == one.bits.size();
+            filters.push_back(one);
+        }
+
+        fclose(f);
+
+        if (!ok)filters.clear();
+
+        return ok;
+    }
+
+    /* the filters marked clean, or a head alone marking the file in use */
+    bool save(bool clean)
+    {
+        FILE *f = fopen(path.c_str(), "wb");
+
+        if (!f)return false;
+
+        uint64_t head[3] = {IX_BLOOM_MAGIC, clean, clean ? filters.size() : 0};
+        bool ok = fwrite(head, sizeof(head), 1, f) == 1;
+
+        for (size_t i = 0; ok && clean && i < filters.size(); i++)
+        {
+            uint64_t meta[4] = {filters[i].capacity, filters[i].count, filters[i].hashes, filters[i].bits.size()};
+            ok = fwrite(meta, sizeof(meta), 1, f) == 1 &&
+                 fwrite(&filters[i].bits[0], sizeof(uint64_t), filters[i].bits.size(), f) == filters[i].bits.size();
+        }
+
+        return fclose(f) == 0 && ok;
+    }
+public:
+    IX_Bloom(const char *_path)
+        : path(_path)
+    {
+        valid = load() && save(false);
+    }
+
+    ~IX_Bloom()
+    {
+        if (valid && !save(true))
+            fprintf(stderr, "Can't write the filter %s\n", path.c_str());
+    }
+
+    /* false if the file was missing or left behind by a crash, then the
+     * filter holds nothing until the index is built */
+    bool Valid() const
+    {
+        return valid;
+    }
+
+    /* forget every key, before the index is built */
+    void Clear()
+    {
+        filters.clear();
+        valid = true;
+    }
+
+    void Add(Type *data)
+    {
+        if (filters.empty() || filters.back().count >= filters.back().capacity)
+            filters.push_back(filter((uint64_t)IX_BLOOM_FIRST << filters.size(), IX_BLOOM_BITS + 2 * filters.size()));
+
+        filters.back().add(hash(data));
+    }
+
+    /* false only for a key that was never added */
+    bool MayContain(Type *data) const
+    {
+        if (!valid)return true;
+
+        uint64_t h = hash(data);
+
+        for (size_t i = 0; i < filters.size(); i++)
+            if (filters[i].has(h))return true;
+
+        return false;
+    }
+};
+
+/* a build that also fills the filter anew with every key it is given */
+class IX_BloomBuild : public IX_Build
+{
+private:
+    IX_Build *build;
+    IX_Bloom *bloom;
+public:
+    IX_BloomBuild(IX_Build *_build, IX_Bloom *_bloom)
+        : build(_build), bloom(_bloom)
+    {
+        bloom->Clear();
+    }
+    ~IX_BloomBuild()
+    {
+        delete build;
+    }
+
+    RC Add(const std::vector<Type *> &key, const RID &rid)
+    {
+        bloom->Add(key[0]);
+        return build->Add(key, rid);
+    }
+
+    RC Finish()
+    {
+        return build->Finish();
+    }
+};
+
+#endif
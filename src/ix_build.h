@@ -0,0 +1,335 @@
+#ifndef IX_BUILD_H
+#define IX_BUILD_H
+
+#include "type.h"
+#include "rc.h"
+#include "bptree.h"
+#include "bptree_str.h"
+#include "hash_index.h"
+#include "lsm_tree.h"
+#include <algorithm>
+#include <cstdio>
+#include <queue>
+#include <string>
+#include <vector>
+
+/* memory an index build may hold before it spills a sorted run to disk */
+#ifndef IX_SORT_BUDGET
+#define IX_SORT_BUDGET (32 << 20)
+#endif
+/* default share of each node filled by a bottom-up build */
+#define IX_FILL_FACTOR 0.9
+
+/* how a sorted run stores an entry: fixed size entries as they are,
+ * strings with their length in front */
+template<class T>
+inline bool ix_save(FILE *f, const T &value)
+{
+    return fwrite(&value, sizeof(T), 1, f) == 1;
+}
+template<class T>
+inline bool ix_load(FILE *f, T &value)
+{
+    return fread(&value, sizeof(T), 1, f) == 1;
+}
+template<class T>
+inline size_t ix_bytes(const T &)
+{
+    return sizeof(T);
+}
+inline bool ix_save(FILE *f, const std::string &value)
+{
+    size_t n = value.size();
+    return fwrite(&n, sizeof(n), 1, f) == 1 && fwrite(value.data(), 1, n, f) == n;
+}
+inline bool ix_load(FILE *f, std::string &value)
+{
+    size_t n;
+
+    if (fread(&n, sizeof(n), 1, f) != 1)return false;
+
+    value.resize(n);
+    return fread(&value[0], 1, n, f) == n;
+}
+inline size_t ix_bytes(const std::string &value)
+{
+    return sizeof(value) + value.size();
+}
+
+/* sorts entries within a bounded amount of memory: every full run is
+ * sorted and spilled to a temporary file, then the runs are merged back
+ * in order; small inputs never leave memory */
+template<class T>
+class IX_Sort
+{
+private:
+    struct head
+    {
+        T value;
+        size_t run;
+    };
+    struct greater
+    {
+        bool operator()(const head &a, const head &b) const
+        {
+            return b.value < a.value;
+        }
+    };
+
+    std::vector<T> buffer;
+    std::vector<FILE *> runs;
+    std::priority_queue<head, std::vector<head>, greater> heap;
+    size_t budget, used, count, pos;
+
+    RC spill()
+    {
+        std::sort(buffer.begin(), buffer.end());
+        FILE *f = tmpfile();
+        bool ok = f != NULL;
+
+        for (size_t i = 0; ok && i < buffer.size(); i++)
+            ok = ix_save(f, buffer[i]);
+
+        if (!ok)
+        {
+            fprintf(stderr, "Can't spill index entries to a temporary file\n");
+
+            if (f)fclose(f);
+
+            return Error;
+        }
+
+        rewind(f);
+        runs.push_back(f);
+        buffer.clear();
+        used = 0;
+        return Success;
+    }
+    void pull(size_t run)
+    {
+        head h;
+        h.run = run;
+
+        if (ix_load(runs[run], h.value))heap.push(h);
+    }
+public:
+    IX_Sort(size_t _budget = IX_SORT_BUDGET)
+        : budget(_budget), used(0), count(0), pos(0)
+    {
+    }
+    ~IX_Sort()
+    {
+        for (auto f : runs)
+            fclose(f);
+    }
+
+    RC Add(const T &value)
+    {
+        buffer.push_back(value);
+        count++;
+        used += ix_bytes(value);
+
+        if (used >= budget)return spill();
+
+        return Success;
+    }
+
+    size_t Size() const
+    {
+        return count;
+    }
+
+    /* sort what is left, after this only Next may be called */
+    RC Finish()
+    {
+        if (runs.empty())
+        {
+            std::sort(buffer.begin(), buffer.end());
+            return Success;
+        }
+
+        if (!buffer.empty() && spill() != Success)return Error;
+
+        std::vector<T>().swap(buffer);
+
+        for (size_t i = 0; i < runs.size(); i++)
+            pull(i);
+
+        return Success;
+    }
+
+    /* entries in ascending order, false once all were returned */
+    bool Next(T &value)
+    {
+        if (runs.empty())
+        {
+            if (pos == buffer.size())return false;
+
+            value = buffer[pos++];
+            return true;
+        }
+
+        if (heap.empty())return false;
+
+        head h = heap.top();
+        heap.pop();
+        value = h.value;
+        pull(h.run);
+        return true;
+    }
+};
+
+/* fills an empty index from a table: entries are added in any order, then
+ * sorted and written bottom-up instead of being inserted one by one */
+class IX_Build
+{
+public:
+    virtual ~IX_Build()
+    {
+    }
+
+    /* the key's columns in index order, a single one unless composite */
+    virtual RC Add(const std::vector<Type *> &key, const RID &rid) = 0;
+
+    /* replace the tree by the added entries, each node filled to the fill factor */
+    virtual RC Finish() = 0;
+};
+
+template<class K, class tree_t = bptree::bplus_tree<bptree::rid_key<K>, RID> >
+class IX_TreeBuild : public IX_Build
+{
+private:
+    typedef bptree::rid_key<K> key_t;
+
+    tree_t *tree;
+    double fill;
+    IX_Sort<key_t> sorter;
+public:
+    IX_TreeBuild(tree_t *_tree, double _fill)
+        : tree(_tree), fill(_fill)
+    {
+    }
+
+    RC Add(const std::vector<Type *> &key, const RID &rid)
+    {
+        return sorter.Add(key_t(bptree::key_of<K>::get(key[0]), rid));
+    }
+
+    RC Finish()
+    {
+        if (sorter.Finish() != Success)return Error;
+
+        tree->build([this](typename tree_t::record_t &record)
+        {
+            if (!sorter.Next(record.key))return false;
+
+            record.value = record.key.rid;
+            return true;
+        }, sorter.Size(), fill);
+        return Success;
+    }
+};
+
+/* a hash index has no order to build in, entries go straight in */
+class IX_HashBuild : public IX_Build
+{
+private:
+    hashidx::linear_hash *table;
+public:
+    IX_HashBuild(hashidx::linear_hash *_table)
+        : table(_table)
+    {
+        table->clear();
+    }
+
+    RC Add(const std::vector<Type *> &key, const RID &rid)
+    {
+        std::string s;
+        bptree::tuple_codec::put_type(s, key[0]);
+        table->insert(s, rid);
+        return Success;
+    }
+
+    RC Finish()
+    {
+        return Success;
+    }
+};
+
+/* an LSM index sorts its entries as a composite one does and writes
+ * them out as its only run */
+class IX_LsmBuild : public IX_Build
+{
+private:
+    lsmidx::lsm_tree *tree;
+    IX_Sort<std::string> sorter;
+public:
+    IX_LsmBuild(lsmidx::lsm_tree *_tree)
+        : tree(_tree)
+    {
+    }
+
+    RC Add(const std::vector<Type *> &key, const RID &rid)
+    {
+        std::string s;
+        bptree::tuple_codec::put_type(s, key[0]);
+        bptree::tuple_codec::put_rid(s, rid);
+        return sorter.Add(s);
+    }
+
+    RC Finish()
+    {
+        if (sorter.Finish() != Success)return Error;
+
+        return tree->build([&](std::string & entry)
+        {
+            return sorter.Next(entry);
+        }) ? Success : Error;
+    }
+};
+
+/* a composite index sorts its encoded entries, whose byte order is the
+ * order of the column values one after another */
+class IX_TupleBuild : public IX_Build
+{
+private:
+    typedef bptree::tuple_codec codec;
+
+    bptree::tuple_tree *tree;
+    double fill;
+    IX_Sort<std::string> sorter;
+public:
+    IX_TupleBuild(bptree::tuple_tree *_tree, double _fill)
+        : tree(_tree), fill(_fill)
+    {
+    }
+
+    RC Add(const std::vector<Type *> &key, const RID &rid)
+    {
+        std::string s;
+
+        for (auto data : key)
+            codec::put_type(s, data);
+
+        codec::put_rid(s, rid);
+        return sorter.Add(s);
+    }
+
+    RC Finish()
+    {
+        if (sorter.Finish() != Success)return Error;
+
+        std::string s;
+        tree->build([&](bptree::tuple_tree::record_t &record)
+        {
+            if (!sorter.Next(s))return false;
+
+            record.key = codec::decode(s);
+            record.value = record.key.rid;
+            return true;
+        }, sorter.Size(), fill);
+        return Success;
+    }
+};
+
+#endif
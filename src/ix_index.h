@@ -0,0 +1,580 @@
+#ifndef IX_INDEX_H
+#define IX_INDEX_H
+
+#include "type.h"
+#include "rc.h"
+#include <bufmanager/BufPageManager.h>
+#include <fileio/FileManager.h>
+#include "bptree.h"
+#include "bptree_str.h"
+#include "hash_index.h"
+#include "lsm_tree.h"
+#include "ix_scan.h"
+#include "ix_build.h"
+#include "rm_keyfile.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/* how the entries of a single column index are kept */
+enum IX_Kind
+{
+    IX_BTREE,
+    IX_HASH,
+    IX_LSM
+};
+
+/* one open index file, whatever structure and key type it has. the
+ * implementation is picked once when the file is opened, so every call
+ * after that is a single virtual call into code made for its key */
+class IX_Index
+{
+public:
+    virtual ~IX_Index()
+    {
+    }
+
+    /* true if the file was created empty and must be filled from the table */
+    virtual bool NeedsBuild() const = 0;
+
+    virtual IX_Kind Kind() const
+    {
+        return IX_BTREE;
+    }
+
+    /* false for an index whose ranges are found by reading it all */
+    virtual bool Ordered() const
+    {
+        return true;
+    }
+
+    /* true if freed pages outnumber live ones */
+    virtual bool Fragmented() const = 0;
+
+    /* rewrite the index as a compact copy */
+    virtual RC Rebuild(double fill) = 0;
+
+    /* bottom-up load replacing the whole index */
+    virtual IX_Build *OpenBuild(double fill) = 0;
+
+    virtual RC InsertEntry(Type *data, const RID &rid) = 0;
+    virtual RC DeleteEntry(Type *data, const RID &rid) = 0;
+    virtual std::vector<RID> SearchEntry(Type *data) = 0;
+    virtual IX_Scan *OpenScan(Type *left, bool left_open, Type *right, bool right_open, bool reverse) = 0;
+
+    /* entries of a composite index, which only IX_TupleIndex has */
+    virtual RC InsertEntry(const std::vector<Type *> &, const RID &)
+    {
+        return Error;
+    }
+    virtual RC DeleteEntry(const std::vector<Type *> &, const RID &)
+    {
+        return Error;
+    }
+    virtual IX_TupleScan *OpenTupleScan(const std::string &, const std::string &)
+    {
+        return NULL;
+    }
+
+    /* the index of a column of the given type and kind; width is the
+     * length of a CHAR column, 0 for any other */
+    static IX_Index *Open(FileManager *fm, BufPageManager *bpm, const char *filename, Type *type, IX_Kind kind, int width);
+
+    /* a composite index, its keys are the columns one after another */
+    static IX_Index *OpenTuple(FileManager *fm, BufPageManager *bpm, const char *filename);
+
+protected:
+    template<class T>
+    static bool fragmented(const T *tree)
+    {
+        typename T::meta_t meta = tree->get_meta();
+        return meta.free_node_num >= 16 &&
+               meta.free_node_num > meta.leaf_node_num + meta.internal_node_num;
+    }
+};
+
+/* a B+ tree of (key, rid) entries, so duplicates of a key are adjacent
+ * in the leafs; K is the key kept for a column value, see bptree::key_of */
+template<class K, class tree_t = bptree::bplus_tree<bptree::rid_key<K>, RID> >
+class IX_TreeIndex : public IX_Index
+{
+private:
+    typedef bptree::rid_key<K> key_t;
+    typedef bptree::key_of<K> key_of;
+
+    tree_t *tree;
+    bool empty;
+public:
+    IX_TreeIndex(FileManager *fm, BufPageManager *bpm, const char *filename)
+    {
+        tree = new tree_t(fm, bpm, filename);
+        empty = tree->initialized_empty();
+    }
+    ~IX_TreeIndex()
+    {
+        delete tree;
+    }
+
+    bool NeedsBuild() const
+    {
+        return empty;
+    }
+
+    bool Fragmented() const
+    {
+        return fragmented(tree);
+    }
+
+    RC Rebuild(double fill)
+    {
+        tree->rebuild(fill);
+        return Success;
+    }
+
+    IX_Build *OpenBuild(double fill)
+    {
+        return new IX_TreeBuild<K, tree_t>(tree, fill);
+    }
+
+    RC InsertEntry(Type *data, const RID &rid)
+    {
+        if (key_of::truncated(data) || tree->insert(key_t(key_of::get(data), rid), rid) != 0)return Error;
+
+        return Success;
+    }
+
+    RC DeleteEntry(Type *data, const RID &rid)
+    {
+        if (key_of::truncated(data) || tree->remove(key_t(key_of::get(data), rid)) != 0)return Error;
+
+        return Success;
+    }
+
+    std::vector<RID> SearchEntry(Type *data)
+    {
+        if (key_of::truncated(data))return std::vector<RID>();
+
+        K k = key_of::get(data);
+        return tree->search_range(key_t::lowest(k), key_t::highest(k));
+    }
+
+    IX_Scan *OpenScan(Type *left, bool left_open, Type *right, bool right_open, bool reverse)
+    {
+        // a bound longer than the keys lies just above its truncation
+        if (left && key_of::truncated(left))left_open = true;
+
+        if (right && key_of::truncated(right))right_open = false;
+
+        return new IX_TreeScan<K, tree_t>(tree, left, left_open, right, right_open, reverse);
+    }
+};
+
+/* a composite index over several columns */
+class IX_TupleIndex : public IX_Index
+{
+private:
+    bptree::tuple_tree *tree;
+    bool empty;
+
+    static bptree::tuple_key tuple(const std::vector<Type *> &key, const RID &rid)
+    {
+        std::string s;
+
+        for (auto data : key)
+            bptree::tuple_codec::put_type(s, data);
+
+        return bptree::tuple_key(s, rid);
+    }
+public:
+    IX_TupleIndex(FileManager *fm, BufPageManager *bpm, const char *filename)
+    {
+        tree = new bptree::tuple_tree(fm, bpm, filename);
+        empty = tree->initialized_empty();
+    }
+    ~IX_TupleIndex()
+    {
+        delete tree;
+    }
+
+    bool NeedsBuild() const
+    {
+        return empty;
+    }
+
+    bool Fragmented() const
+    {
+        return fragmented(tree);
+    }
+
+    RC Rebuild(double fill)
+    {
+        tree->rebuild(fill);
+        return Success;
+    }
+
+    IX_Build *OpenBuild(double fill)
+    {
+        return new IX_TupleBuild(tree, fill);
+    }
+
+    /* a single column is no composite key */
+    RC InsertEntry(Type *, const RID &)
+    {
+        return Error;
+    }
+
+    RC DeleteEntry(Type *, const RID &)
+    {
+        return Error;
+    }
+
+    std::vector<RID> SearchEntry(Type *)
+    {
+        return std::vector<RID>();
+    }
+
+    IX_Scan *OpenScan(Type *, bool, Type *, bool, bool)
+    {
+        return NULL;
+    }
+
+    RC InsertEntry(const std::vector<Type *> &key, const RID &rid)
+    {
+        if (tree->insert(tuple(key, rid), rid) != 0)return Error;
+
+        return Success;
+    }
+
+    RC DeleteEntry(const std::vector<Type *> &key, const RID &rid)
+    {
+        if (tree->remove(tuple(key, rid)) != 0)return Error;
+
+        return Success;
+    }
+
+    IX_TupleScan *OpenTupleScan(const std::string &low, const std::string &high)
+    {
+        return new IX_TupleScan(tree, low, high);
+    }
+};
+
+/* a hash index, equality lookups only */
+class IX_HashIndex : public IX_Index
+{
+private:
+    hashidx::linear_hash *table;
+    bool empty;
+
+    static std::string key(Type *data)
+    {
+        std::string s;
+        bptree::tuple_codec::put_type(s, data);
+        return s;
+    }
+public:
+    IX_HashIndex(FileManager *fm, BufPageManager *bpm, const char *filename)
+    {
+        table = new hashidx::linear_hash(fm, bpm, filename);
+        empty = table->initialized_empty();
+    }
+    ~IX_HashIndex()
+    {
+        delete table;
+    }
+
+    bool NeedsBuild() const
+    {
+        return empty;
+    }
+
+    IX_Kind Kind() const
+    {
+        return IX_HASH;
+    }
+
+    bool Ordered() const
+    {
+        return false;
+    }
+
+    bool Fragmented() const
+    {
+        hashidx::linear_hash::meta_t meta = table->get_meta();
+        return meta.free_page_num >= 16 && meta.free_page_num > meta.page_num;
+    }
+
+    RC Rebuild(double)
+    {
+        table->rebuild();
+        return Success;
+    }
+
+    IX_Build *OpenBuild(double)
+    {
+        return new IX_HashBuild(table);
+    }
+
+    RC InsertEntry(Type *data, const RID &rid)
+    {
+        return table->insert(key(data), rid) == 0 ? Success : Error;
+    }
+
+    RC DeleteEntry(Type *data, const RID &rid)
+    {
+        return table->remove(key(data), rid) == 0 ? Success : Error;
+    }
+
+    std::vector<RID> SearchEntry(Type *data)
+    {
+        return table->search(key(data));
+    }
+
+    /* every entry is read and the ones in range are sorted, as encoded
+     * keys order like the values */
+    IX_Scan *OpenScan(Type *left, bool left_open, Type *right, bool right_open, bool reverse)
+    {
+        std::string low, high = "\1";
+        std::vector<std::string> entries;
+
+        if (left)low = key(left) + (left_open ? "\xff" : "");
+
+        if (right)high = key(right) + (right_open ? "" : "\xff");
+
+        table->scan([&](const std::string & entry)
+        {
+            std::string k = entry.substr(0, entry.size() - 8);
+
+            if (!(k < low) && k < high)entries.push_back(entry);
+        });
+
+        std::sort(entries.begin(), entries.end());
+
+        if (reverse)std::reverse(entries.begin(), entries.end());
+
+        std::vector<RID> rids;
+
+        for (auto entry : entries)
+            rids.push_back(bptree::entry_codec::rid_of(entry));
+
+        return new IX_VectorScan(rids);
+    }
+};
+
+/* an index that takes inserts and deletes into a buffer in memory and
+ * writes them out in sorted runs, merged in the background, so a table
+ * filled with many rows spends little on the index; a lookup reads the
+ * buffer and a block of every run. entries are encoded as in the hash
+ * index. an insert or delete is not checked against the entries there
+ * are, as that would cost the lookup it saves */
+class IX_LsmIndex : public IX_Index
+{
+private:
+    lsmidx::lsm_tree *tree;
+
+    static std::string key(Type *data)
+    {
+        std::string s;
+        bptree::tuple_codec::put_type(s, data);
+        return s;
+    }
+public:
+    IX_LsmIndex(const char *path)
+    {
+        tree = new lsmidx::lsm_tree(path);
+    }
+    ~IX_LsmIndex()
+    {
+        delete tree;
+    }
+
+    IX_Kind Kind() const
+    {
+        return IX_LSM;
+    }
+
+    bool NeedsBuild() const
+    {
+        return tree->initialized_empty();
+    }
+
+    /* true if deletions not merged away outnumber the entries */
+    bool Fragmented() const
+    {
+        lsmidx::lsm_tree::meta_t meta = tree->get_meta();
+        return meta.dead_num >= 1024 && meta.dead_num > meta.live_num;
+    }
+
+    RC Rebuild(double)
+    {
+        return tree->rebuild() ? Success : Error;
+    }
+
+    IX_Build *OpenBuild(double)
+    {
+        return new IX_LsmBuild(tree);
+    }
+
+    RC InsertEntry(Type *data, const RID &rid)
+    {
+        tree->insert(key(data), rid);
+        return Success;
+    }
+
+    RC DeleteEntry(Type *data, const RID &rid)
+    {
+        tree->remove(key(data), rid);
+        return Success;
+    }
+
+    std::vector<RID> SearchEntry(Type *data)
+    {
+        return tree->search(key(data));
+    }
+
+    /* bounds as in the hash index; runs are read forward only, so a
+     * backward scan gathers the range first */
+    IX_Scan *OpenScan(Type *left, bool left_open, Type *right, bool right_open, bool reverse)
+    {
+        std::string low, high = "\1";
+
+        if (left)low = key(left) + (left_open ? "\xff" : "");
+
+        if (right)high = key(right) + (right_open ? "" : "\xff");
+
+        if (!reverse)return new IX_LsmScan(tree->find(low, high));
+
+        IX_LsmScan scan(tree->find(low, high));
+        std::vector<RID> rids;
+        RID rid;
+
+        while (scan.Next(rid))
+            rids.push_back(rid);
+
+        std::reverse(rids.begin(), rids.end());
+        return new IX_VectorScan(rids);
+    }
+};
+
+/* the primary key of an index-organized table, whose entries are the rows
+ * themselves: a row is found by its key and a range is read in key order,
+ * and as rows come and go with their entries there is nothing to maintain */
+class IX_KeyIndex : public IX_Index
+{
+private:
+    RM_KeyFile *rows;
+
+    static std::string key(Type *data)
+    {
+        std::string s;
+        bptree::tuple_codec::put_type(s, data);
+        return s;
+    }
+public:
+    IX_KeyIndex(RM_KeyFile *_rows)
+        : rows(_rows)
+    {
+    }
+
+    bool NeedsBuild() const
+    {
+        return false;
+    }
+
+    bool Fragmented() const
+    {
+        return fragmented(rows->Tree());
+    }
+
+    RC Rebuild(double fill)
+    {
+        rows->Rebuild(fill);
+        return Success;
+    }
+
+    IX_Build *OpenBuild(double)
+    {
+        return NULL;
+    }
+
+    RC InsertEntry(Type *, const RID &)
+    {
+        return Success;
+    }
+
+    RC DeleteEntry(Type *, const RID &)
+    {
+        return Success;
+    }
+
+    std::vector<RID> SearchEntry(Type *data)
+    {
+        std::vector<RID> rids;
+
+        if (data->null)return rids;
+
+        std::string k = key(data);
+        auto c = rows->Tree()->lower_bound(bptree::tuple_key(k, RID(INT_MIN, INT_MIN)));
+
+        if (c.valid() && c.key().key.compare(0, k.size(), k) == 0)rids.push_back(c.value());
+
+        return rids;
+    }
+
+    /* an entry is its key's bytes followed by the rest of the row, which
+     * sort below "\xff" */
+    IX_Scan *OpenScan(Type *left, bool left_open, Type *right, bool right_open, bool reverse)
+    {
+        std::string low, high = "\1";
+
+        if (left)low = key(left) + (left_open ? "\xff" : "");
+
+        if (right)high = key(right) + (right_open ? "" : "\xff");
+
+        return new IX_TupleScan(rows->Tree(), low, high, reverse);
+    }
+};
+
+/* CHAR columns of up to 32 bytes keep their bytes in the key, compared
+ * with memcmp; wider strings and VARCHAR go through bptree::string_tree */
+IX_Index *IX_Index::Open(FileManager *fm, BufPageManager *bpm, const char *filename, Type *type, IX_Kind kind, int width)
+{
+    if (kind == IX_HASH)return new IX_HashIndex(fm, bpm, filename);
+
+    if (kind == IX_LSM)return new IX_LsmIndex(filename);
+
+    if (dynamic_cast<Type_int *>(type) != NULL)
+        return new IX_TreeIndex<Type_int>(fm, bpm, filename);
+
+    if (dynamic_cast<Type_bigint *>(type) != NULL)
+        return new IX_TreeIndex<bptree::int64_key>(fm, bpm, filename);
+
+    if (type->isStr() && width > 0 && width <= 8)
+        return new IX_TreeIndex<bptree::char_key<8> >(fm, bpm, filename);
+
+    if (type->isStr() && width > 0 && width <= 16)
+        return new IX_TreeIndex<bptree::char_key<16> >(fm, bpm, filename);
+
+    if (type->isStr() && width > 0 && width <= 32)
+        return new IX_TreeIndex<bptree::char_key<32> >(fm, bpm, filename);
+
+    if (dynamic_cast<Type_varchar<32>*>(type) != NULL)
+        return new IX_TreeIndex<Type_varchar<32>, bptree::string_tree<32> >(fm, bpm, filename);
+
+    if (dynamic_cast<Type_varchar<64>*>(type) != NULL)
+        return new IX_TreeIndex<Type_varchar<64>, bptree::string_tree<64> >(fm, bpm, filename);
+
+    if (dynamic_cast<Type_varchar<128>*>(type) != NULL)
+        return new IX_TreeIndex<Type_varchar<128>, bptree::string_tree<128> >(fm, bpm, filename);
+
+    if (dynamic_cast<Type_varchar<256>*>(type) != NULL)
+        return new IX_TreeIndex<Type_varchar<256>, bptree::string_tree<256> >(fm, bpm, filename);
+
+    return NULL;
+}
+
+IX_Index *IX_Index::OpenTuple(FileManager *fm, BufPageManager *bpm, const char *filename)
+{
+    return new IX_TupleIndex(fm, bpm, filename);
+}
+
+#endif
@@ -3,483 +3,165 @@
 
 #include "type.h"
 #include "rc.h"
-#include "bptree.h"
-#include <algorithm>
-#include <fstream>
+#include <bufmanager/BufPageManager.h>
+#include <fileio/FileManager.h>
+#include "ix_index.h"
+#include "ix_bloom.h"
 #include <string>
+#include <vector>
 
 class IX_Manager
 {
 private:
-    bool fexists(const char *filename)
-    {
-        std::ifstream ifile(filename);
-        return (bool)ifile;
-    }
-    bptree::bplus_tree<Type_int, RID> *bptree_int;
-    bptree::bplus_tree<Type_varchar<32>, RID> *bptree_str_32;
-    bptree::bplus_tree<Type_varchar<64>, RID> *bptree_str_64;
-    bptree::bplus_tree<Type_varchar<128>, RID> *bptree_str_128;
-    bptree::bplus_tree<Type_varchar<256>, RID> *bptree_str_256;
-    bptree::bplus_tree<RID, std::pair<RID, RID> > *bptree_rid;
+    /* the implementation for the key type, chosen when the file is opened */
+    IX_Index *index;
+    /* the keys of the index, to answer for missing ones without it */
+    IX_Bloom *bloom;
 public:
-    IX_Manager (const char *filename, const char *deque_filename, Type *type)
+    /* a B+ tree over the column, or an index of another kind; width is the
+     * length of a CHAR column, whose short keys are stored inline, and a
+     * Bloom filter is kept in the file `filter` if one is given. an LSM
+     * index is a directory named by filename */
+    IX_Manager (FileManager *fm, BufPageManager *bpm, const char *filename, Type *type, IX_Kind kind = IX_BTREE, int width = 0, const char *filter = NULL)
     {
-        bptree_int = NULL;
-        bptree_str_32 = NULL;
-        bptree_str_64 = NULL;
-        bptree_str_128 = NULL;
-        bptree_str_256 = NULL;
-        bptree_rid = NULL;
-
-        if (dynamic_cast<Type_int *>(type) != NULL)
-        {
-            bptree_int = new bptree::bplus_tree<Type_int, RID>(filename, !fexists(filename));
-        }
-
-        if (dynamic_cast<Type_varchar<32>*>(type) != NULL)
-        {
-            bptree_str_32 = new bptree::bplus_tree<Type_varchar<32>, RID>(filename, !fexists(filename));
-        }
-
-        if (dynamic_cast<Type_varchar<64>*>(type) != NULL)
-        {
-            bptree_str_64 = new bptree::bplus_tree<Type_varchar<64>, RID>(filename, !fexists(filename));
-        }
-
-        if (dynamic_cast<Type_varchar<128>*>(type) != NULL)
-        {
-            bptree_str_128 = new bptree::bplus_tree<Type_varchar<128>, RID>(filename, !fexists(filename));
-        }
+        index = IX_Index::Open(fm, bpm, filename, type, kind, width);
+        bloom = filter ? new IX_Bloom(filter) : NULL;
+    }
 
-        if (dynamic_cast<Type_varchar<256>*>(type) != NULL)
-        {
-            bptree_str_256 = new bptree::bplus_tree<Type_varchar<256>, RID>(filename, !fexists(filename));
-        }
+    /* a composite index, its keys are the columns one after another */
+    IX_Manager (FileManager *fm, BufPageManager *bpm, const char *filename)
+    {
+        index = IX_Index::OpenTuple(fm, bpm, filename);
+        bloom = NULL;
+    }
 
-        if (deque_filename)
-        {
-            bptree_rid = new bptree::bplus_tree<RID, std::pair<RID, RID> >(deque_filename, !fexists(deque_filename));
-        }
+    /* the primary key of an index-organized table, read from its rows */
+    IX_Manager (RM_KeyFile *rows)
+    {
+        index = new IX_KeyIndex(rows);
+        bloom = NULL;
     }
 
     ~IX_Manager ()
     {
-        if (bptree_int)delete bptree_int;
-
-        if (bptree_str_32)delete bptree_str_32;
-
-        if (bptree_str_64)delete bptree_str_64;
+        delete index;
 
-        if (bptree_str_128)delete bptree_str_128;
-
-        if (bptree_str_256)delete bptree_str_256;
-
-        if (bptree_rid)delete bptree_rid;
+        if (bloom)delete bloom;
     }
 
-    RC InsertEntry (Type *data, const RID &rid)
+    /* true if the index file was created empty and must be filled from the
+     * table, or its filter can't be trusted */
+    bool NeedsBuild () const
     {
-        if (bptree_int)
-        {
-            bptree_int->insert(*(Type_int *)data, rid);
-            RID first;
-            bptree_int->search(*(Type_int *)data, &first);
-
-            if (first == RID())
-            {
-                bptree_int->update(*(Type_int *)data, rid);
-
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
-
-                return Success;
-            }
-            else if (first == rid)
-            {
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
-
-                return Success;
-            }
-            else
-            {
-                if (!bptree_rid)return Error;
-
-                std::pair<RID, RID> link;
-                bptree_rid->search(first, &link);
-                link.first = rid;
-                bptree_rid->update(first, link);
-                bptree_rid->insert(rid, std::make_pair(RID(), first));
-                bptree_rid->update(rid, std::make_pair(RID(), first));
-                bptree_int->update(*(Type_int *)data, rid);
-            }
-        }
-
-        if (bptree_str_32)
-        {
-            bptree_str_32->insert(*(Type_varchar<32> *)data, rid);
-            RID first;
-            bptree_str_32->search(*(Type_varchar<32> *)data, &first);
-
-            if (first == RID())
-            {
-                bptree_str_32->update(*(Type_varchar<32> *)data, rid);
-
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
-
-                return Success;
-            }
-            else if (first == rid)
-            {
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
-
-                return Success;
-            }
-            else
-            {
-                if (!bptree_rid)return Error;
-
-                std::pair<RID, RID> link;
-                bptree_rid->search(first, &link);
-                link.first = rid;
-                bptree_rid->update(first, link);
-                bptree_rid->insert(rid, std::make_pair(RID(), first));
-                bptree_rid->update(rid, std::make_pair(RID(), first));
-                bptree_str_32->update(*(Type_varchar<32> *)data, rid);
-            }
-        }
-
-
-        if (bptree_str_64)
-        {
-            bptree_str_64->insert(*(Type_varchar<64> *)data, rid);
-            RID first;
-            bptree_str_64->search(*(Type_varchar<64> *)data, &first);
-
-            if (first == RID())
-            {
-                bptree_str_64->update(*(Type_varchar<64> *)data, rid);
-
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
-
-                return Success;
-            }
-            else if (first == rid)
-            {
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
-
-                return Success;
-            }
-            else
-            {
-                if (!bptree_rid)return Error;
-
-                std::pair<RID, RID> link;
-                bptree_rid->search(first, &link);
-                link.first = rid;
-                bptree_rid->update(first, link);
-                bptree_rid->insert(rid, std::make_pair(RID(), first));
-                bptree_rid->update(rid, std::make_pair(RID(), first));
-                bptree_str_64->update(*(Type_varchar<64> *)data, rid);
-            }
-        }
-
-        if (bptree_str_128)
-        {
-            bptree_str_128->insert(*(Type_varchar<128> *)data, rid);
-            RID first;
-            bptree_str_128->search(*(Type_varchar<128> *)data, &first);
-
-            if (first == RID())
-            {
-                bptree_str_128->update(*(Type_varchar<128> *)data, rid);
-
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
+        return index && (index->NeedsBuild() || (bloom && !bloom->Valid()));
+    }
 
-                return Success;
-            }
-            else if (first == rid)
-            {
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
+    /* true if the index has a Bloom filter */
+    bool Filtered () const
+    {
+        return bloom != NULL;
+    }
 
-                return Success;
-            }
-            else
-            {
-                if (!bptree_rid)return Error;
+    IX_Kind Kind () const
+    {
+        return index ? index->Kind() : IX_BTREE;
+    }
 
-                std::pair<RID, RID> link;
-                bptree_rid->search(first, &link);
-                link.first = rid;
-                bptree_rid->update(first, link);
-                bptree_rid->insert(rid, std::make_pair(RID(), first));
-                bptree_rid->update(rid, std::make_pair(RID(), first));
-                bptree_str_128->update(*(Type_varchar<128> *)data, rid);
-            }
-        }
+    /* false for a hash index, whose ranges are found by reading it all */
+    bool Ordered () const
+    {
+        return !index || index->Ordered();
+    }
 
-        if (bptree_str_256)
-        {
-            bptree_str_256->insert(*(Type_varchar<256> *)data, rid);
-            RID first;
-            bptree_str_256->search(*(Type_varchar<256> *)data, &first);
+    /* true if freed nodes outnumber live ones */
+    bool Fragmented () const
+    {
+        return index && index->Fragmented();
+    }
 
-            if (first == RID())
-            {
-                bptree_str_256->update(*(Type_varchar<256> *)data, rid);
+    /* rewrite the tree as a compact copy with leafs in key order */
+    RC Rebuild (double fill = IX_FILL_FACTOR)
+    {
+        return index ? index->Rebuild(fill) : Success;
+    }
 
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
+    /* bottom-up load replacing the whole tree, the caller adds every entry,
+     * calls Finish and deletes the build */
+    IX_Build *OpenBuild (double fill = IX_FILL_FACTOR)
+    {
+        IX_Build *build = index ? index->OpenBuild(fill) : NULL;
 
-                return Success;
-            }
-            else if (first == rid)
-            {
-                if (bptree_rid)bptree_rid->insert(rid, std::make_pair(RID(), RID()));
+        if (build && bloom)build = new IX_BloomBuild(build, bloom);
 
-                return Success;
-            }
-            else
-            {
-                if (!bptree_rid)return Error;
+        return build;
+    }
 
-                std::pair<RID, RID> link;
-                bptree_rid->search(first, &link);
-                link.first = rid;
-                bptree_rid->update(first, link);
-                bptree_rid->insert(rid, std::make_pair(RID(), first));
-                bptree_rid->update(rid, std::make_pair(RID(), first));
-                bptree_str_256->update(*(Type_varchar<256> *)data, rid);
-            }
-        }
+    RC InsertEntry (Type *data, const RID &rid)
+    {
+        if (!index || index->InsertEntry(data, rid) != Success)return Error;
 
+        if (bloom)bloom->Add(data);
 
         return Success;
     }
 
     RC DeleteEntry (Type *data, const RID &rid)
     {
-        if (bptree_int)
-        {
-            if (bptree_rid)
-            {
-                std::pair<RID, RID> link, next, pre;
-
-                if (bptree_rid->search(rid, &link) != 0)return Error;
-
-                if (link.first == RID())bptree_int->update(*(Type_int *)data, link.second);
-
-                if (link.second != RID())
-                {
-                    bptree_rid->search(link.second, &next);
-                    bptree_rid->update(link.second, make_pair(link.first, next.second));
-                }
-
-                if (link.first != RID())
-                {
-                    bptree_rid->search(link.first, &pre);
-                    bptree_rid->update(link.first, make_pair(pre.first, link.second));
-                }
-            }
-            else
-            {
-                if (bptree_int->update(*(Type_int *)data, RID()) != 0)return Error;
-            }
-        }
-
-        if (bptree_str_32)
-        {
-            if (bptree_rid)
-            {
-                std::pair<RID, RID> link, next, pre;
-
-                if (bptree_rid->search(rid, &link) != 0)return Error;
-
-                if (link.first == RID())bptree_str_32->update(*(Type_varchar<32> *)data, link.second);
-
-                if (link.second != RID())
-                {
-                    bptree_rid->search(link.second, &next);
-                    bptree_rid->update(link.second, make_pair(link.first, next.second));
-                }
-
-                if (link.first != RID())
-                {
-                    bptree_rid->search(link.first, &pre);
-                    bptree_rid->update(link.first, make_pair(pre.first, link.second));
-                }
-            }
-            else
-            {
-                if (bptree_int->update(*(Type_int *)data, RID()) != 0)return Error;
-            }
-        }
-
-
-        if (bptree_str_64)
-        {
-            if (bptree_rid)
-            {
-                std::pair<RID, RID> link, next, pre;
-
-                if (bptree_rid->search(rid, &link) != 0)return Error;
-
-                if (link.first == RID())bptree_str_64->update(*(Type_varchar<64> *)data, link.second);
-
-                if (link.second != RID())
-                {
-                    bptree_rid->search(link.second, &next);
-                    bptree_rid->update(link.second, make_pair(link.first, next.second));
-                }
-
-                if (link.first != RID())
-                {
-                    bptree_rid->search(link.first, &pre);
-                    bptree_rid->update(link.first, make_pair(pre.first, link.second));
-                }
-            }
-            else
-            {
-                if (bptree_int->update(*(Type_int *)data, RID()) != 0)return Error;
-            }
-        }
-
-        if (bptree_str_128)
-        {
-            if (bptree_rid)
-            {
-                std::pair<RID, RID> link, next, pre;
-
-                if (bptree_rid->search(rid, &link) != 0)return Error;
-
-                if (link.first == RID())bptree_str_128->update(*(Type_varchar<128> *)data, link.second);
-
-                if (link.second != RID())
-                {
-                    bptree_rid->search(link.second, &next);
-                    bptree_rid->update(link.second, make_pair(link.first, next.second));
-                }
-
-                if (link.first != RID())
-                {
-                    bptree_rid->search(link.first, &pre);
-                    bptree_rid->update(link.first, make_pair(pre.first, link.second));
-                }
-            }
-            else
-            {
-                if (bptree_int->update(*(Type_int *)data, RID()) != 0)return Error;
-            }
-        }
-
-        if (bptree_str_256)
-        {
-            if (bptree_rid)
-            {
-                std::pair<RID, RID> link, next, pre;
-
-                if (bptree_rid->search(rid, &link) != 0)return Error;
+        return index ? index->DeleteEntry(data, rid) : Error;
+    }
 
-                if (link.first == RID())bptree_str_256->update(*(Type_varchar<256> *)data, link.second);
+    /* the key of every column of a composite index, in index order */
+    RC InsertEntry (const std::vector<Type *> &key, const RID &rid)
+    {
+        if (key.size() == 1)return InsertEntry(key[0], rid);
 
-                if (link.second != RID())
-                {
-                    bptree_rid->search(link.second, &next);
-                    bptree_rid->update(link.second, make_pair(link.first, next.second));
-                }
+        return index ? index->InsertEntry(key, rid) : Error;
+    }
 
-                if (link.first != RID())
-                {
-                    bptree_rid->search(link.first, &pre);
-                    bptree_rid->update(link.first, make_pair(pre.first, link.second));
-                }
-            }
-            else
-            {
-                if (bptree_int->update(*(Type_int *)data, RID()) != 0)return Error;
-            }
-        }
+    RC DeleteEntry (const std::vector<Type *> &key, const RID &rid)
+    {
+        if (key.size() == 1)return DeleteEntry(key[0], rid);
 
-        return Success;
+        return index ? index->DeleteEntry(key, rid) : Error;
     }
 
+    /* all rids of the key, read from contiguous leaf entries, none without
+     * reading the index if the filter doesn't hold the key */
     std::vector<RID> SearchEntry (Type *data)
     {
-        std::vector<RID> ans;
-        ans.clear();
-        RID first;
-        std::pair<RID, RID> t;
-
-        if (bptree_int)
-        {
-            if (bptree_int->search(*(Type_int *)data, &first) != 0)return ans;
-        }
-
-        if (bptree_str_32)
-        {
-            if (bptree_str_32->search(*(Type_varchar<32> *)data, &first) != 0)return ans;
-        }
-
-        if (bptree_str_64)
-        {
-            if (bptree_str_64->search(*(Type_varchar<64> *)data, &first) != 0)return ans;
-        }
-
-        if (bptree_str_128)
-        {
-            if (bptree_str_128->search(*(Type_varchar<128> *)data, &first) != 0)return ans;
-        }
-
-        if (bptree_str_256)
-        {
-            if (bptree_str_256->search(*(Type_varchar<256> *)data, &first) != 0)return ans;
-        }
+        if (!index || (bloom && !bloom->MayContain(data)))return std::vector<RID>();
 
-        if (!bptree_rid)
-        {
-            if (first != RID()) ans.push_back(first);
-
-            return ans;
-        }
-
-        for (RID i = first; i != RID(); bptree_rid->search(i, &t), i = t.second)
-        {
-            ans.push_back(i);
-        }
-
-        return ans;
+        return index->SearchEntry(data);
     }
 
-    std::vector<RID> SearchRangeEntry (Type *left, Type *right)
+    /* lazy scan of the keys from left to right in key order, or backward;
+     * a NULL bound is open ended, NULL keys are never returned and the
+     * caller deletes the scan */
+    IX_Scan *OpenScan (Type *left, bool left_open, Type *right, bool right_open, bool reverse = false)
     {
-        std::vector<RID> ans, tmp;
-        ans.clear();
-        std::pair<RID, RID> t;
-
-        if (bptree_int)
-        {
-            tmp = bptree_int->search_range(*(Type_int *)left, *(Type_int *)right);
-        }
-        else
-        {
-            return ans;
-        }
+        return index ? index->OpenScan(left, left_open, right, right_open, reverse) : NULL;
+    }
 
-        if (!bptree_rid)
-        {
-            for (RID rid : tmp)
-                if (rid != RID()) ans.push_back(rid);
+    /* scan of a composite index over the entries whose columns, encoded
+     * by bptree::tuple_codec, are at least low and less than high */
+    IX_TupleScan *OpenTupleScan (const std::string &low, const std::string &high)
+    {
+        return index ? index->OpenTupleScan(low, high) : NULL;
+    }
 
-            return ans;
-        }
+    /* rids of the keys from left to right, bounds as in OpenScan */
+    std::vector<RID> SearchRangeEntry (Type *left, Type *right, bool left_open = false, bool right_open = false)
+    {
+        std::vector<RID> ans;
+        IX_Scan *scan = OpenScan(left, left_open, right, right_open);
+        RID rid;
 
-        for (RID rid : tmp)
-            for (RID i = rid; i != RID(); bptree_rid->search(i, &t), i = t.second)
-            {
-                ans.push_back(i);
-            }
+        while (scan && scan->Next(rid))
+            ans.push_back(rid);
 
+        delete scan;
         return ans;
     }
 };
 
 #endif
-
@@ -0,0 +1,184 @@
+#ifndef IX_SCAN_H
+#define IX_SCAN_H
+
+#include "type.h"
+#include "rc.h"
+#include "bptree.h"
+#include "bptree_str.h"
+#include "lsm_tree.h"
+
+/* streams the rids of an index range in key order, one leaf at a time,
+ * so the caller can stop as soon as it has seen enough */
+class IX_Scan
+{
+public:
+    virtual ~IX_Scan()
+    {
+    }
+
+    /* next rid of the range, false once it is exhausted */
+    virtual bool Next(RID &rid) = 0;
+};
+
+template<class K, class tree_t = bptree::bplus_tree<bptree::rid_key<K>, RID> >
+class IX_TreeScan : public IX_Scan
+{
+private:
+    typedef bptree::rid_key<K> key_t;
+
+    typename tree_t::cursor cursor;
+    key_t low, high;
+    bool has_low, has_high, reverse, started;
+public:
+    /* keys between left and right, each bound open or closed, or no bound
+     * at all if NULL; NULL keys sort last and never fall in a range */
+    IX_TreeScan(tree_t *tree, Type *left, bool left_open, Type *right, bool right_open, bool _reverse)
+        : has_low(left != NULL), has_high(right != NULL), reverse(_reverse), started(false)
+    {
+        // the lowest and highest rids are never stored, so every bound is
+        // strictly between entries and open/closed only picks the side
+        if (left)
+            low = left_open ? key_t::highest(bptree::key_of<K>::get(left)) : key_t::lowest(bptree::key_of<K>::get(left));
+
+        if (right)
+            high = right_open ? key_t::lowest(bptree::key_of<K>::get(right)) : key_t::highest(bptree::key_of<K>::get(right));
+
+        if (!reverse)
+        {
+            cursor = left ? tree->lower_bound(low) : tree->first();
+        }
+        else
+        {
+            if (right)
+            {
+                cursor = tree->lower_bound(high);
+
+                if (cursor.valid())
+                    cursor.prev();
+                else
+                    cursor = tree->last();
+            }
+            else
+            {
+                cursor = tree->last();
+            }
+
+            // NULL keys are at the end of the index
+            while (cursor.valid() && cursor.key().key.null)
+                cursor.prev();
+        }
+    }
+
+    bool Next(RID &rid)
+    {
+        if (started && !(reverse ? cursor.prev() : cursor.next()))
+            return false;
+
+        started = true;
+
+        if (!cursor.valid() || cursor.key().key.null)
+            return false;
+
+        if (reverse ? has_low && !(low < cursor.key()) : has_high && !(cursor.key() < high))
+            return false;
+
+        rid = cursor.value();
+        return true;
+    }
+};
+
+/* rids gathered up front, for an index that can't walk its keys in order */
+class IX_VectorScan : public IX_Scan
+{
+private:
+    std::vector<RID> rids;
+    size_t pos;
+public:
+    IX_VectorScan(const std::vector<RID> &_rids)
+        : rids(_rids), pos(0)
+    {
+    }
+
+    bool Next(RID &rid)
+    {
+        if (pos == rids.size())
+            return false;
+
+        rid = rids[pos++];
+        return true;
+    }
+};
+
+/* rids of a range of an LSM index, merged from its buffer and runs as
+ * they are read */
+class IX_LsmScan : public IX_Scan
+{
+private:
+    lsmidx::lsm_tree::range range;
+public:
+    IX_LsmScan(const lsmidx::lsm_tree::range &_range)
+        : range(_range)
+    {
+    }
+
+    bool Next(RID &rid)
+    {
+        std::string entry;
+
+        if (!range.next(entry))
+            return false;
+
+        rid = bptree::entry_codec::rid_of(entry);
+        return true;
+    }
+};
+
+/* entries of a composite index whose encoded columns are in [low, high),
+ * compared as bytes without the rid, in order or backward */
+class IX_TupleScan : public IX_Scan
+{
+private:
+    bptree::tuple_tree::cursor cursor;
+    std::string low, high;
+    bool reverse, started;
+public:
+    IX_TupleScan(const bptree::tuple_tree *tree, const std::string &_low, const std::string &_high, bool _reverse = false)
+        : low(_low), high(_high), reverse(_reverse), started(false)
+    {
+        if (!reverse)
+        {
+            cursor = tree->lower_bound(bptree::tuple_key(low, RID(INT_MIN, INT_MIN)));
+        }
+        else
+        {
+            cursor = tree->lower_bound(bptree::tuple_key(high, RID(INT_MIN, INT_MIN)));
+
+            if (cursor.valid())
+                cursor.prev();
+            else
+                cursor = tree->last();
+        }
+    }
+
+    bool Next(RID &rid)
+    {
+        if (started && !(reverse ? cursor.prev() : cursor.next()))
+            return false;
+
+        started = true;
+
+        if (!cursor.valid() || !(cursor.key().key < high) || cursor.key().key < low)
+            return false;
+
+        rid = cursor.value();
+        return true;
+    }
+
+    /* the encoded columns of the entry Next returned last */
+    std::string Key() const
+    {
+        return cursor.key().key;
+    }
+};
+
+#endif
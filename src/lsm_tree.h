@@ -0,0 +1,762 @@
+#ifndef LSM_TREE_H
+#define LSM_TREE_H
+
+#include <stdint.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "bptree_str.h"
+
+namespace lsmidx
+{
+
+/* marks the files written by lsm_tree */
+const uint64_t LSM_MAGIC = 0x4c534d31;
+
+/* entries the buffer takes before it is written out as a run */
+#ifndef LSM_BUFFER
+#define LSM_BUFFER (1 << 16)
+#endif
+/* bytes of a run read at once, the first entry of each block is kept in memory */
+#define LSM_BLOCK 4096
+
+/* an entry of the buffer or a run: key and rid as bptree::entry_codec
+ * bytes, and whether it was added or deleted */
+struct entry_t
+{
+    std::string key;
+    bool live;
+};
+
+/* a sorted run of entries, written once and never changed, so it can be
+ * merged while lookups read it. entries are packed into blocks of about
+ * LSM_BLOCK bytes and the first entry of each is kept in memory, so a
+ * lookup reads the one block its key can be in. behind the blocks are
+ * those first entries, then a tail with the counts */
+class run
+{
+public:
+    const uint64_t id;
+    /* entries added, and deletions of entries in older runs */
+    uint64_t live, dead;
+
+    /* the run in the file, NULL if it is missing or cut short */
+    static std::shared_ptr<run> open(const std::string &path, uint64_t id)
+    {
+        std::shared_ptr<run> r(new run(path, id));
+        return r->load() ? r : NULL;
+    }
+
+    /* a run of the entries next(entry) pulls in order, NULL if the file
+     * can't be written */
+    template<class Source>
+    static std::shared_ptr<run> write(const std::string &path, uint64_t id, Source next)
+    {
+        FILE *f = fopen(path.c_str(), "wb");
+
+        if (!f)return NULL;
+
+        std::vector<std::pair<uint64_t, std::string> > firsts;
+        uint64_t at = 0, count[2] = {0, 0};
+        bool ok = true;
+        entry_t e;
+
+        std::string bytes;
+
+        while (ok && next(e))
+        {
+            if (firsts.empty() || at - firsts.back().first >= LSM_BLOCK)
+                firsts.push_back(std::make_pair(at, e.key));
+
+            bytes.clear();
+            put(bytes, e);
+            ok = fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+            at += bytes.size();
+            count[e.live]++;
+        }
+
+        for (size_t i = 0; ok && i < firsts.size(); i++)
+        {
+            uint16_t n = firsts[i].second.size();
+            ok = fwrite(&firsts[i].first, sizeof(uint64_t), 1, f) == 1 && fwrite(&n, sizeof(n), 1, f) == 1 &&
+                 fwrite(firsts[i].second.data(), 1, n, f) == n;
+        }
+
+        uint64_t tail[5] = {firsts.size(), at, count[1], count[0], LSM_MAGIC};
+        ok = ok && fwrite(tail, sizeof(tail), 1, f) == 1;
+        ok = fclose(f) == 0 && ok;
+
+        if (!ok)
+        {
+            unlink(path.c_str());
+            return NULL;
+        }
+
+        return open(path, id);
+    }
+
+    ~run()
+    {
+        if (fd >= 0)close(fd);
+
+        if (obsolete)unlink(path.c_str());
+    }
+
+    /* the file goes once the last reader of the run is done with it */
+    void retire()
+    {
+        obsolete = true;
+    }
+
+    size_t blocks() const
+    {
+        return firsts.size();
+    }
+
+    /* the block a key would be in */
+    size_t find(const std::string &key) const
+    {
+        size_t block = std::upper_bound(firsts.begin(), firsts.end(), key) - firsts.begin();
+        return block ? block - 1 : 0;
+    }
+
+    /* the bytes of a block, false if they can't be read */
+    bool read(size_t block, std::string &bytes) const
+    {
+        bytes.resize(offsets[block + 1] - offsets[block]);
+        return pread(fd, &bytes[0], bytes.size(), offsets[block]) == (ssize_t)bytes.size();
+    }
+
+    /* an entry as it is stored: length, key bytes and a byte for live */
+    static void put(std::string &bytes, const entry_t &e)
+    {
+        uint16_t n = e.key.size();
+        bytes.append((const char *)&n, sizeof(n));
+        bytes.append(e.key);
+        bytes.push_back(e.live);
+    }
+
+    /* the entry at `at` in bytes, moving past it */
+    static void get(const std::string &bytes, size_t &at, entry_t &e)
+    {
+        uint16_t n;
+        memcpy(&n, bytes.data() + at, sizeof(n));
+        e.key.assign(bytes, at + sizeof(n), n);
+        e.live = bytes[at + sizeof(n) + n] != 0;
+        at += sizeof(n) + n + 1;
+    }
+
+private:
+    std::string path;
+    int fd;
+    bool obsolete;
+    std::vector<std::string> firsts;
+    /* where each block starts, and the end of the last one */
+    std::vector<uint64_t> offsets;
+
+    run(const std::string &_path, uint64_t _id)
+        : id(_id), live(0), dead(0), path(_path), fd(-1), obsolete(false)
+    {
+    }
+
+    bool load()
+    {
+        uint64_t tail[5];
+        fd = ::open(path.c_str(), O_RDONLY);
+
+        if (fd < 0)return false;
+
+        off_t end = lseek(fd, 0, SEEK_END);
+
+        if (end < (off_t)sizeof(tail) || pread(fd, tail, sizeof(tail), end - sizeof(tail)) != sizeof(tail) ||
+                tail[4] != LSM_MAGIC || tail[1] > (uint64_t)end - sizeof(tail))
+            return false;
+
+        std::string index(end - sizeof(tail) - tail[1], '\0');
+
+        if (!index.empty() && pread(fd, &index[0], index.size(), tail[1]) != (ssize_t)index.size())
+            return false;
+
+        for (size_t at = 0, i = 0; i < tail[0]; i++)
+        {
+            uint64_t offset;
+            uint16_t n;
+
+            if (at + sizeof(offset) + sizeof(n) > index.size())return false;
+
+            memcpy(&offset, index.data() + at, sizeof(offset));
+            memcpy(&n, index.data() + at + sizeof(offset), sizeof(n));
+            at += sizeof(offset) + sizeof(n);
+
+            if (at + n > index.size())return false;
+
+            offsets.push_back(offset);
+            firsts.push_back(index.substr(at, n));
+            at += n;
+        }
+
+        offsets.push_back(tail[1]);
+        live = tail[2];
+        dead = tail[3];
+        return true;
+    }
+};
+
+/* the entries of a run from a key on, or of the buffer put in the same
+ * bytes; they are decoded one at a time, as a lookup needs few of them */
+class cursor
+{
+public:
+    cursor(const std::shared_ptr<run> &_source, const std::string &low)
+        : source(_source), block(_source->find(low)), at(0), has(false)
+    {
+        if (block < source->blocks())load();
+
+        do
+        {
+            next();
+        }
+        while (has && current.key < low);
+    }
+
+    cursor(const std::string &_bytes)
+        : block(0), at(0), bytes(_bytes), has(false)
+    {
+        next();
+    }
+
+    bool valid() const
+    {
+        return has;
+    }
+
+    const entry_t &get() const
+    {
+        return current;
+    }
+
+    void next()
+    {
+        // on to the next block at the end of one
+        while (at == bytes.size())
+        {
+            if (!source || ++block >= source->blocks())
+            {
+                has = false;
+                return;
+            }
+
+            load();
+        }
+
+        run::get(bytes, at, current);
+        has = true;
+    }
+
+private:
+    std::shared_ptr<run> source;
+    size_t block, at;
+    std::string bytes;
+    entry_t current;
+    bool has;
+
+    void load()
+    {
+        at = 0;
+
+        if (!source->read(block, bytes))
+        {
+            fprintf(stderr, "Can't read a run of an index\n");
+            bytes.clear();
+        }
+    }
+};
+
+/* entries of several cursors in order, the newest cursor added first;
+ * an entry in more than one is live or not as the newest says */
+class merge
+{
+public:
+    void add(const cursor &c)
+    {
+        cursors.push_back(c);
+    }
+
+    bool next(entry_t &e)
+    {
+        size_t best = cursors.size();
+
+        for (size_t i = 0; i < cursors.size(); i++)
+            if (cursors[i].valid() && (best == cursors.size() || cursors[i].get().key < cursors[best].get().key))
+                best = i;
+
+        if (best == cursors.size())return false;
+
+        e = cursors[best].get();
+
+        for (size_t i = 0; i < cursors.size(); i++)
+            if (cursors[i].valid() && cursors[i].get().key == e.key)
+                cursors[i].next();
+
+        return true;
+    }
+
+private:
+    std::vector<cursor> cursors;
+};
+
+/* a log-structured merge tree of (key, rid) entries: an insert or delete
+ * goes to a sorted buffer in memory, and a full buffer is written out at
+ * once as a sorted run. a thread merges the newest two runs whenever the
+ * newer holds at least half as many entries as the older, so sizes grow
+ * by powers of two and there are about log2(entries / LSM_BUFFER) runs.
+ * a lookup merges the buffer and every run, the newest saying whether an
+ * entry is live; deletions are kept as entries until merged into the
+ * oldest run. the runs are listed in a manifest, marked in use while the
+ * tree is open, so entries left in a buffer by a crash are known to be
+ * lost and the tree is built anew */
+class lsm_tree
+{
+public:
+    /* meta information of the tree */
+    typedef struct
+    {
+        size_t run_num;   /* sorted runs on disk */
+        size_t live_num;  /* entries added, in the runs and the buffer */
+        size_t dead_num;  /* deletions not merged into the oldest run yet */
+    } meta_t;
+
+    /* entries from one key up to another, in order */
+    class range
+    {
+    public:
+        range(merge _entries, const std::string &_high)
+            : entries(std::move(_entries)), high(_high)
+        {
+        }
+
+        bool next(std::string &key)
+        {
+            entry_t e;
+
+            while (entries.next(e) && e.key < high)
+            {
+                if (!e.live)continue;
+
+                key.swap(e.key);
+                return true;
+            }
+
+            return false;
+        }
+
+    private:
+        merge entries;
+        std::string high;
+    };
+
+    /* the tree in the directory p, made if missing */
+    lsm_tree(const char *p)
+        : path(p), next_run(0), trusted(false), merging(false), stopping(false)
+    {
+        mkdir(path.c_str(), 0755);
+        empty_init = !load();
+
+        if (empty_init)runs.clear();
+
+        trusted = !empty_init;
+        save(false);
+    }
+
+    ~lsm_tree()
+    {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+
+        if (merger.joinable())merger.join();
+
+        flush();
+
+        if (trusted && !save(true))
+            fprintf(stderr, "Can't write the index %s\n", path.c_str());
+    }
+
+    meta_t get_meta() const
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        meta_t meta = {runs.size(), 0, 0};
+
+        for (auto r : runs)
+        {
+            meta.live_num += r->live;
+            meta.dead_num += r->dead;
+        }
+
+        for (auto it : buffer)
+            (it.second ? meta.live_num : meta.dead_num)++;
+
+        return meta;
+    }
+
+    /* true if the tree was created empty instead of read from file */
+    bool initialized_empty() const
+    {
+        return empty_init;
+    }
+
+    void insert(const std::string &key, const RID &rid)
+    {
+        std::string entry = key;
+        bptree::entry_codec::put_rid(entry, rid);
+        buffer[entry] = true;
+
+        if (buffer.size() >= LSM_BUFFER)flush();
+    }
+
+    /* a deletion is an entry of its own while some run may hold the key */
+    void remove(const std::string &key, const RID &rid)
+    {
+        std::string entry = key;
+        bptree::entry_codec::put_rid(entry, rid);
+        std::lock_guard<std::mutex> guard(lock);
+
+        if (runs.empty())
+            buffer.erase(entry);
+        else
+            buffer[entry] = false;
+    }
+
+    /* entries at least low and less than high */
+    range find(const std::string &low, const std::string &high) const
+    {
+        std::string newest;
+
+        for (auto it = buffer.lower_bound(low); it != buffer.end() && it->first < high; ++it)
+        {
+            entry_t e = {it->first, it->second};
+            run::put(newest, e);
+        }
+
+        merge entries;
+        entries.add(cursor(newest));
+
+        for (auto r : snapshot())
+            entries.add(cursor(r, low));
+
+        return range(std::move(entries), high);
+    }
+
+    /* rids of the key, as bptree::entry_codec bytes sort below "\xff" */
+    std::vector<RID> search(const std::string &key) const
+    {
+        std::vector<RID> rids;
+        range entries = find(key, key + "\xff");
+        std::string entry;
+
+        while (entries.next(entry))
+            rids.push_back(bptree::entry_codec::rid_of(entry));
+
+        return rids;
+    }
+
+    /* drop every entry and every run file */
+    void clear()
+    {
+        wait();
+        std::lock_guard<std::mutex> guard(lock);
+
+        for (auto r : runs)
+            r->retire();
+
+        runs.clear();
+        buffer.clear();
+        DIR *d = opendir(path.c_str());
+
+        for (struct dirent *e; d && (e = readdir(d)) != NULL;)
+        {
+            std::string name = e->d_name;
+
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".run") == 0)
+                unlink((path + "/" + name).c_str());
+        }
+
+        if (d)closedir(d);
+
+        trusted = true;
+        save(false);
+    }
+
+    /* replace every entry by those next(key) pulls in order, as one run */
+    template<class Source>
+    bool build(Source next)
+    {
+        clear();
+        std::shared_ptr<run> r = run::write(file(next_run), next_run, [&](entry_t & e)
+        {
+            e.live = true;
+            return next(e.key);
+        });
+        next_run++;
+
+        if (!r)return false;
+
+        std::lock_guard<std::mutex> guard(lock);
+        add(r);
+        return save(false);
+    }
+
+    /* merge the buffer and every run into a single run without deletions */
+    bool rebuild()
+    {
+        flush();
+        wait();
+        std::vector<std::shared_ptr<run> > parts = snapshot();
+        std::shared_ptr<run> r = combine(parts, next_run++, true);
+
+        if (!r)return false;
+
+        std::lock_guard<std::mutex> guard(lock);
+
+        for (auto old : runs)
+            old->retire();
+
+        runs.clear();
+        add(r);
+        return save(false);
+    }
+
+private:
+    std::string path;
+    bool empty_init;
+    /* entries not in a run yet, only ever used by the thread that owns the tree */
+    std::map<std::string, bool> buffer;
+    /* oldest first; the lock guards them and what follows, as the thread
+     * merging runs changes them too */
+    std::vector<std::shared_ptr<run> > runs;
+    uint64_t next_run;
+    bool trusted, merging, stopping;
+    mutable std::mutex lock;
+    std::thread merger;
+
+    std::string file(uint64_t id) const
+    {
+        char name[32];
+        sprintf(name, "/%llu.run", (unsigned long long)id);
+        return path + name;
+    }
+
+    std::vector<std::shared_ptr<run> > snapshot() const
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        std::vector<std::shared_ptr<run> > newest(runs.rbegin(), runs.rend());
+        return newest;
+    }
+
+    /* the manifest: magic, whether it was closed cleanly, the next run
+     * id, then the ids of the runs oldest first */
+    bool load()
+    {
+        FILE *f = fopen((path + "/manifest").c_str(), "rb");
+
+        if (!f)return false;
+
+        uint64_t head[4];
+        bool ok = fread(head, sizeof(head), 1, f) == 1 && head[0] == LSM_MAGIC;
+
+        if (ok)next_run = head[2];
+
+        ok = ok && head[1] == 1;
+
+        for (uint64_t i = 0; ok && i < head[3]; i++)
+        {
+            uint64_t id;
+            ok = fread(&id, sizeof(id), 1, f) == 1;
+            std::shared_ptr<run> r = ok ? run::open(file(id), id) : NULL;
+            ok = r != NULL;
+
+            if (ok)runs.push_back(r);
+        }
+
+        fclose(f);
+        return ok;
+    }
+
+    bool save(bool clean)
+    {
+        FILE *f = fopen((path + "/manifest").c_str(), "wb");
+
+        if (!f)return false;
+
+        uint64_t head[4] = {LSM_MAGIC, clean, next_run, runs.size()};
+        bool ok = fwrite(head, sizeof(head), 1, f) == 1;
+
+        for (size_t i = 0; ok && i < runs.size(); i++)
+            ok = fwrite(&runs[i]->id, sizeof(uint64_t), 1, f) == 1;
+
+        return fclose(f) == 0 && ok;
+    }
+
+    /* a run is kept unless nothing was left to write into it */
+    void add(const std::shared_ptr<run> &r)
+    {
+        if (r->live + r->dead > 0)
+            runs.push_back(r);
+        else
+            r->retire();
+    }
+
+    /* write the buffer out as the newest run */
+    void flush()
+    {
+        if (buffer.empty())return;
+
+        bool oldest;
+        uint64_t id;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            oldest = runs.empty();
+            id = next_run++;
+        }
+        auto it = buffer.begin();
+        std::shared_ptr<run> r = run::write(file(id), id, [&](entry_t & e)
+        {
+            // with no older run a deletion has nothing left to hide
+            while (it != buffer.end() && oldest && !it->second)++it;
+
+            if (it == buffer.end())return false;
+
+            e.key = it->first;
+            e.live = it->second;
+            ++it;
+            return true;
+        });
+
+        if (!r)
+        {
+            fprintf(stderr, "Can't write a run of the index %s\n", path.c_str());
+            return;
+        }
+
+        buffer.clear();
+        std::lock_guard<std::mutex> guard(lock);
+        add(r);
+        save(false);
+
+        if (merging || stopping || pick() < 0)return;
+
+        // the thread that merged before has nothing left to do
+        if (merger.joinable())merger.join();
+
+        merging = true;
+        merger = std::thread(&lsm_tree::compact, this);
+    }
+
+    /* the older of the two runs to merge next, -1 if none; the lock is held */
+    int pick() const
+    {
+        for (int i = (int)runs.size() - 2; i >= 0; i--)
+            if (2 * (runs[i + 1]->live + runs[i + 1]->dead) >= runs[i]->live + runs[i]->dead)
+                return i;
+
+        return -1;
+    }
+
+    /* the runs given newest first merged into one; deletions are dropped
+     * if no older run is left for them to hide entries of */
+    std::shared_ptr<run> combine(const std::vector<std::shared_ptr<run> > &parts, uint64_t id, bool oldest) const
+    {
+        merge entries;
+
+        for (auto r : parts)
+            entries.add(cursor(r, ""));
+
+        return run::write(file(id), id, [&](entry_t & e)
+        {
+            while (entries.next(e))
+                if (e.live || !oldest)return true;
+
+            return false;
+        });
+    }
+
+    /* the merging thread, until no two runs are worth merging */
+    void compact()
+    {
+        for (;;)
+        {
+            std::vector<std::shared_ptr<run> > parts;
+            uint64_t id;
+            bool oldest;
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                int i = stopping ? -1 : pick();
+
+                if (i < 0)
+                {
+                    merging = false;
+                    return;
+                }
+
+                parts.push_back(runs[i + 1]);
+                parts.push_back(runs[i]);
+                id = next_run++;
+                oldest = i == 0;
+            }
+            std::shared_ptr<run> r = combine(parts, id, oldest);
+            std::lock_guard<std::mutex> guard(lock);
+
+            if (!r)
+            {
+                fprintf(stderr, "Can't merge runs of the index %s\n", path.c_str());
+                merging = false;
+                return;
+            }
+
+            // only the owner adds runs and only at the end, so the two
+            // are still side by side
+            auto at = std::find(runs.begin(), runs.end(), parts[1]);
+            at = runs.erase(at, at + 2);
+
+            if (r->live + r->dead > 0)
+                runs.insert(at, r);
+            else
+                r->retire();
+
+            parts[0]->retire();
+            parts[1]->retire();
+            save(false);
+        }
+    }
+
+    /* let the merging thread finish the merge it is in and stop */
+    void wait()
+    {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+
+        if (merger.joinable())merger.join();
+
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = false;
+    }
+};
+
+}
+
+#endif
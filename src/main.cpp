@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
 #include "SQLParser.h"
 #include "rc.h"
 #include "parser.h"
@@ -33,20 +35,59 @@ int main(int argc, char *argv[])
 
     for (int i = 0; i < query.length(); i++)if (query[i] == '\r')query[i] = ' ';
 
-    hsql::SQLParserResult *result = hsql::SQLParser::parseSQLString(query);
+    // the text between ANALYZE TABLE statements is parsed part by part,
+    // all of it before anything runs so that a syntax error stops it all
+    std::vector<hsql::SQLParserResult *> parts;
+    std::vector<std::string> tables;
+    size_t at = 0;
 
-    if (result->isValid)
+    for (;;)
     {
-        for (hsql::SQLStatement * stmt : result->statements)
+        size_t end;
+        std::string table;
+        size_t found = hsql::findAnalyze(query, at, end, table);
+        std::string part = query.substr(at, found == string::npos ? string::npos : found - at);
+
+        if ((at == 0 && found == string::npos) || !hsql::isBlank(part))
         {
-            // process the statements...
-            RC result = parseStatement(stmt);
+            hsql::SQLParserResult *result = hsql::SQLParser::parseSQLString(part);
+
+            if (!result->isValid)
+            {
+                // where the part starts in the text
+                int line = count(query.begin(), query.begin() + at, '\n');
+                size_t begin = at == 0 ? 0 : query.rfind('\n', at - 1) + 1;
+                int column = result->errorLine == 0 ? at - begin : 0;
+
+                fprintf(stderr, "line: %d, column: %d\n", line + result->errorLine + 1, column + result->errorColumn + 1);
+                fprintf(stderr, "%s\n", result->errorMsg);
+                return 0;
+            }
+
+            parts.push_back(result);
+            tables.push_back("");
         }
+
+        if (found == string::npos)break;
+
+        parts.push_back(NULL);
+        tables.push_back(table);
+        at = end;
     }
-    else
+
+    for (size_t i = 0; i < parts.size(); i++)
     {
-        fprintf(stderr, "line: %d, column: %d\n", result->errorLine + 1, result->errorColumn + 1);
-        fprintf(stderr, "%s\n", result->errorMsg);
+        if (!parts[i])
+        {
+            hsql::parseAnalyzeStatement(tables[i].c_str());
+            continue;
+        }
+
+        for (hsql::SQLStatement * stmt : parts[i]->statements)
+        {
+            // process the statements...
+            RC result = parseStatement(stmt);
+        }
     }
 
     return 0;
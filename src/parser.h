@@ -2,6 +2,9 @@
 #define PARSER_H
 
 #include "rc.h"
+#include <cctype>
+#include <regex>
+#include <string>
 #include "SQLParser.h"
 #include "sql/SQLStatement.h"
 #include "sql/statements.h"
@@ -127,6 +130,79 @@ RC parseUpdateStatement(UpdateStatement *stmt)
     return sm->updateRecord(stmt->table->name, *stmt->updates, stmt->where);
 }
 
+RC parseAnalyzeStatement(const char *table)
+{
+    SM_Manager *sm = SM_Manager::getInstance();
+    return sm->analyzeTable(table);
+}
+
+/* ANALYZE TABLE isn't in the generated grammar, so the statement is found
+ * in the text and run apart from the rest: the position of the first one
+ * at or after `from`, where a statement begins, npos if none, with `end`
+ * just past it and `table` the table it names */
+size_t findAnalyze(const std::string &query, size_t from, size_t &end, std::string &table)
+{
+    static const std::regex analyze("ANALYZE\\s+TABLE\\s+([A-Za-z_][A-Za-z0-9_]*)\\s*(;|$)", std::regex::icase);
+    bool start = true;
+
+    for (size_t i = from; i < query.length(); i++)
+    {
+        char c = query[i];
+
+        if (isspace(c))continue;
+
+        if (query.compare(i, 2, "--") == 0)
+        {
+            i = query.find('\n', i);
+
+            if (i == std::string::npos)break;
+
+            continue;
+        }
+
+        std::smatch m;
+
+        if (start && std::regex_search(query.begin() + i, query.end(), m, analyze, std::regex_constants::match_continuous))
+        {
+            table = m[1];
+            end = i + m.length(0);
+            return i;
+        }
+
+        start = c == ';';
+
+        // a ; or -- inside a string is part of it
+        if (c == '\'' || c == '"')
+        {
+            i = query.find(c, i + 1);
+
+            if (i == std::string::npos)break;
+        }
+    }
+
+    return std::string::npos;
+}
+
+/* true if the text holds nothing but spaces and comments */
+bool isBlank(const std::string &query)
+{
+    for (size_t i = 0; i < query.length(); i++)
+    {
+        if (query.compare(i, 2, "--") == 0)
+        {
+            i = query.find('\n', i);
+
+            if (i == std::string::npos)break;
+        }
+        else if (!isspace(query[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 RC parseStatement(SQLStatement *stmt)
 {
     switch (stmt->type())
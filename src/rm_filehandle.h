@@ -5,6 +5,7 @@
 #include <fileio/FileManager.h>
 #include <boost/filesystem.hpp>
 #include "rm_record.h"
+#include "rm_keyfile.h"
 
 namespace bf = boost::filesystem;
 class RM_FileHandle
@@ -14,6 +15,10 @@ private:
     BufPageManager *bpm;
     bf::path path;
     int fileId;
+    /* the rows of an index-organized table, which leave the pages empty */
+    RM_KeyFile *keyed;
+    /* type and length of each column, read from the config once */
+    mutable std::vector<std::pair<std::string, int> > layout;
     int findPage(int length)
     {
         int index;
@@ -35,10 +40,11 @@ public:
     {
         bpm = _bpm;
         fileId = -1;
+        keyed = NULL;
     }
     ~RM_FileHandle()
     {
-
+        if (keyed)delete keyed;
     }
     void init (BufPageManager *_bpm, int _fileId, bool clear)
     {
@@ -56,24 +62,45 @@ public:
         return fileId;
     }
 
-    RM_Record makeHead() const
+    /* keep the rows in `file` from now on, the handle deletes it */
+    void organize(RM_KeyFile *file)
     {
-        bf::path filename = path / configFile;
-        std::ifstream fi(filename.string());
-        int n;
-        fi >> n;
-        RM_Record head;
+        keyed = file;
+    }
+    RM_KeyFile *keyFile() const
+    {
+        return keyed;
+    }
 
-        for (int i = 0; i < n; i++)
+    RM_Record makeHead() const
+    {
+        if (layout.empty())
         {
-            std::string name, type;
-            bool notnull, index, primary;
-            int len;
-            getline(fi, name);
+            bf::path filename = path / configFile;
+            std::ifstream fi(filename.string());
+            int n;
+            fi >> n;
+
+            for (int i = 0; i < n; i++)
+            {
+                std::string name, type;
+                bool notnull, index, primary;
+                int len;
+                getline(fi, name);
 
-            if (name.empty())getline(fi, name);
+                if (name.empty())getline(fi, name);
+
+                fi >> type >> len >> notnull >> index >> primary;
+                layout.push_back(make_pair(type, len));
+            }
+        }
 
-            fi >> type >> len >> notnull >> index >> primary;
+        RM_Record head;
+
+        for (auto &column : layout)
+        {
+            const std::string &type = column.first;
+            int len = column.second;
             Type *data;
 
             if (type == "INTEGER")
@@ -97,6 +124,8 @@ public:
 
     RC InsertRec (const RM_Record &rec, RID &rid)
     {
+        if (keyed)return keyed->InsertRec(rec, rid);
+
         Byte byte = rec.toByte();
         int index, index_zero, pageId = findPage(byte.length);
 
@@ -149,6 +178,9 @@ public:
     RC GetRec (const RID &rid, RM_Record &rec) const
     {
         rec = makeHead();
+
+        if (keyed)return keyed->GetRec(rid, rec);
+
         int index;
         BufType b = bpm->getPage(fileId, rid.pageId, index);
         uch *bc = (uch *)b;
@@ -168,6 +200,8 @@ public:
     }
     RC DeleteRec (const RID &rid)
     {
+        if (keyed)return keyed->DeleteRec(rid);
+
         int index, index_zero;
         BufType b = bpm->getPage(fileId, rid.pageId, index);
         uch *bc = (uch *)b;
@@ -199,9 +233,20 @@ public:
     std::vector<std::pair<RID, RM_Record> > ListRec()
     {
         int zero_index;
-        RM_Record b = makeHead();
         std::vector<std::pair<RID, RM_Record> > list;
 
+        if (keyed)
+        {
+            keyed->ScanRec([this]()
+            {
+                return makeHead();
+            }, [&](const RID & rid, RM_Record & rec)
+            {
+                list.push_back(make_pair(rid, rec));
+            });
+            return list;
+        }
+
         for (int i = leftPage + 1; i < PAGE_INT_NUM; i++)
         {
             BufType bb = bpm->getPage(fileId, leftPage, zero_index);
@@ -211,18 +256,159 @@ public:
 
             for (int j = 1; j <= num; j++)
             {
+                RM_Record b;
+
                 if (this->GetRec(RID(i, j), b) == Success)
-                {
-                    RM_Record b = makeHead();
-                    this->GetRec(RID(i, j), b);
                     list.push_back(make_pair(RID(i, j), b));
-                }
+                else
+                    b.clear();
             }
         }
 
         return list;
     }
 
+    /* where a scan that pulls one record at a time stands */
+    struct Cursor
+    {
+        int page, row;
+        RM_KeyFile::Cursor entry;
+        bool started;
+    };
+
+    Cursor OpenCursor() const
+    {
+        Cursor c;
+        c.page = leftPage + 1;
+        c.row = 0;
+        c.started = false;
+        return c;
+    }
+
+    /* the next record of the cursor into rec and its rid, false once every
+     * record was read */
+    bool NextRec(Cursor &c, RID &rid, RM_Record &rec) const
+    {
+        if (keyed)
+        {
+            if (!c.started)c.entry = keyed->First();
+            else if (c.entry.valid())c.entry.next();
+
+            c.started = true;
+
+            if (!c.entry.valid())return false;
+
+            rec = makeHead();
+            keyed->Read(c.entry, rid, rec);
+            return true;
+        }
+
+        int zero_index;
+
+        for (; c.page < PAGE_INT_NUM; c.page++, c.row = 0)
+        {
+            BufType bb = bpm->getPage(fileId, leftPage, zero_index);
+            int num = bb[c.page] & 0x0000ffff;
+
+            while (++c.row <= num)
+            {
+                rid = RID(c.page, c.row);
+
+                if (GetRec(rid, rec) == Success)return true;
+
+                rec.clear();
+            }
+        }
+
+        return false;
+    }
+
+    /* the stored bytes of the next record of the cursor and its rid, for
+     * readers that take columns straight from the page; they stay valid
+     * until the buffer reads another page. false once every record was
+     * read, and always for an index-organized table */
+    bool NextBytes(Cursor &c, RID &rid, Byte &byte) const
+    {
+        if (keyed)return false;
+
+        int zero_index, index;
+
+        for (; c.page < PAGE_INT_NUM; c.page++, c.row = 0)
+        {
+            BufType bb = bpm->getPage(fileId, leftPage, zero_index);
+            int num = bb[c.page] & 0x0000ffff;
+
+            if (num == 0)continue;
+
+            uch *bc = (uch *)bpm->getPage(fileId, c.page, index);
+
+            while (++c.row <= num)
+            {
+                ush offset = *(ush *)(bc + PAGE_SIZE - 4 * (c.row + 1));
+                ush length = *(ush *)(bc + PAGE_SIZE - 4 * (c.row + 1) + 2);
+
+                if (offset == 0xffff)continue;
+
+                rid = RID(c.page, c.row);
+                byte = Byte(length, bc + offset);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /* call visit(rid, record) for every record without keeping them all in
+     * memory, each record is freed once visit returns */
+    template<class F>
+    void ScanRec(F visit)
+    {
+        int zero_index;
+
+        if (keyed)
+        {
+            keyed->ScanRec([this]()
+            {
+                return makeHead();
+            }, [&](const RID & rid, RM_Record & rec)
+            {
+                visit(rid, rec);
+                rec.clear();
+            });
+            return;
+        }
+
+        for (int i = leftPage + 1; i < PAGE_INT_NUM; i++)
+        {
+            BufType bb = bpm->getPage(fileId, leftPage, zero_index);
+            int num = bb[i] & 0x0000ffff;
+
+            for (int j = 1; j <= num; j++)
+            {
+                RM_Record b;
+
+                if (this->GetRec(RID(i, j), b) == Success)
+                    visit(RID(i, j), b);
+
+                b.clear();
+            }
+        }
+    }
+
+    /* pages holding rows, the leafs of the tree for an index-organized table */
+    int PageCount()
+    {
+        if (keyed)return keyed->Tree()->get_meta().leaf_node_num;
+
+        int zero_index, pages = 0;
+        BufType bb = bpm->getPage(fileId, leftPage, zero_index);
+
+        for (int i = leftPage + 1; i < PAGE_INT_NUM; i++)
+            if (bb[i] & 0x0000ffff)pages++;
+
+        return pages;
+    }
+
     //RC UpdateRec      (const RM_Record &rec);              // Update a record
     //RC ForcePages     (PageNum pageNum = ALL_PAGES) const; // Write dirty page(s)
 };
@@ -0,0 +1,199 @@
+#ifndef RM_KEYFILE_H
+#define RM_KEYFILE_H
+#include "rc.h"
+#include <bufmanager/BufPageManager.h>
+#include <fileio/FileManager.h>
+#include <algorithm>
+#include <climits>
+#include <string>
+#include <vector>
+#include "bptree_str.h"
+#include "rm_record.h"
+
+/* the rows of an index-organized table, kept in the leafs of a B+ tree in
+ * the order of their INT primary key instead of in heap pages. an entry is
+ * the key followed by the other columns, all encoded by tuple_codec, so a
+ * key range is a run of adjacent leafs. a row's rid is (key, 1): indexes
+ * on other columns find the row by its key, and a row keeps its rid for
+ * as long as it keeps its key */
+class RM_KeyFile
+{
+private:
+    typedef bptree::tuple_codec codec;
+
+    bptree::tuple_tree *tree;
+    int key;
+    /* the entry fetched last, the next fetch of a scan in key order steps
+     * it instead of searching the tree; any change to the tree drops it */
+    bptree::tuple_tree::cursor last;
+    bool positioned;
+
+    static std::string prefix(int value)
+    {
+        std::string s;
+        Type_int data(false, value);
+        codec::put_type(s, &data);
+        return s;
+    }
+
+    static bool starts(const std::string &s, const std::string &p)
+    {
+        return s.compare(0, p.size(), p) == 0;
+    }
+
+    std::string encode(const RM_Record &rec) const
+    {
+        std::string s;
+        codec::put_type(s, rec.constget(key));
+
+        for (int i = 0; i < rec.getSize(); i++)
+            if (i != key)codec::put_type(s, rec.constget(i));
+
+        return s;
+    }
+
+    void decode(const std::string &s, RM_Record &rec) const
+    {
+        size_t at = 0;
+        codec::get_type(s, at, rec.get(key));
+
+        for (int i = 0; i < rec.getSize(); i++)
+            if (i != key)codec::get_type(s, at, rec.get(i));
+    }
+
+    /* position `last` at the row of the rid, false if there is none */
+    bool seek(const RID &rid)
+    {
+        std::string p = prefix(rid.pageId);
+
+        if (positioned && last.valid() && starts(last.key().key, p))
+            return true;
+
+        if (positioned && last.valid() && last.next() && starts(last.key().key, p))
+            return true;
+
+        last = tree->lower_bound(bptree::tuple_key(p, RID(INT_MIN, INT_MIN)));
+        positioned = true;
+        return last.valid() && starts(last.key().key, p);
+    }
+public:
+    /* the rows in the tree at `filename`, ordered by column `key` */
+    RM_KeyFile(FileManager *fm, BufPageManager *bpm, const char *filename, int _key)
+        : key(_key), positioned(false)
+    {
+        tree = new bptree::tuple_tree(fm, bpm, filename);
+    }
+    ~RM_KeyFile()
+    {
+        delete tree;
+    }
+
+    /* the tree, for the index of the key to read */
+    const bptree::tuple_tree *Tree() const
+    {
+        return tree;
+    }
+
+    /* column the rows are ordered by */
+    int Key() const
+    {
+        return key;
+    }
+
+    /* Error if the key is NULL or another row has it */
+    RC InsertRec(const RM_Record &rec, RID &rid)
+    {
+        if (rec.constget(key)->null)return Error;
+
+        rid = RID(rec.constget(key)->getValue(), 1);
+
+        if (seek(rid))return Error;
+
+        positioned = false;
+        return tree->insert(bptree::tuple_key(encode(rec), rid), rid) == 0 ? Success : Error;
+    }
+
+    /* rec is made by RM_FileHandle::makeHead */
+    RC GetRec(const RID &rid, RM_Record &rec)
+    {
+        if (!seek(rid))return Error;
+
+        decode(last.key().key, rec);
+        return Success;
+    }
+
+    RC DeleteRec(const RID &rid)
+    {
+        if (!seek(rid))return Error;
+
+        bptree::tuple_key entry = last.key();
+        positioned = false;
+        return tree->remove(entry) == 0 ? Success : Error;
+    }
+
+    /* replace every row by the n entries made by Entry that next(entry)
+     * pulls in order, Error if a key is NULL or two rows share one */
+    template<class Source>
+    RC Load(Source next, size_t n, double fill)
+    {
+        std::string entry, previous;
+        bool ok = true;
+        positioned = false;
+        tree->build([&](bptree::tuple_tree::record_t & record)
+        {
+            if (!ok || !next(entry))return false;
+
+            RID rid = codec::rid_of(entry);
+            ok = entry[0] == '\0' && (previous.empty() || codec::rid_of(previous) != rid);
+            record.key = codec::decode(entry);
+            record.value = rid;
+            previous.swap(entry);
+            return ok;
+        }, n, fill);
+        return ok ? Success : Error;
+    }
+
+    /* the encoded entry of a row, its rid last */
+    std::string Entry(const RM_Record &rec) const
+    {
+        std::string s = encode(rec);
+        codec::put_rid(s, RID(rec.constget(key)->getValue(), 1));
+        return s;
+    }
+
+    void Rebuild(double fill)
+    {
+        positioned = false;
+        tree->rebuild(fill);
+    }
+
+    typedef bptree::tuple_tree::cursor Cursor;
+
+    /* the first row in key order, step it with Cursor::next */
+    Cursor First() const
+    {
+        return tree->first();
+    }
+
+    /* the row at a valid cursor into rec made by makeHead, and its rid */
+    void Read(const Cursor &c, RID &rid, RM_Record &rec) const
+    {
+        decode(c.key().key, rec);
+        rid = c.value();
+    }
+
+    /* visit(rid, record) for every row in key order, head makes the empty
+     * record each row is read into and visit owns it */
+    template<class H, class F>
+    void ScanRec(H head, F visit) const
+    {
+        for (auto c = tree->first(); c.valid(); c.next())
+        {
+            RM_Record rec = head();
+            decode(c.key().key, rec);
+            visit(c.value(), rec);
+        }
+    }
+};
+
+#endif
@@ -25,6 +25,22 @@ public:
             delete i;
         }
     }
+    /* a record of copies of the values, the caller clears it */
+    RM_Record copy() const
+    {
+        RM_Record rec;
+
+        for (auto const & i : total)
+            rec.push_back(i->clone());
+
+        return rec;
+    }
+    /* take over the values of other after these */
+    void append(const RM_Record &other)
+    {
+        for (auto const & i : other.total)
+            push_back(i);
+    }
     Type *get(int n)
     {
         return total[n];
@@ -111,6 +127,20 @@ public:
         return byte;
     }
 
+    /* the INT at `offset` of a record stored by toByte, read in place; the
+     * fixed size columns come first, from byte 4 on in column order */
+    static int intAt(const Byte &byte, int offset)
+    {
+        return *(const int *)(byte.a + offset);
+    }
+
+    /* whether column n of a record stored by toByte is NULL */
+    static bool nullAt(const Byte &byte, int n)
+    {
+        ush end = *(const ush *)(byte.a + 2);
+        return byte.a[end + 2 + n / 8] >> (n % 8) & 1;
+    }
+
     RC fromByte(Byte _byte)
     {
         Byte byte = _byte;
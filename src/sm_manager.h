@@ -1,12 +1,14 @@
 #ifndef SM_MANAGER_H
 #define SM_MANAGER_H
 #include "rc.h"
+#include <algorithm>
 #include <boost/filesystem.hpp>
 #include <fstream>
 #include <bufmanager/BufPageManager.h>
 #include <fileio/FileManager.h>
 #include <map>
 #include <set>
+#include <sstream>
 #include "sql/statements.h"
 #include "sql/Expr.h"
 #include "rm_record.h"
@@ -355,6 +357,14 @@ public:
             fo << "SELECT * FROM " << name << " WHERE " << it->expr->toString() << std::endl;
         }
 
+        // no composite, hash or LSM indexes or Bloom filters yet, and the
+        // rows are kept in heap pages
+        fo << 0 << std::endl;
+        fo << 0 << std::endl;
+        fo << 0 << std::endl;
+        fo << 0 << std::endl;
+        fo << 0 << std::endl;
+
         return Success;
     }
 
@@ -394,6 +404,7 @@ public:
         fi.open((path / configFile).string());
         int n;
         fi >> n;
+        std::vector<std::string> names, types;
 
         for (int i = 0; i < n; i++)
         {
@@ -410,13 +421,96 @@ public:
             if (len != -1)printf("(%d) ", len);
 
             printf("--%s, %s, %s\n", notnull ? "Not NULL" : "NULL", index ? "Indexed" : "Unindexed", primary ? "Primary" : "Not Primary");
+            names.push_back(name);
+            types.push_back(type);
+        }
+
+        // the stats of an analyzed table, as the open table keeps them
+        auto it = tbsta.find(path);
+        TM_Stats *stats = it != tbsta.end() ? it->second->stats : new TM_Stats((path / "stats").string().c_str());
+
+        if (stats->Analyzed())
+        {
+            printf("\n%llu rows, %llu pages\n", (unsigned long long)stats->Rows(), (unsigned long long)stats->Pages());
+
+            for (int i = 0; i < n; i++)
+            {
+                const TM_Stats::Column &c = stats->Of(i);
+                printf("%s: %llu distinct, %.1f%% NULL", names[i].c_str(), (unsigned long long)c.distinct,
+                       stats->Rows() ? 100.0 * c.nulls / stats->Rows() : 0.0);
+
+                if (!c.min.empty())
+                    printf(", %s to %s", valueOf(c.min, types[i]).c_str(), valueOf(c.max, types[i]).c_str());
+
+                printf(", %d buckets\n", c.bounds.empty() ? 0 : int(c.bounds.size()) - 1);
+            }
         }
 
+        if (it == tbsta.end())delete stats;
+
         printf("\n");
 
         return Success;
     }
 
+    /* a value kept by the stats, as a column of `type` prints it */
+    static std::string valueOf(const std::string &value, const std::string &type)
+    {
+        bool integer = type == "INTEGER" || type == "INT";
+        Type *data = integer ? Type::make(false, 0, 0) : Type::make(false, "", 256);
+        size_t at = 0;
+        bptree::tuple_codec::get_type(value, at, data);
+        std::string s = integer ? std::to_string(data->getValue()) : "'" + std::string(data->getStr()) + "'";
+        delete data;
+        return s;
+    }
+
+    /* gather the stats of a table, see TM_Stats */
+    RC analyzeTable(const char *name)
+    {
+        if (curdb.empty())
+        {
+            fprintf(stderr, "There is no current database\n");
+            return Error;
+        }
+
+        bf::path workPath = bf::current_path() / curdb;
+        std::ifstream fi((workPath / configFile).string(), std::fstream::in);
+        std::string buf;
+        bool f = false;
+
+        while (getline(fi, buf))
+        {
+            if (strcmp(buf.c_str(), name) == 0)
+            {
+                bf::path path = workPath / name;
+
+                if (bf::exists(path) && bf::is_directory(path))
+                    f = true;
+            }
+        }
+
+        fi.close();
+
+        if (!f)
+        {
+            fprintf(stderr, "Table %s doesn't exist\n", name);
+            return Error;
+        }
+
+        bf::path path = workPath / name;
+
+        auto it = tbsta.find(path);
+
+        if (it == tbsta.end())
+        {
+            tbsta.insert(make_pair(path, new TM_Manager(fm, bpm, path)));
+            it = tbsta.find(path);
+        }
+
+        return it->second->analyze();
+    }
+
     RC insertRecord(const char *name, std::vector<hsql::Expr *> &values)
     {
         if (curdb.empty())
@@ -600,6 +694,44 @@ public:
 
     }
 
+    /* a list of columns such as "a, b" read from spec */
+    static std::vector<std::string> columnList(std::istringstream &spec)
+    {
+        std::string list, more;
+        std::vector<std::string> columns;
+        spec >> list;
+
+        // commas may have spaces on either side
+        while ((!list.empty() && list.back() == ',') || (spec >> std::ws, spec.peek() == ','))
+        {
+            if (!(spec >> more))break;
+
+            list += more;
+        }
+
+        std::istringstream in(list);
+
+        for (std::string column; getline(in, column, ',');)
+            columns.push_back(column);
+
+        return columns;
+    }
+
+    /* how a table config names an index: "a" for one column, "a,b" for a
+     * composite one and "a,b;c" if it also includes c */
+    static std::string indexName(const std::vector<std::string> &columns, const std::vector<std::string> &include)
+    {
+        std::string name;
+
+        for (size_t i = 0; i < columns.size(); i++)
+            name += (i ? "," : "") + columns[i];
+
+        for (size_t i = 0; i < include.size(); i++)
+            name += (i ? "," : ";") + include[i];
+
+        return name;
+    }
+
     RC createIndex(const char *name, const char *indexname)
     {
         if (curdb.empty())
@@ -632,13 +764,112 @@ public:
             return Error;
         }
 
+        // the column may be followed by options, e.g. "name REBUILD FILLFACTOR 70",
+        // columns separated by commas make a composite index, e.g. "a, b", and
+        // INCLUDE adds columns kept in its entries only, e.g. "a INCLUDE b, c",
+        // and USING HASH makes a hash index of one column, e.g. "id USING HASH",
+        // or USING LSM one that buffers its changes, e.g. "id USING LSM",
+        // converting an index the column already has, as BLOOM does giving it
+        // a filter of its keys, and ORGANIZE on an INT primary key keeps the
+        // rows of the table in its index, e.g. "id ORGANIZE"
+        std::istringstream spec(indexname);
+        std::vector<std::string> columns = columnList(spec), include;
+        std::string option, method;
+        bool rebuild = false, bloom = false, organize = false;
+        double fill = IX_FILL_FACTOR;
+
+        while (spec >> option)
+        {
+            if (strcasecmp(option.c_str(), "INCLUDE") == 0)
+            {
+                include = columnList(spec);
+            }
+            else if (strcasecmp(option.c_str(), "REBUILD") == 0)
+            {
+                rebuild = true;
+            }
+            else if (strcasecmp(option.c_str(), "BLOOM") == 0)
+            {
+                bloom = true;
+            }
+            else if (strcasecmp(option.c_str(), "ORGANIZE") == 0)
+            {
+                organize = true;
+            }
+            else if (strcasecmp(option.c_str(), "USING") == 0)
+            {
+                if (!(spec >> method) || (strcasecmp(method.c_str(), "HASH") != 0 && strcasecmp(method.c_str(), "BTREE") != 0 &&
+                                          strcasecmp(method.c_str(), "LSM") != 0))
+                {
+                    fprintf(stderr, "USING must be HASH, BTREE or LSM\n");
+                    return Error;
+                }
+            }
+            else if (strcasecmp(option.c_str(), "FILLFACTOR") == 0)
+            {
+                int percent;
+
+                if (!(spec >> percent) || percent < 10 || percent > 100)
+                {
+                    fprintf(stderr, "FILLFACTOR must be between 10 and 100\n");
+                    return Error;
+                }
+
+                fill = percent / 100.0;
+            }
+            else
+            {
+                fprintf(stderr, "Unknown index option %s\n", option.c_str());
+                return Error;
+            }
+        }
+
+        std::string column = indexName(columns, include);
+        bool composite = columns.size() > 1 || !include.empty();
+        bool hash = strcasecmp(method.c_str(), "HASH") == 0, lsm = strcasecmp(method.c_str(), "LSM") == 0, had = false;
+        size_t width = 0;
+
+        if (composite && hash)
+        {
+            fprintf(stderr, "A hash index has one column\n");
+            return Error;
+        }
+
+        if (composite && lsm)
+        {
+            fprintf(stderr, "An LSM index has one column\n");
+            return Error;
+        }
+
+        if (composite && bloom)
+        {
+            fprintf(stderr, "A Bloom filter is kept for one column\n");
+            return Error;
+        }
+
+        if (organize && (composite || hash || lsm || bloom || rebuild))
+        {
+            fprintf(stderr, "ORGANIZE takes a single column and no other option\n");
+            return Error;
+        }
+
+        columns.insert(columns.end(), include.begin(), include.end());
+
+        for (size_t i = 0; i < columns.size(); i++)
+            if (std::count(columns.begin(), columns.end(), columns[i]) > 1)
+            {
+                fprintf(stderr, "Column %s appears twice in the index\n", columns[i].c_str());
+                return Error;
+            }
+
         bf::path path = workPath / name;
         fi.open((path / configFile).string());
-        char str[1024];
+        std::ostringstream str;
         int n;
         fi >> n;
-        sprintf(str, "%d\n", n);
-        bool flag = false;
+        str << n << "\n";
+        bool flag = false, key = false;
+        size_t row = 0;
 
         for (int i = 0; i < n; i++)
         {
@@ -649,26 +880,29 @@ public:
 
             if (name.empty())getline(fi, name);
 
-            sprintf(str + strlen(str), "%s\n", name.c_str());
+            str << name << "\n";
             fi >> type >> len >> notnull >> index >> primary;
+            row += bptree::tuple_codec::width(type == "INTEGER" || type == "INT", len);
 
-            if (string(indexname) == name)
-            {
-                if (index)
-                {
-                    fprintf(stderr, "Column %s Index already exists\n", indexname);
-                    return Error;
-                }
+            if (column == name)key = primary && (type == "INTEGER" || type == "INT");
 
+            if (composite && std::find(columns.begin(), columns.end(), name) != columns.end())
+            {
+                width += bptree::tuple_codec::width(type == "INTEGER" || type == "INT", len);
+                columns.erase(std::find(columns.begin(), columns.end(), name));
+            }
+            else if (column == name)
+            {
+                had = index;
                 index = true;
                 flag = true;
             }
 
-            sprintf(str + strlen(str), "%s %d %d %d %d\n", type.c_str(), len, notnull, index, primary);
+            str << type << ' ' << len << ' ' << notnull << ' ' << index << ' ' << primary << "\n";
         }
 
         fi >> n;
-        sprintf(str + strlen(str), "%d\n", n);
+        str << n << "\n";
 
         for (int i = 0; i < n; i++)
         {
@@ -677,20 +911,207 @@ public:
 
             if (check.empty())getline(fi, check);
 
-            sprintf(str + strlen(str), "%s\n", check.c_str());
+            str << check << "\n";
+        }
+
+        std::vector<std::string> indexes, hashed, bloomed, buffered;
+        std::string organized;
+
+        // composite indexes by name, then the columns with hash indexes,
+        // then those with Bloom filters, then the key the rows are kept by,
+        // then the columns with LSM indexes, any missing in tables from
+        // before them
+        if (fi >> n)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                std::string index;
+                fi >> index;
+                indexes.push_back(index);
+            }
+        }
+
+        if (fi >> n)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                std::string index;
+                fi >> index;
+                hashed.push_back(index);
+            }
+        }
+
+        if (fi >> n)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                std::string index;
+                fi >> index;
+                bloomed.push_back(index);
+            }
+        }
+
+        if (fi >> n && n == 1)fi >> organized;
+
+        if (fi >> n)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                std::string index;
+                fi >> index;
+                buffered.push_back(index);
+            }
         }
 
         fi.close();
 
+        if (organize)
+        {
+            if (!organized.empty())
+            {
+                fprintf(stderr, "Table %s is already organized by %s\n", name, organized.c_str());
+                return Error;
+            }
+
+            if (!key)
+            {
+                fprintf(stderr, "Only an INT primary key can organize a table\n");
+                return Error;
+            }
+
+            // a row is one entry of the tree
+            if (row + 8 > bptree::tuple_codec::KEY_MAX)
+            {
+                fprintf(stderr, "Rows of table %s are too wide to organize\n", name);
+                return Error;
+            }
+
+            // the rows are the index, so its old kind no longer applies
+            hashed.erase(std::remove(hashed.begin(), hashed.end(), column), hashed.end());
+            bloomed.erase(std::remove(bloomed.begin(), bloomed.end(), column), bloomed.end());
+            buffered.erase(std::remove(buffered.begin(), buffered.end(), column), buffered.end());
+            organized = column;
+        }
+
+        if (!composite && flag)
+        {
+            auto it = std::find(hashed.begin(), hashed.end(), column);
+            auto lt = std::find(buffered.begin(), buffered.end(), column);
+            bool filtered = std::find(bloomed.begin(), bloomed.end(), column) != bloomed.end();
+
+            if (column == organized && !organize && (!method.empty() || bloom))
+            {
+                fprintf(stderr, "Column %s holds the rows of the table\n", column.c_str());
+                return Error;
+            }
+
+            // an index that changes kind or gains a filter is made anew instead,
+            // as is a primary key that comes to hold the rows
+            if (had && ((!method.empty() && (hash != (it != hashed.end()) || lsm != (lt != buffered.end()))) || (bloom && !filtered) ||
+                        organize))
+            {
+                rebuild = false;
+            }
+            else if (rebuild && !had)
+            {
+                fprintf(stderr, "Column %s Index doesn't exist\n", column.c_str());
+                return Error;
+            }
+            else if (!rebuild && had)
+            {
+                fprintf(stderr, "Column %s Index already exists\n", column.c_str());
+                return Error;
+            }
+
+            if (hash && it == hashed.end())
+                hashed.push_back(column);
+            else if (!hash && it != hashed.end() && !method.empty())
+                hashed.erase(it);
+
+            if (lsm && lt == buffered.end())
+                buffered.push_back(column);
+            else if (!lsm && lt != buffered.end() && !method.empty())
+                buffered.erase(lt);
+
+            if (bloom && !filtered)
+                bloomed.push_back(column);
+        }
+
+        if (composite)
+        {
+            bool exists = std::find(indexes.begin(), indexes.end(), column) != indexes.end();
+
+            if (!columns.empty())
+            {
+                fprintf(stderr, "Column %s doesn't exist\n", columns[0].c_str());
+                return Error;
+            }
+
+            if (rebuild && !exists)
+            {
+                fprintf(stderr, "Index %s doesn't exist\n", column.c_str());
+                return Error;
+            }
+
+            if (!rebuild && exists)
+            {
+                fprintf(stderr, "Index %s already exists\n", column.c_str());
+                return Error;
+            }
+
+            // its file is named _<columns>.db
+            if (column.size() + strlen("_.db") > 255)
+            {
+                fprintf(stderr, "Index %s has too long a name\n", column.c_str());
+                return Error;
+            }
+
+            // an entry is the columns and its rid
+            if (width + 8 > bptree::tuple_codec::KEY_MAX)
+            {
+                fprintf(stderr, "Index %s is too wide\n", column.c_str());
+                return Error;
+            }
+
+            if (!rebuild)indexes.push_back(column);
+
+            flag = true;
+        }
+
+        str << indexes.size() << "\n";
+
+        for (auto index : indexes)
+            str << index << "\n";
+
+        str << hashed.size() << "\n";
+
+        for (auto index : hashed)
+            str << index << "\n";
+
+        str << bloomed.size() << "\n";
+
+        for (auto index : bloomed)
+            str << index << "\n";
+
+        if (organized.empty())
+            str << "0\n";
+        else
+            str << "1\n" << organized << "\n";
+
+        str << buffered.size() << "\n";
+
+        for (auto index : buffered)
+            str << index << "\n";
+
         if (!flag)
         {
-            fprintf(stderr, "Column %s doesn't exist\n", indexname);
+            fprintf(stderr, "Column %s doesn't exist\n", column.c_str());
             return Error;
         }
 
-        std::ofstream fo((path / configFile).string());
-        fo << str;
-        fo.close();
+        // open the table before the config names the new index, so that
+        // index is built below with the requested fill factor, or one
+        // converted is dropped and made anew
         auto it = tbsta.find(path);
 
         if (it == tbsta.end())
@@ -699,7 +1120,17 @@ public:
             it = tbsta.find(path);
         }
 
-        return it->second->createIndex(true);
+        if (rebuild)
+        {
+            return it->second->rebuildIndex(column, fill);
+        }
+
+        if (organize && it->second->organize(column, fill) != Success)return Error;
+
+        std::ofstream fo((path / configFile).string());
+        fo << str.str();
+        fo.close();
+        return it->second->createIndex(fill);
 
     }
 
@@ -735,12 +1166,23 @@ public:
             return Error;
         }
 
+        // a composite index is named by its columns, e.g. "a, b INCLUDE c"
+        std::istringstream spec(indexname);
+        std::vector<std::string> columns = columnList(spec), include;
+        std::string option;
+
+        if (spec >> option && strcasecmp(option.c_str(), "INCLUDE") == 0)
+            include = columnList(spec);
+
+        std::string column = indexName(columns, include);
+        bool composite = columns.size() > 1 || !include.empty();
+
         bf::path path = workPath / name;
         fi.open((path / configFile).string());
-        char str[1024];
+        std::ostringstream str;
         int n;
         fi >> n;
-        sprintf(str, "%d\n", n);
+        str << n << "\n";
         bool flag = false;
 
         for (int i = 0; i < n; i++)
@@ -752,10 +1194,10 @@ public:
 
             if (name.empty())getline(fi, name);
 
-            sprintf(str + strlen(str), "%s\n", name.c_str());
+            str << name << "\n";
             fi >> type >> len >> notnull >> index >> primary;
 
-            if (string(indexname) == name)
+            if (!composite && column == name)
             {
                 if (!index)
                 {
@@ -773,11 +1215,11 @@ public:
                 flag = true;
             }
 
-            sprintf(str + strlen(str), "%s %d %d %d %d\n", type.c_str(), len, notnull, index, primary);
+            str << type << ' ' << len << ' ' << notnull << ' ' << index << ' ' << primary << "\n";
         }
 
         fi >> n;
-        sprintf(str + strlen(str), "%d\n", n);
+        str << n << "\n";
 
         for (int i = 0; i < n; i++)
         {
@@ -786,620 +1228,226 @@ public:
 
             if (check.empty())getline(fi, check);
 
-            sprintf(str + strlen(str), "%s\n", check.c_str());
+            str << check << "\n";
         }
 
-        fi.close();
+        std::vector<std::string> indexes;
 
-        if (!flag)
+        if (fi >> n)
         {
-            fprintf(stderr, "Column %s doesn't exist\n", indexname);
-            return Error;
+            for (int i = 0; i < n; i++)
+            {
+                std::string index;
+                fi >> index;
+
+                if (composite && index == column)
+                    flag = true;
+                else
+                    indexes.push_back(index);
+            }
         }
 
-        std::ofstream fo((path / configFile).string());
-        fo << str;
-        fo.close();
-        auto it = tbsta.find(path);
+        std::vector<std::string> hashed;
 
-        if (it == tbsta.end())
+        // a dropped column index is no longer a hash index either
+        if (fi >> n)
         {
-            tbsta.insert(make_pair(path, new TM_Manager(fm, bpm, path)));
-            it = tbsta.find(path);
-        }
+            for (int i = 0; i < n; i++)
+            {
+                std::string index;
+                fi >> index;
 
-        return it->second->dropIndex();
+                if (composite || index != column)hashed.push_back(index);
+            }
+        }
 
-    }
+        std::vector<std::string> bloomed;
 
-    RC getSet(const hsql::Expr &expr, const std::map<std::string, TM_Manager *> nameSt, const std::map<std::string, std::map<string, int> > &headSt, std::set<std::map<std::string, RID> > &ans)
-    {
-        if (expr.type != hsql::kExprOperator)
+        // and it has no filter
+        if (fi >> n)
         {
-            fprintf(stderr, "Where Expr should be a bool expression.\n");
-            return Error;
-        }
-
-        int tleft = 0;
-        std::set<std::map<std::string, RID> > sleft;
-        Type *data;
-        IX_Manager *index;
-        int lit;
-
-        switch (expr.expr->type)
-        {
-            case hsql::kExprColumnRef:
+            for (int i = 0; i < n; i++)
             {
-                auto itt = headSt.find(expr.expr->table);
-
-                if (itt == headSt.end())
-                {
-                    fprintf(stderr, "Table %s is not found.\n", expr.expr->table);
-                    return Error;
-                }
-
-                RM_Record head = nameSt.find(expr.expr->table)->second->rmfh->makeHead();
-                const std::map<string, int> &st = itt->second;
-                auto it = st.find(std::string(expr.expr->name));
+                std::string index;
+                fi >> index;
 
-                if (it == st.end())
-                {
-                    fprintf(stderr, "Column %s is not found.\n", expr.expr->name);
-                    return Error;
-                }
+                if (composite || index != column)bloomed.push_back(index);
+            }
+        }
 
-                data = head.get(it->second);
+        std::string organized;
 
-                if ((index = nameSt.find(expr.expr->table)->second->indexv[it->second]) == NULL)
-                {
-                    fprintf(stderr, "Column %s doesn't have index and creating index...\n", expr.expr->name);
-                    createIndex(expr.expr->table, expr.expr->name);
-                    index = nameSt.find(expr.expr->table)->second->indexv[it->second];
-                }
+        if (fi >> n && n == 1)fi >> organized;
 
-                lit = it->second;
-            }
-            break;
+        std::vector<std::string> buffered;
 
-            case hsql::kExprOperator:
+        if (fi >> n)
+        {
+            for (int i = 0; i < n; i++)
             {
-                tleft = 1;
-                RC result = getSet(*expr.expr, nameSt, headSt, sleft);
+                std::string index;
+                fi >> index;
 
-                if (result == Error)
-                {
-                    return Error;
-                }
+                if (composite || index != column)buffered.push_back(index);
             }
-            break;
-
-            default:
-                fprintf(stderr, "Unsupported Select Expr.\n");
-                return Error;
         }
 
-        if (expr.op_type == hsql::Expr::NOT)
+        fi.close();
+
+        if (!composite && column == organized)
         {
-            fprintf(stderr, "Unsupported Select Expr --- Not OP.\n");
+            fprintf(stderr, "Column %s holds the rows of the table\n", column.c_str());
             return Error;
         }
 
-        int tright;
-        std::set<std::map<std::string, RID> > sright;
-        int iright;
-        const char *cright;
-        std::vector<std::pair<RID, int> > ilist;
-        std::vector<std::pair<RID, std::string> > clist;
+        str << indexes.size() << "\n";
 
-        switch (expr.expr2->type)
-        {
-            case hsql::kExprOperator:
-            {
-                tright = 1;
-                RC result = getSet(*expr.expr2, nameSt, headSt, sright);
+        for (auto index : indexes)
+            str << index << "\n";
 
-                if (result == Error)
-                {
-                    return Error;
-                }
-            }
-            break;
-
-            case hsql::kExprLiteralInt:
-                tright = 2;
-                iright = expr.expr2->ival;
-                break;
-
-            case hsql::kExprLiteralString:
-                tright = 3;
-                cright = expr.expr2->name;
-                break;
-
-            case hsql::kExprLiteralNull:
-                tright = 4;
-                break;
-
-            case hsql::kExprColumnRef:
-            {
-                auto itt = headSt.find(expr.expr2->table);
-
-                if (itt == headSt.end())
-                {
-                    fprintf(stderr, "Table %s is not found.\n", expr.expr2->table);
-                    return Error;
-                }
+        str << hashed.size() << "\n";
 
-                const std::map<string, int> &st = itt->second;
-                auto it = st.find(std::string(expr.expr2->name));
+        for (auto index : hashed)
+            str << index << "\n";
 
-                if (it == st.end())
-                {
-                    fprintf(stderr, "Column %s is not found.\n", expr.expr2->name);
-                    return Error;
-                }
+        str << bloomed.size() << "\n";
 
-                std::vector<std::pair<RID, RM_Record> > data = nameSt.find(expr.expr2->table)->second->rmfh->ListRec();
+        for (auto index : bloomed)
+            str << index << "\n";
 
-                for (std::pair<RID, RM_Record> p : data)
-                {
-                    if (p.second.get(it->second)->isInt())
-                    {
-                        ilist.push_back(make_pair(p.first, p.second.get(it->second)->getValue()));
-                        tright = 5;
-                    }
-                    else if (p.second.get(it->second)->isStr())
-                    {
-                        clist.push_back(make_pair(p.first, p.second.get(it->second)->getStr()));
-                        tright = 6;
-                    }
-                    else
-                    {
-                        fprintf(stderr, "Column %s.%s is not found.\n", expr.expr2->table, expr.expr2->name);
-                        return Error;
-                    }
+        if (organized.empty())
+            str << "0\n";
+        else
+            str << "1\n" << organized << "\n";
 
-                    p.second.clear();
-                }
+        str << buffered.size() << "\n";
 
-            }
-            break;
+        for (auto index : buffered)
+            str << index << "\n";
 
-            default:
-                fprintf(stderr, "Unsupported Select Expr.\n");
-                return Success;
+        if (!flag && composite)
+        {
+            fprintf(stderr, "Index %s doesn't exist\n", column.c_str());
+            return Error;
         }
 
-
-
-        if (tleft == tright && tleft == 1)
+        if (!flag)
         {
-            switch (expr.op_type)
-            {
-                case hsql::Expr::AND:
-                {
-                    typedef std::multimap<std::pair<std::string, RID>, std::map<std::string, RID> > multitype;
-                    std::multimap<std::pair<std::string, RID>, std::map<std::string, RID> > multist;
-                    std::set<std::string> lname, rname, name;
-
-                    for (auto lit : sleft)
-                    {
-                        for (auto litit : lit)
-                            lname.insert(litit.first);
-                    }
-
-                    for (auto rit : sright)
-                    {
-                        for (auto ritit : rit)
-                            rname.insert(ritit.first);
-                    }
-
-                    for (auto lit : lname)
-                        if (rname.find(lit)  != rname.end())
-                            name.insert(lit);
-
-                    for (auto lit : sleft)
-                    {
-                        for (auto it : name)
-                        {
-                            if (lit.find(it) != lit.end())
-                                multist.insert(make_pair(*lit.find(it), lit));
-                            else
-                                multist.insert(make_pair(make_pair(it, RID()), lit));
-                        }
-                    }
+            fprintf(stderr, "Column %s doesn't exist\n", indexname);
+            return Error;
+        }
 
-                    for (auto rit : sright)
-                    {
-                        bool f;
-                        std::set<std::map<std::string, RID> >tmp;
+        // open the table while the config still names the index, so that
+        // its file is known and removed below
+        auto it = tbsta.find(path);
 
-                        for (auto ritit : rit)
-                        {
-                            if (name.find(ritit.first) != name.end())
-                            {
-                                f = true;
-                                auto ret = multist.equal_range(ritit);
+        if (it == tbsta.end())
+        {
+            tbsta.insert(make_pair(path, new TM_Manager(fm, bpm, path)));
+            it = tbsta.find(path);
+        }
 
-                                for (auto it = ret.first; it != ret.second; it++)
-                                    tmp.insert(it->second);
+        std::ofstream fo((path / configFile).string());
+        fo << str.str();
+        fo.close();
+        return it->second->dropIndex();
 
-                                ret = multist.equal_range(make_pair(ritit.first, RID()));
+    }
 
-                                for (auto it = ret.first; it != ret.second; it++)
-                                    tmp.insert(it->second);
+    /* the table of a column a join reads: the one the column names, or the
+     * only table having such a column; empty if there is none */
+    static std::string tableOf(const hsql::Expr &ref, const std::vector<hsql::TableRef *> &names, const std::map<std::string, std::map<string, int> > &headSt)
+    {
+        if (ref.table)return headSt.count(ref.table) ? ref.table : "";
 
-                                break;
-                            }
-                        }
+        std::string found;
 
-                        if (!f)
-                        {
-                            for (auto lit : sleft)
-                            {
-                                std::map<std::string, RID> tmp = rit;
-                                tmp.insert(lit.begin(), lit.end());
-                                ans.insert(tmp);
-                            }
-                        }
-                        else
-                        {
-                            for (auto lit : tmp)
-                            {
-                                bool ff = true;
-
-                                if (f)
-                                {
-                                    for (auto litit : lit)
-                                        for (auto ritit : rit)
-                                            if (litit.first == ritit.first && litit.second != ritit.second)
-                                            {
-                                                ff = false;
-                                                break;
-                                            }
-                                }
-
-                                if (ff)
-                                {
-                                    std::map<std::string, RID> tmp = lit;
-                                    tmp.insert(rit.begin(), rit.end());
-                                    ans.insert(tmp);
-                                }
-                            }
-                        }
-                    }
-                }
+        for (hsql::TableRef * tab : names)
+        {
+            if (!headSt.find(tab->name)->second.count(ref.name))continue;
 
-                break;
+            if (!found.empty())return "";
 
-                case hsql::Expr::OR:
-                    ans.insert(sleft.begin(), sleft.end());
-                    ans.insert(sright.begin(), sright.end());
+            found = tab->name;
+        }
 
-                    break;
+        return found;
+    }
 
-                default:
-                    fprintf(stderr, "The Expr Operation is error.\n");
-                    return Error;
-            }
+    /* the column compared on the left of each comparison in a join's WHERE
+     * gets an index if it has none, for the filters and joins to use */
+    RC indexJoin(const hsql::Expr &expr, const std::map<std::string, TM_Manager *> &nameSt, const std::map<std::string, std::map<string, int> > &headSt, const std::vector<hsql::TableRef *> &names)
+    {
+        if (expr.type != hsql::kExprOperator)
+        {
+            fprintf(stderr, "Where Expr should be a bool expression.\n");
+            return Error;
         }
-        else if (tleft == 0 && tright == 2)
+
+        if (expr.expr && expr.expr->type == hsql::kExprColumnRef)
         {
-            if (!data->set(iright))
-            {
-                fprintf(stderr, "The Expr Column Type is error.\n");
-                return Error;
-            }
+            std::string table = tableOf(*expr.expr, names, headSt);
 
-            switch (expr.op_type)
+            if (table.empty())
             {
-                case hsql::Expr::SIMPLE_OP:
-
-                    if (expr.op_char == '=')
-                    {
-                        std::vector<RID> vec = index->SearchEntry(data);
-
-                        for (auto rid : vec)
-                        {
-                            std::map<std::string, RID>st;
-                            st.insert(make_pair(expr.expr->table, rid));
-                            ans.insert(st);
-                        }
-                    }
-
-                    else if (expr.op_char == '<')
-                    {
-                        Type *t = new Type_int(false, 0x80000000);
-                        std::vector<RID> vec = index->SearchRangeEntry(t, data);
-
-                        for (auto rid : vec)
-                        {
-                            RM_Record rec;
-                            nameSt.find(expr.expr->table)->second->rmfh->GetRec(rid, rec);
-
-                            if (*((Type_int *)rec.get(lit)) == *(Type_int *)data)
-                            {
-                                rec.clear();
-                                continue;
-                            }
+                if (expr.expr->table)fprintf(stderr, "Table %s is not found.\n", expr.expr->table);
+                else fprintf(stderr, "Column %s is not found.\n", expr.expr->name);
 
-                            rec.clear();
-
-                            std::map<std::string, RID>st;
-                            st.insert(make_pair(expr.expr->table, rid));
-                            ans.insert(st);
-                        }
-                    }
-                    else if (expr.op_char == '>')
-                    {
-                        Type *t = new Type_int(false, 0x7fffffff);
-                        std::vector<RID> vec = index->SearchRangeEntry(data, t);
-
-                        for (auto rid : vec)
-                        {
-                            RM_Record rec;
-                            nameSt.find(expr.expr->table)->second->rmfh->GetRec(rid, rec);
-
-                            if (*((Type_int *)rec.get(lit)) == *(Type_int *)data)
-                            {
-                                rec.clear();
-                                continue;
-                            }
-
-                            rec.clear();
-                            std::map<std::string, RID>st;
-                            st.insert(make_pair(expr.expr->table, rid));
-                            ans.insert(st);
-                        }
-                    }
-
-                    break;
-
-                case hsql::Expr::LESS_EQ:
-                {
-                    Type *t = new Type_int(false, 0x80000000);
-                    std::vector<RID> vec = index->SearchRangeEntry(t, data);
-
-                    for (auto rid : vec)
-                    {
-                        std::map<std::string, RID>st;
-                        st.insert(make_pair(expr.expr->table, rid));
-                        ans.insert(st);
-                    }
-                }
-                break;
+                return Error;
+            }
 
-                case hsql::Expr::GREATER_EQ:
-                {
-                    Type *t = new Type_int(false, 0x7fffffff);
-                    std::vector<RID> vec = index->SearchRangeEntry(data, t);
+            const std::map<string, int> &st = headSt.find(table)->second;
+            auto it = st.find(std::string(expr.expr->name));
 
-                    for (auto rid : vec)
-                    {
-                        std::map<std::string, RID>st;
-                        st.insert(make_pair(expr.expr->table, rid));
-                        ans.insert(st);
-                    }
-                }
-                break;
-
-                default:
-                    fprintf(stderr, "Unsupported Select Expr.\n");
-                    return Success;
-            }
-        }
-        else if (tleft == 0 && tright == 3)
-        {
-            if (!data->set(cright, strlen(cright)))
+            if (it == st.end())
             {
-                fprintf(stderr, "The Expr Column Type is error.\n");
+                fprintf(stderr, "Column %s is not found.\n", expr.expr->name);
                 return Error;
             }
 
-            switch (expr.op_type)
+            if (nameSt.find(table)->second->indexv[it->second] == NULL)
             {
-                case hsql::Expr::SIMPLE_OP:
-                    if (expr.op_char == '=')
-                    {
-                        std::vector<RID> vec = index->SearchEntry(data);
-
-                        for (auto rid : vec)
-                        {
-                            std::map<std::string, RID>st;
-                            st.insert(make_pair(expr.expr->table, rid));
-                            ans.insert(st);
-                        }
-                    }
-
-                    break;
-
-                default:
-                    fprintf(stderr, "Unsupported Select Expr.\n");
-                    return Error;
+                fprintf(stderr, "Column %s doesn't have index and creating index...\n", expr.expr->name);
+                createIndex(table.c_str(), expr.expr->name);
             }
         }
-        else if (tleft == 0 && tright == 4)
+        else if (expr.expr && expr.expr->type == hsql::kExprOperator && indexJoin(*expr.expr, nameSt, headSt, names) == Error)
         {
-            data->setnull();
-
-            switch (expr.op_type)
-            {
-                case hsql::Expr::SIMPLE_OP:
-                    if (expr.op_char == '=')
-                    {
-                        std::vector<RID> vec = index->SearchEntry(data);
-
-                        for (auto rid : vec)
-                        {
-                            std::map<std::string, RID>st;
-                            st.insert(make_pair(expr.expr->table, rid));
-                            ans.insert(st);
-                        }
-                    }
-
-                    break;
-
-                default:
-                    fprintf(stderr, "Unsupported Select Expr.\n");
-                    return Error;
-            }
+            return Error;
         }
-        else if (tleft == 0 && tright == 5)
-        {
-            for (auto p : ilist)
-            {
-                if (!data->set(p.second))
-                {
-                    fprintf(stderr, "The Expr Column Type is error.\n");
-                    return Error;
-                }
-
-                switch (expr.op_type)
-                {
-                    case hsql::Expr::SIMPLE_OP:
-
-                        if (expr.op_char == '=')
-                        {
-                            std::vector<RID> vec = index->SearchEntry(data);
-
-                            for (auto rid : vec)
-                            {
-                                std::map<std::string, RID>st;
-                                st.insert(make_pair(expr.expr->table, rid));
-                                st.insert(make_pair(expr.expr2->table, p.first));
-                                ans.insert(st);
-                            }
-                        }
-
-                        else if (expr.op_char == '<')
-                        {
-                            Type *t = new Type_int(false, 0x80000000);
-                            std::vector<RID> vec = index->SearchRangeEntry(t, data);
-
-                            for (auto rid : vec)
-                            {
-                                RM_Record rec;
-                                nameSt.find(expr.expr->table)->second->rmfh->GetRec(rid, rec);
-
-                                if (*((Type_int *)rec.get(lit)) == *(Type_int *)data)
-                                {
-                                    rec.clear();
-                                    continue;
-                                }
-
-                                rec.clear();
-
-                                std::map<std::string, RID>st;
-                                st.insert(make_pair(expr.expr->table, rid));
-                                st.insert(make_pair(expr.expr2->table, p.first));
-                                ans.insert(st);
-                            }
-                        }
-                        else if (expr.op_char == '>')
-                        {
-                            Type *t = new Type_int(false, 0x7fffffff);
-                            std::vector<RID> vec = index->SearchRangeEntry(data, t);
-
-                            for (auto rid : vec)
-                            {
-                                RM_Record rec;
-                                nameSt.find(expr.expr->table)->second->rmfh->GetRec(rid, rec);
-
-                                if (*((Type_int *)rec.get(lit)) == *(Type_int *)data)
-                                {
-                                    rec.clear();
-                                    continue;
-                                }
-
-                                rec.clear();
-                                std::map<std::string, RID>st;
-                                st.insert(make_pair(expr.expr->table, rid));
-                                st.insert(make_pair(expr.expr2->table, p.first));
-                                ans.insert(st);
-                            }
-                        }
 
-                        break;
-
-                    case hsql::Expr::LESS_EQ:
-                    {
-                        Type *t = new Type_int(false, 0x80000000);
-                        std::vector<RID> vec = index->SearchRangeEntry(t, data);
-
-                        for (auto rid : vec)
-                        {
-                            std::map<std::string, RID>st;
-                            st.insert(make_pair(expr.expr->table, rid));
-                            st.insert(make_pair(expr.expr2->table, p.first));
-                            ans.insert(st);
-                        }
-                    }
-                    break;
+        if (expr.expr2 && expr.expr2->type == hsql::kExprOperator && indexJoin(*expr.expr2, nameSt, headSt, names) == Error)
+            return Error;
 
-                    case hsql::Expr::GREATER_EQ:
-                    {
-                        Type *t = new Type_int(false, 0x7fffffff);
-                        std::vector<RID> vec = index->SearchRangeEntry(data, t);
+        return Success;
+    }
 
-                        for (auto rid : vec)
-                        {
-                            std::map<std::string, RID>st;
-                            st.insert(make_pair(expr.expr->table, rid));
-                            st.insert(make_pair(expr.expr2->table, p.first));
-                            ans.insert(st);
-                        }
-                    }
-                    break;
+    /* the positions in FROM of the tables expr reads, -1 for a column of none */
+    static void tablesIn(const hsql::Expr *expr, const std::vector<hsql::TableRef *> &names, const std::map<std::string, std::map<string, int> > &headSt, std::set<int> &at)
+    {
+        if (!expr)return;
 
-                    default:
-                        fprintf(stderr, "Unsupported Select Expr.\n");
-                        return Success;
-                }
-            }
-        }
-        else if (tleft == 0 && tright == 6)
+        if (expr->type == hsql::kExprColumnRef)
         {
-            for (auto p : clist)
-            {
-                if (!data->set(p.second.c_str(), p.second.length()))
-                {
-                    fprintf(stderr, "The Expr Column Type is error.\n");
-                    return Error;
-                }
-
-                switch (expr.op_type)
-                {
-                    case hsql::Expr::SIMPLE_OP:
-                        if (expr.op_char == '=')
-                        {
-                            std::vector<RID> vec = index->SearchEntry(data);
-
-                            for (auto rid : vec)
-                            {
-                                std::map<std::string, RID>st;
-                                st.insert(make_pair(expr.expr->table, rid));
-                                st.insert(make_pair(expr.expr2->table, p.first));
-                                ans.insert(st);
-                            }
-                        }
+            std::string table = tableOf(*expr, names, headSt);
+            int k = 0;
 
-                        break;
+            while (k < (int)names.size() && table != names[k]->name)
+                k++;
 
-                    default:
-                        fprintf(stderr, "Unsupported Select Expr.\n");
-                        return Error;
-                }
-            }
-        }
-        else
-        {
-            fprintf(stderr, "The Expr Type is error.\n");
-            return Error;
+            at.insert(k < (int)names.size() ? k : -1);
+            return;
         }
 
-        return Success;
-
+        tablesIn(expr->expr, names, headSt, at);
+        tablesIn(expr->expr2, names, headSt, at);
     }
 
+    /* the rows of the tables joined in FROM order: each table is read
+     * through its own terms of WHERE, joined to the tables before it by an
+     * index on an equality with one of their columns or else by reading it
+     * again for each row, and the terms across tables filter the rows once
+     * the tables they read are in */
     RC selectRecord(std::vector<hsql::TableRef *>names, std::vector<hsql::Expr *> &fields, hsql::Expr *wheres)
     {
         if (curdb.empty())
@@ -1456,212 +1504,258 @@ public:
 
         }
 
-        std::set<std::map<std::string, RID> >set;
+        if (wheres && indexJoin(*wheres, nameSt, headSt, names) == Error)return Error;
 
-        if (!wheres)
-        {
-            set.insert(std::map<std::string, RID>());
-        }
-        else if (getSet(*wheres, nameSt, headSt, set) == Error)return Error;
+        // a joined row is the columns of the tables one after another, named
+        // table.column, and column too where only one table has it
+        std::map<string, int> st;
+        std::map<string, int> seen;
+        std::vector<int> offset;
+        int width = 0;
 
-        for (auto it = set.begin(); it != set.end(); it++)
+        for (hsql::TableRef * tab : names)
         {
-            for (hsql::TableRef * tab : names)
-            {
-                if (it->find(tab->name) == it->end())
-                {
-                    auto data = nameSt.find(tab->name)->second->rmfh->ListRec();
+            offset.push_back(width);
 
-                    for (auto rec : data)
-                    {
-                        auto st = *it;
-                        st.insert(make_pair(tab->name, rec.first));
-                        set.insert(st);
-                        rec.second.clear();
-                    }
-                }
+            for (auto it : headSt.find(tab->name)->second)
+            {
+                st[std::string(tab->name) + "." + it.first] = width + it.second;
+                seen[it.first]++;
             }
+
+            width += headSt.find(tab->name)->second.size();
         }
 
-        std::map<pair<std::string, std::string>, int>mi, ma, num;
-        std::map<pair<std::string, std::string>, long long>sum;
-        bool func = false, newline = false;
-        int starsize = 0;
+        for (size_t k = 0; k < names.size(); k++)
+            for (auto it : headSt.find(names[k]->name)->second)
+                if (seen[it.first] == 1)st[it.first] = offset[k] + it.second;
+
+        std::vector<const hsql::Expr *> terms;
+        std::vector<std::vector<const hsql::Expr *> > local(names.size()), across(names.size());
+
+        if (wheres)TM_Manager::termsOf(wheres, terms);
 
-        for (auto st : set)
+        for (const hsql::Expr * term : terms)
         {
-            bool f = true;
+            std::set<int> at;
+            tablesIn(term, names, headSt, at);
 
-            for (hsql::TableRef * tab : names)
-            {
-                if (st.find(tab->name) == st.end())
-                {
-                    f = false;
-                    break;
-                }
-            }
+            if (at.size() <= 1 && !at.count(-1))
+                local[at.empty() ? 0 : *at.begin()].push_back(term);
+            else
+                across[at.count(-1) ? 0 : *at.rbegin()].push_back(term);
+        }
+
+        TM_Manager *first = nameSt.find(names[0]->name)->second;
+        TM_Operator *rows = NULL;
 
-            if (!f)continue;
+        if (first->termsPlan(local[0], rows) == Error)return Error;
+
+        for (size_t k = 0; k < names.size(); k++)
+        {
+            TM_Manager *tm = nameSt.find(names[k]->name)->second;
+            const std::map<string, int> &tst = headSt.find(names[k]->name)->second;
 
-            for (hsql::Expr * expr : fields)
+            if (k > 0)
             {
-                switch (expr->type)
-                {
-                    case hsql::kExprStar:
-                        for (hsql::TableRef * tab : names)
-                        {
-                            RM_Record rec;
-                            nameSt.find(tab->name)->second->rmfh->GetRec(st.find(tab->name)->second, rec);
-                            rec.print();
-                            starsize += rec.getSize();
-                            rec.clear();
-                        }
+                // an equality with a column of a table joined before, on an
+                // indexed column of the same type
+                IX_Manager *index = NULL;
+                int outer = -1;
+                RM_Record head = tm->rmfh->makeHead();
 
-                        newline = true;
-                        break;
+                for (const hsql::Expr * term : across[k])
+                {
+                    if (index || term->op_type != hsql::Expr::SIMPLE_OP || term->op_char != '=' ||
+                            term->expr->type != hsql::kExprColumnRef || term->expr2->type != hsql::kExprColumnRef)continue;
 
-                    case hsql::kExprColumnRef:
+                    for (int side = 0; side < 2 && !index; side++)
                     {
-                        auto itt = headSt.find(expr->table);
+                        const hsql::Expr *in = side ? term->expr2 : term->expr, *out = side ? term->expr : term->expr2;
+                        std::set<int> at, from;
+                        tablesIn(in, names, headSt, at);
+                        tablesIn(out, names, headSt, from);
 
-                        if (itt == headSt.end())
-                        {
-                            fprintf(stderr, "Table %s is not found.\n", expr->table);
-                            return Error;
-                        }
+                        if (*at.begin() != (int)k || *from.begin() < 0 || *from.begin() >= (int)k)continue;
+
+                        auto column = tst.find(in->name);
+                        auto it = TM_Manager::columnOf(*out, st);
+                        std::string table = tableOf(*out, names, headSt);
+
+                        if (column == tst.end() || it == st.end())continue;
 
-                        RM_Record rec;
-                        nameSt.find(expr->table)->second->rmfh->GetRec(st.find(expr->table)->second, rec);
-                        const std::map<string, int> &st = itt->second;
-                        auto it = st.find(std::string(expr->name));
+                        RM_Record other = nameSt.find(table)->second->rmfh->makeHead();
+                        const Type *a = head.constget(column->second), *b = other.constget(it->second - offset[*from.begin()]);
 
-                        if (it == st.end())
+                        if (tm->indexv[column->second] && typeid(*a) == typeid(*b))
                         {
-                            fprintf(stderr, "Column %s is not found.\n", expr->name);
-                            return Error;
+                            index = tm->indexv[column->second];
+                            outer = it->second;
                         }
 
-                        Type *t = rec.get(it->second);
-                        t->print();
-                        newline = true;
+                        other.clear();
                     }
-                    break;
+                }
+
+                head.clear();
+
+                if (index)
+                {
+                    rows = new TM_IndexJoin(rows, tm->rmfh, index, outer, tm->where(local[k], tst));
+                }
+                else
+                {
+                    TM_Operator *inner = NULL;
 
-                    case hsql::kExprFunctionRef:
+                    if (tm->termsPlan(local[k], inner) == Error)
                     {
-                        func = true;
-                        auto itt = headSt.find(expr->expr->table);
+                        delete rows;
+                        return Error;
+                    }
 
-                        if (itt == headSt.end())
-                        {
-                            fprintf(stderr, "Table %s is not found.\n", expr->expr->table);
-                            return Error;
-                        }
+                    rows = new TM_NestedLoop(rows, inner);
+                }
+            }
 
-                        RM_Record rec;
-                        nameSt.find(expr->expr->table)->second->rmfh->GetRec(st.find(expr->expr->table)->second, rec);
-                        const std::map<string, int> &st = itt->second;
-                        auto it = st.find(std::string(expr->expr->name));
+            for (const hsql::Expr * term : across[k])
+                rows = new TM_Filter(rows, first->where(*term, st));
+        }
 
-                        if (it == st.end())
-                        {
-                            fprintf(stderr, "Column %s is not found.\n", expr->expr->name);
-                            return Error;
-                        }
+        // the columns printed for each row, those the functions add up, where
+        // each function finds its total and the table it names; a field that
+        // can't be shown is an error once there is a row to show
+        std::vector<int> shown, summed, totalOf(fields.size(), -1);
+        std::vector<std::string> tableAt(fields.size());
+        std::string bad;
+        RC rc = Success;
 
-                        Type *t = rec.get(it->second);
-//                        t->print();
+        for (size_t i = 0; i < fields.size() && bad.empty(); i++)
+        {
+            hsql::Expr *expr = fields[i];
 
-                        if (dynamic_cast<Type_int *>(t) == NULL)
-                        {
-                            fprintf(stderr, "Column %s is not a integer.\n", expr->expr->name);
-                            return Error;
-                        }
+            if (expr->type == hsql::kExprStar)
+            {
+                for (int k = 0; k < width; k++)
+                    shown.push_back(k);
 
-                        auto tmp = ma.begin();
-                        sum[make_pair(expr->expr->table, expr->expr->name)] += ((Type_int *)t)->getValue();
-                        num[make_pair(expr->expr->table, expr->expr->name)] ++;
+                continue;
+            }
 
-                        if ((tmp = ma.find(make_pair(expr->expr->table, expr->expr->name))) == ma.end())
-                            ma.insert(make_pair(make_pair(expr->expr->table, expr->expr->name), ((Type_int *)t)->getValue()));
-                        else
-                            tmp->second = std::max(it->second, ((Type_int *)t)->getValue());
+            if (expr->type != hsql::kExprColumnRef && expr->type != hsql::kExprFunctionRef)
+            {
+                bad = "Expr type is error.\n";
+                break;
+            }
 
-                        if ((tmp = mi.find(make_pair(expr->expr->table, expr->expr->name))) == mi.end())
-                            mi.insert(make_pair(make_pair(expr->expr->table, expr->expr->name), ((Type_int *)t)->getValue()));
-                        else
-                            tmp->second = std::min(it->second, ((Type_int *)t)->getValue());
-                    }
-                    break;
+            hsql::Expr *ref = expr->type == hsql::kExprColumnRef ? expr : expr->expr;
+            std::string table = tableOf(*ref, names, headSt);
+            auto it = st.find(table + "." + ref->name);
 
-                    default:
-                        fprintf(stderr, "Expr type is error.\n");
-                        return Error;
-                }
+            if (table.empty() && ref->table)
+            {
+                bad = std::string("Table ") + ref->table + " is not found.\n";
             }
+            else if (it == st.end())
+            {
+                bad = std::string("Column ") + ref->name + " is not found.\n";
+            }
+            else if (expr->type == hsql::kExprColumnRef)
+            {
+                shown.push_back(it->second);
+            }
+            else
+            {
+                RM_Record head = nameSt.find(table)->second->rmfh->makeHead();
 
-            if (newline)printf("\n");
+                if (dynamic_cast<Type_int *>(head.get(headSt.find(table)->second.find(ref->name)->second)) == NULL)
+                {
+                    bad = std::string("Column ") + ref->name + " is not a integer.\n";
+                }
+
+                head.clear();
+                tableAt[i] = table;
+                totalOf[i] = std::find(summed.begin(), summed.end(), it->second) - summed.begin();
+
+                if (totalOf[i] == (int)summed.size())summed.push_back(it->second);
+            }
         }
 
-        if (func)
+        TM_Aggregate *totals = new TM_Aggregate(rows, summed);
+        TM_Operator *root = new TM_Project(totals, shown);
+
+        rc = root->Open();
+
+        while (rc == Success)
         {
-            for (hsql::Expr * expr : fields)
-            {
-                switch (expr->type)
-                {
-                    case hsql::kExprStar:
-//                        for (int i = 0; i < starsize; i++)printf("|  | ");
+            RM_Record rec;
+            bool more;
 
-                        break;
+            if ((rc = root->Next(rec, more)) == Error || !more)break;
 
-                    case hsql::kExprColumnRef:
+            if (!bad.empty())
+            {
+                fprintf(stderr, "%s", bad.c_str());
+                rec.clear();
+                rc = Error;
+                break;
+            }
 
-//                        printf("|  | ");
+            if (!shown.empty())
+            {
+                rec.print();
+                printf("\n");
+            }
 
-                        break;
+            rec.clear();
+        }
 
-                    case hsql::kExprFunctionRef:
-                    {
-                        std::string f = expr->name;
+        root->Close();
 
-                        if (f == "AVG")
-                        {
-                            printf("| %s(%s.%s) = %.2lf | ", expr->name, expr->expr->table, expr->expr->name, double(sum[make_pair(expr->expr->table, expr->expr->name)]) / num[make_pair(expr->expr->table, expr->expr->name)]);
-                        }
-                        else if (f == "SUM")
-                        {
-                            printf("| %s(%s.%s) = %lld | ", expr->name, expr->expr->table, expr->expr->name, sum[make_pair(expr->expr->table, expr->expr->name)]);
-                        }
-                        else if (f == "MAX")
-                        {
-                            printf("| %s(%s.%s) = %d | ", expr->name, expr->expr->table, expr->expr->name, ma[make_pair(expr->expr->table, expr->expr->name)]);
-                        }
-                        else if (f == "MIN")
-                        {
-                            printf("| %s(%s.%s) = %d | ", expr->name, expr->expr->table, expr->expr->name, mi[make_pair(expr->expr->table, expr->expr->name)]);
-                        }
-                        else if (f == "NUM")
-                        {
-                            printf("| %s(%s.%s) = %d | ", expr->name, expr->expr->table, expr->expr->name, num[make_pair(expr->expr->table, expr->expr->name)]);
-                        }
-                        else
-                        {
-                            fprintf(stderr, "Unsupport function %s\n", expr->name);
-                        }
-                    }
-                    break;
+        if (rc == Success && totals->Rows() && !summed.empty())
+        {
+            for (size_t i = 0; i < fields.size(); i++)
+            {
+                if (totalOf[i] == -1)continue;
 
-                    default:
-                        fprintf(stderr, "Expr type is error.\n");
-                        return Error;
+                hsql::Expr *expr = fields[i];
+                const char *table = tableAt[i].c_str();
+                const TM_Aggregate::Total &t = totals->Of(totalOf[i]);
+                std::string f = expr->name;
+
+                if (f == "AVG")
+                {
+                    printf("| %s(%s.%s) = %.2lf | ", expr->name, table, expr->expr->name, double(t.sum) / t.num);
+                }
+                else if (f == "SUM")
+                {
+                    printf("| %s(%s.%s) = %lld | ", expr->name, table, expr->expr->name, t.sum);
+                }
+                else if (f == "MAX")
+                {
+                    printf("| %s(%s.%s) = %d | ", expr->name, table, expr->expr->name, t.max);
+                }
+                else if (f == "MIN")
+                {
+                    printf("| %s(%s.%s) = %d | ", expr->name, table, expr->expr->name, t.min);
+                }
+                else if (f == "NUM")
+                {
+                    printf("| %s(%s.%s) = %d | ", expr->name, table, expr->expr->name, t.num);
+                }
+                else
+                {
+                    fprintf(stderr, "Unsupport function %s\n", expr->name);
                 }
             }
 
             printf("\n");
         }
 
-        printf("\n");
+        delete root;
+
+        if (rc == Success)printf("\n");
 
+        return rc;
     }
 
 };
@@ -0,0 +1,1420 @@
+#ifndef TM_EXEC_H
+#define TM_EXEC_H
+
+#include "rc.h"
+#include "type.h"
+#include "rm_record.h"
+#include "rm_filehandle.h"
+#include "ix_manager.h"
+#include "sql/statements.h"
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <regex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+/* whether a row passes, Error if it can't be told */
+typedef std::function<RC(RM_Record &, bool &)> TM_Predicate;
+
+/* a step of a query plan that hands its rows to the step above one at a
+ * time, so rows go from the table to the output without the whole result
+ * kept in between; only sorting holds its input. a step owns the steps
+ * below it */
+class TM_Operator
+{
+public:
+    virtual ~TM_Operator()
+    {
+    }
+
+    /* start the rows, or start them over after Close */
+    virtual RC Open() = 0;
+
+    /* the next row into rec, which the caller then owns and clears; flag
+     * is false once there are no more */
+    virtual RC Next(RM_Record &rec, bool &flag) = 0;
+
+    /* let go of what Open kept, it may be called again before Open */
+    virtual void Close()
+    {
+    }
+};
+
+/* every row of a table, in the order it is stored */
+class TM_TableScan : public TM_Operator
+{
+private:
+    const RM_FileHandle *rmfh;
+    RM_FileHandle::Cursor cursor;
+public:
+    TM_TableScan(const RM_FileHandle *_rmfh)
+        : rmfh(_rmfh), cursor(_rmfh->OpenCursor())
+    {
+    }
+
+    RC Open()
+    {
+        cursor = rmfh->OpenCursor();
+        return Success;
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        RID rid;
+        flag = rmfh->NextRec(cursor, rid, rec);
+        return Success;
+    }
+};
+
+/* the rows of an index range, in key order or backward; takes the bounds,
+ * NULL for none */
+class TM_IndexScan : public TM_Operator
+{
+private:
+    const RM_FileHandle *rmfh;
+    IX_Manager *index;
+    Type *left, *right;
+    bool left_open, right_open, reverse;
+    IX_Scan *scan;
+public:
+    TM_IndexScan(const RM_FileHandle *_rmfh, IX_Manager *_index, Type *_left, bool _left_open, Type *_right, bool _right_open, bool _reverse)
+        : rmfh(_rmfh), index(_index), left(_left), right(_right), left_open(_left_open), right_open(_right_open), reverse(_reverse), scan(NULL)
+    {
+    }
+    ~TM_IndexScan()
+    {
+        Close();
+        delete left;
+        delete right;
+    }
+
+    RC Open()
+    {
+        Close();
+        scan = index->OpenScan(left, left_open, right, right_open, reverse);
+        return scan ? Success : Error;
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        RID rid;
+        flag = false;
+
+        while (scan && scan->Next(rid))
+        {
+            if (rmfh->GetRec(rid, rec) == Success)
+            {
+                flag = true;
+                break;
+            }
+
+            rec.clear();
+        }
+
+        return Success;
+    }
+
+    void Close()
+    {
+        delete scan;
+        scan = NULL;
+    }
+};
+
+/* no rows, for a WHERE that no key can meet */
+class TM_SetScan : public TM_Operator
+{
+public:
+    RC Open()
+    {
+        return Success;
+    }
+
+    RC Next(RM_Record &, bool &flag)
+    {
+        flag = false;
+        return Success;
+    }
+};
+
+/* the rows of the rids an index answered a WHERE with, read from the table
+ * one at a time in the order given; only the rids are kept */
+class TM_RidScan : public TM_Operator
+{
+private:
+    const RM_FileHandle *rmfh;
+    std::vector<RID> rids;
+    size_t at;
+public:
+    /* takes the rids */
+    TM_RidScan(const RM_FileHandle *_rmfh, std::vector<RID> &_rids)
+        : rmfh(_rmfh), at(0)
+    {
+        rids.swap(_rids);
+    }
+
+    RC Open()
+    {
+        at = 0;
+        return Success;
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        flag = false;
+
+        while (at < rids.size())
+        {
+            if (rmfh->GetRec(rids[at++], rec) == Success)
+            {
+                flag = true;
+                break;
+            }
+
+            rec.clear();
+        }
+
+        return Success;
+    }
+};
+
+/* the rows of the entries of a composite index in [low, high), rebuilt
+ * from the entries without reading the table; columns the index doesn't
+ * hold are left as in the head */
+class TM_CoverScan : public TM_Operator
+{
+private:
+    const RM_FileHandle *rmfh;
+    IX_Manager *index;
+    std::vector<int> columns;
+    std::string low, high;
+    IX_TupleScan *scan;
+public:
+    TM_CoverScan(const RM_FileHandle *_rmfh, IX_Manager *_index, const std::vector<int> &_columns, const std::string &_low, const std::string &_high)
+        : rmfh(_rmfh), index(_index), columns(_columns), low(_low), high(_high), scan(NULL)
+    {
+    }
+    ~TM_CoverScan()
+    {
+        Close();
+    }
+
+    RC Open()
+    {
+        Close();
+
+        if (!(low < high))return Success;
+
+        scan = index->OpenTupleScan(low, high);
+        return scan ? Success : Error;
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        RID rid;
+        flag = scan && scan->Next(rid);
+
+        if (!flag)return Success;
+
+        std::string key = scan->Key();
+        size_t at = 0;
+        rec = rmfh->makeHead();
+
+        for (int i : columns)
+            bptree::tuple_codec::get_type(key, at, rec.get(i));
+
+        return Success;
+    }
+
+    void Close()
+    {
+        delete scan;
+        scan = NULL;
+    }
+};
+
+class TM_Filter : public TM_Operator
+{
+private:
+    TM_Operator *child;
+    TM_Predicate pass;
+public:
+    TM_Filter(TM_Operator *_child, TM_Predicate _pass)
+        : child(_child), pass(_pass)
+    {
+    }
+    ~TM_Filter()
+    {
+        delete child;
+    }
+
+    RC Open()
+    {
+        return child->Open();
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        while (true)
+        {
+            if (child->Next(rec, flag) == Error)return Error;
+
+            if (!flag)return Success;
+
+            bool ok = false;
+
+            if (pass(rec, ok) == Error)
+            {
+                rec.clear();
+                flag = false;
+                return Error;
+            }
+
+            if (ok)return Success;
+
+            rec.clear();
+        }
+    }
+
+    void Close()
+    {
+        child->Close();
+    }
+};
+
+/* the rows of child in a stable order, or that order reversed; Open reads
+ * them all */
+class TM_Sort : public TM_Operator
+{
+private:
+    TM_Operator *child;
+    Record_Less less;
+    bool reverse;
+    std::vector<RM_Record> rows;
+    size_t at;
+public:
+    TM_Sort(TM_Operator *_child, const Record_Less &_less, bool _reverse)
+        : child(_child), less(_less), reverse(_reverse), at(0)
+    {
+    }
+    ~TM_Sort()
+    {
+        Close();
+        delete child;
+    }
+
+    RC Open()
+    {
+        Close();
+
+        if (child->Open() == Error)return Error;
+
+        while (true)
+        {
+            RM_Record rec;
+            bool flag;
+
+            if (child->Next(rec, flag) == Error)return Error;
+
+            if (!flag)break;
+
+            rows.push_back(rec);
+        }
+
+        std::stable_sort(rows.begin(), rows.end(), less);
+
+        if (reverse)std::reverse(rows.begin(), rows.end());
+
+        return Success;
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        flag = at < rows.size();
+
+        if (flag)rec = rows[at++];
+
+        return Success;
+    }
+
+    void Close()
+    {
+        for (; at < rows.size(); at++)
+            rows[at].clear();
+
+        rows.clear();
+        at = 0;
+        child->Close();
+    }
+};
+
+/* skips offset rows and stops after limit more, without reading further */
+class TM_Limit : public TM_Operator
+{
+private:
+    TM_Operator *child;
+    long long offset, limit, seen;
+public:
+    TM_Limit(TM_Operator *_child, long long _offset, long long _limit)
+        : child(_child), offset(_offset), limit(_limit), seen(0)
+    {
+    }
+    ~TM_Limit()
+    {
+        delete child;
+    }
+
+    RC Open()
+    {
+        seen = 0;
+        return child->Open();
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        flag = false;
+
+        while (seen < offset || seen - offset < limit)
+        {
+            if (child->Next(rec, flag) == Error)return Error;
+
+            if (!flag)return Success;
+
+            if (seen++ >= offset)return Success;
+
+            rec.clear();
+            flag = false;
+        }
+
+        return Success;
+    }
+
+    void Close()
+    {
+        child->Close();
+    }
+};
+
+/* the rows of child, which come sorted by the group columns, one group at
+ * a time: Start opens child, NextGroup moves to a group and Next hands out
+ * its rows. Open and Close stay within the group, so the steps above it
+ * are opened and closed once per group */
+class TM_Group : public TM_Operator
+{
+private:
+    TM_Operator *child;
+    Record_Equal equal;
+    RM_Record key, ahead;
+    bool has_key, has_ahead;
+
+    RC advance()
+    {
+        ahead = RM_Record();
+        return child->Next(ahead, has_ahead);
+    }
+public:
+    TM_Group(TM_Operator *_child, const Record_Equal &_equal)
+        : child(_child), equal(_equal), has_key(false), has_ahead(false)
+    {
+    }
+    ~TM_Group()
+    {
+        if (has_key)key.clear();
+
+        if (has_ahead)ahead.clear();
+
+        child->Close();
+        delete child;
+    }
+
+    RC Start()
+    {
+        if (child->Open() == Error)return Error;
+
+        return advance();
+    }
+
+    /* flag is false once there are no more groups */
+    RC NextGroup(bool &flag)
+    {
+        // the rows of the group that weren't read
+        while (has_key && has_ahead && equal(key, ahead))
+        {
+            ahead.clear();
+
+            if (advance() == Error)return Error;
+        }
+
+        if (has_key)key.clear();
+
+        has_key = flag = has_ahead;
+
+        if (has_key)key = ahead.copy();
+
+        return Success;
+    }
+
+    /* the first row of the group */
+    RM_Record &Key()
+    {
+        return key;
+    }
+
+    RC Open()
+    {
+        return Success;
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        flag = has_key && has_ahead && equal(key, ahead);
+
+        if (!flag)return Success;
+
+        rec = ahead;
+        return advance();
+    }
+};
+
+/* rows a batch holds */
+#ifndef TM_BATCH
+#define TM_BATCH 1024
+#endif
+
+/* a comparison of an INT column with a constant */
+struct TM_IntTerm
+{
+    enum Op
+    {
+        EQ, NE, LT, LE, GT, GE
+    } op;
+    int column, value;
+
+    static bool compare(Op op, int a, int b)
+    {
+        switch (op)
+        {
+            case EQ:
+                return a == b;
+
+            case NE:
+                return a != b;
+
+            case LT:
+                return a < b;
+
+            case LE:
+                return a <= b;
+
+            case GT:
+                return a > b;
+
+            default:
+                return a >= b;
+        }
+    }
+};
+
+/* a LIKE pattern made ready once to be matched against many strings. it
+ * means what it always has: % is one or more characters, _ is one, [..]
+ * is a set as the regex library reads it, and the rest is given to the
+ * regex as it is. plain text with %, _ and simple sets is matched without
+ * the regex library, by comparing the whole string, its head or its tail,
+ * by a substring search, or by a wildcard walk. other patterns, and
+ * strings with line breaks, which the regex dot doesn't take, go through
+ * one regex built when first needed */
+class TM_Like
+{
+private:
+    // what one place of the pattern takes: a character, a set, or a run
+    struct Place
+    {
+        enum Kind
+        {
+            CHAR, SET, RUN
+        } kind;
+        unsigned char c;
+        std::bitset<256> in;
+    };
+
+    enum Shape
+    {
+        EXACT, PREFIX, SUFFIX, CONTAINS, WALK, REGEX
+    } shape;
+    bool bad;
+    std::string source, text;
+    std::vector<Place> places;
+    mutable std::shared_ptr<std::regex> regex;
+
+    /* the characters a simple [..] takes, false for one left to the regex */
+    static bool setOf(const std::string &inner, Place &place)
+    {
+        size_t i = inner[0] == '^';
+
+        if (i == inner.size())return false;
+
+        place.kind = Place::SET;
+
+        for (; i < inner.size(); i++)
+        {
+            unsigned char lo = inner[i], hi = lo;
+
+            if (i + 2 < inner.size() && inner[i + 1] == '-')
+            {
+                hi = inner[i + 2];
+                i += 2;
+            }
+
+            if (lo > hi || hi >= 0x80 || strchr("[]\\", lo) || strchr("[]\\", hi))return false;
+
+            for (int c = lo; c <= hi; c++)
+                place.in.set(c);
+        }
+
+        if (inner[0] == '^')place.in.flip();
+
+        return true;
+    }
+
+    bool walk(const char *s, size_t n) const
+    {
+        size_t i = 0, p = 0, star = std::string::npos, from = 0;
+
+        // a run is one character then a star; on a miss the last star
+        // takes one more character and the walk goes on from after it
+        while (i < n)
+        {
+            if (p < places.size() && places[p].kind == Place::RUN)
+            {
+                star = p;
+                from = ++i;
+                p++;
+            }
+            else if (p < places.size() && places[p].kind != Place::RUN &&
+                     (places[p].kind == Place::CHAR ? places[p].c == (unsigned char)s[i] : places[p].in.test((unsigned char)s[i])))
+            {
+                i++;
+                p++;
+            }
+            else if (star != std::string::npos)
+            {
+                i = ++from;
+                p = star + 1;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return p == places.size();
+    }
+
+    RC matchRegex(const char *s, bool &flag) const
+    {
+        try
+        {
+            if (!regex)regex.reset(new std::regex(source));
+
+            flag = std::regex_match(s, *regex);
+        }
+        catch (const std::regex_error &)
+        {
+            fprintf(stderr, "Like Expr is error.\n");
+            flag = false;
+            return Error;
+        }
+
+        return Success;
+    }
+
+public:
+    TM_Like(const char *pattern)
+        : shape(WALK), bad(false)
+    {
+        static const std::regex token("(%)|(_)|(\\[(.+?)\\])|(\\[(!.+?)\\])|(\\[(\\^.+?)\\])|([^\\[_%\\]]+)");
+        std::smatch result;
+        std::string str = pattern;
+        bool simple = true;
+
+        while (std::regex_search(str, result, token))
+        {
+            if (!result.prefix().str().empty())
+            {
+                bad = true;
+                return;
+            }
+
+            Place place;
+            place.kind = Place::SET;
+            place.c = 0;
+
+            if (result[1].matched)
+            {
+                source += ".+";
+                place.kind = Place::RUN;
+                places.push_back(place);
+            }
+            else if (result[2].matched)
+            {
+                source += ".";
+                place.in.set();
+                places.push_back(place);
+            }
+            else if (result[4].matched)
+            {
+                source += "[" + result.str(4) + "]";
+                simple = simple && setOf(result.str(4), place);
+                places.push_back(place);
+            }
+            else
+            {
+                std::string run = result.str(9);
+                source += run;
+                simple = simple && run.find_first_of(".^$|()*+?{}\\") == std::string::npos;
+                place.kind = Place::CHAR;
+
+                for (size_t i = 0; i < run.size(); i++)
+                {
+                    place.c = run[i];
+                    places.push_back(place);
+                }
+            }
+
+            str = result.suffix().str();
+        }
+
+        if (!simple)
+        {
+            shape = REGEX;
+            return;
+        }
+
+        // text between a run at each end, or at neither
+        size_t first = 0, last = places.size();
+        bool tail = first < last && places[last - 1].kind == Place::RUN;
+
+        if (tail)last--;
+
+        bool head = first < last && places[first].kind == Place::RUN;
+
+        if (head)first++;
+
+        for (size_t i = first; i < last; i++)
+        {
+            if (places[i].kind != Place::CHAR)return;
+
+            text.push_back(places[i].c);
+        }
+
+        if (!head && !tail)shape = EXACT;
+        else if (!head)shape = PREFIX;
+        else if (!tail)shape = SUFFIX;
+        else if (!text.empty())shape = CONTAINS;
+    }
+
+    /* whether every match is the text Prefix gives then one or more
+     * characters, so an index finds them in a range */
+    bool Prefix(std::string &prefix) const
+    {
+        prefix = text;
+        return !bad && shape == PREFIX;
+    }
+
+    /* whether Match prints an error */
+    bool Bad() const
+    {
+        return bad;
+    }
+
+    RC Match(const char *s, bool &flag) const
+    {
+        flag = false;
+
+        if (bad)
+        {
+            fprintf(stderr, "Like Expr is error.\n");
+            return Error;
+        }
+
+        size_t n = strlen(s), k = text.size();
+
+        if (shape == REGEX || strpbrk(s, "\n\r"))return matchRegex(s, flag);
+
+        switch (shape)
+        {
+            case EXACT:
+                flag = n == k && memcmp(s, text.data(), k) == 0;
+                break;
+
+            case PREFIX:
+                flag = n > k && memcmp(s, text.data(), k) == 0;
+                break;
+
+            case SUFFIX:
+                flag = n > k && memcmp(s + n - k, text.data(), k) == 0;
+                break;
+
+            case CONTAINS:
+                flag = n >= k + 2 && memmem(s + 1, n - 2, text.data(), k) != NULL;
+                break;
+
+            default:
+                flag = walk(s, n);
+        }
+
+        return Success;
+    }
+};
+
+/* one step of a compiled WHERE, see TM_Expr */
+struct TM_Step
+{
+    enum Code
+    {
+        INT_LIT,    // column `left` op `value`
+        STR_LIT,    // column `left` op `str`
+        INT_COL,    // column `left` op column `right`
+        STR_COL,
+        IS_NULL,    // column `left` op NULL
+        LIKE,       // column `left` LIKE `like`
+        CONST,      // `value`
+        JUMP_FALSE, // on to step `value` if the flag is false
+        JUMP_TRUE,
+        NOT,
+        SLOW        // the tree check of `expr`
+    } code;
+    TM_IntTerm::Op op;
+    // whether an error here is the statement's, a nested one only prints
+    bool top;
+    int left, right, value;
+    const char *str;
+    const hsql::Expr *expr;
+    const TM_Like *like;
+
+    /* whether running it may print an error */
+    bool loud() const
+    {
+        if (code == SLOW)return true;
+
+        if (code == LIKE)return like->Bad();
+
+        return op != TM_IntTerm::EQ && (code == INT_COL || code == STR_COL || code == IS_NULL);
+    }
+};
+
+/* a WHERE resolved once for a statement: column names are looked up, the
+ * operand types fixed and constant comparisons worked out up front, into
+ * a flat list of steps that leaves the result in one flag. a part the
+ * steps don't cover, or that is wrong, stays a SLOW step given to `slow`,
+ * so it prints and fails just as checking the tree did */
+class TM_Expr
+{
+public:
+    std::vector<TM_Step> steps;
+    std::vector<std::shared_ptr<TM_Like> > likes;
+    std::function<RC(const hsql::Expr &, RM_Record &, bool &)> slow;
+
+    RC Run(RM_Record &rec, bool &flag) const
+    {
+        flag = false;
+
+        for (size_t i = 0; i < steps.size(); i++)
+        {
+            const TM_Step &s = steps[i];
+            bool bad = false;
+
+            switch (s.code)
+            {
+                case TM_Step::INT_LIT:
+                {
+                    Type *t = rec.get(s.left);
+                    flag = !t->null && TM_IntTerm::compare(s.op, t->getValue(), s.value);
+                }
+                break;
+
+                case TM_Step::STR_LIT:
+                {
+                    Type *t = rec.get(s.left);
+                    flag = !t->null && TM_IntTerm::compare(s.op, strcmp(t->getStr(), s.str), 0);
+                }
+                break;
+
+                case TM_Step::INT_COL:
+                case TM_Step::STR_COL:
+                {
+                    Type *a = rec.get(s.left), *b = rec.get(s.right);
+
+                    if (a->null && b->null)
+                        bad = !(flag = s.op == TM_IntTerm::EQ);
+                    else if (a->null || b->null)
+                        flag = false;
+                    else if (s.code == TM_Step::INT_COL)
+                        flag = TM_IntTerm::compare(s.op, a->getValue(), b->getValue());
+                    else
+                        flag = TM_IntTerm::compare(s.op, strcmp(a->getStr(), b->getStr()), 0);
+                }
+                break;
+
+                case TM_Step::IS_NULL:
+                    flag = rec.get(s.left)->null;
+                    bad = flag && s.op != TM_IntTerm::EQ;
+                    break;
+
+                case TM_Step::LIKE:
+                {
+                    Type *t = rec.get(s.left);
+                    flag = false;
+
+                    if (!t->null && s.like->Match(t->getStr(), flag) == Error && s.top)return Error;
+                }
+                break;
+
+                case TM_Step::CONST:
+                    flag = s.value;
+                    break;
+
+                case TM_Step::JUMP_FALSE:
+                    if (!flag)i = s.value - 1;
+
+                    break;
+
+                case TM_Step::JUMP_TRUE:
+                    if (flag)i = s.value - 1;
+
+                    break;
+
+                case TM_Step::NOT:
+                    flag = !flag;
+                    break;
+
+                case TM_Step::SLOW:
+                    flag = false;
+
+                    if (slow(*s.expr, rec, flag) == Error && s.top)return Error;
+
+                    break;
+            }
+
+            // only NULL against NULL by anything but = gets here
+            if (bad)
+            {
+                fprintf(stderr, "The Expr Type is error.\n");
+
+                if (s.top)return Error;
+
+                flag = false;
+            }
+        }
+
+        return Success;
+    }
+};
+
+/* up to TM_BATCH rows of a table read at once: their rids, the values and
+ * NULL flags of the INT columns read, by column, and in sel the positions
+ * of the `selected` rows that passed the terms so far */
+struct TM_Batch
+{
+    int n, selected;
+    RID rids[TM_BATCH];
+    int sel[TM_BATCH];
+    std::vector<std::vector<int> > values;
+    std::vector<std::vector<char> > nulls;
+};
+
+/* the rows of a table that pass comparisons of INT columns with constants,
+ * taken a batch at a time: the columns are read straight from the pages
+ * into arrays, each comparison narrows the selected rows with one tight
+ * loop over them, and only the rows left are made into records, by Next.
+ * steps that can work on whole batches use NextBatch instead */
+class TM_BatchScan : public TM_Operator
+{
+private:
+    const RM_FileHandle *rmfh;
+    RM_FileHandle::Cursor cursor;
+    std::vector<TM_IntTerm> terms;
+    // the columns read, and where each sits in a stored record
+    std::vector<int> columns, offset;
+    TM_Batch batch;
+    int at;
+
+    template<class Cmp>
+    static int select(const int *v, const char *null, int value, int *sel, int n)
+    {
+        Cmp cmp;
+        int k = 0;
+
+        // keeps the row by moving the write position, not by a branch
+        for (int i = 0; i < n; i++)
+        {
+            int r = sel[i];
+            sel[k] = r;
+            k += !null[r] & cmp(v[r], value);
+        }
+
+        return k;
+    }
+
+    void narrow(const TM_IntTerm &term)
+    {
+        const int *v = batch.values[term.column].data();
+        const char *null = batch.nulls[term.column].data();
+        int &k = batch.selected;
+
+        switch (term.op)
+        {
+            case TM_IntTerm::EQ:
+                k = select<std::equal_to<int> >(v, null, term.value, batch.sel, k);
+                break;
+
+            case TM_IntTerm::NE:
+                k = select<std::not_equal_to<int> >(v, null, term.value, batch.sel, k);
+                break;
+
+            case TM_IntTerm::LT:
+                k = select<std::less<int> >(v, null, term.value, batch.sel, k);
+                break;
+
+            case TM_IntTerm::LE:
+                k = select<std::less_equal<int> >(v, null, term.value, batch.sel, k);
+                break;
+
+            case TM_IntTerm::GT:
+                k = select<std::greater<int> >(v, null, term.value, batch.sel, k);
+                break;
+
+            case TM_IntTerm::GE:
+                k = select<std::greater_equal<int> >(v, null, term.value, batch.sel, k);
+                break;
+        }
+    }
+public:
+    /* the table must not be index-organized; read lists the columns the
+     * steps above take from batches besides those of the terms, all INT */
+    TM_BatchScan(const RM_FileHandle *_rmfh, const std::vector<TM_IntTerm> &_terms, std::vector<int> read)
+        : rmfh(_rmfh), cursor(_rmfh->OpenCursor()), terms(_terms), at(0)
+    {
+        RM_Record head = rmfh->makeHead();
+        offset.assign(head.getSize(), -1);
+
+        for (int i = 0, pos = 4; i < head.getSize(); i++)
+        {
+            if (head.get(i)->sizeType != Type::sta)continue;
+
+            offset[i] = pos;
+            pos += head.get(i)->getSize();
+        }
+
+        head.clear();
+
+        for (const TM_IntTerm &term : terms)
+            read.push_back(term.column);
+
+        std::sort(read.begin(), read.end());
+        read.erase(std::unique(read.begin(), read.end()), read.end());
+        columns = read;
+        batch.values.resize(offset.size());
+        batch.nulls.resize(offset.size());
+
+        for (int c : columns)
+        {
+            batch.values[c].resize(TM_BATCH);
+            batch.nulls[c].resize(TM_BATCH);
+        }
+
+        batch.n = batch.selected = 0;
+    }
+
+    RC Open()
+    {
+        cursor = rmfh->OpenCursor();
+        batch.n = batch.selected = at = 0;
+        return Success;
+    }
+
+    /* the next batch with rows left after the terms, false once the table
+     * is read */
+    bool NextBatch()
+    {
+        RID rid;
+        Byte byte;
+        at = 0;
+
+        while (true)
+        {
+            int n = 0;
+
+            while (n < TM_BATCH && rmfh->NextBytes(cursor, rid, byte))
+            {
+                batch.rids[n] = rid;
+
+                for (int c : columns)
+                {
+                    batch.values[c][n] = RM_Record::intAt(byte, offset[c]);
+                    batch.nulls[c][n] = RM_Record::nullAt(byte, c);
+                }
+
+                n++;
+            }
+
+            batch.n = batch.selected = n;
+
+            if (n == 0)return false;
+
+            for (int i = 0; i < n; i++)
+                batch.sel[i] = i;
+
+            for (size_t i = 0; i < terms.size() && batch.selected; i++)
+                narrow(terms[i]);
+
+            if (batch.selected)return true;
+        }
+    }
+
+    const TM_Batch &Batch() const
+    {
+        return batch;
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        flag = true;
+
+        while (at == batch.selected)
+            if (!NextBatch())
+            {
+                flag = false;
+                return Success;
+            }
+
+        return rmfh->GetRec(batch.rids[batch.sel[at++]], rec);
+    }
+};
+
+/* passes the rows of child on and adds up the INT columns they hold. when
+ * the rows aren't wanted above and child is a TM_BatchScan, Open adds up
+ * whole batches of it instead and no rows are passed on */
+class TM_Aggregate : public TM_Operator
+{
+public:
+    struct Total
+    {
+        long long sum;
+        int num, min, max;
+    };
+private:
+    TM_Operator *child;
+    TM_BatchScan *batches;
+    std::vector<int> columns;
+    std::vector<Total> totals;
+    long long rows;
+
+    static void add(Total &t, const int *v, const int *sel, int n)
+    {
+        if (n == 0)return;
+
+        long long sum = 0;
+        int lo = t.num ? t.min : v[sel[0]], hi = t.num ? t.max : v[sel[0]];
+
+        for (int i = 0; i < n; i++)
+        {
+            int x = v[sel[i]];
+            sum += x;
+            lo = std::min(lo, x);
+            hi = std::max(hi, x);
+        }
+
+        t.sum += sum;
+        t.num += n;
+        t.min = lo;
+        t.max = hi;
+    }
+public:
+    TM_Aggregate(TM_Operator *_child, const std::vector<int> &_columns, bool wanted = true)
+        : child(_child), batches(wanted ? NULL : dynamic_cast<TM_BatchScan *>(_child)), columns(_columns), totals(_columns.size()), rows(0)
+    {
+    }
+    ~TM_Aggregate()
+    {
+        delete child;
+    }
+
+    RC Open()
+    {
+        rows = 0;
+
+        for (Total &t : totals)
+            t = Total {0, 0, 0, 0};
+
+        if (child->Open() == Error)return Error;
+
+        // NULLs add up as 0, as Type_int holds them
+        while (batches && batches->NextBatch())
+        {
+            const TM_Batch &batch = batches->Batch();
+            rows += batch.selected;
+
+            for (size_t i = 0; i < columns.size(); i++)
+                add(totals[i], batch.values[columns[i]].data(), batch.sel, batch.selected);
+        }
+
+        return Success;
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        if (batches)
+        {
+            flag = false;
+            return Success;
+        }
+
+        if (child->Next(rec, flag) == Error)return Error;
+
+        if (!flag)return Success;
+
+        rows++;
+
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            int v = rec.get(columns[i])->getValue();
+            Total &t = totals[i];
+            t.min = t.num ? std::min(t.min, v) : v;
+            t.max = t.num ? std::max(t.max, v) : v;
+            t.sum += v;
+            t.num++;
+        }
+
+        return Success;
+    }
+
+    void Close()
+    {
+        child->Close();
+    }
+
+    /* rows passed since Open */
+    long long Rows() const
+    {
+        return rows;
+    }
+
+    /* the total of columns[i] */
+    const Total &Of(int i) const
+    {
+        return totals[i];
+    }
+};
+
+/* the listed columns of the rows of child, in that order */
+class TM_Project : public TM_Operator
+{
+private:
+    TM_Operator *child;
+    std::vector<int> columns;
+public:
+    TM_Project(TM_Operator *_child, const std::vector<int> &_columns)
+        : child(_child), columns(_columns)
+    {
+    }
+    ~TM_Project()
+    {
+        delete child;
+    }
+
+    RC Open()
+    {
+        return child->Open();
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        RM_Record in;
+
+        if (child->Next(in, flag) == Error)return Error;
+
+        if (!flag)return Success;
+
+        for (int c : columns)
+            rec.push_back(in.get(c)->clone());
+
+        in.clear();
+        return Success;
+    }
+
+    void Close()
+    {
+        child->Close();
+    }
+};
+
+/* each row of outer followed by each row of inner, which is read again for
+ * every row of outer */
+class TM_NestedLoop : public TM_Operator
+{
+private:
+    TM_Operator *outer, *inner;
+    RM_Record current;
+    bool has_current;
+public:
+    TM_NestedLoop(TM_Operator *_outer, TM_Operator *_inner)
+        : outer(_outer), inner(_inner), has_current(false)
+    {
+    }
+    ~TM_NestedLoop()
+    {
+        Close();
+        delete outer;
+        delete inner;
+    }
+
+    RC Open()
+    {
+        Close();
+        return outer->Open();
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        while (true)
+        {
+            if (!has_current)
+            {
+                current = RM_Record();
+
+                if (outer->Next(current, has_current) == Error)return Error;
+
+                if (!has_current)
+                {
+                    flag = false;
+                    return Success;
+                }
+
+                inner->Close();
+
+                if (inner->Open() == Error)return Error;
+            }
+
+            RM_Record in;
+
+            if (inner->Next(in, flag) == Error)return Error;
+
+            if (flag)
+            {
+                rec = current.copy();
+                rec.append(in);
+                return Success;
+            }
+
+            current.clear();
+            has_current = false;
+        }
+    }
+
+    void Close()
+    {
+        if (has_current)current.clear();
+
+        has_current = false;
+        outer->Close();
+        inner->Close();
+    }
+};
+
+/* each row of outer followed by the rows of a table whose indexed column
+ * equals its column `column` and that pass `pass` */
+class TM_IndexJoin : public TM_Operator
+{
+private:
+    TM_Operator *outer;
+    const RM_FileHandle *rmfh;
+    IX_Manager *index;
+    int column;
+    TM_Predicate pass;
+    RM_Record current;
+    bool has_current;
+    std::vector<RID> rids;
+    size_t at;
+public:
+    TM_IndexJoin(TM_Operator *_outer, const RM_FileHandle *_rmfh, IX_Manager *_index, int _column, TM_Predicate _pass)
+        : outer(_outer), rmfh(_rmfh), index(_index), column(_column), pass(_pass), has_current(false), at(0)
+    {
+    }
+    ~TM_IndexJoin()
+    {
+        Close();
+        delete outer;
+    }
+
+    RC Open()
+    {
+        Close();
+        return outer->Open();
+    }
+
+    RC Next(RM_Record &rec, bool &flag)
+    {
+        while (true)
+        {
+            if (!has_current)
+            {
+                current = RM_Record();
+
+                if (outer->Next(current, has_current) == Error)return Error;
+
+                if (!has_current)
+                {
+                    flag = false;
+                    return Success;
+                }
+
+                // in page order, as a scan of the inner table would give them
+                rids = index->SearchEntry(current.get(column));
+                std::sort(rids.begin(), rids.end());
+                at = 0;
+            }
+
+            while (at < rids.size())
+            {
+                RM_Record in;
+                bool ok = false;
+
+                if (rmfh->GetRec(rids[at++], in) == Success && pass(in, ok) == Error)
+                {
+                    in.clear();
+                    return Error;
+                }
+
+                if (!ok)
+                {
+                    in.clear();
+                    continue;
+                }
+
+                rec = current.copy();
+                rec.append(in);
+                flag = true;
+                return Success;
+            }
+
+            current.clear();
+            has_current = false;
+        }
+    }
+
+    void Close()
+    {
+        if (has_current)current.clear();
+
+        has_current = false;
+        rids.clear();
+        outer->Close();
+    }
+};
+
+#endif
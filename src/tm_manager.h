@@ -2,15 +2,21 @@
 #define TM_MANAGER_H
 #include "rc.h"
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <climits>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <regex>
+#include <sstream>
 #include <string>
 #include "sql/statements.h"
 #include "rm_filehandle.h"
 #include "rm_manager.h"
 #include "rm_record.h"
 #include "ix_manager.h"
+#include "tm_stats.h"
+#include "tm_exec.h"
 
 namespace bf = boost::filesystem;
 
@@ -18,24 +24,45 @@ class TM_Manager
 {
 private:
     RM_Manager *rmm;
+    FileManager *fm;
+    BufPageManager *bpm;
     bf::path path;
 public:
     RM_FileHandle *rmfh;
+    TM_Stats *stats;
     std::map<std::string, IX_Manager *> indexst;
     std::vector<IX_Manager *> indexv;
+    /* a composite index: its entries hold the values of `columns` one
+     * after another and are ordered by the first `keys` of them, the rest
+     * are included so that queries can be answered from the index alone */
+    struct Composite
+    {
+        std::vector<int> columns;
+        size_t keys;
+        IX_Manager *index;
+    };
+    std::vector<Composite> indexc;
     TM_Manager(FileManager *fm, BufPageManager *bpm, bf::path path)
-        : path(path)
+        : fm(fm), bpm(bpm), path(path)
     {
         rmm = new RM_Manager(fm, bpm);
         rmfh = new RM_FileHandle(path);
         bool exists = boost::filesystem::exists(path / "data.db");
         rmm->CreateFile((path / "data.db").string().c_str());
         rmm->OpenFile((path / "data.db").string().c_str(), rmfh, !exists);
+        std::string organized;
+        makeComposite(NULL, NULL, &organized);
+
+        if (!organized.empty())
+            rmfh->organize(new RM_KeyFile(fm, bpm, (path / "rows.db").string().c_str(), makeHeadMap()[organized]));
+
+        stats = new TM_Stats((path / "stats").string().c_str());
         createIndex();
     }
 
     ~TM_Manager()
     {
+        delete stats;
         rmm->CloseFile(rmfh);
         delete rmfh;
         delete rmm;
@@ -44,12 +71,14 @@ public:
             delete it.second;
     }
 
-    RC createIndex(bool createNew = false)
+    RC createIndex(double fill = IX_FILL_FACTOR)
     {
         indexv.clear();
-        std::vector<std::pair<RID, RM_Record> > alldata;
-
-        if (createNew)alldata = rmfh->ListRec();
+        indexc.clear();
+        std::vector<std::pair<std::vector<int>, IX_Build *> > builds;
+        std::vector<std::string> hashed, bloomed, buffered;
+        std::string organized;
+        std::vector<std::string> composites = makeComposite(&hashed, &bloomed, &organized, &buffered);
 
         bf::path filename = path / configFile;
         std::ifstream fi(filename.string());
@@ -81,16 +110,42 @@ public:
                 data = Type::make(!notnull, "", len);
             }
 
+            IX_Kind kind = IX_BTREE;
+
+            if (std::find(hashed.begin(), hashed.end(), name) != hashed.end())
+                kind = IX_HASH;
+            else if (std::find(buffered.begin(), buffered.end(), name) != buffered.end())
+                kind = IX_LSM;
+
+            bool bloom = std::find(bloomed.begin(), bloomed.end(), name) != bloomed.end();
+            auto old = indexst.find(name);
+
+            // an index changed to another kind, or given a filter, is made anew
+            if (index && old != indexst.end() && (old->second->Kind() != kind || old->second->Filtered() != bloom))
+            {
+                delete old->second;
+                bf::remove(path / ("_" + name + ".db"));
+                bf::remove(path / ("_" + name + ".bloom"));
+                bf::remove_all(path / ("_" + name + ".lsm"));
+                indexst.erase(old);
+            }
+
+            // the rows of an organized table are the entries of its key
+            if (index && name == organized && indexst.find(name) == indexst.end())
+                indexst.insert(make_pair(name, new IX_Manager(rmfh->keyFile())));
+
             if (index && indexst.find(name) == indexst.end())
             {
-                bf::path f1 = path / ("_" + name + ".db");
-                bf::path f2 = path / ("_deque_" + name + ".db");
-                IX_Manager *it = new IX_Manager(f1.c_str(), primary ? NULL : f2.c_str(), data);
+                bf::path f1 = path / ("_" + name + (kind == IX_LSM ? ".lsm" : ".db")), f2 = path / ("_" + name + ".bloom");
+                IX_Manager *it = new IX_Manager(fm, bpm, f1.c_str(), data, kind, type == "CHAR" ? len : 0, bloom ? f2.c_str() : NULL);
                 indexst.insert(make_pair(name, it));
 
-                for (auto data : alldata)
+                // a new index, or one whose file was missing or unreadable
+                if (it->NeedsBuild())
                 {
-                    it->InsertEntry(data.second.get(i), data.first);
+                    IX_Build *build = it->OpenBuild(fill);
+
+                    if (build)builds.push_back(make_pair(std::vector<int>(1, i), build));
                 }
             }
 
@@ -98,17 +153,63 @@ public:
             indexv.push_back(it == indexst.end() ? NULL : it->second);
         }
 
-        for (auto it : alldata)
+        fi.close();
+        std::map<string, int> st = makeHeadMap();
+
+        for (auto name : composites)
         {
-            it.second.clear();
+            Composite composite = compositeOf(name, st);
+
+            if (indexst.find(name) == indexst.end())
+            {
+                bf::path f1 = path / ("_" + name + ".db");
+                IX_Manager *it = new IX_Manager(fm, bpm, f1.c_str());
+                indexst.insert(make_pair(name, it));
+
+                if (it->NeedsBuild())
+                {
+                    IX_Build *build = it->OpenBuild(fill);
+
+                    if (build)builds.push_back(make_pair(composite.columns, build));
+                }
+            }
+
+            composite.index = indexst.find(name)->second;
+            indexc.push_back(composite);
         }
 
-        return Success;
+        return buildIndex(builds);
+    }
+
+    /* one pass over the table feeds every index being built, each with
+     * the positions of its columns */
+    RC buildIndex(std::vector<std::pair<std::vector<int>, IX_Build *> > &builds)
+    {
+        RC rc = Success;
+
+        if (!builds.empty())
+        {
+            rmfh->ScanRec([&](const RID & rid, RM_Record & rec)
+            {
+                for (auto build : builds)
+                    if (build.second->Add(keyOf(rec, build.first), rid) != Success)rc = Error;
+            });
+        }
+
+        for (auto build : builds)
+        {
+            if (rc == Success && build.second->Finish() != Success)rc = Error;
+
+            delete build.second;
+        }
+
+        return rc;
     }
 
     RC dropIndex()
     {
         indexv.clear();
+        indexc.clear();
         bf::path filename = path / configFile;
         std::ifstream fi(filename.string());
         int n;
@@ -131,10 +232,9 @@ public:
             {
                 delete it->second;
                 bf::path f1 = path / ("_" + name + ".db");
-                bf::path f2 = path / ("deque_" + name + ".db");
                 bf::remove(f1);
-
-                if (!primary)bf::remove(f2);
+                bf::remove(path / ("_" + name + ".bloom"));
+                bf::remove_all(path / ("_" + name + ".lsm"));
 
                 indexst.erase(it);
             }
@@ -143,9 +243,138 @@ public:
             indexv.push_back(it == indexst.end() ? NULL : it->second);
         }
 
+        fi.close();
+        std::map<string, int> st = makeHeadMap();
+        std::vector<std::string> composite = makeComposite();
+
+        // composite indexes are named by their columns joined with commas,
+        // a covering one lists its included columns after a semicolon
+        for (auto it = indexst.begin(); it != indexst.end();)
+        {
+            if (it->first.find_first_of(",;") == std::string::npos ||
+                    std::find(composite.begin(), composite.end(), it->first) != composite.end())
+            {
+                ++it;
+                continue;
+            }
+
+            delete it->second;
+            bf::remove(path / ("_" + it->first + ".db"));
+            indexst.erase(it++);
+        }
+
+        for (auto name : composite)
+        {
+            indexc.push_back(compositeOf(name, st));
+            indexc.back().index = indexst.find(name)->second;
+        }
+
+        return Success;
+    }
+
+    RC rebuildIndex(const std::string &name, double fill = IX_FILL_FACTOR)
+    {
+        auto it = indexst.find(name);
+
+        if (it == indexst.end())
+        {
+            fprintf(stderr, "Column %s Index doesn't exist\n", name.c_str());
+            return Error;
+        }
+
+        // a filter sheds deleted keys only when built from the table
+        if (it->second->Filtered())
+        {
+            std::map<string, int> st = makeHeadMap();
+            IX_Build *build = it->second->OpenBuild(fill);
+            std::vector<std::pair<std::vector<int>, IX_Build *> > builds;
+
+            if (build)builds.push_back(make_pair(std::vector<int>(1, st[name]), build));
+
+            return buildIndex(builds);
+        }
+
+        return it->second->Rebuild(fill);
+    }
+
+    /* move the rows out of the heap pages into a B+ tree ordered by the
+     * column, which must be an INT key; every index is dropped as the rows
+     * get new rids, createIndex builds them again once the config names
+     * the table organized */
+    RC organize(const std::string &column, double fill = IX_FILL_FACTOR)
+    {
+        bf::path file = path / "rows.db";
+        RM_KeyFile *rows = new RM_KeyFile(fm, bpm, file.string().c_str(), makeHeadMap()[column]);
+        IX_Sort<std::string> sorter;
+        RC rc = Success;
+
+        rmfh->ScanRec([&](const RID &, RM_Record & rec)
+        {
+            if (sorter.Add(rows->Entry(rec)) != Success)rc = Error;
+        });
+
+        auto next = [&](std::string & entry)
+        {
+            return sorter.Next(entry);
+        };
+
+        if (rc == Success)rc = sorter.Finish();
+
+        if (rc == Success && rows->Load(next, sorter.Size(), fill) != Success)
+        {
+            fprintf(stderr, "Column %s has NULL or repeated values\n", column.c_str());
+            rc = Error;
+        }
+
+        if (rc != Success)
+        {
+            delete rows;
+            bf::remove(file);
+            return Error;
+        }
+
+        rmfh->init(bpm, rmfh->getFileId(), true);
+        rmfh->organize(rows);
+
+        for (auto it : indexst)
+        {
+            delete it.second;
+            bf::remove(path / ("_" + it.first + ".db"));
+            bf::remove(path / ("_" + it.first + ".bloom"));
+            bf::remove_all(path / ("_" + it.first + ".lsm"));
+        }
+
+        indexst.clear();
+        indexv.clear();
+        indexc.clear();
+        return Success;
+    }
+
+    /* gather the stats of the table from all its rows */
+    RC analyze()
+    {
+        stats->Begin(makeHeadMap().size());
+        rmfh->ScanRec([&](const RID &, RM_Record & rec)
+        {
+            stats->Add(rec);
+        });
+        stats->Finish(rmfh->PageCount());
         return Success;
     }
 
+    /* analyze again once the stats drifted too far from the table */
+    void refreshStats()
+    {
+        if (stats->Stale())analyze();
+    }
+
+    /* rebuild indexes that deletes have left mostly free */
+    void compactIndex()
+    {
+        for (auto it : indexst)
+            if (it.second->Fragmented())rebuildIndex(it.first);
+    }
+
     std::map<string, int> makeHeadMap()
     {
         bf::path filename = path / configFile;
@@ -170,6 +399,157 @@ public:
         return st;
     }
 
+    /* names of the composite indexes, listed after the checks in the config,
+     * into `hashed` the columns with hash indexes, listed after those, and
+     * into `bloomed` the columns whose indexes have Bloom filters, into
+     * `organized` the key an index-organized table keeps its rows by, and
+     * into `buffered` the columns with LSM indexes, last */
+    std::vector<std::string> makeComposite(std::vector<std::string> *hashed = NULL, std::vector<std::string> *bloomed = NULL,
+                                           std::string *organized = NULL, std::vector<std::string> *buffered = NULL)
+    {
+        bf::path filename = path / configFile;
+        std::ifstream fi(filename.string());
+        int n, m;
+        fi >> n;
+        std::vector<std::string> v;
+
+        for (int i = 0; i < n; i++)
+        {
+            std::string name, type;
+            bool notnull, index, primary;
+            int len;
+            getline(fi, name);
+
+            if (name.empty())getline(fi, name);
+
+            fi >> type >> len >> notnull >> index >> primary;
+        }
+
+        fi >> m;
+
+        for (int i = 0; i < m; i++)
+        {
+            std::string check;
+            getline(fi, check);
+
+            if (check.empty())getline(fi, check);
+        }
+
+        // tables created before composite indexes have no such section
+        if (!(fi >> m))return v;
+
+        for (int i = 0; i < m; i++)
+        {
+            std::string name;
+            fi >> name;
+            v.push_back(name);
+        }
+
+        // nor does one from before hash indexes have the next, and so on
+        if (!(fi >> m))return v;
+
+        for (int i = 0; i < m; i++)
+        {
+            std::string name;
+            fi >> name;
+
+            if (hashed)hashed->push_back(name);
+        }
+
+        if (!(fi >> m))return v;
+
+        for (int i = 0; i < m; i++)
+        {
+            std::string name;
+            fi >> name;
+
+            if (bloomed)bloomed->push_back(name);
+        }
+
+        if (!(fi >> m))return v;
+
+        if (m == 1)
+        {
+            std::string name;
+            fi >> name;
+
+            if (organized)*organized = name;
+        }
+
+        if (!(fi >> m))return v;
+
+        for (int i = 0; i < m; i++)
+        {
+            std::string name;
+            fi >> name;
+
+            if (buffered)buffered->push_back(name);
+        }
+
+        return v;
+    }
+
+    /* the columns of a composite index named "a,b,...", followed by
+     * ";c,d,..." if it includes more */
+    static Composite compositeOf(const std::string &name, const std::map<string, int> &st)
+    {
+        Composite composite;
+        std::istringstream in(name);
+        std::string part, column;
+        getline(in, part, ';');
+
+        for (int keys = 0; keys < 2; keys++)
+        {
+            std::istringstream list(part);
+
+            while (getline(list, column, ','))
+                composite.columns.push_back(st.find(column)->second);
+
+            if (keys == 0)composite.keys = composite.columns.size();
+
+            part.clear();
+            getline(in, part);
+        }
+
+        composite.index = NULL;
+        return composite;
+    }
+
+    /* the values of a record that make up an index key */
+    static std::vector<Type *> keyOf(RM_Record &rec, const std::vector<int> &columns)
+    {
+        std::vector<Type *> key;
+
+        for (int i : columns)
+            key.push_back(rec.get(i));
+
+        return key;
+    }
+
+    std::vector<bool> makeNotNull()
+    {
+        bf::path filename = path / configFile;
+        std::ifstream fi(filename.string());
+        int n;
+        fi >> n;
+        std::vector<bool> v;
+
+        for (int i = 0; i < n; i++)
+        {
+            std::string name, type;
+            bool notnull, index, primary;
+            int len;
+            getline(fi, name);
+
+            if (name.empty())getline(fi, name);
+
+            fi >> type >> len >> notnull >> index >> primary;
+            v.push_back(notnull);
+        }
+
+        return v;
+    }
+
     RC insertRecord(std::vector<hsql::Expr *> values)
     {
 
@@ -331,11 +711,30 @@ public:
 
         for (int i = 0; i < indexv.size(); i++)if (indexv[i])indexv[i]->InsertEntry(head.get(i), rid);
 
+        for (auto it : indexc)it.index->InsertEntry(keyOf(head, it.columns), rid);
+
+        if (result == Success)stats->Insert(head);
+
         head.clear();
+        refreshStats();
         return result;
 
     }
 
+    /* the column a reference names; rows joined from several tables are
+     * looked up as table.column first */
+    static std::map<string, int>::const_iterator columnOf(const hsql::Expr &ref, const std::map<string, int> &st)
+    {
+        if (ref.table)
+        {
+            auto it = st.find(std::string(ref.table) + "." + ref.name);
+
+            if (it != st.end())return it;
+        }
+
+        return st.find(std::string(ref.name));
+    }
+
     RC check(const hsql::Expr &expr, const std::map<string, int> &st, RM_Record &rec, bool &flag)
     {
         if (expr.type != hsql::kExprOperator)
@@ -353,7 +752,7 @@ public:
         {
             case hsql::kExprColumnRef:
             {
-                auto it = st.find(std::string(expr.expr->name));
+                auto it = columnOf(*expr.expr, st);
 
                 if (it == st.end())
                 {
@@ -432,7 +831,7 @@ public:
         {
             case hsql::kExprColumnRef:
             {
-                auto it = st.find(std::string(expr.expr2->name));
+                auto it = columnOf(*expr.expr2, st);
 
                 if (it == st.end())
                 {
@@ -607,66 +1006,9 @@ public:
                 break;
 
             case hsql::Expr::LIKE:
-            {
-                std::smatch result;
-                std::regex reg("(%)|(_)|(\\[(.+?)\\])|(\\[(!.+?)\\])|(\\[(\\^.+?)\\])|([^\\[_%\\]]+)");
-                std::string str = cright, ans;
-
-                while (std::regex_search(str, result, reg))
-                {
-                    if (!result.prefix().str().empty())
-                    {
-                        fprintf(stderr, "Like Expr is error.\n");
-                        return Error;
-                    }
+                if (TM_Like(cright).Match(cleft, flag) == Error)return Error;
 
-                    for (size_t i = 0; i < result.size(); ++i)
-                    {
-                        if (result.str(i).empty())continue;
-
-                        switch (i)
-                        {
-                            case 1:
-                                ans += ".+";
-                                break;
-
-                            case 2:
-                                ans += ".";
-                                break;
-
-                            case 4:
-                                ans += "[" + result.str(i) + "]";
-                                break;
-
-                            case 6:
-                                ans += "[^" + result.str(i).substr(1) + "]";
-                                break;
-
-                            case 8:
-                                ans += "[" + result.str(i) + "]";
-                                break;
-
-                            case 9:
-                                ans += result.str(i);
-                                break;
-                        }
-                    }
-
-                    str = result.suffix().str();
-                }
-
-                try
-                {
-                    std::regex r(ans);
-                    flag = std::regex_match(cleft, r);
-                }
-                catch (std::regex_error e)
-                {
-                    fprintf(stderr, "Like Expr is error.\n");
-                    return Error;
-                }
-            }
-            break;
+                break;
 
             default:
                 fprintf(stderr, "The Expr Operation is error.\n");
@@ -678,31 +1020,570 @@ public:
 
     }
 
-    RC getSet(const hsql::Expr &expr, const std::map<string, int> &st, std::map<RID, RM_Record> &ans, bool &flag)
+    /* the comparison expr makes, turned round if `flip`; false for one
+     * that isn't a plain comparison */
+    static bool opOf(const hsql::Expr &expr, bool flip, TM_IntTerm::Op &op)
     {
-        if (expr.type != hsql::kExprOperator)
+        switch (expr.op_type)
         {
-            fprintf(stderr, "Where Expr should be a bool expression.\n");
-            return Error;
+            case hsql::Expr::SIMPLE_OP:
+                if (expr.op_char == '=')op = TM_IntTerm::EQ;
+                else if (expr.op_char == '<')op = flip ? TM_IntTerm::GT : TM_IntTerm::LT;
+                else if (expr.op_char == '>')op = flip ? TM_IntTerm::LT : TM_IntTerm::GT;
+                else return false;
+
+                return true;
+
+            case hsql::Expr::NOT_EQUALS:
+                op = TM_IntTerm::NE;
+                return true;
+
+            case hsql::Expr::LESS_EQ:
+                op = flip ? TM_IntTerm::GE : TM_IntTerm::LE;
+                return true;
+
+            case hsql::Expr::GREATER_EQ:
+                op = flip ? TM_IntTerm::LE : TM_IntTerm::GE;
+                return true;
+
+            default:
+                return false;
         }
+    }
 
-        int tleft = 0;
-        std::map<RID, RM_Record> sleft;
-        RM_Record head = rmfh->makeHead();
-        Type *data;
-        IX_Manager *index;
+    /* what a side of a comparison is, as check tells them apart: 0 an INT,
+     * 1 a string, 3 NULL, with its position in rec or -1 for a literal;
+     * false if only check can take it */
+    static bool operandOf(const hsql::Expr &expr, const std::map<string, int> &st, RM_Record &rec, int &kind, int &column)
+    {
+        column = -1;
 
-        switch (expr.expr->type)
+        switch (expr.type)
         {
             case hsql::kExprColumnRef:
             {
-                auto it = st.find(std::string(expr.expr->name));
+                auto it = columnOf(expr, st);
 
-                if (it == st.end())
-                {
-                    fprintf(stderr, "Column %s is not found.\n", expr.expr->name);
-                    return Error;
-                }
+                if (it == st.end())return false;
+
+                Type *t = rec.get(it->second);
+
+                if (t->isInt())kind = 0;
+                else if (t->isStr())kind = 1;
+                else return false;
+
+                column = it->second;
+                return true;
+            }
+
+            case hsql::kExprLiteralInt:
+                kind = 0;
+                return true;
+
+            case hsql::kExprLiteralString:
+                kind = 1;
+                return true;
+
+            case hsql::kExprLiteralNull:
+                kind = 3;
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    /* append the steps that leave in the flag what check would for expr,
+     * on rows shaped like rec; `top` if expr is a term of its own, whose
+     * errors fail the statement where check ignores nested ones */
+    void compile(const hsql::Expr &expr, const std::map<string, int> &st, RM_Record &rec, bool top, TM_Expr &program)
+    {
+        std::vector<TM_Step> &steps = program.steps;
+        TM_Step step = TM_Step();
+        step.code = TM_Step::SLOW;
+        step.top = top;
+        step.expr = &expr;
+
+        if (expr.type != hsql::kExprOperator || !expr.expr)
+        {
+            steps.push_back(step);
+            return;
+        }
+
+        if (expr.op_type == hsql::Expr::NOT)
+        {
+            if (expr.expr->type == hsql::kExprOperator)
+            {
+                compile(*expr.expr, st, rec, false, program);
+                step.code = TM_Step::NOT;
+            }
+
+            steps.push_back(step);
+            return;
+        }
+
+        if (!expr.expr2)
+        {
+            steps.push_back(step);
+            return;
+        }
+
+        if (expr.op_type == hsql::Expr::AND || expr.op_type == hsql::Expr::OR)
+        {
+            if (expr.expr->type != hsql::kExprOperator || expr.expr2->type != hsql::kExprOperator)
+            {
+                steps.push_back(step);
+                return;
+            }
+
+            size_t start = steps.size();
+            compile(*expr.expr, st, rec, false, program);
+            size_t jump = steps.size();
+            steps.push_back(step);
+            steps[jump].code = expr.op_type == hsql::Expr::AND ? TM_Step::JUMP_FALSE : TM_Step::JUMP_TRUE;
+            compile(*expr.expr2, st, rec, false, program);
+            steps[jump].value = steps.size();
+
+            // check works out both sides, so a right side that may print
+            // an error can't be skipped
+            for (size_t i = jump + 1; i < steps.size(); i++)
+            {
+                if (steps[i].loud())
+                {
+                    steps.resize(start);
+                    steps.push_back(step);
+                    return;
+                }
+            }
+
+            return;
+        }
+
+        const hsql::Expr *a = expr.expr, *b = expr.expr2;
+        int ka, kb, ca, cb;
+
+        // a pattern given as a string is made ready here, once
+        if (expr.op_type == hsql::Expr::LIKE && b->type == hsql::kExprLiteralString && operandOf(*a, st, rec, ka, ca) && ka == 1 && ca >= 0)
+        {
+            program.likes.push_back(std::shared_ptr<TM_Like>(new TM_Like(b->name)));
+            step.code = TM_Step::LIKE;
+            step.left = ca;
+            step.like = program.likes.back().get();
+            steps.push_back(step);
+            return;
+        }
+
+        if (!opOf(expr, false, step.op) || !operandOf(*a, st, rec, ka, ca) || !operandOf(*b, st, rec, kb, cb))
+        {
+            steps.push_back(step);
+            return;
+        }
+
+        // the column goes first
+        if (ca < 0 && cb >= 0)
+        {
+            std::swap(a, b);
+            std::swap(ka, kb);
+            std::swap(ca, cb);
+            opOf(expr, true, step.op);
+        }
+
+        if (ca < 0)
+        {
+            // two literals, worked out now unless they are an error
+            if (ka == 3 || kb == 3)
+            {
+                if (ka == kb && step.op != TM_IntTerm::EQ)
+                {
+                    steps.push_back(step);
+                    return;
+                }
+
+                step.value = ka == kb;
+            }
+            else if (ka != kb)
+            {
+                steps.push_back(step);
+                return;
+            }
+            else if (ka == 0)
+            {
+                step.value = TM_IntTerm::compare(step.op, (int)a->ival, (int)b->ival);
+            }
+            else
+            {
+                step.value = TM_IntTerm::compare(step.op, strcmp(a->name, b->name), 0);
+            }
+
+            step.code = TM_Step::CONST;
+        }
+        else if (kb == 3)
+        {
+            step.code = TM_Step::IS_NULL;
+        }
+        else if (ka != kb)
+        {
+            // an error unless the column is NULL, left to check
+            steps.push_back(step);
+            return;
+        }
+        else if (cb < 0)
+        {
+            step.code = ka == 0 ? TM_Step::INT_LIT : TM_Step::STR_LIT;
+            step.value = (int)b->ival;
+            step.str = b->name;
+        }
+        else
+        {
+            step.code = ka == 0 ? TM_Step::INT_COL : TM_Step::STR_COL;
+            step.right = cb;
+        }
+
+        step.left = ca;
+        steps.push_back(step);
+    }
+
+    /* the comparisons of column op literal that are ANDed in `expr` */
+    static void conjuncts(const hsql::Expr &expr, const std::map<string, int> &st, std::vector<std::pair<int, const hsql::Expr *> > &terms)
+    {
+        if (expr.type != hsql::kExprOperator || !expr.expr || !expr.expr2)return;
+
+        if (expr.op_type == hsql::Expr::AND)
+        {
+            conjuncts(*expr.expr, st, terms);
+            conjuncts(*expr.expr2, st, terms);
+            return;
+        }
+
+        if (expr.expr->type != hsql::kExprColumnRef)return;
+
+        auto it = st.find(expr.expr->name);
+
+        if (it != st.end())terms.push_back(make_pair(it->second, &expr));
+    }
+
+    /* append the literal a comparison holds as a key column of `data`'s
+     * type, false if the index can't use it */
+    static bool literalOf(const hsql::Expr &expr, Type *data, std::string &s)
+    {
+        if (expr.type == hsql::kExprLiteralInt && data->isInt() && expr.ival >= INT_MIN && expr.ival <= INT_MAX)
+            bptree::tuple_codec::put_int(s, expr.ival);
+        else if (expr.type == hsql::kExprLiteralString && data->isStr())
+            bptree::tuple_codec::put_str(s, expr.name, strlen(expr.name));
+        else
+            return false;
+
+        return true;
+    }
+
+    /* set value to the literal a comparison holds, false if it doesn't fit */
+    static bool valueOf(const hsql::Expr &literal, Type *value)
+    {
+        if (literal.type == hsql::kExprLiteralNull)
+            value->setnull();
+        else if (literal.type == hsql::kExprLiteralInt && value->isInt() && literal.ival >= INT_MIN && literal.ival <= INT_MAX)
+            value->set((int)literal.ival);
+        else if (literal.type == hsql::kExprLiteralString && value->isStr())
+            value->set(literal.name, strlen(literal.name));
+        else
+            return false;
+
+        return true;
+    }
+
+    /* fraction of the rows a composite index keeps: the equalities on its
+     * leading columns and the bounds on the column after them, taken as
+     * independent; a comparison the stats can't read keeps every row */
+    double compositeFraction(const Composite &index, const std::vector<const hsql::Expr *> &fixed, const hsql::Expr *lowTerm, const hsql::Expr *highTerm)
+    {
+        RM_Record lowRec = rmfh->makeHead(), highRec = rmfh->makeHead();
+        double fraction = 1;
+
+        for (size_t i = 0; i < fixed.size(); i++)
+        {
+            Type *value = lowRec.get(index.columns[i]);
+
+            if (valueOf(*fixed[i]->expr2, value))fraction *= stats->Equal(index.columns[i], value);
+        }
+
+        if (lowTerm || highTerm)
+        {
+            int column = index.columns[fixed.size()];
+            Type *low = lowRec.get(column), *high = highRec.get(column);
+
+            if (!lowTerm || !valueOf(*lowTerm->expr2, low))low = NULL;
+
+            if (!highTerm || !valueOf(*highTerm->expr2, high))high = NULL;
+
+            bool lowOpen = lowTerm && lowTerm->op_type == hsql::Expr::SIMPLE_OP;
+            bool highOpen = highTerm && highTerm->op_type == hsql::Expr::SIMPLE_OP;
+            fraction *= stats->Between(column, low, high, lowOpen, highOpen);
+        }
+
+        lowRec.clear();
+        highRec.clear();
+        return fraction;
+    }
+
+    /* the composite index that fixes the most leading columns of an AND
+     * chain by equality, the column after them may be bounded by a range,
+     * and the entries [low, high) it keeps; covering is whether it holds
+     * every column in `need`. NULL if none fits, or if it doesn't cover
+     * and the stats tell a scan is cheaper; access is how to read it */
+    const Composite *composite(const hsql::Expr &expr, const std::map<string, int> &st, const std::vector<bool> *need, bool &covering, std::string &low, std::string &high, TM_Stats::Access &access)
+    {
+        std::vector<std::pair<int, const hsql::Expr *> > terms;
+        conjuncts(expr, st, terms);
+        RM_Record head = rmfh->makeHead();
+        const Composite *best = NULL;
+        // the comparisons the best index uses, for its selectivity
+        std::vector<const hsql::Expr *> bestFixed;
+        const hsql::Expr *bestLow = NULL, *bestHigh = NULL;
+        size_t score = 0;
+        covering = false;
+
+        for (const Composite &index : indexc)
+        {
+            const std::vector<int> &columns = index.columns;
+            std::vector<const hsql::Expr *> fixedTerms;
+            const hsql::Expr *lowTerm = NULL, *highTerm = NULL;
+            std::string prefix;
+            size_t k = 0;
+
+            for (; k < index.keys; k++)
+            {
+                bool fixed = false;
+
+                for (auto term : terms)
+                {
+                    const hsql::Expr &e = *term.second;
+
+                    if (term.first != columns[k] || e.op_type != hsql::Expr::SIMPLE_OP || e.op_char != '=')continue;
+
+                    if (e.expr2->type == hsql::kExprLiteralNull)
+                    {
+                        bptree::tuple_codec::put_null(prefix);
+                        fixed = true;
+                    }
+                    else
+                    {
+                        fixed = literalOf(*e.expr2, head.get(columns[k]), prefix);
+                    }
+
+                    if (fixed)
+                    {
+                        fixedTerms.push_back(&e);
+                        break;
+                    }
+                }
+
+                if (!fixed)break;
+            }
+
+            // entries of the prefix are in [prefix, prefix + 0xff), the
+            // column after it leaves out NULL, which sorts last, once bounded
+            std::string lo = prefix, hi = prefix + '\xff';
+            bool range = false;
+
+            for (auto term : terms)
+            {
+                const hsql::Expr &e = *term.second;
+                std::string v = prefix, text;
+
+                // 'abc%' is every key that runs on from 'abc', up to 'abd'
+                if (e.op_type == hsql::Expr::LIKE && k < index.keys && term.first == columns[k] && head.get(columns[k])->isStr() &&
+                        e.expr2->type == hsql::kExprLiteralString && TM_Like(e.expr2->name).Prefix(text))
+                {
+                    if (!range)hi = prefix + '\1';
+
+                    range = true;
+                    bptree::tuple_codec::put_str(v, text.c_str(), text.size());
+                    v.back() = '\1';
+                    lo = std::max(lo, v);
+
+                    while (!text.empty() && (unsigned char)text.back() == 0xff)
+                        text.pop_back();
+
+                    if (text.empty())continue;
+
+                    text.back()++;
+                    v = prefix;
+                    bptree::tuple_codec::put_str(v, text.c_str(), text.size());
+                    v.pop_back();
+                    hi = std::min(hi, v);
+                    continue;
+                }
+
+                bool bound = e.op_type == hsql::Expr::LESS_EQ || e.op_type == hsql::Expr::GREATER_EQ ||
+                             (e.op_type == hsql::Expr::SIMPLE_OP && (e.op_char == '<' || e.op_char == '>'));
+
+                if (!bound || k == index.keys || term.first != columns[k] || !literalOf(*e.expr2, head.get(columns[k]), v))continue;
+
+                if (!range)hi = prefix + '\1';
+
+                range = true;
+
+                bool upper = e.op_type == hsql::Expr::LESS_EQ || (e.op_type == hsql::Expr::SIMPLE_OP && e.op_char == '<');
+
+                if (e.op_type == hsql::Expr::SIMPLE_OP && e.op_char == '>')
+                    v += '\xff';
+                else if (e.op_type == hsql::Expr::LESS_EQ)
+                    v += '\xff';
+
+                if (upper && v < hi)
+                {
+                    hi = v;
+                    highTerm = &e;
+                }
+                else if (!upper && v > lo)
+                {
+                    lo = v;
+                    lowTerm = &e;
+                }
+            }
+
+            bool covers = need != NULL;
+
+            for (size_t i = 0; covers && i < need->size(); i++)
+                if ((*need)[i] && std::find(columns.begin(), columns.end(), i) == columns.end())covers = false;
+
+            // a single column index does as well on just the first column,
+            // unless this one saves reading the table or that one is a hash
+            // index and the first column is only bounded
+            size_t columnsUsed = k + range;
+            bool single = indexv[columns[0]] && (k == 1 || indexv[columns[0]]->Ordered());
+
+            if (columnsUsed == 0 || (columnsUsed == 1 && single && !covers))continue;
+
+            // more columns narrow the range more, then skipping the table wins
+            if (4 * k + 2 * range + covers > score)
+            {
+                score = 4 * k + 2 * range + covers;
+                best = &index;
+                covering = covers;
+                low = lo;
+                high = hi;
+                bestFixed = fixedTerms;
+                bestLow = lowTerm;
+                bestHigh = highTerm;
+            }
+        }
+
+        // entries that hold the columns read cost less than any scan
+        access = TM_Stats::ACCESS_INDEX;
+
+        if (best && !covering)
+        {
+            access = stats->Cheapest(compositeFraction(*best, bestFixed, bestLow, bestHigh));
+
+            if (access == TM_Stats::ACCESS_SCAN)best = NULL;
+        }
+
+        head.clear();
+        return best;
+    }
+
+    /* the rids of an AND chain through a composite index, in key order or
+     * sorted as access tells, with used false if none fits; the rows are
+     * yet to be checked against the chain */
+    void compositeSet(const hsql::Expr &expr, const std::map<string, int> &st, std::vector<RID> &ans, bool &used)
+    {
+        bool covering;
+        std::string low, high;
+        TM_Stats::Access access;
+        const Composite *best = composite(expr, st, NULL, covering, low, high, access);
+        used = best != NULL;
+
+        if (!used || !(low < high))return;
+
+        IX_TupleScan *scan = best->index->OpenTupleScan(low, high);
+        RID rid;
+
+        while (scan->Next(rid))
+            ans.push_back(rid);
+
+        delete scan;
+
+        // each page read once, in page order
+        if (access == TM_Stats::ACCESS_SORTED)
+            std::sort(ans.begin(), ans.end());
+    }
+
+    /* rows of WHERE rebuilt from the entries of a composite index that holds
+     * every column in need, NULL if none does */
+    TM_Operator *coverPlan(const hsql::Expr &expr, const std::map<string, int> &st, const std::vector<bool> &need)
+    {
+        bool covering;
+        std::string low, high;
+        TM_Stats::Access access;
+        const Composite *best = indexc.empty() ? NULL : composite(expr, st, &need, covering, low, high, access);
+
+        if (!best || !covering)return NULL;
+
+        return new TM_Filter(new TM_CoverScan(rmfh, best->index, best->columns, low, high), where(expr, st));
+    }
+
+    /* mark in need the columns `expr` reads, every one for a star */
+    static void columnsIn(const hsql::Expr *expr, const std::map<string, int> &st, std::vector<bool> &need)
+    {
+        if (!expr)return;
+
+        if (expr->type == hsql::kExprStar)
+            need.assign(need.size(), true);
+
+        if (expr->type == hsql::kExprColumnRef)
+        {
+            auto it = st.find(expr->name);
+
+            if (it != st.end())need[it->second] = true;
+        }
+
+        columnsIn(expr->expr, st, need);
+        columnsIn(expr->expr2, st, need);
+    }
+
+    /* the rids of the rows that may match expr through indexes, in the
+     * order to read them: key order, or sorted when the stats tell page
+     * order is cheaper or sets of rids are combined. flag is false if it
+     * needs a full scan. the rows found are a superset the caller checks
+     * against expr */
+    RC getSet(const hsql::Expr &expr, const std::map<string, int> &st, std::vector<RID> &ans, bool &flag)
+    {
+        if (expr.type != hsql::kExprOperator)
+        {
+            fprintf(stderr, "Where Expr should be a bool expression.\n");
+            return Error;
+        }
+
+        if (expr.op_type != hsql::Expr::OR && !indexc.empty())
+        {
+            bool used;
+            compositeSet(expr, st, ans, used);
+
+            if (used)
+            {
+                flag = true;
+                return Success;
+            }
+        }
+
+        int tleft = 0;
+        std::vector<RID> sleft;
+        RM_Record head = rmfh->makeHead();
+        Type *data;
+        IX_Manager *index;
+
+        switch (expr.expr->type)
+        {
+            case hsql::kExprColumnRef:
+            {
+                auto it = st.find(std::string(expr.expr->name));
+
+                if (it == st.end())
+                {
+                    fprintf(stderr, "Column %s is not found.\n", expr.expr->name);
+                    return Error;
+                }
 
                 data = head.get(it->second);
 
@@ -725,6 +1606,11 @@ public:
                 {
                     return Error;
                 }
+                else if (f == false && expr.op_type == hsql::Expr::AND)
+                {
+                    // the rows of the other side are checked against it
+                    tleft = 5;
+                }
                 else if (f == false)
                 {
                     flag = false;
@@ -747,7 +1633,7 @@ public:
         }
 
         int tright;
-        std::map<RID, RM_Record> sright;
+        std::vector<RID> sright;
         int iright;
         const char *cright;
 
@@ -782,6 +1668,10 @@ public:
                 {
                     return Error;
                 }
+                else if (f == false && expr.op_type == hsql::Expr::AND && tleft == 1)
+                {
+                    tright = 5;
+                }
                 else if (f == false)
                 {
                     flag = false;
@@ -798,35 +1688,34 @@ public:
 
 
 
-        if (tleft == tright && tleft == 1)
+        if (expr.op_type == hsql::Expr::AND && tleft + tright == 6)
         {
+            // one side found its rows, often the few an index kept where the
+            // other side would keep most of the table
+            ans.swap(tleft == 5 ? sright : sleft);
+            flag = true;
+        }
+        else if (tleft == 5)
+        {
+            flag = false;
+            return Success;
+        }
+        else if (tleft == tright && tleft == 1)
+        {
+            // sets of rids combine in rid order
+            std::sort(sleft.begin(), sleft.end());
+            std::sort(sright.begin(), sright.end());
+
             switch (expr.op_type)
             {
                 case hsql::Expr::AND:
-                    for (auto it : sleft)
-                    {
-                        if (sright.find(it.first) != sright.end())
-                            ans.insert(it);
-                    }
-
+                    std::set_intersection(sleft.begin(), sleft.end(), sright.begin(), sright.end(), std::back_inserter(ans));
                     flag = true;
                     break;
 
                 case hsql::Expr::OR:
-                    for (auto it : sleft)
-                    {
-                        if (ans.find(it.first) == ans.end())
-                            ans.insert(it);
-                    }
-
-                    for (auto it : sright)
-                    {
-                        if (ans.find(it.first) == ans.end())
-                            ans.insert(it);
-                    }
-
+                    std::set_union(sleft.begin(), sleft.end(), sright.begin(), sright.end(), std::back_inserter(ans));
                     flag = true;
-
                     break;
 
                 default:
@@ -834,214 +1723,512 @@ public:
                     return Error;
             }
         }
-        else if (tleft == 0 && tright == 2)
+        else if (tleft == 0 && (tright == 2 || tright == 3))
         {
-            if (!data->set(iright))
+            if (tright == 2 ? !data->set(iright) : !data->set(cright, strlen(cright)))
             {
                 fprintf(stderr, "The Expr Column Type is error.\n");
                 return Error;
             }
 
+            // comparisons against NULL are false, and ranges never return NULL keys
+            RM_Record bound = rmfh->makeHead();
+            int column = st.find(std::string(expr.expr->name))->second;
+            std::string prefix;
+            // the keys kept, equal to data or from low to high
+            bool equal = false, low_open = false, high_open = false;
+            Type *low = NULL, *high = NULL;
+
+            // a hash index only finds equal keys
+            if (!index->Ordered() && !(expr.op_type == hsql::Expr::SIMPLE_OP && expr.op_char == '='))
+            {
+                bound.clear();
+                fprintf(stderr, "Try to use brute-force...\n");
+                flag = false;
+                return Success;
+            }
+
             switch (expr.op_type)
             {
                 case hsql::Expr::SIMPLE_OP:
-
                     if (expr.op_char == '=')
+                        equal = true;
+                    else if (expr.op_char == '<')
+                        high = data, high_open = true;
+                    else if (expr.op_char == '>')
+                        low = data, low_open = true;
+
+                    if (equal || low || high)break;
+
+                    bound.clear();
+                    flag = true;
+                    return Success;
+
+                case hsql::Expr::LESS_EQ:
+                    high = data;
+                    break;
+
+                case hsql::Expr::GREATER_EQ:
+                    low = data;
+                    break;
+
+                case hsql::Expr::LIKE:
+                    if (tright == 3 && TM_Like(cright).Prefix(prefix))
                     {
-                        std::vector<RID> vec = index->SearchEntry(data);
+                        // 'abc%' is every key after 'abc' and before 'abd', since
+                        // % stands for one or more characters
+                        data->set(prefix.c_str(), prefix.length());
+                        low = data, low_open = true;
 
-                        for (auto rid : vec)
-                        {
-                            RM_Record rec;
-                            rmfh->GetRec(rid, rec);
-                            ans.insert(make_pair(rid, rec));
-                        }
+                        while (!prefix.empty() && (unsigned char)prefix.back() == 0xff)
+                            prefix.pop_back();
+
+                        if (prefix.empty())break;
+
+                        prefix.back()++;
+                        high = bound.get(column);
+                        high->set(prefix.c_str(), prefix.length());
+                        high_open = true;
+                        break;
                     }
 
-                    else if (expr.op_char == '<')
-                    {
-                        Type *t = new Type_int(false, 0x80000000);
-                        std::vector<RID> vec = index->SearchRangeEntry(t, data);
-                        auto it = st.find(std::string(expr.expr->name));
+                // other patterns are left to a scan
+                // fall through
+                default:
+                    bound.clear();
+                    fprintf(stderr, "Try to use brute-force...\n");
+                    flag = false;
+                    return Success;
+            }
+
+            RC rc = fetch(index, column, equal, data, low, high, low_open, high_open, ans, flag);
+            bound.clear();
+            return rc;
+        }
+        else if (tleft == 0 && tright == 4)
+        {
+            data->setnull();
+
+            switch (expr.op_type)
+            {
+                case hsql::Expr::SIMPLE_OP:
+                    if (expr.op_char == '=')
+                        return fetch(index, st.find(std::string(expr.expr->name))->second, true, data, NULL, NULL, false, false, ans, flag);
+
+                    break;
+
+                default:
+                    fprintf(stderr, "Try to use brute-force...\n");
+                    flag = false;
+                    return Success;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "The Expr Type is error.\n");
+            return Error;
+        }
+
+        flag = true;
+        return Success;
+
+    }
+
+    /* the rids of the keys equal to data, or from low to high, through the
+     * index or by a scan, whichever the stats of the table tell is cheaper;
+     * flag is false when the rows are left to a scan */
+    RC fetch(IX_Manager *index, int column, bool equal, Type *data, Type *low, Type *high, bool low_open, bool high_open, std::vector<RID> &ans, bool &flag)
+    {
+        double selectivity = equal ? stats->Equal(column, data) : stats->Between(column, low, high, low_open, high_open);
+        TM_Stats::Access access = stats->Cheapest(selectivity);
+
+        if (access == TM_Stats::ACCESS_SCAN)
+        {
+            flag = false;
+            return Success;
+        }
+
+        ans = equal ? index->SearchEntry(data) : index->SearchRangeEntry(low, high, low_open, high_open);
+
+        // each page read once, in page order
+        if (access == TM_Stats::ACCESS_SORTED)
+            std::sort(ans.begin(), ans.end());
+
+        flag = true;
+        return Success;
+    }
+
+    /* narrow [lo, hi] by the integer comparisons on `name` that are ANDed in `expr` */
+    void rangeOf(const hsql::Expr &expr, const std::string &name, long long &lo, long long &hi, bool &used)
+    {
+        if (expr.type != hsql::kExprOperator || !expr.expr || !expr.expr2)return;
+
+        if (expr.op_type == hsql::Expr::AND)
+        {
+            rangeOf(*expr.expr, name, lo, hi, used);
+            rangeOf(*expr.expr2, name, lo, hi, used);
+            return;
+        }
+
+        if (expr.expr->type != hsql::kExprColumnRef || name != expr.expr->name ||
+                expr.expr2->type != hsql::kExprLiteralInt)return;
+
+        long long v = expr.expr2->ival;
+
+        switch (expr.op_type)
+        {
+            case hsql::Expr::SIMPLE_OP:
+                if (expr.op_char == '=')
+                {
+                    lo = std::max(lo, v);
+                    hi = std::min(hi, v);
+                }
+                else if (expr.op_char == '<')hi = std::min(hi, v - 1);
+                else if (expr.op_char == '>')lo = std::max(lo, v + 1);
+                else return;
+
+                break;
+
+            case hsql::Expr::LESS_EQ:
+                hi = std::min(hi, v);
+                break;
+
+            case hsql::Expr::GREATER_EQ:
+                lo = std::max(lo, v);
+                break;
+
+            default:
+                return;
+        }
+
+        used = true;
+    }
+
+    /* for LIMIT, an index walked in key order that stops once offset + limit
+     * rows passed WHERE; the index is the ORDER BY column or one WHERE
+     * bounds. op is left NULL if no index fits */
+    void limitPlan(std::vector<hsql::Expr *> &fields, hsql::Expr *wheres, hsql::OrderDescription *order, hsql::LimitDescription *limit, const std::map<string, int> &st, TM_Operator *&op)
+    {
+        op = NULL;
+
+        for (hsql::Expr * expr : fields)
+            if (expr->type == hsql::kExprFunctionRef)return;
+
+        RM_Record head = rmfh->makeHead();
+        int col = -1;
+        long long lo = INT_MIN, hi = INT_MAX;
+
+        if (order)
+        {
+            auto it = st.find(order->expr->type == hsql::kExprColumnRef ? order->expr->name : "");
+
+            // ORDER BY sorts NULL as 0 while the index puts it last
+            if (it != st.end() && indexv[it->second] && indexv[it->second]->Ordered() && makeNotNull()[it->second])
+            {
+                col = it->second;
+                bool b = false;
+
+                if (wheres && head.get(col)->isInt())rangeOf(*wheres, it->first, lo, hi, b);
+            }
+        }
+        else if (wheres)
+        {
+            for (auto it : st)
+            {
+                bool b = false;
+
+                if (!indexv[it.second] || !indexv[it.second]->Ordered() || !head.get(it.second)->isInt())continue;
+
+                rangeOf(*wheres, it.first, lo, hi, b);
+
+                if (b)
+                {
+                    col = it.second;
+                    break;
+                }
+            }
+        }
+
+        bool isInt = col != -1 && head.get(col)->isInt();
+        head.clear();
+
+        if (col == -1)return;
+
+        long long skip = limit->offset == hsql::kNoOffset ? 0 : limit->offset;
+        long long want = limit->limit == hsql::kNoLimit ? LLONG_MAX : limit->limit;
+        bool desc = order && order->type == hsql::kOrderDesc;
+
+        if (lo > hi)
+            op = new TM_SetScan();
+        else if (isInt)
+            op = new TM_IndexScan(rmfh, indexv[col], new Type_int(false, lo), false, new Type_int(false, hi), false, desc);
+        else
+            op = new TM_IndexScan(rmfh, indexv[col], NULL, false, NULL, false, desc);
+
+        if (wheres)op = new TM_Filter(op, where(*wheres, st));
+
+        op = new TM_Limit(op, skip, want);
+    }
+
+    /* a predicate checking rows against expr */
+    TM_Predicate where(const hsql::Expr &expr, const std::map<string, int> &st)
+    {
+        return where(std::vector<const hsql::Expr *>(1, &expr), st);
+    }
+
+    /* the terms ANDed in expr */
+    static void termsOf(const hsql::Expr *expr, std::vector<const hsql::Expr *> &terms)
+    {
+        if (expr->type == hsql::kExprOperator && expr->op_type == hsql::Expr::AND)
+        {
+            termsOf(expr->expr, terms);
+            termsOf(expr->expr2, terms);
+        }
+        else
+        {
+            terms.push_back(expr);
+        }
+    }
+
+    /* a comparison of an INT column with an INT literal, either way round */
+    static bool intTerm(const hsql::Expr &expr, const std::map<string, int> &st, RM_Record &head, TM_IntTerm &term)
+    {
+        if (expr.type != hsql::kExprOperator || !expr.expr || !expr.expr2)return false;
+
+        const hsql::Expr *column = expr.expr, *literal = expr.expr2;
+        bool flip = column->type == hsql::kExprLiteralInt;
+
+        if (flip)std::swap(column, literal);
+
+        if (column->type != hsql::kExprColumnRef || literal->type != hsql::kExprLiteralInt)return false;
+
+        auto it = columnOf(*column, st);
+
+        if (it == st.end() || dynamic_cast<Type_int *>(head.get(it->second)) == NULL)return false;
+
+        if (!opOf(expr, flip, term.op))return false;
+
+        term.column = it->second;
+        term.value = literal->ival;
+        return true;
+    }
+
+    /* a scan that runs the comparisons of INT columns with constants among
+     * the terms on batches of rows and checks the rest row by row, reading
+     * the INT columns in `read` into the batches as well; NULL if the table
+     * isn't stored in pages or batches have nothing to do */
+    TM_Operator *batchPlan(std::vector<const hsql::Expr *> terms, const std::map<string, int> &st, const std::vector<int> &read)
+    {
+        if (rmfh->keyFile())return NULL;
+
+        RM_Record head = rmfh->makeHead();
+        std::vector<TM_IntTerm> ints;
+
+        for (size_t i = 0; i < terms.size();)
+        {
+            TM_IntTerm term;
+
+            if (intTerm(*terms[i], st, head, term))
+            {
+                ints.push_back(term);
+                terms.erase(terms.begin() + i);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        head.clear();
+
+        // with no comparison to batch, batches only pay off when nothing
+        // but the adding up reads the rows
+        if (ints.empty() && (read.empty() || !terms.empty()))return NULL;
+
+        TM_Operator *op = new TM_BatchScan(rmfh, ints, read);
+
+        if (!terms.empty())op = new TM_Filter(op, where(terms, st));
+
+        return op;
+    }
+
+    /* the rows WHERE keeps, from the entries of an index that holds every
+     * column in need, the rids an index answers it with or a scan; the
+     * rows of a scan are only added up over the columns in summed unless
+     * it is NULL */
+    RC wherePlan(hsql::Expr *wheres, const std::map<string, int> &st, const std::vector<bool> *need, const std::vector<int> *summed, TM_Operator *&op)
+    {
+        std::vector<RID> set;
+        bool flag = false;
+        op = NULL;
+
+        if (wheres && need && (op = coverPlan(*wheres, st, *need)) != NULL)return Success;
+
+        if (wheres && getSet(*wheres, st, set, flag) == Error)return Error;
+
+        if (flag && set.empty())
+        {
+            op = new TM_SetScan();
+            return Success;
+        }
+
+        if (flag)
+        {
+            op = new TM_Filter(new TM_RidScan(rmfh, set), where(*wheres, st));
+            return Success;
+        }
 
-                        for (auto rid : vec)
-                        {
-                            RM_Record rec;
-                            rmfh->GetRec(rid, rec);
+        std::vector<const hsql::Expr *> terms;
 
-                            if (*((Type_int *)rec.get(it->second)) == *(Type_int *)data)
-                            {
-                                rec.clear();
-                                continue;
-                            }
+        if (wheres)termsOf(wheres, terms);
 
-                            ans.insert(make_pair(rid, rec));
-                        }
-                    }
-                    else if (expr.op_char == '>')
-                    {
-                        Type *t = new Type_int(false, 0x7fffffff);
-                        std::vector<RID> vec = index->SearchRangeEntry(data, t);
-                        auto it = st.find(std::string(expr.expr->name));
+        if ((op = batchPlan(terms, st, summed ? *summed : std::vector<int>())) != NULL)return Success;
 
-                        for (auto rid : vec)
-                        {
-                            RM_Record rec;
-                            rmfh->GetRec(rid, rec);
+        op = new TM_TableScan(rmfh);
 
-                            if (*((Type_int *)rec.get(it->second)) == *(Type_int *)data)
-                            {
-                                rec.clear();
-                                continue;
-                            }
+        if (wheres)op = new TM_Filter(op, where(*wheres, st));
 
-                            ans.insert(make_pair(rid, rec));
-                        }
-                    }
+        return Success;
+    }
 
-                    break;
+    /* a predicate checking rows against every term */
+    TM_Predicate where(const std::vector<const hsql::Expr *> &terms, const std::map<string, int> &st)
+    {
+        std::shared_ptr<TM_Expr> program(new TM_Expr());
 
-                case hsql::Expr::LESS_EQ:
-                {
-                    Type *t = new Type_int(false, 0x80000000);
-                    std::vector<RID> vec = index->SearchRangeEntry(t, data);
-                    auto it = st.find(std::string(expr.expr->name));
+        return [this, terms, st, program](RM_Record & rec, bool & flag)
+        {
+            // compiled on the first row, which shows the column types
+            if (!program->slow)
+            {
+                std::vector<TM_Step> &steps = program->steps;
+                std::vector<size_t> jumps;
+                TM_Step step = TM_Step();
+                step.code = TM_Step::CONST;
+                step.value = 1;
 
-                    for (auto rid : vec)
-                    {
-                        RM_Record rec;
-                        rmfh->GetRec(rid, rec);
-                        ans.insert(make_pair(rid, rec));
-                    }
-                }
-                break;
+                if (terms.empty())steps.push_back(step);
 
-                case hsql::Expr::GREATER_EQ:
+                for (size_t i = 0; i < terms.size(); i++)
                 {
-                    Type *t = new Type_int(false, 0x7fffffff);
-                    std::vector<RID> vec = index->SearchRangeEntry(data, t);
-                    auto it = st.find(std::string(expr.expr->name));
+                    compile(*terms[i], st, rec, true, *program);
 
-                    for (auto rid : vec)
-                    {
-                        RM_Record rec;
-                        rmfh->GetRec(rid, rec);
-                        ans.insert(make_pair(rid, rec));
-                    }
+                    if (i + 1 == terms.size())break;
+
+                    jumps.push_back(steps.size());
+                    step.code = TM_Step::JUMP_FALSE;
+                    steps.push_back(step);
                 }
-                break;
 
-                default:
-                    fprintf(stderr, "Try to use brute-force...\n");
-                    flag = false;
-                    return Success;
-            }
-        }
-        else if (tleft == 0 && tright == 3)
-        {
-            if (!data->set(cright, strlen(cright)))
-            {
-                fprintf(stderr, "The Expr Column Type is error.\n");
-                return Error;
+                for (size_t i : jumps)
+                    steps[i].value = steps.size();
+
+                program->slow = [this, st](const hsql::Expr & e, RM_Record & r, bool & f)
+                {
+                    return check(e, st, r, f);
+                };
             }
 
-            switch (expr.op_type)
-            {
-                case hsql::Expr::SIMPLE_OP:
-                    if (expr.op_char == '=')
-                    {
-                        std::vector<RID> vec = index->SearchEntry(data);
+            return program->Run(rec, flag);
+        };
+    }
 
-                        for (auto rid : vec)
-                        {
-                            RM_Record rec;
-                            rmfh->GetRec(rid, rec);
-                            ans.insert(make_pair(rid, rec));
-                        }
-                    }
+    /* the rows every term keeps, from the rids of the first term an index
+     * answers or from a scan, checked row by row against all */
+    RC termsPlan(const std::vector<const hsql::Expr *> &terms, TM_Operator *&op)
+    {
+        std::map<string, int> st = makeHeadMap();
+        std::vector<RID> set;
+        bool flag = false;
+        op = NULL;
 
-                    break;
+        for (size_t i = 0; i < terms.size() && !flag; i++)
+        {
+            if (getSet(*terms[i], st, set, flag) == Error)return Error;
 
-                default:
-                    fprintf(stderr, "Try to use brute-force...\n");
-                    flag = false;
-                    return Success;
-            }
+            if (!flag)set.clear();
         }
-        else if (tleft == 0 && tright == 4)
-        {
-            data->setnull();
 
-            switch (expr.op_type)
-            {
-                case hsql::Expr::SIMPLE_OP:
-                    if (expr.op_char == '=')
-                    {
-                        std::vector<RID> vec = index->SearchEntry(data);
+        if (flag && set.empty())
+        {
+            op = new TM_SetScan();
+            return Success;
+        }
 
-                        for (auto rid : vec)
-                        {
-                            RM_Record rec;
-                            rmfh->GetRec(rid, rec);
-                            ans.insert(make_pair(rid, rec));
-                        }
-                    }
+        if (!flag && (op = batchPlan(terms, st, std::vector<int>())) != NULL)return Success;
 
-                    break;
+        op = flag ? (TM_Operator *)new TM_RidScan(rmfh, set) : new TM_TableScan(rmfh);
 
-                default:
-                    fprintf(stderr, "Try to use brute-force...\n");
-                    flag = false;
-                    return Success;
-            }
-        }
-        else
-        {
-            fprintf(stderr, "The Expr Type is error.\n");
-            return Error;
-        }
+        if (!terms.empty())op = new TM_Filter(op, where(terms, st));
 
-        flag = true;
         return Success;
-
     }
 
     RC selectRecord(std::vector<hsql::Expr *> &fields, hsql::Expr *wheres, hsql::OrderDescription *order, hsql::LimitDescription *limit, hsql::GroupByDescription *group)
     {
         std::map<string, int> st = makeHeadMap();
-        std::vector<RM_Record> ans;
-        bool flag = false;
-        std::map<RID, RM_Record> set;
-        std::vector<std::pair<RID, RM_Record> > data;
-
-        if (wheres && getSet(*wheres, st, set, flag) == Error)return Error;
+        RM_Record head = rmfh->makeHead();
+        // the columns printed for each row, those the functions add up and
+        // where each function finds its total; a field that can't be shown
+        // is an error once there is a row to show
+        std::vector<int> shown, summed, totalOf(fields.size(), -1);
+        std::vector<int> groupV;
+        int sorted = -1;
+        std::string bad;
+        RC rc = Success;
 
-        if (flag)
-        {
-            for (auto it : set)
-            {
-                data.push_back(it);
-                ans.push_back(it.second);
-            }
-        }
-        else
+        for (size_t i = 0; i < fields.size() && bad.empty(); i++)
         {
-            data = rmfh->ListRec();
+            hsql::Expr *expr = fields[i];
 
-            for (auto it : data)
+            switch (expr->type)
             {
-                bool flag;
+                case hsql::kExprStar:
+                    for (int k = 0; k < head.getSize(); k++)
+                        shown.push_back(k);
+
+                    break;
 
-                if (wheres && check(*wheres, st, it.second, flag) == Error)
+                case hsql::kExprColumnRef:
                 {
-                    return Error;
+                    auto it = columnOf(*expr, st);
+
+                    if (it == st.end())
+                    {
+                        bad = std::string("Column ") + expr->name + " is not found.\n";
+                    }
+                    else
+                        shown.push_back(it->second);
+                }
+                break;
+
+                case hsql::kExprFunctionRef:
+                {
+                    auto it = columnOf(*expr->expr, st);
+
+                    if (it == st.end())
+                    {
+                        bad = std::string("Column ") + expr->expr->name + " is not found.\n";
+                    }
+                    else if (dynamic_cast<Type_int *>(head.get(it->second)) == NULL)
+                    {
+                        bad = std::string("Column ") + expr->expr->name + " is not a integer.\n";
+                    }
+                    else
+                    {
+                        totalOf[i] = std::find(summed.begin(), summed.end(), it->second) - summed.begin();
+
+                        if (totalOf[i] == (int)summed.size())summed.push_back(it->second);
+                    }
                 }
+                break;
 
-                if (!wheres || flag)ans.push_back(it.second);
+                default:
+                    bad = "Expr type is error.\n";
             }
         }
 
-        std::vector<int> groupV;
+        head.clear();
 
         if (group)
         {
@@ -1066,193 +2253,147 @@ public:
             }
         }
 
-        Record_Less less(groupV);
-        Record_Equal equal(groupV);
-        std::stable_sort(ans.begin(), ans.end(), less);
-        std::vector<RM_Record> ans2 = ans;
-        ans.clear();
-
-        for (int i = 0; i <= ans2.size(); i++)
+        if (order && order->expr->type == hsql::kExprColumnRef)
         {
-            if (i != ans2.size() && (ans.empty() || equal(ans[0], ans2[i])))
-            {
-                ans.push_back(ans2[i]);
-                continue;
-            }
+            auto it = st.find(order->expr->name);
 
-            for (int k : groupV)
+            if (it == st.end())
             {
-                ans[0].get(k)->print();
+                fprintf(stderr, "Column %s is not found.\n", order->expr->name);
+                return Error;
             }
 
-            printf("\n");
+            sorted = it->second;
+        }
 
-            if (order && order->expr->type == hsql::kExprColumnRef)
-            {
-                auto it = st.find(order->expr->name);
+        // rows that are only added up can be added up a batch at a time, in
+        // any order
+        bool added = shown.empty() && groupV.empty() && !limit && bad.empty();
+        TM_Operator *rows = NULL;
 
-                if (it != st.end())
-                {
-                    Record_Less rl(it->second);
-                    std::stable_sort(ans.begin(), ans.end(), rl);
-                }
-                else
-                {
-                    fprintf(stderr, "Column %s is not found.\n", order->expr->name);
-                    return Error;
-                }
+        if (limit && !group)limitPlan(fields, wheres, order, limit, st, rows);
 
-                if (order->type == hsql::kOrderDesc)
-                {
-                    std::reverse(ans.begin(), ans.end());
-                }
-            }
+        // the index walk above already gives the order and the limit
+        bool limited = rows != NULL;
 
-            if (limit)
-            {
-                if (limit->offset == hsql::kNoOffset)limit->offset = 0;
+        if (!limited)
+        {
+            // every column the query reads, an index holding all of them
+            // answers it without reading the table
+            std::vector<bool> need(st.size(), false);
 
-                if (limit->limit == hsql::kNoLimit)limit->limit = ans.size();
+            for (hsql::Expr * expr : fields)
+                columnsIn(expr, st, need);
 
-                if (ans.size() < limit->offset)
-                {
-                    ans.clear();
-                }
-                else
-                {
-                    std::vector<RM_Record>ans2 = ans;
-                    ans.clear();
+            columnsIn(wheres, st, need);
 
-                    for (int i = limit->offset; i < ans2.size() && i < limit->offset + limit->limit; i++)ans.push_back(ans2[i]);
-                }
-            }
+            if (order)columnsIn(order->expr, st, need);
 
-            std::map<std::string, int>mi, ma, num;
-            std::map<std::string, long long>sum;
-            bool func = false, newline = false;
+            if (group)
+                for (hsql::Expr * expr : *group->columns)
+                    columnsIn(expr, st, need);
 
-            for (RM_Record rec : ans)
-            {
-                for (hsql::Expr * expr : fields)
-                {
-                    switch (expr->type)
-                    {
-                        case hsql::kExprStar:
-                            rec.print();
-                            newline = true;
-                            break;
+            if (wherePlan(wheres, st, &need, added ? &summed : NULL, rows) == Error)return Error;
+        }
 
-                        case hsql::kExprColumnRef:
-                        {
-                            auto it = st.find(std::string(expr->name));
+        // groups are runs of rows sorted by the group columns, and each
+        // is sorted, limited and added up on its own
+        TM_Group *groups = NULL;
 
-                            if (it == st.end())
-                            {
-                                fprintf(stderr, "Column %s is not found.\n", expr->name);
-                                return Error;
-                            }
+        if (!groupV.empty())
+            rows = groups = new TM_Group(new TM_Sort(rows, Record_Less(groupV), false), Record_Equal(groupV));
 
-                            Type *t = rec.get(it->second);
-                            t->print();
-                            newline = true;
-                        }
-                        break;
+        if (sorted != -1 && !limited && !added)
+            rows = new TM_Sort(rows, Record_Less(sorted), order->type == hsql::kOrderDesc);
 
-                        case hsql::kExprFunctionRef:
-                        {
-                            func = true;
-                            auto it = st.find(std::string(expr->expr->name));
-
-                            if (it == st.end())
-                            {
-                                fprintf(stderr, "Column %s is not found.\n", expr->expr->name);
-                                return Error;
-                            }
-
-                            Type *t = rec.get(it->second);
-//                            t->print();
-
-                            if (dynamic_cast<Type_int *>(t) == NULL)
-                            {
-                                fprintf(stderr, "Column %s is not a integer.\n", expr->expr->name);
-                                return Error;
-                            }
-
-                            sum[std::string(expr->expr->name)] += ((Type_int *)t)->getValue();
-                            num[std::string(expr->expr->name)] ++;
-
-                            if ((it = ma.find(std::string(expr->expr->name))) == ma.end())
-                                ma.insert(make_pair(std::string(expr->expr->name), ((Type_int *)t)->getValue()));
-                            else
-                                it->second = std::max(it->second, ((Type_int *)t)->getValue());
-
-                            if ((it = mi.find(std::string(expr->expr->name))) == mi.end())
-                                mi.insert(make_pair(std::string(expr->expr->name), ((Type_int *)t)->getValue()));
-                            else
-                                it->second = std::min(it->second, ((Type_int *)t)->getValue());
-                        }
-                        break;
+        if (limit && !limited)
+            rows = new TM_Limit(rows, limit->offset == hsql::kNoOffset ? 0 : limit->offset, limit->limit == hsql::kNoLimit ? LLONG_MAX : limit->limit);
 
-                        default:
-                            fprintf(stderr, "Expr type is error.\n");
-                            return Error;
-                    }
-                }
+        TM_Aggregate *totals = new TM_Aggregate(rows, summed, !added);
+        TM_Operator *root = new TM_Project(totals, shown);
+
+        if (groups)rc = groups->Start();
 
-                if (newline)printf("\n");
+        while (rc == Success)
+        {
+            bool more = true;
+
+            if (groups && (rc = groups->NextGroup(more)) == Error)break;
+
+            if (!more)break;
+
+            for (int k : groupV)
+            {
+                groups->Key().get(k)->print();
             }
 
-            if (func)
+            printf("\n");
+
+            if ((rc = root->Open()) == Error)break;
+
+            // rows are printed as they come, so a WHERE that fails on a
+            // later row, as comparing two NULL columns does, leaves the
+            // rows before it printed ahead of the error
+            while (true)
             {
-                for (hsql::Expr * expr : fields)
+                RM_Record rec;
+
+                if ((rc = root->Next(rec, more)) == Error || !more)break;
+
+                if (!bad.empty())
                 {
-                    switch (expr->type)
-                    {
-                        case hsql::kExprStar:
-//                            for (int i = 0; i < ans[0].getSize(); i++)printf("|  | ");
+                    fprintf(stderr, "%s", bad.c_str());
+                    rec.clear();
+                    rc = Error;
+                    break;
+                }
+
+                if (!shown.empty())
+                {
+                    rec.print();
+                    printf("\n");
+                }
 
-                            break;
+                rec.clear();
+            }
 
-                        case hsql::kExprColumnRef:
+            root->Close();
 
-//                            printf("|  | ");
+            if (rc == Error)break;
 
-                            break;
+            if (totals->Rows() && !summed.empty())
+            {
+                for (size_t i = 0; i < fields.size(); i++)
+                {
+                    if (totalOf[i] == -1)continue;
 
-                        case hsql::kExprFunctionRef:
-                        {
-                            std::string f = expr->name;
-
-                            if (f == "AVG")
-                            {
-                                printf("| %s(%s) = %.2lf | ", expr->name, expr->expr->name, double(sum[std::string(expr->expr->name)]) / num[std::string(expr->expr->name)]);
-                            }
-                            else if (f == "SUM")
-                            {
-                                printf("| %s(%s) = %lld | ", expr->name, expr->expr->name, sum[std::string(expr->expr->name)]);
-                            }
-                            else if (f == "MAX")
-                            {
-                                printf("| %s(%s) = %d | ", expr->name, expr->expr->name, ma[std::string(expr->expr->name)]);
-                            }
-                            else if (f == "MIN")
-                            {
-                                printf("| %s(%s) = %d | ", expr->name, expr->expr->name, mi[std::string(expr->expr->name)]);
-                            }
-                            else if (f == "NUM")
-                            {
-                                printf("| %s(%s) = %d | ", expr->name, expr->expr->name, num[std::string(expr->expr->name)]);
-                            }
-                            else
-                            {
-                                fprintf(stderr, "Unsupport function %s\n", expr->name);
-                            }
-                        }
-                        break;
+                    hsql::Expr *expr = fields[i];
+                    const TM_Aggregate::Total &t = totals->Of(totalOf[i]);
+                    std::string f = expr->name;
 
-                        default:
-                            fprintf(stderr, "Expr type is error.\n");
-                            return Error;
+                    if (f == "AVG")
+                    {
+                        printf("| %s(%s) = %.2lf | ", expr->name, expr->expr->name, double(t.sum) / t.num);
+                    }
+                    else if (f == "SUM")
+                    {
+                        printf("| %s(%s) = %lld | ", expr->name, expr->expr->name, t.sum);
+                    }
+                    else if (f == "MAX")
+                    {
+                        printf("| %s(%s) = %d | ", expr->name, expr->expr->name, t.max);
+                    }
+                    else if (f == "MIN")
+                    {
+                        printf("| %s(%s) = %d | ", expr->name, expr->expr->name, t.min);
+                    }
+                    else if (f == "NUM")
+                    {
+                        printf("| %s(%s) = %d | ", expr->name, expr->expr->name, t.num);
+                    }
+                    else
+                    {
+                        fprintf(stderr, "Unsupport function %s\n", expr->name);
                     }
                 }
 
@@ -1261,17 +2402,32 @@ public:
 
             printf("\n");
 
-            ans.clear();
-
-            if (i < ans2.size())ans.push_back(ans2[i]);
+            if (!groups)break;
         }
 
-        printf("\n");
+        delete root;
 
-        for (auto it : data)
+        if (rc == Success)printf("\n");
+
+        return rc;
+    }
+
+    /* the rows of rids, as ListRec gives them */
+    std::vector<std::pair<RID, RM_Record> > listRec(const std::vector<RID> &rids)
+    {
+        std::vector<std::pair<RID, RM_Record> > data;
+
+        for (RID rid : rids)
         {
-            it.second.clear();
+            RM_Record rec;
+
+            if (rmfh->GetRec(rid, rec) == Success)
+                data.push_back(make_pair(rid, rec));
+            else
+                rec.clear();
         }
+
+        return data;
     }
 
     RC deleteRecord(hsql::Expr *wheres)
@@ -1279,34 +2435,30 @@ public:
         std::map<string, int> st = makeHeadMap();
         std::vector<RID> ans;
         bool flag = false;
-        std::map<RID, RM_Record> set;
+        std::vector<RID> set;
         std::vector<std::pair<RID, RM_Record> > data;
 
         if (wheres && getSet(*wheres, st, set, flag) == Error)return Error;
 
         if (flag)
-        {
-            for (auto it : set)
-            {
-                data.push_back(it);
-                ans.push_back(it.first);
-            }
-        }
+            data = listRec(set);
         else
-        {
             data = rmfh->ListRec();
 
-            for (auto it : data)
-            {
-                bool flag;
+        TM_Predicate pass;
 
-                if (wheres && check(*wheres, st, it.second, flag) == Error)
-                {
-                    return Error;
-                }
+        if (wheres)pass = where(*wheres, st);
+
+        for (auto it : data)
+        {
+            bool flag;
 
-                if (!wheres || flag)ans.push_back(it.first);
+            if (wheres && pass(it.second, flag) == Error)
+            {
+                return Error;
             }
+
+            if (!wheres || flag)ans.push_back(it.first);
         }
 
         for (RID rid : ans)
@@ -1319,10 +2471,16 @@ public:
                     indexv[i]->DeleteEntry(record.get(i), rid);
                 }
 
+            for (auto it : indexc)it.index->DeleteEntry(keyOf(record, it.columns), rid);
+
+            stats->Delete(record);
             record.clear();
             rmfh->DeleteRec(rid);
         }
 
+        compactIndex();
+        refreshStats();
+
         for (auto it : data)
         {
             it.second.clear();
@@ -1345,35 +2503,30 @@ public:
         std::vector<RM_Record> rec;
         std::vector<RID> rid;
         bool flag = false;
-        std::map<RID, RM_Record> set;
+        std::vector<RID> set;
         std::vector<std::pair<RID, RM_Record> > data;
 
         if (wheres && getSet(*wheres, st, set, flag) == Error)return Error;
 
         if (flag)
-        {
-            for (auto it : set)
-            {
-                data.push_back(it);
-                rid.push_back(it.first);
-                rec.push_back(it.second);
-            }
-        }
+            data = listRec(set);
         else
-        {
             data = rmfh->ListRec();
 
-            for (auto it : data)
-            {
-                bool flag;
+        TM_Predicate pass;
 
-                if (wheres && check(*wheres, st, it.second, flag) == Error)
-                {
-                    return Error;
-                }
+        if (wheres)pass = where(*wheres, st);
+
+        for (auto it : data)
+        {
+            bool flag;
 
-                if (!wheres || flag)rid.push_back(it.first), rec.push_back(it.second);
+            if (wheres && pass(it.second, flag) == Error)
+            {
+                return Error;
             }
+
+            if (!wheres || flag)rid.push_back(it.first), rec.push_back(it.second);
         }
 
         std::vector<RM_Record> ans(rec.size());
@@ -1546,6 +2699,9 @@ public:
             for (int i = 0; i < indexv.size(); i++)if (indexv[i])
                     indexv[i]->DeleteEntry(record.get(i), rec);
 
+            for (auto it : indexc)it.index->DeleteEntry(keyOf(record, it.columns), rec);
+
+            stats->Delete(record);
             record.clear();
             rmfh->DeleteRec(rec);
         }
@@ -1557,8 +2713,15 @@ public:
 
             for (int i = 0; i < indexv.size(); i++)if (indexv[i])
                     indexv[i]->InsertEntry(rec.get(i), rid);
+
+            for (auto it : indexc)it.index->InsertEntry(keyOf(rec, it.columns), rid);
+
+            stats->Insert(rec);
         }
 
+        compactIndex();
+        refreshStats();
+
 
         for (auto it : data)
         {
@@ -0,0 +1,434 @@
+#ifndef TM_STATS_H
+#define TM_STATS_H
+
+#include "rc.h"
+#include "type.h"
+#include "rm_record.h"
+#include "bptree_str.h"
+#include <utils/pagedef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+/* marks a file written by TM_Stats */
+#define TM_STATS_MAGIC 0x53544131
+/* rows a table is sampled down to, a smaller table is read whole */
+#ifndef TM_STATS_SAMPLE
+#define TM_STATS_SAMPLE 30000
+#endif
+/* buckets of a histogram, each holding about as many rows */
+#define TM_STATS_BUCKETS 64
+/* rows changed since the last analyze, as a fraction of the rows plus a
+ * few so small tables aren't read again for every change, after which
+ * the stats are gathered anew */
+#define TM_STATS_STALE 0.2
+#define TM_STATS_STALE_MIN 100
+
+/* costs of the ways to fetch rows, in reads of a row by a scan, measured
+ * on tables held in the buffer: a row fetched by its rid in key order and
+ * in page order, an index entry and a comparison of the sort. pages only
+ * cost for the part of a table the buffer can't hold, a page in order as
+ * much as a few rows and one out of order four times that */
+#define TM_COST_FETCH 1.8
+#define TM_COST_FETCH_SORTED 1.5
+#define TM_COST_INDEX_ENTRY 0.05
+#define TM_COST_COMPARE 0.01
+#define TM_COST_PAGE 4.0
+#define TM_COST_RANDOM_PAGE 16.0
+
+/* what ANALYZE TABLE found out about a table, to tell how many rows a
+ * predicate keeps. values are kept encoded by tuple_codec, so they order
+ * as the indexes order them. the counts of rows and NULLs and the bounds
+ * follow every insert and delete; distinct counts and histograms are
+ * taken from a sample of the rows and only change when the stats are
+ * gathered anew. a table never analyzed has none */
+class TM_Stats
+{
+public:
+    /* ways to fetch the rows a predicate keeps: the rids an index finds
+     * in key order, the same sorted so each page is read once in page
+     * order, or every row of the table */
+    enum Access
+    {
+        ACCESS_INDEX,
+        ACCESS_SORTED,
+        ACCESS_SCAN
+    };
+
+    struct Column
+    {
+        uint64_t nulls;
+        /* distinct values but NULL, estimated from the sample */
+        uint64_t distinct;
+        /* smallest and largest value, empty if there is none */
+        std::string min, max;
+        /* equi-depth histogram of the values but NULL: bucket i holds the
+         * values from bounds[i] to bounds[i + 1], as many in each */
+        std::vector<std::string> bounds;
+    };
+private:
+    std::string path;
+    bool analyzed, dirty;
+    uint64_t rows, pages, changed;
+    std::vector<Column> columns;
+
+    /* the rows picked while gathering, each a value per column */
+    std::vector<std::vector<std::string> > sample;
+    uint64_t seen;
+    std::mt19937_64 rng;
+
+    static bool put(FILE *f, const std::string &s)
+    {
+        uint32_t n = s.size();
+        return fwrite(&n, sizeof(n), 1, f) == 1 && (n == 0 || fwrite(s.data(), 1, n, f) == n);
+    }
+
+    static bool get(FILE *f, std::string &s)
+    {
+        uint32_t n;
+
+        if (fread(&n, sizeof(n), 1, f) != 1 || n > (1u << 20))return false;
+
+        s.resize(n);
+        return n == 0 || fread(&s[0], 1, n, f) == n;
+    }
+
+    bool load()
+    {
+        FILE *f = fopen(path.c_str(), "rb");
+
+        if (!f)return false;
+
+        uint64_t head[5];
+        bool ok = fread(head, sizeof(head), 1, f) == 1 && head[0] == TM_STATS_MAGIC && head[4] < (1u << 16);
+
+        if (ok)
+        {
+            rows = head[1];
+            pages = head[2];
+            changed = head[3];
+            columns.resize(head[4]);
+        }
+
+        for (size_t i = 0; ok && i < columns.size(); i++)
+        {
+            uint64_t meta[3];
+            ok = fread(meta, sizeof(meta), 1, f) == 1 && meta[2] <= TM_STATS_BUCKETS + 1;
+
+            if (!ok)break;
+
+            columns[i].nulls = meta[0];
+            columns[i].distinct = meta[1];
+            columns[i].bounds.resize(meta[2]);
+            ok = get(f, columns[i].min) && get(f, columns[i].max);
+
+            for (size_t j = 0; ok && j < columns[i].bounds.size(); j++)
+                ok = get(f, columns[i].bounds[j]);
+        }
+
+        fclose(f);
+
+        if (!ok)columns.clear();
+
+        return ok;
+    }
+
+    bool save()
+    {
+        FILE *f = fopen(path.c_str(), "wb");
+
+        if (!f)return false;
+
+        uint64_t head[5] = {TM_STATS_MAGIC, rows, pages, changed, columns.size()};
+        bool ok = fwrite(head, sizeof(head), 1, f) == 1;
+
+        for (size_t i = 0; ok && i < columns.size(); i++)
+        {
+            uint64_t meta[3] = {columns[i].nulls, columns[i].distinct, columns[i].bounds.size()};
+            ok = fwrite(meta, sizeof(meta), 1, f) == 1 && put(f, columns[i].min) && put(f, columns[i].max);
+
+            for (size_t j = 0; ok && j < columns[i].bounds.size(); j++)
+                ok = put(f, columns[i].bounds[j]);
+        }
+
+        return fclose(f) == 0 && ok;
+    }
+
+    static bool isNull(const std::string &value)
+    {
+        return value[0] == '\1';
+    }
+
+    static void widen(Column &c, const std::string &value)
+    {
+        if (isNull(value))
+        {
+            c.nulls++;
+            return;
+        }
+
+        if (c.min.empty() || value < c.min)c.min = value;
+
+        if (c.max.empty() || value > c.max)c.max = value;
+    }
+
+    /* the place of value from 0 to 1 between two values of a column, as
+     * numbers for an INT column, halfway for a string */
+    static double between(const std::string &low, const std::string &high, const std::string &value, bool integer)
+    {
+        if (!integer || low.size() < 5 || high.size() < 5 || value.size() < 5)return 0.5;
+
+        double l = bptree::tuple_codec::get(low, 1), h = bptree::tuple_codec::get(high, 1);
+        double v = bptree::tuple_codec::get(value, 1);
+        return h > l ? std::min(1.0, std::max(0.0, (v - l) / (h - l))) : 0.5;
+    }
+
+    /* fraction of the rows below value, or not above it if `equal` */
+    double below(int column, const Type *value, bool equal) const
+    {
+        const Column &c = columns[column];
+
+        if (!rows || c.bounds.empty())return 0;
+
+        std::string v;
+        bptree::tuple_codec::put_type(v, value);
+        double values = 1 - (double)c.nulls / rows;
+        size_t buckets = c.bounds.size() - 1;
+        double fraction;
+
+        if (v < c.bounds.front())
+            fraction = 0;
+        else if (v >= c.bounds.back())
+            fraction = buckets ? 1 : 0;
+        else
+        {
+            size_t i = std::upper_bound(c.bounds.begin(), c.bounds.end(), v) - c.bounds.begin() - 1;
+            fraction = (i + between(c.bounds[i], c.bounds[i + 1], v, value->isInt())) / buckets;
+        }
+
+        fraction = fraction * values + (equal ? Equal(column, value) : 0);
+        return std::min(values, std::max(0.0, fraction));
+    }
+public:
+    TM_Stats(const char *_path)
+        : path(_path), dirty(false), rows(0), pages(0), changed(0), seen(0), rng(1)
+    {
+        analyzed = load();
+    }
+
+    ~TM_Stats()
+    {
+        if (dirty && !save())
+            fprintf(stderr, "Can't write the stats %s\n", path.c_str());
+    }
+
+    /* false until the table is analyzed */
+    bool Analyzed() const
+    {
+        return analyzed;
+    }
+
+    uint64_t Rows() const
+    {
+        return rows;
+    }
+
+    uint64_t Pages() const
+    {
+        return pages;
+    }
+
+    const Column &Of(int column) const
+    {
+        return columns[column];
+    }
+
+    /* fraction of the rows where the column equals value, or is NULL */
+    double Equal(int column, const Type *value) const
+    {
+        const Column &c = columns[column];
+
+        if (!rows)return 0;
+
+        if (value->null)return (double)c.nulls / rows;
+
+        std::string v;
+        bptree::tuple_codec::put_type(v, value);
+
+        if (c.min.empty() || v < c.min || v > c.max)return 0;
+
+        return (1 - (double)c.nulls / rows) / std::max<uint64_t>(c.distinct, 1);
+    }
+
+    /* fraction of the rows from low to high, either left out when it is
+     * open and no bound on that side when NULL; NULLs are never in it */
+    double Between(int column, const Type *low, const Type *high, bool low_open, bool high_open) const
+    {
+        if (!rows)return 0;
+
+        double above = high ? below(column, high, !high_open) : 1 - (double)columns[column].nulls / rows;
+        double under = low ? below(column, low, low_open) : 0;
+        return std::max(0.0, above - under);
+    }
+
+    /* the cheapest access to the rows a predicate keeps, given the fraction
+     * of the rows it keeps; scans aren't chosen without stats */
+    Access Cheapest(double selectivity) const
+    {
+        if (!analyzed)return ACCESS_INDEX;
+
+        double n = rows, p = std::max<uint64_t>(pages, 1), k = selectivity * n;
+        // the fraction of the pages read that aren't in the buffer
+        double miss = p > CAP ? 1 - CAP / p : 0;
+        double scan = n + p * TM_COST_PAGE * miss;
+
+        // in key order every row may be a page read out of order
+        double index = k * (TM_COST_INDEX_ENTRY + TM_COST_FETCH + TM_COST_RANDOM_PAGE * miss);
+
+        // in page order each page is read once, the more of them the
+        // closer they come to a scan (Cardenas' count of pages touched)
+        double touched = p * (1 - pow(1 - 1 / p, k));
+        double page = TM_COST_RANDOM_PAGE - (TM_COST_RANDOM_PAGE - TM_COST_PAGE) * sqrt(touched / p);
+        double sorted = k * (TM_COST_INDEX_ENTRY + TM_COST_FETCH_SORTED + TM_COST_COMPARE * log2(k + 1))
+                        + touched * page * miss;
+
+        if (scan <= index && scan <= sorted)return ACCESS_SCAN;
+
+        return sorted < index ? ACCESS_SORTED : ACCESS_INDEX;
+    }
+
+    /* true once enough rows changed that the stats should be gathered anew */
+    bool Stale() const
+    {
+        return analyzed && changed > rows * TM_STATS_STALE + TM_STATS_STALE_MIN;
+    }
+
+    /* gather the stats anew from the n column rows Add is given next */
+    void Begin(int n)
+    {
+        rows = changed = seen = 0;
+        columns.assign(n, Column());
+
+        for (auto &c : columns)
+            c.nulls = c.distinct = 0;
+
+        sample.clear();
+        rng.seed(1);
+    }
+
+    /* count the row and keep it in the sample with the same chance as
+     * every row before it */
+    void Add(const RM_Record &rec)
+    {
+        std::vector<std::string> values(columns.size());
+
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            bptree::tuple_codec::put_type(values[i], rec.constget(i));
+            widen(columns[i], values[i]);
+        }
+
+        rows++;
+
+        if (seen++ < TM_STATS_SAMPLE)
+        {
+            sample.push_back(values);
+            return;
+        }
+
+        uint64_t j = rng() % seen;
+
+        if (j < TM_STATS_SAMPLE)sample[j].swap(values);
+    }
+
+    /* the distinct counts and histograms from the sample, then written */
+    void Finish(uint64_t _pages)
+    {
+        pages = _pages;
+
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            std::vector<std::string> values;
+
+            for (auto &row : sample)
+                if (!isNull(row[i]))values.push_back(row[i]);
+
+            std::sort(values.begin(), values.end());
+            Column &c = columns[i];
+            c.bounds.clear();
+
+            if (values.empty())continue;
+
+            // values seen once in the sample, and all the distinct ones
+            uint64_t once = 0, d = 0;
+
+            for (size_t j = 0, k; j < values.size(); j = k)
+            {
+                for (k = j + 1; k < values.size() && values[k] == values[j]; k++);
+
+                once += k - j == 1;
+                d++;
+            }
+
+            // the more of the sample's values are seen once, the more
+            // values the rest of the table holds (Haas and Stokes' Duj1)
+            uint64_t total = rows - c.nulls;
+            double n = values.size();
+
+            if (n < total)
+            {
+                double estimate = n * d / (n - once + once * n / total);
+                d = std::max<uint64_t>(d, std::min<uint64_t>(total, estimate + 0.5));
+            }
+
+            c.distinct = d;
+            size_t buckets = std::min<size_t>(TM_STATS_BUCKETS, values.size() - 1);
+
+            for (size_t j = 0; j <= buckets; j++)
+                c.bounds.push_back(values[buckets ? j * (values.size() - 1) / buckets : 0]);
+        }
+
+        sample.clear();
+        analyzed = true;
+
+        if (!save())
+            fprintf(stderr, "Can't write the stats %s\n", path.c_str());
+
+        dirty = false;
+    }
+
+    void Insert(const RM_Record &rec)
+    {
+        if (!analyzed)return;
+
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            std::string value;
+            bptree::tuple_codec::put_type(value, rec.constget(i));
+            widen(columns[i], value);
+        }
+
+        rows++;
+        changed++;
+        dirty = true;
+    }
+
+    void Delete(const RM_Record &rec)
+    {
+        if (!analyzed)return;
+
+        for (size_t i = 0; i < columns.size(); i++)
+            if (rec.constget(i)->null && columns[i].nulls)columns[i].nulls--;
+
+        if (rows)rows--;
+
+        changed++;
+        dirty = true;
+    }
+};
+
+#endif
@@ -17,10 +17,15 @@ public:
     virtual void fromByte(Byte byte) = 0;
     virtual int getSize() = 0;
     virtual void print() = 0;
+    /* a copy the caller owns */
+    virtual Type *clone() const = 0;
     Type(SizeType _sizeType, bool _null)
         : sizeType(_sizeType), null(_null)
     {
     }
+    virtual ~Type()
+    {
+    }
     bool set(const char *str, int length);
     bool set(int value);
     bool isStr() const;
@@ -66,6 +71,10 @@ public:
     {
         value = *(int *)byte.a;
     }
+    Type *clone() const
+    {
+        return new Type_tinyint(*this);
+    }
     void print()
     {
         if (null)printf("%d ", 0);
@@ -121,6 +130,10 @@ public:
     {
         value = *(int *)byte.a;
     }
+    Type *clone() const
+    {
+        return new Type_int(*this);
+    }
     void print()
     {
         char buf[16];
@@ -158,6 +171,67 @@ public:
     }
 };
 
+/* a 64 bit integer */
+class Type_bigint : public Type
+{
+private:
+    long long value;
+public:
+    Type_bigint(bool _null = true, long long t = 0)
+        : Type(Type::sta, _null), value(t)
+    {
+    }
+    int getSize()
+    {
+        return sizeof(long long) / sizeof(uch);
+    }
+
+    Byte toByte()
+    {
+        if (null) value = 0;
+
+        return Byte(sizeof(long long) / sizeof(uch), (uch *)&value);
+    }
+    void fromByte(Byte byte)
+    {
+        value = *(long long *)byte.a;
+    }
+    Type *clone() const
+    {
+        return new Type_bigint(*this);
+    }
+    void print()
+    {
+        if (null)printf("| 0 | ");
+        else printf("| %lld | ", value);
+    }
+
+    long long getLong() const
+    {
+        return value;
+    }
+    void setLong(long long t)
+    {
+        value = t;
+    }
+
+    bool operator < (const Type_bigint &t) const
+    {
+        if (null && t.null)return false;
+
+        if (null != t.null)return null < t.null;
+
+        return value < t.value;
+    }
+
+    bool operator == (const Type_bigint &t) const
+    {
+        if (null && t.null) return true;
+
+        return value == t.value;
+    }
+};
+
 template<int size = 64>
 class Type_varchar : public Type
 {
@@ -194,6 +268,10 @@ public:
         memcpy(str, _str, std::min(length, size) * sizeof(char));
         str[length] = '\000';
     }
+    Type *clone() const
+    {
+        return new Type_varchar<size>(*this);
+    }
     void print()
     {
         if (!null)printf("| %s | ", str);
@@ -0,0 +1,138 @@
+-- the stats ANALYZE TABLE gathers, as DESC shows them, and how they follow
+-- the rows changed after it; see run_sql.sh
+CREATE DATABASE an;
+USE DATABASE an;
+CREATE TABLE t(id int(10) NOT NULL, a int(10), s varchar(10));
+CREATE TABLE e(id int(10));
+-- an empty table, and one not yet analyzed
+ANALYZE TABLE e;
+DESC e;
+INSERT INTO t VALUES (1, 7, 's1'), (2, 14, 's2'), (3, 21, 's3'), (4, 28, 's4'), (5, 35, 's5'), (6, 42, 's6'), (7, 49, 's7'), (8, 6, 's8'), (9, 13, 's9'), (10, NULL, 's10'), (11, 27, 's11'), (12, 34, 's12'), (13, 41, 's0'), (14, 48, 's1'), (15, 5, 's2'), (16, 12, 's3'), (17, 19, 's4'), (18, 26, 's5'), (19, 33, 's6'), (20, NULL, 's7'), (21, 47, 's8'), (22, 4, 's9'), (23, 11, 's10'), (24, 18, 's11'), (25, 25, 's12');
+INSERT INTO t VALUES (26, 32, 's0'), (27, 39, 's1'), (28, 46, 's2'), (29, 3, 's3'), (30, NULL, 's4'), (31, 17, 's5'), (32, 24, 's6'), (33, 31, 's7'), (34, 38, 's8'), (35, 45, 's9'), (36, 2, 's10'), (37, 9, 's11'), (38, 16, 's12'), (39, 23, 's0'), (40, NULL, 's1'), (41, 37, 's2'), (42, 44, 's3'), (43, 1, 's4'), (44, 8, 's5'), (45, 15, 's6'), (46, 22, 's7'), (47, 29, 's8'), (48, 36, 's9'), (49, 43, 's10'), (50, NULL, 's11');
+INSERT INTO t VALUES (51, 7, 's12'), (52, 14, 's0'), (53, 21, 's1'), (54, 28, 's2'), (55, 35, 's3'), (56, 42, 's4'), (57, 49, 's5'), (58, 6, 's6'), (59, 13, 's7'), (60, NULL, 's8'), (61, 27, 's9'), (62, 34, 's10'), (63, 41, 's11'), (64, 48, 's12'), (65, 5, 's0'), (66, 12, 's1'), (67, 19, 's2'), (68, 26, 's3'), (69, 33, 's4'), (70, NULL, 's5'), (71, 47, 's6'), (72, 4, 's7'), (73, 11, 's8'), (74, 18, 's9'), (75, 25, 's10');
+INSERT INTO t VALUES (76, 32, 's11'), (77, 39, 's12'), (78, 46, 's0'), (79, 3, 's1'), (80, NULL, 's2'), (81, 17, 's3'), (82, 24, 's4'), (83, 31, 's5'), (84, 38, 's6'), (85, 45, 's7'), (86, 2, 's8'), (87, 9, 's9'), (88, 16, 's10'), (89, 23, 's11'), (90, NULL, 's12'), (91, 37, 's0'), (92, 44, 's1'), (93, 1, 's2'), (94, 8, 's3'), (95, 15, 's4'), (96, 22, 's5'), (97, 29, 's6'), (98, 36, 's7'), (99, 43, 's8'), (100, NULL, 's9');
+INSERT INTO t VALUES (101, 7, 's10'), (102, 14, 's11'), (103, 21, 's12'), (104, 28, 's0'), (105, 35, 's1'), (106, 42, 's2'), (107, 49, 's3'), (108, 6, 's4'), (109, 13, 's5'), (110, NULL, 's6'), (111, 27, 's7'), (112, 34, 's8'), (113, 41, 's9'), (114, 48, 's10'), (115, 5, 's11'), (116, 12, 's12'), (117, 19, 's0'), (118, 26, 's1'), (119, 33, 's2'), (120, NULL, 's3'), (121, 47, 's4'), (122, 4, 's5'), (123, 11, 's6'), (124, 18, 's7'), (125, 25, 's8');
+INSERT INTO t VALUES (126, 32, 's9'), (127, 39, 's10'), (128, 46, 's11'), (129, 3, 's12'), (130, NULL, 's0'), (131, 17, 's1'), (132, 24, 's2'), (133, 31, 's3'), (134, 38, 's4'), (135, 45, 's5'), (136, 2, 's6'), (137, 9, 's7'), (138, 16, 's8'), (139, 23, 's9'), (140, NULL, 's10'), (141, 37, 's11'), (142, 44, 's12'), (143, 1, 's0'), (144, 8, 's1'), (145, 15, 's2'), (146, 22, 's3'), (147, 29, 's4'), (148, 36, 's5'), (149, 43, 's6'), (150, NULL, 's7');
+INSERT INTO t VALUES (151, 7, 's8'), (152, 14, 's9'), (153, 21, 's10'), (154, 28, 's11'), (155, 35, 's12'), (156, 42, 's0'), (157, 49, 's1'), (158, 6, 's2'), (159, 13, 's3'), (160, NULL, 's4'), (161, 27, 's5'), (162, 34, 's6'), (163, 41, 's7'), (164, 48, 's8'), (165, 5, 's9'), (166, 12, 's10'), (167, 19, 's11'), (168, 26, 's12'), (169, 33, 's0'), (170, NULL, 's1'), (171, 47, 's2'), (172, 4, 's3'), (173, 11, 's4'), (174, 18, 's5'), (175, 25, 's6');
+INSERT INTO t VALUES (176, 32, 's7'), (177, 39, 's8'), (178, 46, 's9'), (179, 3, 's10'), (180, NULL, 's11'), (181, 17, 's12'), (182, 24, 's0'), (183, 31, 's1'), (184, 38, 's2'), (185, 45, 's3'), (186, 2, 's4'), (187, 9, 's5'), (188, 16, 's6'), (189, 23, 's7'), (190, NULL, 's8'), (191, 37, 's9'), (192, 44, 's10'), (193, 1, 's11'), (194, 8, 's12'), (195, 15, 's0'), (196, 22, 's1'), (197, 29, 's2'), (198, 36, 's3'), (199, 43, 's4'), (200, NULL, 's5');
+INSERT INTO t VALUES (201, 7, 's6'), (202, 14, 's7'), (203, 21, 's8'), (204, 28, 's9'), (205, 35, 's10'), (206, 42, 's11'), (207, 49, 's12'), (208, 6, 's0'), (209, 13, 's1'), (210, NULL, 's2'), (211, 27, 's3'), (212, 34, 's4'), (213, 41, 's5'), (214, 48, 's6'), (215, 5, 's7'), (216, 12, 's8'), (217, 19, 's9'), (218, 26, 's10'), (219, 33, 's11'), (220, NULL, 's12'), (221, 47, 's0'), (222, 4, 's1'), (223, 11, 's2'), (224, 18, 's3'), (225, 25, 's4');
+INSERT INTO t VALUES (226, 32, 's5'), (227, 39, 's6'), (228, 46, 's7'), (229, 3, 's8'), (230, NULL, 's9'), (231, 17, 's10'), (232, 24, 's11'), (233, 31, 's12'), (234, 38, 's0'), (235, 45, 's1'), (236, 2, 's2'), (237, 9, 's3'), (238, 16, 's4'), (239, 23, 's5'), (240, NULL, 's6'), (241, 37, 's7'), (242, 44, 's8'), (243, 1, 's9'), (244, 8, 's10'), (245, 15, 's11'), (246, 22, 's12'), (247, 29, 's0'), (248, 36, 's1'), (249, 43, 's2'), (250, NULL, 's3');
+INSERT INTO t VALUES (251, 7, 's4'), (252, 14, 's5'), (253, 21, 's6'), (254, 28, 's7'), (255, 35, 's8'), (256, 42, 's9'), (257, 49, 's10'), (258, 6, 's11'), (259, 13, 's12'), (260, NULL, 's0'), (261, 27, 's1'), (262, 34, 's2'), (263, 41, 's3'), (264, 48, 's4'), (265, 5, 's5'), (266, 12, 's6'), (267, 19, 's7'), (268, 26, 's8'), (269, 33, 's9'), (270, NULL, 's10'), (271, 47, 's11'), (272, 4, 's12'), (273, 11, 's0'), (274, 18, 's1'), (275, 25, 's2');
+INSERT INTO t VALUES (276, 32, 's3'), (277, 39, 's4'), (278, 46, 's5'), (279, 3, 's6'), (280, NULL, 's7'), (281, 17, 's8'), (282, 24, 's9'), (283, 31, 's10'), (284, 38, 's11'), (285, 45, 's12'), (286, 2, 's0'), (287, 9, 's1'), (288, 16, 's2'), (289, 23, 's3'), (290, NULL, 's4'), (291, 37, 's5'), (292, 44, 's6'), (293, 1, 's7'), (294, 8, 's8'), (295, 15, 's9'), (296, 22, 's10'), (297, 29, 's11'), (298, 36, 's12'), (299, 43, 's0'), (300, NULL, 's1');
+INSERT INTO t VALUES (301, 7, 's2'), (302, 14, 's3'), (303, 21, 's4'), (304, 28, 's5'), (305, 35, 's6'), (306, 42, 's7'), (307, 49, 's8'), (308, 6, 's9'), (309, 13, 's10'), (310, NULL, 's11'), (311, 27, 's12'), (312, 34, 's0'), (313, 41, 's1'), (314, 48, 's2'), (315, 5, 's3'), (316, 12, 's4'), (317, 19, 's5'), (318, 26, 's6'), (319, 33, 's7'), (320, NULL, 's8'), (321, 47, 's9'), (322, 4, 's10'), (323, 11, 's11'), (324, 18, 's12'), (325, 25, 's0');
+INSERT INTO t VALUES (326, 32, 's1'), (327, 39, 's2'), (328, 46, 's3'), (329, 3, 's4'), (330, NULL, 's5'), (331, 17, 's6'), (332, 24, 's7'), (333, 31, 's8'), (334, 38, 's9'), (335, 45, 's10'), (336, 2, 's11'), (337, 9, 's12'), (338, 16, 's0'), (339, 23, 's1'), (340, NULL, 's2'), (341, 37, 's3'), (342, 44, 's4'), (343, 1, 's5'), (344, 8, 's6'), (345, 15, 's7'), (346, 22, 's8'), (347, 29, 's9'), (348, 36, 's10'), (349, 43, 's11'), (350, NULL, 's12');
+INSERT INTO t VALUES (351, 7, 's0'), (352, 14, 's1'), (353, 21, 's2'), (354, 28, 's3'), (355, 35, 's4'), (356, 42, 's5'), (357, 49, 's6'), (358, 6, 's7'), (359, 13, 's8'), (360, NULL, 's9'), (361, 27, 's10'), (362, 34, 's11'), (363, 41, 's12'), (364, 48, 's0'), (365, 5, 's1'), (366, 12, 's2'), (367, 19, 's3'), (368, 26, 's4'), (369, 33, 's5'), (370, NULL, 's6'), (371, 47, 's7'), (372, 4, 's8'), (373, 11, 's9'), (374, 18, 's10'), (375, 25, 's11');
+INSERT INTO t VALUES (376, 32, 's12'), (377, 39, 's0'), (378, 46, 's1'), (379, 3, 's2'), (380, NULL, 's3'), (381, 17, 's4'), (382, 24, 's5'), (383, 31, 's6'), (384, 38, 's7'), (385, 45, 's8'), (386, 2, 's9'), (387, 9, 's10'), (388, 16, 's11'), (389, 23, 's12'), (390, NULL, 's0'), (391, 37, 's1'), (392, 44, 's2'), (393, 1, 's3'), (394, 8, 's4'), (395, 15, 's5'), (396, 22, 's6'), (397, 29, 's7'), (398, 36, 's8'), (399, 43, 's9'), (400, NULL, 's10');
+INSERT INTO t VALUES (401, 7, 's11'), (402, 14, 's12'), (403, 21, 's0'), (404, 28, 's1'), (405, 35, 's2'), (406, 42, 's3'), (407, 49, 's4'), (408, 6, 's5'), (409, 13, 's6'), (410, NULL, 's7'), (411, 27, 's8'), (412, 34, 's9'), (413, 41, 's10'), (414, 48, 's11'), (415, 5, 's12'), (416, 12, 's0'), (417, 19, 's1'), (418, 26, 's2'), (419, 33, 's3'), (420, NULL, 's4'), (421, 47, 's5'), (422, 4, 's6'), (423, 11, 's7'), (424, 18, 's8'), (425, 25, 's9');
+INSERT INTO t VALUES (426, 32, 's10'), (427, 39, 's11'), (428, 46, 's12'), (429, 3, 's0'), (430, NULL, 's1'), (431, 17, 's2'), (432, 24, 's3'), (433, 31, 's4'), (434, 38, 's5'), (435, 45, 's6'), (436, 2, 's7'), (437, 9, 's8'), (438, 16, 's9'), (439, 23, 's10'), (440, NULL, 's11'), (441, 37, 's12'), (442, 44, 's0'), (443, 1, 's1'), (444, 8, 's2'), (445, 15, 's3'), (446, 22, 's4'), (447, 29, 's5'), (448, 36, 's6'), (449, 43, 's7'), (450, NULL, 's8');
+INSERT INTO t VALUES (451, 7, 's9'), (452, 14, 's10'), (453, 21, 's11'), (454, 28, 's12'), (455, 35, 's0'), (456, 42, 's1'), (457, 49, 's2'), (458, 6, 's3'), (459, 13, 's4'), (460, NULL, 's5'), (461, 27, 's6'), (462, 34, 's7'), (463, 41, 's8'), (464, 48, 's9'), (465, 5, 's10'), (466, 12, 's11'), (467, 19, 's12'), (468, 26, 's0'), (469, 33, 's1'), (470, NULL, 's2'), (471, 47, 's3'), (472, 4, 's4'), (473, 11, 's5'), (474, 18, 's6'), (475, 25, 's7');
+INSERT INTO t VALUES (476, 32, 's8'), (477, 39, 's9'), (478, 46, 's10'), (479, 3, 's11'), (480, NULL, 's12'), (481, 17, 's0'), (482, 24, 's1'), (483, 31, 's2'), (484, 38, 's3'), (485, 45, 's4'), (486, 2, 's5'), (487, 9, 's6'), (488, 16, 's7'), (489, 23, 's8'), (490, NULL, 's9'), (491, 37, 's10'), (492, 44, 's11'), (493, 1, 's12'), (494, 8, 's0'), (495, 15, 's1'), (496, 22, 's2'), (497, 29, 's3'), (498, 36, 's4'), (499, 43, 's5'), (500, NULL, 's6');
+INSERT INTO t VALUES (501, 7, 's7'), (502, 14, 's8'), (503, 21, 's9'), (504, 28, 's10'), (505, 35, 's11'), (506, 42, 's12'), (507, 49, 's0'), (508, 6, 's1'), (509, 13, 's2'), (510, NULL, 's3'), (511, 27, 's4'), (512, 34, 's5'), (513, 41, 's6'), (514, 48, 's7'), (515, 5, 's8'), (516, 12, 's9'), (517, 19, 's10'), (518, 26, 's11'), (519, 33, 's12'), (520, NULL, 's0'), (521, 47, 's1'), (522, 4, 's2'), (523, 11, 's3'), (524, 18, 's4'), (525, 25, 's5');
+INSERT INTO t VALUES (526, 32, 's6'), (527, 39, 's7'), (528, 46, 's8'), (529, 3, 's9'), (530, NULL, 's10'), (531, 17, 's11'), (532, 24, 's12'), (533, 31, 's0'), (534, 38, 's1'), (535, 45, 's2'), (536, 2, 's3'), (537, 9, 's4'), (538, 16, 's5'), (539, 23, 's6'), (540, NULL, 's7'), (541, 37, 's8'), (542, 44, 's9'), (543, 1, 's10'), (544, 8, 's11'), (545, 15, 's12'), (546, 22, 's0'), (547, 29, 's1'), (548, 36, 's2'), (549, 43, 's3'), (550, NULL, 's4');
+INSERT INTO t VALUES (551, 7, 's5'), (552, 14, 's6'), (553, 21, 's7'), (554, 28, 's8'), (555, 35, 's9'), (556, 42, 's10'), (557, 49, 's11'), (558, 6, 's12'), (559, 13, 's0'), (560, NULL, 's1'), (561, 27, 's2'), (562, 34, 's3'), (563, 41, 's4'), (564, 48, 's5'), (565, 5, 's6'), (566, 12, 's7'), (567, 19, 's8'), (568, 26, 's9'), (569, 33, 's10'), (570, NULL, 's11'), (571, 47, 's12'), (572, 4, 's0'), (573, 11, 's1'), (574, 18, 's2'), (575, 25, 's3');
+INSERT INTO t VALUES (576, 32, 's4'), (577, 39, 's5'), (578, 46, 's6'), (579, 3, 's7'), (580, NULL, 's8'), (581, 17, 's9'), (582, 24, 's10'), (583, 31, 's11'), (584, 38, 's12'), (585, 45, 's0'), (586, 2, 's1'), (587, 9, 's2'), (588, 16, 's3'), (589, 23, 's4'), (590, NULL, 's5'), (591, 37, 's6'), (592, 44, 's7'), (593, 1, 's8'), (594, 8, 's9'), (595, 15, 's10'), (596, 22, 's11'), (597, 29, 's12'), (598, 36, 's0'), (599, 43, 's1'), (600, NULL, 's2');
+INSERT INTO t VALUES (601, 7, 's3'), (602, 14, 's4'), (603, 21, 's5'), (604, 28, 's6'), (605, 35, 's7'), (606, 42, 's8'), (607, 49, 's9'), (608, 6, 's10'), (609, 13, 's11'), (610, NULL, 's12'), (611, 27, 's0'), (612, 34, 's1'), (613, 41, 's2'), (614, 48, 's3'), (615, 5, 's4'), (616, 12, 's5'), (617, 19, 's6'), (618, 26, 's7'), (619, 33, 's8'), (620, NULL, 's9'), (621, 47, 's10'), (622, 4, 's11'), (623, 11, 's12'), (624, 18, 's0'), (625, 25, 's1');
+INSERT INTO t VALUES (626, 32, 's2'), (627, 39, 's3'), (628, 46, 's4'), (629, 3, 's5'), (630, NULL, 's6'), (631, 17, 's7'), (632, 24, 's8'), (633, 31, 's9'), (634, 38, 's10'), (635, 45, 's11'), (636, 2, 's12'), (637, 9, 's0'), (638, 16, 's1'), (639, 23, 's2'), (640, NULL, 's3'), (641, 37, 's4'), (642, 44, 's5'), (643, 1, 's6'), (644, 8, 's7'), (645, 15, 's8'), (646, 22, 's9'), (647, 29, 's10'), (648, 36, 's11'), (649, 43, 's12'), (650, NULL, 's0');
+INSERT INTO t VALUES (651, 7, 's1'), (652, 14, 's2'), (653, 21, 's3'), (654, 28, 's4'), (655, 35, 's5'), (656, 42, 's6'), (657, 49, 's7'), (658, 6, 's8'), (659, 13, 's9'), (660, NULL, 's10'), (661, 27, 's11'), (662, 34, 's12'), (663, 41, 's0'), (664, 48, 's1'), (665, 5, 's2'), (666, 12, 's3'), (667, 19, 's4'), (668, 26, 's5'), (669, 33, 's6'), (670, NULL, 's7'), (671, 47, 's8'), (672, 4, 's9'), (673, 11, 's10'), (674, 18, 's11'), (675, 25, 's12');
+INSERT INTO t VALUES (676, 32, 's0'), (677, 39, 's1'), (678, 46, 's2'), (679, 3, 's3'), (680, NULL, 's4'), (681, 17, 's5'), (682, 24, 's6'), (683, 31, 's7'), (684, 38, 's8'), (685, 45, 's9'), (686, 2, 's10'), (687, 9, 's11'), (688, 16, 's12'), (689, 23, 's0'), (690, NULL, 's1'), (691, 37, 's2'), (692, 44, 's3'), (693, 1, 's4'), (694, 8, 's5'), (695, 15, 's6'), (696, 22, 's7'), (697, 29, 's8'), (698, 36, 's9'), (699, 43, 's10'), (700, NULL, 's11');
+INSERT INTO t VALUES (701, 7, 's12'), (702, 14, 's0'), (703, 21, 's1'), (704, 28, 's2'), (705, 35, 's3'), (706, 42, 's4'), (707, 49, 's5'), (708, 6, 's6'), (709, 13, 's7'), (710, NULL, 's8'), (711, 27, 's9'), (712, 34, 's10'), (713, 41, 's11'), (714, 48, 's12'), (715, 5, 's0'), (716, 12, 's1'), (717, 19, 's2'), (718, 26, 's3'), (719, 33, 's4'), (720, NULL, 's5'), (721, 47, 's6'), (722, 4, 's7'), (723, 11, 's8'), (724, 18, 's9'), (725, 25, 's10');
+INSERT INTO t VALUES (726, 32, 's11'), (727, 39, 's12'), (728, 46, 's0'), (729, 3, 's1'), (730, NULL, 's2'), (731, 17, 's3'), (732, 24, 's4'), (733, 31, 's5'), (734, 38, 's6'), (735, 45, 's7'), (736, 2, 's8'), (737, 9, 's9'), (738, 16, 's10'), (739, 23, 's11'), (740, NULL, 's12'), (741, 37, 's0'), (742, 44, 's1'), (743, 1, 's2'), (744, 8, 's3'), (745, 15, 's4'), (746, 22, 's5'), (747, 29, 's6'), (748, 36, 's7'), (749, 43, 's8'), (750, NULL, 's9');
+INSERT INTO t VALUES (751, 7, 's10'), (752, 14, 's11'), (753, 21, 's12'), (754, 28, 's0'), (755, 35, 's1'), (756, 42, 's2'), (757, 49, 's3'), (758, 6, 's4'), (759, 13, 's5'), (760, NULL, 's6'), (761, 27, 's7'), (762, 34, 's8'), (763, 41, 's9'), (764, 48, 's10'), (765, 5, 's11'), (766, 12, 's12'), (767, 19, 's0'), (768, 26, 's1'), (769, 33, 's2'), (770, NULL, 's3'), (771, 47, 's4'), (772, 4, 's5'), (773, 11, 's6'), (774, 18, 's7'), (775, 25, 's8');
+INSERT INTO t VALUES (776, 32, 's9'), (777, 39, 's10'), (778, 46, 's11'), (779, 3, 's12'), (780, NULL, 's0'), (781, 17, 's1'), (782, 24, 's2'), (783, 31, 's3'), (784, 38, 's4'), (785, 45, 's5'), (786, 2, 's6'), (787, 9, 's7'), (788, 16, 's8'), (789, 23, 's9'), (790, NULL, 's10'), (791, 37, 's11'), (792, 44, 's12'), (793, 1, 's0'), (794, 8, 's1'), (795, 15, 's2'), (796, 22, 's3'), (797, 29, 's4'), (798, 36, 's5'), (799, 43, 's6'), (800, NULL, 's7');
+INSERT INTO t VALUES (801, 7, 's8'), (802, 14, 's9'), (803, 21, 's10'), (804, 28, 's11'), (805, 35, 's12'), (806, 42, 's0'), (807, 49, 's1'), (808, 6, 's2'), (809, 13, 's3'), (810, NULL, 's4'), (811, 27, 's5'), (812, 34, 's6'), (813, 41, 's7'), (814, 48, 's8'), (815, 5, 's9'), (816, 12, 's10'), (817, 19, 's11'), (818, 26, 's12'), (819, 33, 's0'), (820, NULL, 's1'), (821, 47, 's2'), (822, 4, 's3'), (823, 11, 's4'), (824, 18, 's5'), (825, 25, 's6');
+INSERT INTO t VALUES (826, 32, 's7'), (827, 39, 's8'), (828, 46, 's9'), (829, 3, 's10'), (830, NULL, 's11'), (831, 17, 's12'), (832, 24, 's0'), (833, 31, 's1'), (834, 38, 's2'), (835, 45, 's3'), (836, 2, 's4'), (837, 9, 's5'), (838, 16, 's6'), (839, 23, 's7'), (840, NULL, 's8'), (841, 37, 's9'), (842, 44, 's10'), (843, 1, 's11'), (844, 8, 's12'), (845, 15, 's0'), (846, 22, 's1'), (847, 29, 's2'), (848, 36, 's3'), (849, 43, 's4'), (850, NULL, 's5');
+INSERT INTO t VALUES (851, 7, 's6'), (852, 14, 's7'), (853, 21, 's8'), (854, 28, 's9'), (855, 35, 's10'), (856, 42, 's11'), (857, 49, 's12'), (858, 6, 's0'), (859, 13, 's1'), (860, NULL, 's2'), (861, 27, 's3'), (862, 34, 's4'), (863, 41, 's5'), (864, 48, 's6'), (865, 5, 's7'), (866, 12, 's8'), (867, 19, 's9'), (868, 26, 's10'), (869, 33, 's11'), (870, NULL, 's12'), (871, 47, 's0'), (872, 4, 's1'), (873, 11, 's2'), (874, 18, 's3'), (875, 25, 's4');
+INSERT INTO t VALUES (876, 32, 's5'), (877, 39, 's6'), (878, 46, 's7'), (879, 3, 's8'), (880, NULL, 's9'), (881, 17, 's10'), (882, 24, 's11'), (883, 31, 's12'), (884, 38, 's0'), (885, 45, 's1'), (886, 2, 's2'), (887, 9, 's3'), (888, 16, 's4'), (889, 23, 's5'), (890, NULL, 's6'), (891, 37, 's7'), (892, 44, 's8'), (893, 1, 's9'), (894, 8, 's10'), (895, 15, 's11'), (896, 22, 's12'), (897, 29, 's0'), (898, 36, 's1'), (899, 43, 's2'), (900, NULL, 's3');
+INSERT INTO t VALUES (901, 7, 's4'), (902, 14, 's5'), (903, 21, 's6'), (904, 28, 's7'), (905, 35, 's8'), (906, 42, 's9'), (907, 49, 's10'), (908, 6, 's11'), (909, 13, 's12'), (910, NULL, 's0'), (911, 27, 's1'), (912, 34, 's2'), (913, 41, 's3'), (914, 48, 's4'), (915, 5, 's5'), (916, 12, 's6'), (917, 19, 's7'), (918, 26, 's8'), (919, 33, 's9'), (920, NULL, 's10'), (921, 47, 's11'), (922, 4, 's12'), (923, 11, 's0'), (924, 18, 's1'), (925, 25, 's2');
+INSERT INTO t VALUES (926, 32, 's3'), (927, 39, 's4'), (928, 46, 's5'), (929, 3, 's6'), (930, NULL, 's7'), (931, 17, 's8'), (932, 24, 's9'), (933, 31, 's10'), (934, 38, 's11'), (935, 45, 's12'), (936, 2, 's0'), (937, 9, 's1'), (938, 16, 's2'), (939, 23, 's3'), (940, NULL, 's4'), (941, 37, 's5'), (942, 44, 's6'), (943, 1, 's7'), (944, 8, 's8'), (945, 15, 's9'), (946, 22, 's10'), (947, 29, 's11'), (948, 36, 's12'), (949, 43, 's0'), (950, NULL, 's1');
+INSERT INTO t VALUES (951, 7, 's2'), (952, 14, 's3'), (953, 21, 's4'), (954, 28, 's5'), (955, 35, 's6'), (956, 42, 's7'), (957, 49, 's8'), (958, 6, 's9'), (959, 13, 's10'), (960, NULL, 's11'), (961, 27, 's12'), (962, 34, 's0'), (963, 41, 's1'), (964, 48, 's2'), (965, 5, 's3'), (966, 12, 's4'), (967, 19, 's5'), (968, 26, 's6'), (969, 33, 's7'), (970, NULL, 's8'), (971, 47, 's9'), (972, 4, 's10'), (973, 11, 's11'), (974, 18, 's12'), (975, 25, 's0');
+INSERT INTO t VALUES (976, 32, 's1'), (977, 39, 's2'), (978, 46, 's3'), (979, 3, 's4'), (980, NULL, 's5'), (981, 17, 's6'), (982, 24, 's7'), (983, 31, 's8'), (984, 38, 's9'), (985, 45, 's10'), (986, 2, 's11'), (987, 9, 's12'), (988, 16, 's0'), (989, 23, 's1'), (990, NULL, 's2'), (991, 37, 's3'), (992, 44, 's4'), (993, 1, 's5'), (994, 8, 's6'), (995, 15, 's7'), (996, 22, 's8'), (997, 29, 's9'), (998, 36, 's10'), (999, 43, 's11'), (1000, NULL, 's12');
+DESC t;
+-- gathered from every row of a small table
+ANALYZE TABLE t;
+DESC t;
+-- between other statements on one line
+SELECT NUM(id) FROM t WHERE a = 7; ANALYZE TABLE t; SELECT NUM(id) FROM t WHERE s = 's3';
+-- changes widen the bounds and keep the row and NULL counts
+INSERT INTO t VALUES (2001, 500, 'zz'), (0, 60, 'a'), (2003, NULL, NULL);
+DELETE FROM t WHERE a = NULL AND id < 300;
+UPDATE t SET a = 900 WHERE id = 7;
+DESC t;
+-- read back from the file once the table was closed
+CREATE DATABASE other;
+USE DATABASE other;
+USE DATABASE an;
+DESC t;
+-- enough changed rows gather them anew, which counts the new values
+INSERT INTO t VALUES (3000, 1000, 'n0'), (3001, 1001, 'n1'), (3002, 1002, 'n2'), (3003, 1003, 'n3'), (3004, 1004, 'n4'), (3005, 1005, 'n5'), (3006, 1006, 'n6'), (3007, 1007, 'n7'), (3008, 1008, 'n8'), (3009, 1009, 'n9'), (3010, 1010, 'n10'), (3011, 1011, 'n11'), (3012, 1012, 'n12'), (3013, 1013, 'n13'), (3014, 1014, 'n14'), (3015, 1015, 'n15'), (3016, 1016, 'n16'), (3017, 1017, 'n17'), (3018, 1018, 'n18'), (3019, 1019, 'n19'), (3020, 1020, 'n20'), (3021, 1021, 'n21'), (3022, 1022, 'n22'), (3023, 1023, 'n23'), (3024, 1024, 'n24');
+INSERT INTO t VALUES (3025, 1025, 'n25'), (3026, 1026, 'n26'), (3027, 1027, 'n27'), (3028, 1028, 'n28'), (3029, 1029, 'n29'), (3030, 1030, 'n30'), (3031, 1031, 'n31'), (3032, 1032, 'n32'), (3033, 1033, 'n33'), (3034, 1034, 'n34'), (3035, 1035, 'n35'), (3036, 1036, 'n36'), (3037, 1037, 'n37'), (3038, 1038, 'n38'), (3039, 1039, 'n39'), (3040, 1040, 'n40'), (3041, 1041, 'n41'), (3042, 1042, 'n42'), (3043, 1043, 'n43'), (3044, 1044, 'n44'), (3045, 1045, 'n45'), (3046, 1046, 'n46'), (3047, 1047, 'n47'), (3048, 1048, 'n48'), (3049, 1049, 'n49');
+INSERT INTO t VALUES (3050, 1050, 'n50'), (3051, 1051, 'n51'), (3052, 1052, 'n52'), (3053, 1053, 'n53'), (3054, 1054, 'n54'), (3055, 1055, 'n55'), (3056, 1056, 'n56'), (3057, 1057, 'n57'), (3058, 1058, 'n58'), (3059, 1059, 'n59'), (3060, 1060, 'n60'), (3061, 1061, 'n61'), (3062, 1062, 'n62'), (3063, 1063, 'n63'), (3064, 1064, 'n64'), (3065, 1065, 'n65'), (3066, 1066, 'n66'), (3067, 1067, 'n67'), (3068, 1068, 'n68'), (3069, 1069, 'n69'), (3070, 1070, 'n70'), (3071, 1071, 'n71'), (3072, 1072, 'n72'), (3073, 1073, 'n73'), (3074, 1074, 'n74');
+INSERT INTO t VALUES (3075, 1075, 'n75'), (3076, 1076, 'n76'), (3077, 1077, 'n77'), (3078, 1078, 'n78'), (3079, 1079, 'n79'), (3080, 1080, 'n80'), (3081, 1081, 'n81'), (3082, 1082, 'n82'), (3083, 1083, 'n83'), (3084, 1084, 'n84'), (3085, 1085, 'n85'), (3086, 1086, 'n86'), (3087, 1087, 'n87'), (3088, 1088, 'n88'), (3089, 1089, 'n89'), (3090, 1090, 'n90'), (3091, 1091, 'n91'), (3092, 1092, 'n92'), (3093, 1093, 'n93'), (3094, 1094, 'n94'), (3095, 1095, 'n95'), (3096, 1096, 'n96'), (3097, 1097, 'n97'), (3098, 1098, 'n98'), (3099, 1099, 'n99');
+INSERT INTO t VALUES (3100, 1100, 'n100'), (3101, 1101, 'n101'), (3102, 1102, 'n102'), (3103, 1103, 'n103'), (3104, 1104, 'n104'), (3105, 1105, 'n105'), (3106, 1106, 'n106'), (3107, 1107, 'n107'), (3108, 1108, 'n108'), (3109, 1109, 'n109'), (3110, 1110, 'n110'), (3111, 1111, 'n111'), (3112, 1112, 'n112'), (3113, 1113, 'n113'), (3114, 1114, 'n114'), (3115, 1115, 'n115'), (3116, 1116, 'n116'), (3117, 1117, 'n117'), (3118, 1118, 'n118'), (3119, 1119, 'n119'), (3120, 1120, 'n120'), (3121, 1121, 'n121'), (3122, 1122, 'n122'), (3123, 1123, 'n123'), (3124, 1124, 'n124');
+INSERT INTO t VALUES (3125, 1125, 'n125'), (3126, 1126, 'n126'), (3127, 1127, 'n127'), (3128, 1128, 'n128'), (3129, 1129, 'n129'), (3130, 1130, 'n130'), (3131, 1131, 'n131'), (3132, 1132, 'n132'), (3133, 1133, 'n133'), (3134, 1134, 'n134'), (3135, 1135, 'n135'), (3136, 1136, 'n136'), (3137, 1137, 'n137'), (3138, 1138, 'n138'), (3139, 1139, 'n139'), (3140, 1140, 'n140'), (3141, 1141, 'n141'), (3142, 1142, 'n142'), (3143, 1143, 'n143'), (3144, 1144, 'n144'), (3145, 1145, 'n145'), (3146, 1146, 'n146'), (3147, 1147, 'n147'), (3148, 1148, 'n148'), (3149, 1149, 'n149');
+INSERT INTO t VALUES (3150, 1150, 'n150'), (3151, 1151, 'n151'), (3152, 1152, 'n152'), (3153, 1153, 'n153'), (3154, 1154, 'n154'), (3155, 1155, 'n155'), (3156, 1156, 'n156'), (3157, 1157, 'n157'), (3158, 1158, 'n158'), (3159, 1159, 'n159'), (3160, 1160, 'n160'), (3161, 1161, 'n161'), (3162, 1162, 'n162'), (3163, 1163, 'n163'), (3164, 1164, 'n164'), (3165, 1165, 'n165'), (3166, 1166, 'n166'), (3167, 1167, 'n167'), (3168, 1168, 'n168'), (3169, 1169, 'n169'), (3170, 1170, 'n170'), (3171, 1171, 'n171'), (3172, 1172, 'n172'), (3173, 1173, 'n173'), (3174, 1174, 'n174');
+INSERT INTO t VALUES (3175, 1175, 'n175'), (3176, 1176, 'n176'), (3177, 1177, 'n177'), (3178, 1178, 'n178'), (3179, 1179, 'n179'), (3180, 1180, 'n180'), (3181, 1181, 'n181'), (3182, 1182, 'n182'), (3183, 1183, 'n183'), (3184, 1184, 'n184'), (3185, 1185, 'n185'), (3186, 1186, 'n186'), (3187, 1187, 'n187'), (3188, 1188, 'n188'), (3189, 1189, 'n189'), (3190, 1190, 'n190'), (3191, 1191, 'n191'), (3192, 1192, 'n192'), (3193, 1193, 'n193'), (3194, 1194, 'n194'), (3195, 1195, 'n195'), (3196, 1196, 'n196'), (3197, 1197, 'n197'), (3198, 1198, 'n198'), (3199, 1199, 'n199');
+INSERT INTO t VALUES (3200, 1200, 'n200'), (3201, 1201, 'n201'), (3202, 1202, 'n202'), (3203, 1203, 'n203'), (3204, 1204, 'n204'), (3205, 1205, 'n205'), (3206, 1206, 'n206'), (3207, 1207, 'n207'), (3208, 1208, 'n208'), (3209, 1209, 'n209'), (3210, 1210, 'n210'), (3211, 1211, 'n211'), (3212, 1212, 'n212'), (3213, 1213, 'n213'), (3214, 1214, 'n214'), (3215, 1215, 'n215'), (3216, 1216, 'n216'), (3217, 1217, 'n217'), (3218, 1218, 'n218'), (3219, 1219, 'n219'), (3220, 1220, 'n220'), (3221, 1221, 'n221'), (3222, 1222, 'n222'), (3223, 1223, 'n223'), (3224, 1224, 'n224');
+INSERT INTO t VALUES (3225, 1225, 'n225'), (3226, 1226, 'n226'), (3227, 1227, 'n227'), (3228, 1228, 'n228'), (3229, 1229, 'n229'), (3230, 1230, 'n230'), (3231, 1231, 'n231'), (3232, 1232, 'n232'), (3233, 1233, 'n233'), (3234, 1234, 'n234'), (3235, 1235, 'n235'), (3236, 1236, 'n236'), (3237, 1237, 'n237'), (3238, 1238, 'n238'), (3239, 1239, 'n239'), (3240, 1240, 'n240'), (3241, 1241, 'n241'), (3242, 1242, 'n242'), (3243, 1243, 'n243'), (3244, 1244, 'n244'), (3245, 1245, 'n245'), (3246, 1246, 'n246'), (3247, 1247, 'n247'), (3248, 1248, 'n248'), (3249, 1249, 'n249');
+INSERT INTO t VALUES (3250, 1250, 'n250'), (3251, 1251, 'n251'), (3252, 1252, 'n252'), (3253, 1253, 'n253'), (3254, 1254, 'n254'), (3255, 1255, 'n255'), (3256, 1256, 'n256'), (3257, 1257, 'n257'), (3258, 1258, 'n258'), (3259, 1259, 'n259'), (3260, 1260, 'n260'), (3261, 1261, 'n261'), (3262, 1262, 'n262'), (3263, 1263, 'n263'), (3264, 1264, 'n264'), (3265, 1265, 'n265'), (3266, 1266, 'n266'), (3267, 1267, 'n267'), (3268, 1268, 'n268'), (3269, 1269, 'n269'), (3270, 1270, 'n270'), (3271, 1271, 'n271'), (3272, 1272, 'n272'), (3273, 1273, 'n273'), (3274, 1274, 'n274');
+INSERT INTO t VALUES (3275, 1275, 'n275'), (3276, 1276, 'n276'), (3277, 1277, 'n277'), (3278, 1278, 'n278'), (3279, 1279, 'n279'), (3280, 1280, 'n280'), (3281, 1281, 'n281'), (3282, 1282, 'n282'), (3283, 1283, 'n283'), (3284, 1284, 'n284'), (3285, 1285, 'n285'), (3286, 1286, 'n286'), (3287, 1287, 'n287'), (3288, 1288, 'n288'), (3289, 1289, 'n289'), (3290, 1290, 'n290'), (3291, 1291, 'n291'), (3292, 1292, 'n292'), (3293, 1293, 'n293'), (3294, 1294, 'n294'), (3295, 1295, 'n295'), (3296, 1296, 'n296'), (3297, 1297, 'n297'), (3298, 1298, 'n298'), (3299, 1299, 'n299');
+INSERT INTO t VALUES (3300, 1300, 'n300'), (3301, 1301, 'n301'), (3302, 1302, 'n302'), (3303, 1303, 'n303'), (3304, 1304, 'n304'), (3305, 1305, 'n305'), (3306, 1306, 'n306'), (3307, 1307, 'n307'), (3308, 1308, 'n308'), (3309, 1309, 'n309'), (3310, 1310, 'n310'), (3311, 1311, 'n311'), (3312, 1312, 'n312'), (3313, 1313, 'n313'), (3314, 1314, 'n314'), (3315, 1315, 'n315'), (3316, 1316, 'n316'), (3317, 1317, 'n317'), (3318, 1318, 'n318'), (3319, 1319, 'n319'), (3320, 1320, 'n320'), (3321, 1321, 'n321'), (3322, 1322, 'n322'), (3323, 1323, 'n323'), (3324, 1324, 'n324');
+INSERT INTO t VALUES (3325, 1325, 'n325'), (3326, 1326, 'n326'), (3327, 1327, 'n327'), (3328, 1328, 'n328'), (3329, 1329, 'n329'), (3330, 1330, 'n330'), (3331, 1331, 'n331'), (3332, 1332, 'n332'), (3333, 1333, 'n333'), (3334, 1334, 'n334'), (3335, 1335, 'n335'), (3336, 1336, 'n336'), (3337, 1337, 'n337'), (3338, 1338, 'n338'), (3339, 1339, 'n339'), (3340, 1340, 'n340'), (3341, 1341, 'n341'), (3342, 1342, 'n342'), (3343, 1343, 'n343'), (3344, 1344, 'n344'), (3345, 1345, 'n345'), (3346, 1346, 'n346'), (3347, 1347, 'n347'), (3348, 1348, 'n348'), (3349, 1349, 'n349');
+INSERT INTO t VALUES (3350, 1350, 'n350'), (3351, 1351, 'n351'), (3352, 1352, 'n352'), (3353, 1353, 'n353'), (3354, 1354, 'n354'), (3355, 1355, 'n355'), (3356, 1356, 'n356'), (3357, 1357, 'n357'), (3358, 1358, 'n358'), (3359, 1359, 'n359'), (3360, 1360, 'n360'), (3361, 1361, 'n361'), (3362, 1362, 'n362'), (3363, 1363, 'n363'), (3364, 1364, 'n364'), (3365, 1365, 'n365'), (3366, 1366, 'n366'), (3367, 1367, 'n367'), (3368, 1368, 'n368'), (3369, 1369, 'n369'), (3370, 1370, 'n370'), (3371, 1371, 'n371'), (3372, 1372, 'n372'), (3373, 1373, 'n373'), (3374, 1374, 'n374');
+INSERT INTO t VALUES (3375, 1375, 'n375'), (3376, 1376, 'n376'), (3377, 1377, 'n377'), (3378, 1378, 'n378'), (3379, 1379, 'n379'), (3380, 1380, 'n380'), (3381, 1381, 'n381'), (3382, 1382, 'n382'), (3383, 1383, 'n383'), (3384, 1384, 'n384'), (3385, 1385, 'n385'), (3386, 1386, 'n386'), (3387, 1387, 'n387'), (3388, 1388, 'n388'), (3389, 1389, 'n389'), (3390, 1390, 'n390'), (3391, 1391, 'n391'), (3392, 1392, 'n392'), (3393, 1393, 'n393'), (3394, 1394, 'n394'), (3395, 1395, 'n395'), (3396, 1396, 'n396'), (3397, 1397, 'n397'), (3398, 1398, 'n398'), (3399, 1399, 'n399');
+DESC t;
+DELETE FROM t WHERE id >= 3000;
+ANALYZE TABLE t;
+DESC t;
+-- an index range comes out in key order until the stats tell page order
+-- is cheaper, and a scan once it keeps most of the table; the rids of
+-- both sides of an OR are merged in page order
+CREATE TABLE p(id int(10) NOT NULL, k int(10) NOT NULL);
+CREATE INDEX p(k);
+INSERT INTO p VALUES (0, 1000), (1, 999), (2, 998), (3, 997), (4, 996), (5, 995), (6, 994), (7, 993), (8, 992), (9, 991), (10, 990), (11, 989), (12, 988), (13, 987), (14, 986), (15, 985), (16, 984), (17, 983), (18, 982), (19, 981), (20, 980), (21, 979), (22, 978), (23, 977), (24, 976);
+INSERT INTO p VALUES (25, 975), (26, 974), (27, 973), (28, 972), (29, 971), (30, 970), (31, 969), (32, 968), (33, 967), (34, 966), (35, 965), (36, 964), (37, 963), (38, 962), (39, 961), (40, 960), (41, 959), (42, 958), (43, 957), (44, 956), (45, 955), (46, 954), (47, 953), (48, 952), (49, 951);
+INSERT INTO p VALUES (50, 950), (51, 949), (52, 948), (53, 947), (54, 946), (55, 945), (56, 944), (57, 943), (58, 942), (59, 941), (60, 940), (61, 939), (62, 938), (63, 937), (64, 936), (65, 935), (66, 934), (67, 933), (68, 932), (69, 931), (70, 930), (71, 929), (72, 928), (73, 927), (74, 926);
+INSERT INTO p VALUES (75, 925), (76, 924), (77, 923), (78, 922), (79, 921), (80, 920), (81, 919), (82, 918), (83, 917), (84, 916), (85, 915), (86, 914), (87, 913), (88, 912), (89, 911), (90, 910), (91, 909), (92, 908), (93, 907), (94, 906), (95, 905), (96, 904), (97, 903), (98, 902), (99, 901);
+INSERT INTO p VALUES (100, 900), (101, 899), (102, 898), (103, 897), (104, 896), (105, 895), (106, 894), (107, 893), (108, 892), (109, 891), (110, 890), (111, 889), (112, 888), (113, 887), (114, 886), (115, 885), (116, 884), (117, 883), (118, 882), (119, 881), (120, 880), (121, 879), (122, 878), (123, 877), (124, 876);
+INSERT INTO p VALUES (125, 875), (126, 874), (127, 873), (128, 872), (129, 871), (130, 870), (131, 869), (132, 868), (133, 867), (134, 866), (135, 865), (136, 864), (137, 863), (138, 862), (139, 861), (140, 860), (141, 859), (142, 858), (143, 857), (144, 856), (145, 855), (146, 854), (147, 853), (148, 852), (149, 851);
+INSERT INTO p VALUES (150, 850), (151, 849), (152, 848), (153, 847), (154, 846), (155, 845), (156, 844), (157, 843), (158, 842), (159, 841), (160, 840), (161, 839), (162, 838), (163, 837), (164, 836), (165, 835), (166, 834), (167, 833), (168, 832), (169, 831), (170, 830), (171, 829), (172, 828), (173, 827), (174, 826);
+INSERT INTO p VALUES (175, 825), (176, 824), (177, 823), (178, 822), (179, 821), (180, 820), (181, 819), (182, 818), (183, 817), (184, 816), (185, 815), (186, 814), (187, 813), (188, 812), (189, 811), (190, 810), (191, 809), (192, 808), (193, 807), (194, 806), (195, 805), (196, 804), (197, 803), (198, 802), (199, 801);
+INSERT INTO p VALUES (200, 800), (201, 799), (202, 798), (203, 797), (204, 796), (205, 795), (206, 794), (207, 793), (208, 792), (209, 791), (210, 790), (211, 789), (212, 788), (213, 787), (214, 786), (215, 785), (216, 784), (217, 783), (218, 782), (219, 781), (220, 780), (221, 779), (222, 778), (223, 777), (224, 776);
+INSERT INTO p VALUES (225, 775), (226, 774), (227, 773), (228, 772), (229, 771), (230, 770), (231, 769), (232, 768), (233, 767), (234, 766), (235, 765), (236, 764), (237, 763), (238, 762), (239, 761), (240, 760), (241, 759), (242, 758), (243, 757), (244, 756), (245, 755), (246, 754), (247, 753), (248, 752), (249, 751);
+INSERT INTO p VALUES (250, 750), (251, 749), (252, 748), (253, 747), (254, 746), (255, 745), (256, 744), (257, 743), (258, 742), (259, 741), (260, 740), (261, 739), (262, 738), (263, 737), (264, 736), (265, 735), (266, 734), (267, 733), (268, 732), (269, 731), (270, 730), (271, 729), (272, 728), (273, 727), (274, 726);
+INSERT INTO p VALUES (275, 725), (276, 724), (277, 723), (278, 722), (279, 721), (280, 720), (281, 719), (282, 718), (283, 717), (284, 716), (285, 715), (286, 714), (287, 713), (288, 712), (289, 711), (290, 710), (291, 709), (292, 708), (293, 707), (294, 706), (295, 705), (296, 704), (297, 703), (298, 702), (299, 701);
+INSERT INTO p VALUES (300, 700), (301, 699), (302, 698), (303, 697), (304, 696), (305, 695), (306, 694), (307, 693), (308, 692), (309, 691), (310, 690), (311, 689), (312, 688), (313, 687), (314, 686), (315, 685), (316, 684), (317, 683), (318, 682), (319, 681), (320, 680), (321, 679), (322, 678), (323, 677), (324, 676);
+INSERT INTO p VALUES (325, 675), (326, 674), (327, 673), (328, 672), (329, 671), (330, 670), (331, 669), (332, 668), (333, 667), (334, 666), (335, 665), (336, 664), (337, 663), (338, 662), (339, 661), (340, 660), (341, 659), (342, 658), (343, 657), (344, 656), (345, 655), (346, 654), (347, 653), (348, 652), (349, 651);
+INSERT INTO p VALUES (350, 650), (351, 649), (352, 648), (353, 647), (354, 646), (355, 645), (356, 644), (357, 643), (358, 642), (359, 641), (360, 640), (361, 639), (362, 638), (363, 637), (364, 636), (365, 635), (366, 634), (367, 633), (368, 632), (369, 631), (370, 630), (371, 629), (372, 628), (373, 627), (374, 626);
+INSERT INTO p VALUES (375, 625), (376, 624), (377, 623), (378, 622), (379, 621), (380, 620), (381, 619), (382, 618), (383, 617), (384, 616), (385, 615), (386, 614), (387, 613), (388, 612), (389, 611), (390, 610), (391, 609), (392, 608), (393, 607), (394, 606), (395, 605), (396, 604), (397, 603), (398, 602), (399, 601);
+INSERT INTO p VALUES (400, 600), (401, 599), (402, 598), (403, 597), (404, 596), (405, 595), (406, 594), (407, 593), (408, 592), (409, 591), (410, 590), (411, 589), (412, 588), (413, 587), (414, 586), (415, 585), (416, 584), (417, 583), (418, 582), (419, 581), (420, 580), (421, 579), (422, 578), (423, 577), (424, 576);
+INSERT INTO p VALUES (425, 575), (426, 574), (427, 573), (428, 572), (429, 571), (430, 570), (431, 569), (432, 568), (433, 567), (434, 566), (435, 565), (436, 564), (437, 563), (438, 562), (439, 561), (440, 560), (441, 559), (442, 558), (443, 557), (444, 556), (445, 555), (446, 554), (447, 553), (448, 552), (449, 551);
+INSERT INTO p VALUES (450, 550), (451, 549), (452, 548), (453, 547), (454, 546), (455, 545), (456, 544), (457, 543), (458, 542), (459, 541), (460, 540), (461, 539), (462, 538), (463, 537), (464, 536), (465, 535), (466, 534), (467, 533), (468, 532), (469, 531), (470, 530), (471, 529), (472, 528), (473, 527), (474, 526);
+INSERT INTO p VALUES (475, 525), (476, 524), (477, 523), (478, 522), (479, 521), (480, 520), (481, 519), (482, 518), (483, 517), (484, 516), (485, 515), (486, 514), (487, 513), (488, 512), (489, 511), (490, 510), (491, 509), (492, 508), (493, 507), (494, 506), (495, 505), (496, 504), (497, 503), (498, 502), (499, 501);
+INSERT INTO p VALUES (500, 500), (501, 499), (502, 498), (503, 497), (504, 496), (505, 495), (506, 494), (507, 493), (508, 492), (509, 491), (510, 490), (511, 489), (512, 488), (513, 487), (514, 486), (515, 485), (516, 484), (517, 483), (518, 482), (519, 481), (520, 480), (521, 479), (522, 478), (523, 477), (524, 476);
+INSERT INTO p VALUES (525, 475), (526, 474), (527, 473), (528, 472), (529, 471), (530, 470), (531, 469), (532, 468), (533, 467), (534, 466), (535, 465), (536, 464), (537, 463), (538, 462), (539, 461), (540, 460), (541, 459), (542, 458), (543, 457), (544, 456), (545, 455), (546, 454), (547, 453), (548, 452), (549, 451);
+INSERT INTO p VALUES (550, 450), (551, 449), (552, 448), (553, 447), (554, 446), (555, 445), (556, 444), (557, 443), (558, 442), (559, 441), (560, 440), (561, 439), (562, 438), (563, 437), (564, 436), (565, 435), (566, 434), (567, 433), (568, 432), (569, 431), (570, 430), (571, 429), (572, 428), (573, 427), (574, 426);
+INSERT INTO p VALUES (575, 425), (576, 424), (577, 423), (578, 422), (579, 421), (580, 420), (581, 419), (582, 418), (583, 417), (584, 416), (585, 415), (586, 414), (587, 413), (588, 412), (589, 411), (590, 410), (591, 409), (592, 408), (593, 407), (594, 406), (595, 405), (596, 404), (597, 403), (598, 402), (599, 401);
+INSERT INTO p VALUES (600, 400), (601, 399), (602, 398), (603, 397), (604, 396), (605, 395), (606, 394), (607, 393), (608, 392), (609, 391), (610, 390), (611, 389), (612, 388), (613, 387), (614, 386), (615, 385), (616, 384), (617, 383), (618, 382), (619, 381), (620, 380), (621, 379), (622, 378), (623, 377), (624, 376);
+INSERT INTO p VALUES (625, 375), (626, 374), (627, 373), (628, 372), (629, 371), (630, 370), (631, 369), (632, 368), (633, 367), (634, 366), (635, 365), (636, 364), (637, 363), (638, 362), (639, 361), (640, 360), (641, 359), (642, 358), (643, 357), (644, 356), (645, 355), (646, 354), (647, 353), (648, 352), (649, 351);
+INSERT INTO p VALUES (650, 350), (651, 349), (652, 348), (653, 347), (654, 346), (655, 345), (656, 344), (657, 343), (658, 342), (659, 341), (660, 340), (661, 339), (662, 338), (663, 337), (664, 336), (665, 335), (666, 334), (667, 333), (668, 332), (669, 331), (670, 330), (671, 329), (672, 328), (673, 327), (674, 326);
+INSERT INTO p VALUES (675, 325), (676, 324), (677, 323), (678, 322), (679, 321), (680, 320), (681, 319), (682, 318), (683, 317), (684, 316), (685, 315), (686, 314), (687, 313), (688, 312), (689, 311), (690, 310), (691, 309), (692, 308), (693, 307), (694, 306), (695, 305), (696, 304), (697, 303), (698, 302), (699, 301);
+INSERT INTO p VALUES (700, 300), (701, 299), (702, 298), (703, 297), (704, 296), (705, 295), (706, 294), (707, 293), (708, 292), (709, 291), (710, 290), (711, 289), (712, 288), (713, 287), (714, 286), (715, 285), (716, 284), (717, 283), (718, 282), (719, 281), (720, 280), (721, 279), (722, 278), (723, 277), (724, 276);
+INSERT INTO p VALUES (725, 275), (726, 274), (727, 273), (728, 272), (729, 271), (730, 270), (731, 269), (732, 268), (733, 267), (734, 266), (735, 265), (736, 264), (737, 263), (738, 262), (739, 261), (740, 260), (741, 259), (742, 258), (743, 257), (744, 256), (745, 255), (746, 254), (747, 253), (748, 252), (749, 251);
+INSERT INTO p VALUES (750, 250), (751, 249), (752, 248), (753, 247), (754, 246), (755, 245), (756, 244), (757, 243), (758, 242), (759, 241), (760, 240), (761, 239), (762, 238), (763, 237), (764, 236), (765, 235), (766, 234), (767, 233), (768, 232), (769, 231), (770, 230), (771, 229), (772, 228), (773, 227), (774, 226);
+INSERT INTO p VALUES (775, 225), (776, 224), (777, 223), (778, 222), (779, 221), (780, 220), (781, 219), (782, 218), (783, 217), (784, 216), (785, 215), (786, 214), (787, 213), (788, 212), (789, 211), (790, 210), (791, 209), (792, 208), (793, 207), (794, 206), (795, 205), (796, 204), (797, 203), (798, 202), (799, 201);
+INSERT INTO p VALUES (800, 200), (801, 199), (802, 198), (803, 197), (804, 196), (805, 195), (806, 194), (807, 193), (808, 192), (809, 191), (810, 190), (811, 189), (812, 188), (813, 187), (814, 186), (815, 185), (816, 184), (817, 183), (818, 182), (819, 181), (820, 180), (821, 179), (822, 178), (823, 177), (824, 176);
+INSERT INTO p VALUES (825, 175), (826, 174), (827, 173), (828, 172), (829, 171), (830, 170), (831, 169), (832, 168), (833, 167), (834, 166), (835, 165), (836, 164), (837, 163), (838, 162), (839, 161), (840, 160), (841, 159), (842, 158), (843, 157), (844, 156), (845, 155), (846, 154), (847, 153), (848, 152), (849, 151);
+INSERT INTO p VALUES (850, 150), (851, 149), (852, 148), (853, 147), (854, 146), (855, 145), (856, 144), (857, 143), (858, 142), (859, 141), (860, 140), (861, 139), (862, 138), (863, 137), (864, 136), (865, 135), (866, 134), (867, 133), (868, 132), (869, 131), (870, 130), (871, 129), (872, 128), (873, 127), (874, 126);
+INSERT INTO p VALUES (875, 125), (876, 124), (877, 123), (878, 122), (879, 121), (880, 120), (881, 119), (882, 118), (883, 117), (884, 116), (885, 115), (886, 114), (887, 113), (888, 112), (889, 111), (890, 110), (891, 109), (892, 108), (893, 107), (894, 106), (895, 105), (896, 104), (897, 103), (898, 102), (899, 101);
+INSERT INTO p VALUES (900, 100), (901, 99), (902, 98), (903, 97), (904, 96), (905, 95), (906, 94), (907, 93), (908, 92), (909, 91), (910, 90), (911, 89), (912, 88), (913, 87), (914, 86), (915, 85), (916, 84), (917, 83), (918, 82), (919, 81), (920, 80), (921, 79), (922, 78), (923, 77), (924, 76);
+INSERT INTO p VALUES (925, 75), (926, 74), (927, 73), (928, 72), (929, 71), (930, 70), (931, 69), (932, 68), (933, 67), (934, 66), (935, 65), (936, 64), (937, 63), (938, 62), (939, 61), (940, 60), (941, 59), (942, 58), (943, 57), (944, 56), (945, 55), (946, 54), (947, 53), (948, 52), (949, 51);
+INSERT INTO p VALUES (950, 50), (951, 49), (952, 48), (953, 47), (954, 46), (955, 45), (956, 44), (957, 43), (958, 42), (959, 41), (960, 40), (961, 39), (962, 38), (963, 37), (964, 36), (965, 35), (966, 34), (967, 33), (968, 32), (969, 31), (970, 30), (971, 29), (972, 28), (973, 27), (974, 26);
+INSERT INTO p VALUES (975, 25), (976, 24), (977, 23), (978, 22), (979, 21), (980, 20), (981, 19), (982, 18), (983, 17), (984, 16), (985, 15), (986, 14), (987, 13), (988, 12), (989, 11), (990, 10), (991, 9), (992, 8), (993, 7), (994, 6), (995, 5), (996, 4), (997, 3), (998, 2), (999, 1);
+SELECT id, k FROM p WHERE k < 6;
+SELECT id, k FROM p WHERE k = 3 OR k = 5;
+SELECT NUM(id) FROM p WHERE k >= 10;
+ANALYZE TABLE p;
+SELECT id, k FROM p WHERE k < 6;
+SELECT id, k FROM p WHERE k = 3 OR k = 5;
+SELECT NUM(id) FROM p WHERE k >= 10;
@@ -0,0 +1,108 @@
+// g++ -std=c++11 -O2 -pthread -Isrc -Isrc/include test/bptree_olc_bench.cpp -o olc_bench
+// olc_bench [max threads] [keys] [write percent]
+#include <bufmanager/BufPageManager.h>
+#include <fileio/FileManager.h>
+#include <utils/pagedef.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <unistd.h>
+#include "bptree_olc.h"
+using namespace std;
+
+typedef bptree::olc_tree<bptree::int_rid, RID> tree_t;
+
+bptree::int_rid key(int k)
+{
+    return bptree::int_rid(Type_int(false, k), RID(k, k));
+}
+
+/* lookups of loaded keys, and with `writes` percent chance the insert or
+ * remove of a key above them instead */
+long long run(tree_t *tree, int threads, int keys, int writes, double seconds)
+{
+    atomic<bool> stop(false);
+    atomic<long long> ops(0);
+    vector<thread> pool;
+
+    for (int t = 0; t < threads; ++t)
+        pool.push_back(thread([&, t]()
+        {
+            mt19937 rng(t);
+            long long n = 0;
+            RID value;
+
+            while (!stop)
+            {
+                if ((int)(rng() % 100) < writes)
+                {
+                    int k = keys + t + threads * (rng() % 1024);
+
+                    if (tree->insert(key(k), RID(k, k)) != 0)tree->remove(key(k));
+                }
+                else
+                {
+                    tree->search(key(rng() % keys), &value);
+                }
+
+                n++;
+            }
+
+            ops += n;
+        }));
+
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    stop = true;
+
+    for (auto &t : pool)
+        t.join();
+
+    return ops / seconds;
+}
+
+int main(int argc, char **argv)
+{
+    int threads = argc > 1 ? atoi(argv[1]) : thread::hardware_concurrency();
+    int keys = argc > 2 ? atoi(argv[2]) : 1000000;
+    int writes = argc > 3 ? atoi(argv[3]) : 0;
+
+    MyBitMap::initConst();
+    FileManager *fm = new FileManager();
+    BufPageManager *bpm = new BufPageManager(fm);
+    const char *path = "olc_bench.db";
+    unlink(path);
+    tree_t *tree = new tree_t(fm, bpm, path, true);
+
+    {
+        int k = 0;
+        tree->build([&](tree_t::record_t & record)
+        {
+            if (k == keys)return false;
+
+            record.key = key(k);
+            record.value = RID(k, k);
+            k++;
+            return true;
+        }, keys, 0.9);
+    }
+
+    // readers scale with threads only up to the cores that run them
+    printf("%d keys, %d%% writes, %u cores\nthreads  ops/s\n", keys, writes, thread::hardware_concurrency());
+    long long one = 0;
+
+    for (int t = 1; t <= threads; ++t)
+    {
+        long long ops = run(tree, t, keys, writes, 1.0);
+
+        if (t == 1)one = ops;
+
+        printf("%7d  %lld (%.2fx)\n", t, ops, (double)ops / one);
+    }
+
+    delete tree;
+    unlink(path);
+    return 0;
+}
@@ -0,0 +1,165 @@
+// g++ -std=c++11 -O2 -pthread -Isrc -Isrc/include test/bptree_olc_stress.cpp -o olc_stress
+// olc_stress [readers] [writers] [seconds]
+#include <bufmanager/BufPageManager.h>
+#include <fileio/FileManager.h>
+#include <utils/pagedef.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <thread>
+#include <unistd.h>
+#include "bptree_olc.h"
+using namespace std;
+
+typedef bptree::olc_tree<bptree::int_rid, RID> tree_t;
+
+/* even keys are loaded up front and never removed, writers own the odd
+ * keys equal to their number modulo the writer count */
+const int STABLE = 200000;
+
+bptree::int_rid key(int k)
+{
+    return bptree::int_rid(Type_int(false, k), RID(k, k));
+}
+
+atomic<bool> stop(false);
+atomic<long long> reads(0), writes(0);
+atomic<int> failures(0);
+
+void fail(const char *what, int k)
+{
+    if (failures++ < 10)printf("FAIL %s %d\n", what, k);
+}
+
+void reader(tree_t *tree, int seed)
+{
+    mt19937 rng(seed);
+    long long n = 0;
+
+    while (!stop)
+    {
+        int k = rng() % STABLE * 2;
+        RID value;
+
+        if (rng() % 8)
+        {
+            if (tree->search(key(k), &value) != 0 || value.pageId != k)fail("search", k);
+        }
+        else
+        {
+            // every stable key in range is there, everything is in order
+            vector<RID> values = tree->search_range(key(k), key(k + 200));
+            size_t stable = 0;
+
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                if (i > 0 && values[i].pageId <= values[i - 1].pageId)fail("order", k);
+
+                if (values[i].pageId < k || values[i].pageId > k + 200)fail("bounds", k);
+
+                if (values[i].pageId % 2 == 0)stable++;
+            }
+
+            if (stable != (size_t)min(101, STABLE - k / 2))fail("range", k);
+        }
+
+        n++;
+    }
+
+    reads += n;
+}
+
+void writer(tree_t *tree, int w, int writers, set<int> *mine)
+{
+    mt19937 rng(1000 + w);
+    long long n = 0;
+
+    while (!stop)
+    {
+        int k = (rng() % (STABLE / writers)) * writers + w;
+        k = 2 * k + 1;
+
+        if (mine->count(k))
+        {
+            if (tree->remove(key(k)) != 0)fail("remove", k);
+
+            mine->erase(k);
+        }
+        else
+        {
+            if (tree->insert(key(k), RID(k, k)) != 0)fail("insert", k);
+
+            mine->insert(k);
+        }
+
+        // writes of this thread are seen by its own reads
+        RID value;
+        int found = tree->search(key(k), &value);
+
+        if ((found == 0) != (mine->count(k) > 0))fail("own", k);
+
+        n++;
+    }
+
+    writes += n;
+}
+
+int main(int argc, char **argv)
+{
+    int readers = argc > 1 ? atoi(argv[1]) : 4;
+    int writers = argc > 2 ? atoi(argv[2]) : 2;
+    int seconds = argc > 3 ? atoi(argv[3]) : 5;
+
+    MyBitMap::initConst();
+    FileManager *fm = new FileManager();
+    BufPageManager *bpm = new BufPageManager(fm);
+    const char *path = "olc_stress.db";
+    unlink(path);
+    tree_t *tree = new tree_t(fm, bpm, path, true);
+
+    for (int k = 0; k < STABLE; ++k)
+        tree->insert(key(2 * k), RID(2 * k, 2 * k));
+
+    vector<set<int> > mine(writers);
+    vector<thread> threads;
+
+    for (int i = 0; i < readers; ++i)
+        threads.push_back(thread(reader, tree, i));
+
+    for (int i = 0; i < writers; ++i)
+        threads.push_back(thread(writer, tree, i, writers, &mine[i]));
+
+    this_thread::sleep_for(chrono::seconds(seconds));
+    stop = true;
+
+    for (auto &t : threads)
+        t.join();
+
+    // the tree holds exactly the stable keys and what the writers left
+    set<int> expect;
+
+    for (int k = 0; k < STABLE; ++k)
+        expect.insert(2 * k);
+
+    for (auto &s : mine)
+        expect.insert(s.begin(), s.end());
+
+    auto it = expect.begin();
+
+    for (auto c = tree->first(); c.valid(); c.next(), ++it)
+        if (it == expect.end() || c.value().pageId != *it)
+        {
+            fail("contents", it == expect.end() ? -1 : *it);
+            break;
+        }
+
+    if (it != expect.end())fail("missing", *it);
+
+    printf("%lld reads, %lld writes, %d failures\n", (long long)reads, (long long)writes, (int)failures);
+    delete tree;
+    unlink(path);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+// g++ -std=c++11 -O2 [-mavx2] -Isrc -Isrc/include test/bptree_search_bench.cpp -o search_bench
+// search_bench [keys] [lookups]
+#include <bufmanager/BufPageManager.h>
+#include <fileio/FileManager.h>
+#include <utils/pagedef.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unistd.h>
+#include "bptree.h"
+using namespace std;
+
+typedef bptree::bplus_tree<bptree::int_rid, RID> tree_t;
+typedef bptree::key_column<bptree::int_rid> column_of;
+
+bptree::int_rid key(int k)
+{
+    return bptree::int_rid(Type_int(false, k), RID(k, k));
+}
+
+double since(chrono::steady_clock::time_point start, int n)
+{
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / n;
+}
+
+int main(int argc, char **argv)
+{
+    int keys = argc > 1 ? atoi(argv[1]) : 1000000;
+    int lookups = argc > 2 ? atoi(argv[2]) : 2000000;
+    mt19937 rng(1);
+
+#if defined(__AVX2__)
+    printf("kernel: AVX2\n");
+#elif defined(__SSE2__)
+    printf("kernel: SSE2\n");
+#else
+    printf("kernel: scalar\n");
+#endif
+
+    // one full internal node, searched as before and through its column
+    tree_t::internal_node_t node;
+    node.n = tree_t::BP_ORDER;
+
+    for (size_t i = 0; i < node.n; ++i)
+    {
+        node.children[i].key = key(2 * i);
+        node.children[i].child = i;
+    }
+
+    column_of::fill(node.column, &node.children[0].key, sizeof(tree_t::index_t), node.n - 1, tree_t::COLUMN_SIZE);
+
+    vector<bptree::int_rid> probes;
+
+    for (int i = 0; i < 4096; ++i)
+        probes.push_back(key(rng() % (2 * node.n)));
+
+    long long sum = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < lookups; ++i)
+        sum += std::upper_bound(node.children, node.children + node.n - 1, probes[i & 4095])->child;
+
+    double plain = since(start, lookups);
+    start = chrono::steady_clock::now();
+
+    for (int i = 0; i < lookups; ++i)
+    {
+        size_t less, not_greater;
+        column_of::rank(node.column, node.n - 1, probes[i & 4095], less, not_greater);
+        sum -= std::upper_bound(node.children + less, node.children + not_greater, probes[i & 4095])->child;
+    }
+
+    double column = since(start, lookups);
+
+    if (sum != 0)printf("mismatch\n");
+
+    printf("node of %zu keys: %.1f ns by key compares, %.1f ns by column (%.2fx)\n",
+           (size_t)node.n, plain, column, plain / column);
+
+    // whole lookups through a tree
+    MyBitMap::initConst();
+    FileManager *fm = new FileManager();
+    BufPageManager *bpm = new BufPageManager(fm);
+    const char *path = "search_bench.db";
+    unlink(path);
+    tree_t *tree = new tree_t(fm, bpm, path, true);
+    int k = 0;
+
+    tree->build([&](tree_t::record_t & record)
+    {
+        if (k == keys)return false;
+
+        record.key = key(k);
+        record.value = RID(k, k);
+        k++;
+        return true;
+    }, keys, 0.9);
+
+    start = chrono::steady_clock::now();
+
+    for (int i = 0; i < lookups; ++i)
+    {
+        RID value;
+        int probe = rng() % keys;
+
+        if (tree->search(key(probe), &value) != 0 || value.pageId != probe)
+        {
+            printf("lost key %d\n", probe);
+            return 1;
+        }
+    }
+
+    printf("tree of %d keys, height %zu: %.1f ns per lookup\n", keys, tree->get_meta().height, since(start, lookups));
+    delete tree;
+    unlink(path);
+    return 0;
+}
@@ -0,0 +1,234 @@
+-- Bloom filters on the primary key, built on an empty table and grown
+-- by inserts, and on a string column, built from loaded rows; see
+-- run_sql.sh
+CREATE DATABASE ib;
+USE DATABASE ib;
+CREATE TABLE t(id int(10) NOT NULL, a int(10), s varchar(10), PRIMARY KEY(id));
+CREATE INDEX t("id BLOOM");
+INSERT INTO t VALUES (2, 1, 'k7919'), (4, 2, 'k5831'), (6, 3, 'k3743'), (8, 4, 'k1655'), (10, 5, 'k9574'), (12, 6, 'k7486'), (14, 7, 'k5398'), (16, 8, 'k3310'), (18, 9, 'k1222'), (20, 10, 'k9141'), (22, 11, 'k7053'), (24, 12, 'k4965'), (26, 13, 'k2877'), (28, 14, 'k789'), (30, 15, 'k8708'), (32, 16, 'k6620'), (34, 17, 'k4532'), (36, 18, 'k2444'), (38, 19, 'k356'), (40, 20, 'k8275'), (42, 21, 'k6187'), (44, 22, 'k4099'), (46, 23, 'k2011'), (48, 24, 'k9930'), (50, 25, 'k7842');
+INSERT INTO t VALUES (52, 26, 'k5754'), (54, 27, 'k3666'), (56, 28, 'k1578'), (58, 29, 'k9497'), (60, 30, 'k7409'), (62, 31, 'k5321'), (64, 32, 'k3233'), (66, 33, 'k1145'), (68, 34, 'k9064'), (70, 35, 'k6976'), (72, 36, 'k4888'), (74, 37, 'k2800'), (76, 38, 'k712'), (78, 39, 'k8631'), (80, 40, 'k6543'), (82, 41, 'k4455'), (84, 42, 'k2367'), (86, 43, 'k279'), (88, 44, 'k8198'), (90, 45, 'k6110'), (92, 46, 'k4022'), (94, 47, 'k1934'), (96, 48, 'k9853'), (98, 49, 'k7765'), (100, 0, 'k5677');
+INSERT INTO t VALUES (102, 1, 'k3589'), (104, 2, 'k1501'), (106, 3, 'k9420'), (108, 4, 'k7332'), (110, 5, 'k5244'), (112, 6, 'k3156'), (114, 7, 'k1068'), (116, 8, 'k8987'), (118, 9, 'k6899'), (120, 10, 'k4811'), (122, 11, 'k2723'), (124, 12, 'k635'), (126, 13, 'k8554'), (128, 14, 'k6466'), (130, 15, 'k4378'), (132, 16, 'k2290'), (134, 17, 'k202'), (136, 18, 'k8121'), (138, 19, 'k6033'), (140, 20, 'k3945'), (142, 21, 'k1857'), (144, 22, 'k9776'), (146, 23, 'k7688'), (148, 24, 'k5600'), (150, 25, 'k3512');
+INSERT INTO t VALUES (152, 26, 'k1424'), (154, 27, 'k9343'), (156, 28, 'k7255'), (158, 29, 'k5167'), (160, 30, 'k3079'), (162, 31, 'k991'), (164, 32, 'k8910'), (166, 33, 'k6822'), (168, 34, 'k4734'), (170, 35, 'k2646'), (172, 36, 'k558'), (174, 37, 'k8477'), (176, 38, 'k6389'), (178, 39, 'k4301'), (180, 40, 'k2213'), (182, 41, 'k125'), (184, 42, 'k8044'), (186, 43, 'k5956'), (188, 44, 'k3868'), (190, 45, 'k1780'), (192, 46, 'k9699'), (194, 47, 'k7611'), (196, 48, 'k5523'), (198, 49, 'k3435'), (200, 0, 'k1347');
+INSERT INTO t VALUES (202, 1, 'k9266'), (204, 2, 'k7178'), (206, 3, 'k5090'), (208, 4, 'k3002'), (210, 5, 'k914'), (212, 6, 'k8833'), (214, 7, 'k6745'), (216, 8, 'k4657'), (218, 9, 'k2569'), (220, 10, 'k481'), (222, 11, 'k8400'), (224, 12, 'k6312'), (226, 13, 'k4224'), (228, 14, 'k2136'), (230, 15, 'k48'), (232, 16, 'k7967'), (234, 17, 'k5879'), (236, 18, 'k3791'), (238, 19, 'k1703'), (240, 20, 'k9622'), (242, 21, 'k7534'), (244, 22, 'k5446'), (246, 23, 'k3358'), (248, 24, 'k1270'), (250, 25, 'k9189');
+INSERT INTO t VALUES (252, 26, 'k7101'), (254, 27, 'k5013'), (256, 28, 'k2925'), (258, 29, 'k837'), (260, 30, 'k8756'), (262, 31, 'k6668'), (264, 32, 'k4580'), (266, 33, 'k2492'), (268, 34, 'k404'), (270, 35, 'k8323'), (272, 36, 'k6235'), (274, 37, 'k4147'), (276, 38, 'k2059'), (278, 39, 'k9978'), (280, 40, 'k7890'), (282, 41, 'k5802'), (284, 42, 'k3714'), (286, 43, 'k1626'), (288, 44, 'k9545'), (290, 45, 'k7457'), (292, 46, 'k5369'), (294, 47, 'k3281'), (296, 48, 'k1193'), (298, 49, 'k9112'), (300, 0, 'k7024');
+INSERT INTO t VALUES (302, 1, 'k4936'), (304, 2, 'k2848'), (306, 3, 'k760'), (308, 4, 'k8679'), (310, 5, 'k6591'), (312, 6, 'k4503'), (314, 7, 'k2415'), (316, 8, 'k327'), (318, 9, 'k8246'), (320, 10, 'k6158'), (322, 11, 'k4070'), (324, 12, 'k1982'), (326, 13, 'k9901'), (328, 14, 'k7813'), (330, 15, 'k5725'), (332, 16, 'k3637'), (334, 17, 'k1549'), (336, 18, 'k9468'), (338, 19, 'k7380'), (340, 20, 'k5292'), (342, 21, 'k3204'), (344, 22, 'k1116'), (346, 23, 'k9035'), (348, 24, 'k6947'), (350, 25, 'k4859');
+INSERT INTO t VALUES (352, 26, 'k2771'), (354, 27, 'k683'), (356, 28, 'k8602'), (358, 29, 'k6514'), (360, 30, 'k4426'), (362, 31, 'k2338'), (364, 32, 'k250'), (366, 33, 'k8169'), (368, 34, 'k6081'), (370, 35, 'k3993'), (372, 36, 'k1905'), (374, 37, 'k9824'), (376, 38, 'k7736'), (378, 39, 'k5648'), (380, 40, 'k3560'), (382, 41, 'k1472'), (384, 42, 'k9391'), (386, 43, 'k7303'), (388, 44, 'k5215'), (390, 45, 'k3127'), (392, 46, 'k1039'), (394, 47, 'k8958'), (396, 48, 'k6870'), (398, 49, 'k4782'), (400, 0, 'k2694');
+INSERT INTO t VALUES (402, 1, 'k606'), (404, 2, 'k8525'), (406, 3, 'k6437'), (408, 4, 'k4349'), (410, 5, 'k2261'), (412, 6, 'k173'), (414, 7, 'k8092'), (416, 8, 'k6004'), (418, 9, 'k3916'), (420, 10, 'k1828'), (422, 11, 'k9747'), (424, 12, 'k7659'), (426, 13, 'k5571'), (428, 14, 'k3483'), (430, 15, 'k1395'), (432, 16, 'k9314'), (434, 17, 'k7226'), (436, 18, 'k5138'), (438, 19, 'k3050'), (440, 20, 'k962'), (442, 21, 'k8881'), (444, 22, 'k6793'), (446, 23, 'k4705'), (448, 24, 'k2617'), (450, 25, 'k529');
+INSERT INTO t VALUES (452, 26, 'k8448'), (454, 27, 'k6360'), (456, 28, 'k4272'), (458, 29, 'k2184'), (460, 30, 'k96'), (462, 31, 'k8015'), (464, 32, 'k5927'), (466, 33, 'k3839'), (468, 34, 'k1751'), (470, 35, 'k9670'), (472, 36, 'k7582'), (474, 37, 'k5494'), (476, 38, 'k3406'), (478, 39, 'k1318'), (480, 40, 'k9237'), (482, 41, 'k7149'), (484, 42, 'k5061'), (486, 43, 'k2973'), (488, 44, 'k885'), (490, 45, 'k8804'), (492, 46, 'k6716'), (494, 47, 'k4628'), (496, 48, 'k2540'), (498, 49, 'k452'), (500, 0, 'k8371');
+INSERT INTO t VALUES (502, 1, 'k6283'), (504, 2, 'k4195'), (506, 3, 'k2107'), (508, 4, 'k19'), (510, 5, 'k7938'), (512, 6, 'k5850'), (514, 7, 'k3762'), (516, 8, 'k1674'), (518, 9, 'k9593'), (520, 10, 'k7505'), (522, 11, 'k5417'), (524, 12, 'k3329'), (526, 13, 'k1241'), (528, 14, 'k9160'), (530, 15, 'k7072'), (532, 16, 'k4984'), (534, 17, 'k2896'), (536, 18, 'k808'), (538, 19, 'k8727'), (540, 20, 'k6639'), (542, 21, 'k4551'), (544, 22, 'k2463'), (546, 23, 'k375'), (548, 24, 'k8294'), (550, 25, 'k6206');
+INSERT INTO t VALUES (552, 26, 'k4118'), (554, 27, 'k2030'), (556, 28, 'k9949'), (558, 29, 'k7861'), (560, 30, 'k5773'), (562, 31, 'k3685'), (564, 32, 'k1597'), (566, 33, 'k9516'), (568, 34, 'k7428'), (570, 35, 'k5340'), (572, 36, 'k3252'), (574, 37, 'k1164'), (576, 38, 'k9083'), (578, 39, 'k6995'), (580, 40, 'k4907'), (582, 41, 'k2819'), (584, 42, 'k731'), (586, 43, 'k8650'), (588, 44, 'k6562'), (590, 45, 'k4474'), (592, 46, 'k2386'), (594, 47, 'k298'), (596, 48, 'k8217'), (598, 49, 'k6129'), (600, 0, 'k4041');
+INSERT INTO t VALUES (602, 1, 'k1953'), (604, 2, 'k9872'), (606, 3, 'k7784'), (608, 4, 'k5696'), (610, 5, 'k3608'), (612, 6, 'k1520'), (614, 7, 'k9439'), (616, 8, 'k7351'), (618, 9, 'k5263'), (620, 10, 'k3175'), (622, 11, 'k1087'), (624, 12, 'k9006'), (626, 13, 'k6918'), (628, 14, 'k4830'), (630, 15, 'k2742'), (632, 16, 'k654'), (634, 17, 'k8573'), (636, 18, 'k6485'), (638, 19, 'k4397'), (640, 20, 'k2309'), (642, 21, 'k221'), (644, 22, 'k8140'), (646, 23, 'k6052'), (648, 24, 'k3964'), (650, 25, 'k1876');
+INSERT INTO t VALUES (652, 26, 'k9795'), (654, 27, 'k7707'), (656, 28, 'k5619'), (658, 29, 'k3531'), (660, 30, 'k1443'), (662, 31, 'k9362'), (664, 32, 'k7274'), (666, 33, 'k5186'), (668, 34, 'k3098'), (670, 35, 'k1010'), (672, 36, 'k8929'), (674, 37, 'k6841'), (676, 38, 'k4753'), (678, 39, 'k2665'), (680, 40, 'k577'), (682, 41, 'k8496'), (684, 42, 'k6408'), (686, 43, 'k4320'), (688, 44, 'k2232'), (690, 45, 'k144'), (692, 46, 'k8063'), (694, 47, 'k5975'), (696, 48, 'k3887'), (698, 49, 'k1799'), (700, 0, 'k9718');
+INSERT INTO t VALUES (702, 1, 'k7630'), (704, 2, 'k5542'), (706, 3, 'k3454'), (708, 4, 'k1366'), (710, 5, 'k9285'), (712, 6, 'k7197'), (714, 7, 'k5109'), (716, 8, 'k3021'), (718, 9, 'k933'), (720, 10, 'k8852'), (722, 11, 'k6764'), (724, 12, 'k4676'), (726, 13, 'k2588'), (728, 14, 'k500'), (730, 15, 'k8419'), (732, 16, 'k6331'), (734, 17, 'k4243'), (736, 18, 'k2155'), (738, 19, 'k67'), (740, 20, 'k7986'), (742, 21, 'k5898'), (744, 22, 'k3810'), (746, 23, 'k1722'), (748, 24, 'k9641'), (750, 25, 'k7553');
+INSERT INTO t VALUES (752, 26, 'k5465'), (754, 27, 'k3377'), (756, 28, 'k1289'), (758, 29, 'k9208'), (760, 30, 'k7120'), (762, 31, 'k5032'), (764, 32, 'k2944'), (766, 33, 'k856'), (768, 34, 'k8775'), (770, 35, 'k6687'), (772, 36, 'k4599'), (774, 37, 'k2511'), (776, 38, 'k423'), (778, 39, 'k8342'), (780, 40, 'k6254'), (782, 41, 'k4166'), (784, 42, 'k2078'), (786, 43, 'k9997'), (788, 44, 'k7909'), (790, 45, 'k5821'), (792, 46, 'k3733'), (794, 47, 'k1645'), (796, 48, 'k9564'), (798, 49, 'k7476'), (800, 0, 'k5388');
+INSERT INTO t VALUES (802, 1, 'k3300'), (804, 2, 'k1212'), (806, 3, 'k9131'), (808, 4, 'k7043'), (810, 5, 'k4955'), (812, 6, 'k2867'), (814, 7, 'k779'), (816, 8, 'k8698'), (818, 9, 'k6610'), (820, 10, 'k4522'), (822, 11, 'k2434'), (824, 12, 'k346'), (826, 13, 'k8265'), (828, 14, 'k6177'), (830, 15, 'k4089'), (832, 16, 'k2001'), (834, 17, 'k9920'), (836, 18, 'k7832'), (838, 19, 'k5744'), (840, 20, 'k3656'), (842, 21, 'k1568'), (844, 22, 'k9487'), (846, 23, 'k7399'), (848, 24, 'k5311'), (850, 25, 'k3223');
+INSERT INTO t VALUES (852, 26, 'k1135'), (854, 27, 'k9054'), (856, 28, 'k6966'), (858, 29, 'k4878'), (860, 30, 'k2790'), (862, 31, 'k702'), (864, 32, 'k8621'), (866, 33, 'k6533'), (868, 34, 'k4445'), (870, 35, 'k2357'), (872, 36, 'k269'), (874, 37, 'k8188'), (876, 38, 'k6100'), (878, 39, 'k4012'), (880, 40, 'k1924'), (882, 41, 'k9843'), (884, 42, 'k7755'), (886, 43, 'k5667'), (888, 44, 'k3579'), (890, 45, 'k1491'), (892, 46, 'k9410'), (894, 47, 'k7322'), (896, 48, 'k5234'), (898, 49, 'k3146'), (900, 0, 'k1058');
+INSERT INTO t VALUES (902, 1, 'k8977'), (904, 2, 'k6889'), (906, 3, 'k4801'), (908, 4, 'k2713'), (910, 5, 'k625'), (912, 6, 'k8544'), (914, 7, 'k6456'), (916, 8, 'k4368'), (918, 9, 'k2280'), (920, 10, 'k192'), (922, 11, 'k8111'), (924, 12, 'k6023'), (926, 13, 'k3935'), (928, 14, 'k1847'), (930, 15, 'k9766'), (932, 16, 'k7678'), (934, 17, 'k5590'), (936, 18, 'k3502'), (938, 19, 'k1414'), (940, 20, 'k9333'), (942, 21, 'k7245'), (944, 22, 'k5157'), (946, 23, 'k3069'), (948, 24, 'k981'), (950, 25, 'k8900');
+INSERT INTO t VALUES (952, 26, 'k6812'), (954, 27, 'k4724'), (956, 28, 'k2636'), (958, 29, 'k548'), (960, 30, 'k8467'), (962, 31, 'k6379'), (964, 32, 'k4291'), (966, 33, 'k2203'), (968, 34, 'k115'), (970, 35, 'k8034'), (972, 36, 'k5946'), (974, 37, 'k3858'), (976, 38, 'k1770'), (978, 39, 'k9689'), (980, 40, 'k7601'), (982, 41, 'k5513'), (984, 42, 'k3425'), (986, 43, 'k1337'), (988, 44, 'k9256'), (990, 45, 'k7168'), (992, 46, 'k5080'), (994, 47, 'k2992'), (996, 48, 'k904'), (998, 49, 'k8823'), (1000, 0, 'k6735');
+INSERT INTO t VALUES (1002, 1, 'k4647'), (1004, 2, 'k2559'), (1006, 3, 'k471'), (1008, 4, 'k8390'), (1010, 5, 'k6302'), (1012, 6, 'k4214'), (1014, 7, 'k2126'), (1016, 8, 'k38'), (1018, 9, 'k7957'), (1020, 10, 'k5869'), (1022, 11, 'k3781'), (1024, 12, 'k1693'), (1026, 13, 'k9612'), (1028, 14, 'k7524'), (1030, 15, 'k5436'), (1032, 16, 'k3348'), (1034, 17, 'k1260'), (1036, 18, 'k9179'), (1038, 19, 'k7091'), (1040, 20, 'k5003'), (1042, 21, 'k2915'), (1044, 22, 'k827'), (1046, 23, 'k8746'), (1048, 24, 'k6658'), (1050, 25, 'k4570');
+INSERT INTO t VALUES (1052, 26, 'k2482'), (1054, 27, 'k394'), (1056, 28, 'k8313'), (1058, 29, 'k6225'), (1060, 30, 'k4137'), (1062, 31, 'k2049'), (1064, 32, 'k9968'), (1066, 33, 'k7880'), (1068, 34, 'k5792'), (1070, 35, 'k3704'), (1072, 36, 'k1616'), (1074, 37, 'k9535'), (1076, 38, 'k7447'), (1078, 39, 'k5359'), (1080, 40, 'k3271'), (1082, 41, 'k1183'), (1084, 42, 'k9102'), (1086, 43, 'k7014'), (1088, 44, 'k4926'), (1090, 45, 'k2838'), (1092, 46, 'k750'), (1094, 47, 'k8669'), (1096, 48, 'k6581'), (1098, 49, 'k4493'), (1100, 0, 'k2405');
+INSERT INTO t VALUES (1102, 1, 'k317'), (1104, 2, 'k8236'), (1106, 3, 'k6148'), (1108, 4, 'k4060'), (1110, 5, 'k1972'), (1112, 6, 'k9891'), (1114, 7, 'k7803'), (1116, 8, 'k5715'), (1118, 9, 'k3627'), (1120, 10, 'k1539'), (1122, 11, 'k9458'), (1124, 12, 'k7370'), (1126, 13, 'k5282'), (1128, 14, 'k3194'), (1130, 15, 'k1106'), (1132, 16, 'k9025'), (1134, 17, 'k6937'), (1136, 18, 'k4849'), (1138, 19, 'k2761'), (1140, 20, 'k673'), (1142, 21, 'k8592'), (1144, 22, 'k6504'), (1146, 23, 'k4416'), (1148, 24, 'k2328'), (1150, 25, 'k240');
+INSERT INTO t VALUES (1152, 26, 'k8159'), (1154, 27, 'k6071'), (1156, 28, 'k3983'), (1158, 29, 'k1895'), (1160, 30, 'k9814'), (1162, 31, 'k7726'), (1164, 32, 'k5638'), (1166, 33, 'k3550'), (1168, 34, 'k1462'), (1170, 35, 'k9381'), (1172, 36, 'k7293'), (1174, 37, 'k5205'), (1176, 38, 'k3117'), (1178, 39, 'k1029'), (1180, 40, 'k8948'), (1182, 41, 'k6860'), (1184, 42, 'k4772'), (1186, 43, 'k2684'), (1188, 44, 'k596'), (1190, 45, 'k8515'), (1192, 46, 'k6427'), (1194, 47, 'k4339'), (1196, 48, 'k2251'), (1198, 49, 'k163'), (1200, 0, 'k8082');
+INSERT INTO t VALUES (1202, 1, 'k5994'), (1204, 2, 'k3906'), (1206, 3, 'k1818'), (1208, 4, 'k9737'), (1210, 5, 'k7649'), (1212, 6, 'k5561'), (1214, 7, 'k3473'), (1216, 8, 'k1385'), (1218, 9, 'k9304'), (1220, 10, 'k7216'), (1222, 11, 'k5128'), (1224, 12, 'k3040'), (1226, 13, 'k952'), (1228, 14, 'k8871'), (1230, 15, 'k6783'), (1232, 16, 'k4695'), (1234, 17, 'k2607'), (1236, 18, 'k519'), (1238, 19, 'k8438'), (1240, 20, 'k6350'), (1242, 21, 'k4262'), (1244, 22, 'k2174'), (1246, 23, 'k86'), (1248, 24, 'k8005'), (1250, 25, 'k5917');
+INSERT INTO t VALUES (1252, 26, 'k3829'), (1254, 27, 'k1741'), (1256, 28, 'k9660'), (1258, 29, 'k7572'), (1260, 30, 'k5484'), (1262, 31, 'k3396'), (1264, 32, 'k1308'), (1266, 33, 'k9227'), (1268, 34, 'k7139'), (1270, 35, 'k5051'), (1272, 36, 'k2963'), (1274, 37, 'k875'), (1276, 38, 'k8794'), (1278, 39, 'k6706'), (1280, 40, 'k4618'), (1282, 41, 'k2530'), (1284, 42, 'k442'), (1286, 43, 'k8361'), (1288, 44, 'k6273'), (1290, 45, 'k4185'), (1292, 46, 'k2097'), (1294, 47, 'k9'), (1296, 48, 'k7928'), (1298, 49, 'k5840'), (1300, 0, 'k3752');
+INSERT INTO t VALUES (1302, 1, 'k1664'), (1304, 2, 'k9583'), (1306, 3, 'k7495'), (1308, 4, 'k5407'), (1310, 5, 'k3319'), (1312, 6, 'k1231'), (1314, 7, 'k9150'), (1316, 8, 'k7062'), (1318, 9, 'k4974'), (1320, 10, 'k2886'), (1322, 11, 'k798'), (1324, 12, 'k8717'), (1326, 13, 'k6629'), (1328, 14, 'k4541'), (1330, 15, 'k2453'), (1332, 16, 'k365'), (1334, 17, 'k8284'), (1336, 18, 'k6196'), (1338, 19, 'k4108'), (1340, 20, 'k2020'), (1342, 21, 'k9939'), (1344, 22, 'k7851'), (1346, 23, 'k5763'), (1348, 24, 'k3675'), (1350, 25, 'k1587');
+INSERT INTO t VALUES (1352, 26, 'k9506'), (1354, 27, 'k7418'), (1356, 28, 'k5330'), (1358, 29, 'k3242'), (1360, 30, 'k1154'), (1362, 31, 'k9073'), (1364, 32, 'k6985'), (1366, 33, 'k4897'), (1368, 34, 'k2809'), (1370, 35, 'k721'), (1372, 36, 'k8640'), (1374, 37, 'k6552'), (1376, 38, 'k4464'), (1378, 39, 'k2376'), (1380, 40, 'k288'), (1382, 41, 'k8207'), (1384, 42, 'k6119'), (1386, 43, 'k4031'), (1388, 44, 'k1943'), (1390, 45, 'k9862'), (1392, 46, 'k7774'), (1394, 47, 'k5686'), (1396, 48, 'k3598'), (1398, 49, 'k1510'), (1400, 0, 'k9429');
+INSERT INTO t VALUES (1402, 1, 'k7341'), (1404, 2, 'k5253'), (1406, 3, 'k3165'), (1408, 4, 'k1077'), (1410, 5, 'k8996'), (1412, 6, 'k6908'), (1414, 7, 'k4820'), (1416, 8, 'k2732'), (1418, 9, 'k644'), (1420, 10, 'k8563'), (1422, 11, 'k6475'), (1424, 12, 'k4387'), (1426, 13, 'k2299'), (1428, 14, 'k211'), (1430, 15, 'k8130'), (1432, 16, 'k6042'), (1434, 17, 'k3954'), (1436, 18, 'k1866'), (1438, 19, 'k9785'), (1440, 20, 'k7697'), (1442, 21, 'k5609'), (1444, 22, 'k3521'), (1446, 23, 'k1433'), (1448, 24, 'k9352'), (1450, 25, 'k7264');
+INSERT INTO t VALUES (1452, 26, 'k5176'), (1454, 27, 'k3088'), (1456, 28, 'k1000'), (1458, 29, 'k8919'), (1460, 30, 'k6831'), (1462, 31, 'k4743'), (1464, 32, 'k2655'), (1466, 33, 'k567'), (1468, 34, 'k8486'), (1470, 35, 'k6398'), (1472, 36, 'k4310'), (1474, 37, 'k2222'), (1476, 38, 'k134'), (1478, 39, 'k8053'), (1480, 40, 'k5965'), (1482, 41, 'k3877'), (1484, 42, 'k1789'), (1486, 43, 'k9708'), (1488, 44, 'k7620'), (1490, 45, 'k5532'), (1492, 46, 'k3444'), (1494, 47, 'k1356'), (1496, 48, 'k9275'), (1498, 49, 'k7187'), (1500, 0, 'k5099');
+INSERT INTO t VALUES (1502, 1, 'k3011'), (1504, 2, 'k923'), (1506, 3, 'k8842'), (1508, 4, 'k6754'), (1510, 5, 'k4666'), (1512, 6, 'k2578'), (1514, 7, 'k490'), (1516, 8, 'k8409'), (1518, 9, 'k6321'), (1520, 10, 'k4233'), (1522, 11, 'k2145'), (1524, 12, 'k57'), (1526, 13, 'k7976'), (1528, 14, 'k5888'), (1530, 15, 'k3800'), (1532, 16, 'k1712'), (1534, 17, 'k9631'), (1536, 18, 'k7543'), (1538, 19, 'k5455'), (1540, 20, 'k3367'), (1542, 21, 'k1279'), (1544, 22, 'k9198'), (1546, 23, 'k7110'), (1548, 24, 'k5022'), (1550, 25, 'k2934');
+INSERT INTO t VALUES (1552, 26, 'k846'), (1554, 27, 'k8765'), (1556, 28, 'k6677'), (1558, 29, 'k4589'), (1560, 30, 'k2501'), (1562, 31, 'k413'), (1564, 32, 'k8332'), (1566, 33, 'k6244'), (1568, 34, 'k4156'), (1570, 35, 'k2068'), (1572, 36, 'k9987'), (1574, 37, 'k7899'), (1576, 38, 'k5811'), (1578, 39, 'k3723'), (1580, 40, 'k1635'), (1582, 41, 'k9554'), (1584, 42, 'k7466'), (1586, 43, 'k5378'), (1588, 44, 'k3290'), (1590, 45, 'k1202'), (1592, 46, 'k9121'), (1594, 47, 'k7033'), (1596, 48, 'k4945'), (1598, 49, 'k2857'), (1600, 0, 'k769');
+INSERT INTO t VALUES (1602, 1, 'k8688'), (1604, 2, 'k6600'), (1606, 3, 'k4512'), (1608, 4, 'k2424'), (1610, 5, 'k336'), (1612, 6, 'k8255'), (1614, 7, 'k6167'), (1616, 8, 'k4079'), (1618, 9, 'k1991'), (1620, 10, 'k9910'), (1622, 11, 'k7822'), (1624, 12, 'k5734'), (1626, 13, 'k3646'), (1628, 14, 'k1558'), (1630, 15, 'k9477'), (1632, 16, 'k7389'), (1634, 17, 'k5301'), (1636, 18, 'k3213'), (1638, 19, 'k1125'), (1640, 20, 'k9044'), (1642, 21, 'k6956'), (1644, 22, 'k4868'), (1646, 23, 'k2780'), (1648, 24, 'k692'), (1650, 25, 'k8611');
+INSERT INTO t VALUES (1652, 26, 'k6523'), (1654, 27, 'k4435'), (1656, 28, 'k2347'), (1658, 29, 'k259'), (1660, 30, 'k8178'), (1662, 31, 'k6090'), (1664, 32, 'k4002'), (1666, 33, 'k1914'), (1668, 34, 'k9833'), (1670, 35, 'k7745'), (1672, 36, 'k5657'), (1674, 37, 'k3569'), (1676, 38, 'k1481'), (1678, 39, 'k9400'), (1680, 40, 'k7312'), (1682, 41, 'k5224'), (1684, 42, 'k3136'), (1686, 43, 'k1048'), (1688, 44, 'k8967'), (1690, 45, 'k6879'), (1692, 46, 'k4791'), (1694, 47, 'k2703'), (1696, 48, 'k615'), (1698, 49, 'k8534'), (1700, 0, 'k6446');
+INSERT INTO t VALUES (1702, 1, 'k4358'), (1704, 2, 'k2270'), (1706, 3, 'k182'), (1708, 4, 'k8101'), (1710, 5, 'k6013'), (1712, 6, 'k3925'), (1714, 7, 'k1837'), (1716, 8, 'k9756'), (1718, 9, 'k7668'), (1720, 10, 'k5580'), (1722, 11, 'k3492'), (1724, 12, 'k1404'), (1726, 13, 'k9323'), (1728, 14, 'k7235'), (1730, 15, 'k5147'), (1732, 16, 'k3059'), (1734, 17, 'k971'), (1736, 18, 'k8890'), (1738, 19, 'k6802'), (1740, 20, 'k4714'), (1742, 21, 'k2626'), (1744, 22, 'k538'), (1746, 23, 'k8457'), (1748, 24, 'k6369'), (1750, 25, 'k4281');
+INSERT INTO t VALUES (1752, 26, 'k2193'), (1754, 27, 'k105'), (1756, 28, 'k8024'), (1758, 29, 'k5936'), (1760, 30, 'k3848'), (1762, 31, 'k1760'), (1764, 32, 'k9679'), (1766, 33, 'k7591'), (1768, 34, 'k5503'), (1770, 35, 'k3415'), (1772, 36, 'k1327'), (1774, 37, 'k9246'), (1776, 38, 'k7158'), (1778, 39, 'k5070'), (1780, 40, 'k2982'), (1782, 41, 'k894'), (1784, 42, 'k8813'), (1786, 43, 'k6725'), (1788, 44, 'k4637'), (1790, 45, 'k2549'), (1792, 46, 'k461'), (1794, 47, 'k8380'), (1796, 48, 'k6292'), (1798, 49, 'k4204'), (1800, 0, 'k2116');
+INSERT INTO t VALUES (1802, 1, 'k28'), (1804, 2, 'k7947'), (1806, 3, 'k5859'), (1808, 4, 'k3771'), (1810, 5, 'k1683'), (1812, 6, 'k9602'), (1814, 7, 'k7514'), (1816, 8, 'k5426'), (1818, 9, 'k3338'), (1820, 10, 'k1250'), (1822, 11, 'k9169'), (1824, 12, 'k7081'), (1826, 13, 'k4993'), (1828, 14, 'k2905'), (1830, 15, 'k817'), (1832, 16, 'k8736'), (1834, 17, 'k6648'), (1836, 18, 'k4560'), (1838, 19, 'k2472'), (1840, 20, 'k384'), (1842, 21, 'k8303'), (1844, 22, 'k6215'), (1846, 23, 'k4127'), (1848, 24, 'k2039'), (1850, 25, 'k9958');
+INSERT INTO t VALUES (1852, 26, 'k7870'), (1854, 27, 'k5782'), (1856, 28, 'k3694'), (1858, 29, 'k1606'), (1860, 30, 'k9525'), (1862, 31, 'k7437'), (1864, 32, 'k5349'), (1866, 33, 'k3261'), (1868, 34, 'k1173'), (1870, 35, 'k9092'), (1872, 36, 'k7004'), (1874, 37, 'k4916'), (1876, 38, 'k2828'), (1878, 39, 'k740'), (1880, 40, 'k8659'), (1882, 41, 'k6571'), (1884, 42, 'k4483'), (1886, 43, 'k2395'), (1888, 44, 'k307'), (1890, 45, 'k8226'), (1892, 46, 'k6138'), (1894, 47, 'k4050'), (1896, 48, 'k1962'), (1898, 49, 'k9881'), (1900, 0, 'k7793');
+INSERT INTO t VALUES (1902, 1, 'k5705'), (1904, 2, 'k3617'), (1906, 3, 'k1529'), (1908, 4, 'k9448'), (1910, 5, 'k7360'), (1912, 6, 'k5272'), (1914, 7, 'k3184'), (1916, 8, 'k1096'), (1918, 9, 'k9015'), (1920, 10, 'k6927'), (1922, 11, 'k4839'), (1924, 12, 'k2751'), (1926, 13, 'k663'), (1928, 14, 'k8582'), (1930, 15, 'k6494'), (1932, 16, 'k4406'), (1934, 17, 'k2318'), (1936, 18, 'k230'), (1938, 19, 'k8149'), (1940, 20, 'k6061'), (1942, 21, 'k3973'), (1944, 22, 'k1885'), (1946, 23, 'k9804'), (1948, 24, 'k7716'), (1950, 25, 'k5628');
+INSERT INTO t VALUES (1952, 26, 'k3540'), (1954, 27, 'k1452'), (1956, 28, 'k9371'), (1958, 29, 'k7283'), (1960, 30, 'k5195'), (1962, 31, 'k3107'), (1964, 32, 'k1019'), (1966, 33, 'k8938'), (1968, 34, 'k6850'), (1970, 35, 'k4762'), (1972, 36, 'k2674'), (1974, 37, 'k586'), (1976, 38, 'k8505'), (1978, 39, 'k6417'), (1980, 40, 'k4329'), (1982, 41, 'k2241'), (1984, 42, 'k153'), (1986, 43, 'k8072'), (1988, 44, 'k5984'), (1990, 45, 'k3896'), (1992, 46, 'k1808'), (1994, 47, 'k9727'), (1996, 48, 'k7639'), (1998, 49, 'k5551'), (2000, 0, 'k3463');
+INSERT INTO t VALUES (2002, 1, 'k1375'), (2004, 2, 'k9294'), (2006, 3, 'k7206'), (2008, 4, 'k5118'), (2010, 5, 'k3030'), (2012, 6, 'k942'), (2014, 7, 'k8861'), (2016, 8, 'k6773'), (2018, 9, 'k4685'), (2020, 10, 'k2597'), (2022, 11, 'k509'), (2024, 12, 'k8428'), (2026, 13, 'k6340'), (2028, 14, 'k4252'), (2030, 15, 'k2164'), (2032, 16, 'k76'), (2034, 17, 'k7995'), (2036, 18, 'k5907'), (2038, 19, 'k3819'), (2040, 20, 'k1731'), (2042, 21, 'k9650'), (2044, 22, 'k7562'), (2046, 23, 'k5474'), (2048, 24, 'k3386'), (2050, 25, 'k1298');
+INSERT INTO t VALUES (2052, 26, 'k9217'), (2054, 27, 'k7129'), (2056, 28, 'k5041'), (2058, 29, 'k2953'), (2060, 30, 'k865'), (2062, 31, 'k8784'), (2064, 32, 'k6696'), (2066, 33, 'k4608'), (2068, 34, 'k2520'), (2070, 35, 'k432'), (2072, 36, 'k8351'), (2074, 37, 'k6263'), (2076, 38, 'k4175'), (2078, 39, 'k2087'), (2080, 40, 'k10006'), (2082, 41, 'k7918'), (2084, 42, 'k5830'), (2086, 43, 'k3742'), (2088, 44, 'k1654'), (2090, 45, 'k9573'), (2092, 46, 'k7485'), (2094, 47, 'k5397'), (2096, 48, 'k3309'), (2098, 49, 'k1221'), (2100, 0, 'k9140');
+INSERT INTO t VALUES (2102, 1, 'k7052'), (2104, 2, 'k4964'), (2106, 3, 'k2876'), (2108, 4, 'k788'), (2110, 5, 'k8707'), (2112, 6, 'k6619'), (2114, 7, 'k4531'), (2116, 8, 'k2443'), (2118, 9, 'k355'), (2120, 10, 'k8274'), (2122, 11, 'k6186'), (2124, 12, 'k4098'), (2126, 13, 'k2010'), (2128, 14, 'k9929'), (2130, 15, 'k7841'), (2132, 16, 'k5753'), (2134, 17, 'k3665'), (2136, 18, 'k1577'), (2138, 19, 'k9496'), (2140, 20, 'k7408'), (2142, 21, 'k5320'), (2144, 22, 'k3232'), (2146, 23, 'k1144'), (2148, 24, 'k9063'), (2150, 25, 'k6975');
+INSERT INTO t VALUES (2152, 26, 'k4887'), (2154, 27, 'k2799'), (2156, 28, 'k711'), (2158, 29, 'k8630'), (2160, 30, 'k6542'), (2162, 31, 'k4454'), (2164, 32, 'k2366'), (2166, 33, 'k278'), (2168, 34, 'k8197'), (2170, 35, 'k6109'), (2172, 36, 'k4021'), (2174, 37, 'k1933'), (2176, 38, 'k9852'), (2178, 39, 'k7764'), (2180, 40, 'k5676'), (2182, 41, 'k3588'), (2184, 42, 'k1500'), (2186, 43, 'k9419'), (2188, 44, 'k7331'), (2190, 45, 'k5243'), (2192, 46, 'k3155'), (2194, 47, 'k1067'), (2196, 48, 'k8986'), (2198, 49, 'k6898'), (2200, 0, 'k4810');
+INSERT INTO t VALUES (2202, 1, 'k2722'), (2204, 2, 'k634'), (2206, 3, 'k8553'), (2208, 4, 'k6465'), (2210, 5, 'k4377'), (2212, 6, 'k2289'), (2214, 7, 'k201'), (2216, 8, 'k8120'), (2218, 9, 'k6032'), (2220, 10, 'k3944'), (2222, 11, 'k1856'), (2224, 12, 'k9775'), (2226, 13, 'k7687'), (2228, 14, 'k5599'), (2230, 15, 'k3511'), (2232, 16, 'k1423'), (2234, 17, 'k9342'), (2236, 18, 'k7254'), (2238, 19, 'k5166'), (2240, 20, 'k3078'), (2242, 21, 'k990'), (2244, 22, 'k8909'), (2246, 23, 'k6821'), (2248, 24, 'k4733'), (2250, 25, 'k2645');
+INSERT INTO t VALUES (2252, 26, 'k557'), (2254, 27, 'k8476'), (2256, 28, 'k6388'), (2258, 29, 'k4300'), (2260, 30, 'k2212'), (2262, 31, 'k124'), (2264, 32, 'k8043'), (2266, 33, 'k5955'), (2268, 34, 'k3867'), (2270, 35, 'k1779'), (2272, 36, 'k9698'), (2274, 37, 'k7610'), (2276, 38, 'k5522'), (2278, 39, 'k3434'), (2280, 40, 'k1346'), (2282, 41, 'k9265'), (2284, 42, 'k7177'), (2286, 43, 'k5089'), (2288, 44, 'k3001'), (2290, 45, 'k913'), (2292, 46, 'k8832'), (2294, 47, 'k6744'), (2296, 48, 'k4656'), (2298, 49, 'k2568'), (2300, 0, 'k480');
+INSERT INTO t VALUES (2302, 1, 'k8399'), (2304, 2, 'k6311'), (2306, 3, 'k4223'), (2308, 4, 'k2135'), (2310, 5, 'k47'), (2312, 6, 'k7966'), (2314, 7, 'k5878'), (2316, 8, 'k3790'), (2318, 9, 'k1702'), (2320, 10, 'k9621'), (2322, 11, 'k7533'), (2324, 12, 'k5445'), (2326, 13, 'k3357'), (2328, 14, 'k1269'), (2330, 15, 'k9188'), (2332, 16, 'k7100'), (2334, 17, 'k5012'), (2336, 18, 'k2924'), (2338, 19, 'k836'), (2340, 20, 'k8755'), (2342, 21, 'k6667'), (2344, 22, 'k4579'), (2346, 23, 'k2491'), (2348, 24, 'k403'), (2350, 25, 'k8322');
+INSERT INTO t VALUES (2352, 26, 'k6234'), (2354, 27, 'k4146'), (2356, 28, 'k2058'), (2358, 29, 'k9977'), (2360, 30, 'k7889'), (2362, 31, 'k5801'), (2364, 32, 'k3713'), (2366, 33, 'k1625'), (2368, 34, 'k9544'), (2370, 35, 'k7456'), (2372, 36, 'k5368'), (2374, 37, 'k3280'), (2376, 38, 'k1192'), (2378, 39, 'k9111'), (2380, 40, 'k7023'), (2382, 41, 'k4935'), (2384, 42, 'k2847'), (2386, 43, 'k759'), (2388, 44, 'k8678'), (2390, 45, 'k6590'), (2392, 46, 'k4502'), (2394, 47, 'k2414'), (2396, 48, 'k326'), (2398, 49, 'k8245'), (2400, 0, 'k6157');
+INSERT INTO t VALUES (2402, 1, 'k4069'), (2404, 2, 'k1981'), (2406, 3, 'k9900'), (2408, 4, 'k7812'), (2410, 5, 'k5724'), (2412, 6, 'k3636'), (2414, 7, 'k1548'), (2416, 8, 'k9467'), (2418, 9, 'k7379'), (2420, 10, 'k5291'), (2422, 11, 'k3203'), (2424, 12, 'k1115'), (2426, 13, 'k9034'), (2428, 14, 'k6946'), (2430, 15, 'k4858'), (2432, 16, 'k2770'), (2434, 17, 'k682'), (2436, 18, 'k8601'), (2438, 19, 'k6513'), (2440, 20, 'k4425'), (2442, 21, 'k2337'), (2444, 22, 'k249'), (2446, 23, 'k8168'), (2448, 24, 'k6080'), (2450, 25, 'k3992');
+INSERT INTO t VALUES (2452, 26, 'k1904'), (2454, 27, 'k9823'), (2456, 28, 'k7735'), (2458, 29, 'k5647'), (2460, 30, 'k3559'), (2462, 31, 'k1471'), (2464, 32, 'k9390'), (2466, 33, 'k7302'), (2468, 34, 'k5214'), (2470, 35, 'k3126'), (2472, 36, 'k1038'), (2474, 37, 'k8957'), (2476, 38, 'k6869'), (2478, 39, 'k4781'), (2480, 40, 'k2693'), (2482, 41, 'k605'), (2484, 42, 'k8524'), (2486, 43, 'k6436'), (2488, 44, 'k4348'), (2490, 45, 'k2260'), (2492, 46, 'k172'), (2494, 47, 'k8091'), (2496, 48, 'k6003'), (2498, 49, 'k3915'), (2500, 0, 'k1827');
+INSERT INTO t VALUES (2502, 1, 'k9746'), (2504, 2, 'k7658'), (2506, 3, 'k5570'), (2508, 4, 'k3482'), (2510, 5, 'k1394'), (2512, 6, 'k9313'), (2514, 7, 'k7225'), (2516, 8, 'k5137'), (2518, 9, 'k3049'), (2520, 10, 'k961'), (2522, 11, 'k8880'), (2524, 12, 'k6792'), (2526, 13, 'k4704'), (2528, 14, 'k2616'), (2530, 15, 'k528'), (2532, 16, 'k8447'), (2534, 17, 'k6359'), (2536, 18, 'k4271'), (2538, 19, 'k2183'), (2540, 20, 'k95'), (2542, 21, 'k8014'), (2544, 22, 'k5926'), (2546, 23, 'k3838'), (2548, 24, 'k1750'), (2550, 25, 'k9669');
+INSERT INTO t VALUES (2552, 26, 'k7581'), (2554, 27, 'k5493'), (2556, 28, 'k3405'), (2558, 29, 'k1317'), (2560, 30, 'k9236'), (2562, 31, 'k7148'), (2564, 32, 'k5060'), (2566, 33, 'k2972'), (2568, 34, 'k884'), (2570, 35, 'k8803'), (2572, 36, 'k6715'), (2574, 37, 'k4627'), (2576, 38, 'k2539'), (2578, 39, 'k451'), (2580, 40, 'k8370'), (2582, 41, 'k6282'), (2584, 42, 'k4194'), (2586, 43, 'k2106'), (2588, 44, 'k18'), (2590, 45, 'k7937'), (2592, 46, 'k5849'), (2594, 47, 'k3761'), (2596, 48, 'k1673'), (2598, 49, 'k9592'), (2600, 0, 'k7504');
+INSERT INTO t VALUES (2602, 1, 'k5416'), (2604, 2, 'k3328'), (2606, 3, 'k1240'), (2608, 4, 'k9159'), (2610, 5, 'k7071'), (2612, 6, 'k4983'), (2614, 7, 'k2895'), (2616, 8, 'k807'), (2618, 9, 'k8726'), (2620, 10, 'k6638'), (2622, 11, 'k4550'), (2624, 12, 'k2462'), (2626, 13, 'k374'), (2628, 14, 'k8293'), (2630, 15, 'k6205'), (2632, 16, 'k4117'), (2634, 17, 'k2029'), (2636, 18, 'k9948'), (2638, 19, 'k7860'), (2640, 20, 'k5772'), (2642, 21, 'k3684'), (2644, 22, 'k1596'), (2646, 23, 'k9515'), (2648, 24, 'k7427'), (2650, 25, 'k5339');
+INSERT INTO t VALUES (2652, 26, 'k3251'), (2654, 27, 'k1163'), (2656, 28, 'k9082'), (2658, 29, 'k6994'), (2660, 30, 'k4906'), (2662, 31, 'k2818'), (2664, 32, 'k730'), (2666, 33, 'k8649'), (2668, 34, 'k6561'), (2670, 35, 'k4473'), (2672, 36, 'k2385'), (2674, 37, 'k297'), (2676, 38, 'k8216'), (2678, 39, 'k6128'), (2680, 40, 'k4040'), (2682, 41, 'k1952'), (2684, 42, 'k9871'), (2686, 43, 'k7783'), (2688, 44, 'k5695'), (2690, 45, 'k3607'), (2692, 46, 'k1519'), (2694, 47, 'k9438'), (2696, 48, 'k7350'), (2698, 49, 'k5262'), (2700, 0, 'k3174');
+INSERT INTO t VALUES (2702, 1, 'k1086'), (2704, 2, 'k9005'), (2706, 3, 'k6917'), (2708, 4, 'k4829'), (2710, 5, 'k2741'), (2712, 6, 'k653'), (2714, 7, 'k8572'), (2716, 8, 'k6484'), (2718, 9, 'k4396'), (2720, 10, 'k2308'), (2722, 11, 'k220'), (2724, 12, 'k8139'), (2726, 13, 'k6051'), (2728, 14, 'k3963'), (2730, 15, 'k1875'), (2732, 16, 'k9794'), (2734, 17, 'k7706'), (2736, 18, 'k5618'), (2738, 19, 'k3530'), (2740, 20, 'k1442'), (2742, 21, 'k9361'), (2744, 22, 'k7273'), (2746, 23, 'k5185'), (2748, 24, 'k3097'), (2750, 25, 'k1009');
+INSERT INTO t VALUES (2752, 26, 'k8928'), (2754, 27, 'k6840'), (2756, 28, 'k4752'), (2758, 29, 'k2664'), (2760, 30, 'k576'), (2762, 31, 'k8495'), (2764, 32, 'k6407'), (2766, 33, 'k4319'), (2768, 34, 'k2231'), (2770, 35, 'k143'), (2772, 36, 'k8062'), (2774, 37, 'k5974'), (2776, 38, 'k3886'), (2778, 39, 'k1798'), (2780, 40, 'k9717'), (2782, 41, 'k7629'), (2784, 42, 'k5541'), (2786, 43, 'k3453'), (2788, 44, 'k1365'), (2790, 45, 'k9284'), (2792, 46, 'k7196'), (2794, 47, 'k5108'), (2796, 48, 'k3020'), (2798, 49, 'k932'), (2800, 0, 'k8851');
+INSERT INTO t VALUES (2802, 1, 'k6763'), (2804, 2, 'k4675'), (2806, 3, 'k2587'), (2808, 4, 'k499'), (2810, 5, 'k8418'), (2812, 6, 'k6330'), (2814, 7, 'k4242'), (2816, 8, 'k2154'), (2818, 9, 'k66'), (2820, 10, 'k7985'), (2822, 11, 'k5897'), (2824, 12, 'k3809'), (2826, 13, 'k1721'), (2828, 14, 'k9640'), (2830, 15, 'k7552'), (2832, 16, 'k5464'), (2834, 17, 'k3376'), (2836, 18, 'k1288'), (2838, 19, 'k9207'), (2840, 20, 'k7119'), (2842, 21, 'k5031'), (2844, 22, 'k2943'), (2846, 23, 'k855'), (2848, 24, 'k8774'), (2850, 25, 'k6686');
+INSERT INTO t VALUES (2852, 26, 'k4598'), (2854, 27, 'k2510'), (2856, 28, 'k422'), (2858, 29, 'k8341'), (2860, 30, 'k6253'), (2862, 31, 'k4165'), (2864, 32, 'k2077'), (2866, 33, 'k9996'), (2868, 34, 'k7908'), (2870, 35, 'k5820'), (2872, 36, 'k3732'), (2874, 37, 'k1644'), (2876, 38, 'k9563'), (2878, 39, 'k7475'), (2880, 40, 'k5387'), (2882, 41, 'k3299'), (2884, 42, 'k1211'), (2886, 43, 'k9130'), (2888, 44, 'k7042'), (2890, 45, 'k4954'), (2892, 46, 'k2866'), (2894, 47, 'k778'), (2896, 48, 'k8697'), (2898, 49, 'k6609'), (2900, 0, 'k4521');
+INSERT INTO t VALUES (2902, 1, 'k2433'), (2904, 2, 'k345'), (2906, 3, 'k8264'), (2908, 4, 'k6176'), (2910, 5, 'k4088'), (2912, 6, 'k2000'), (2914, 7, 'k9919'), (2916, 8, 'k7831'), (2918, 9, 'k5743'), (2920, 10, 'k3655'), (2922, 11, 'k1567'), (2924, 12, 'k9486'), (2926, 13, 'k7398'), (2928, 14, 'k5310'), (2930, 15, 'k3222'), (2932, 16, 'k1134'), (2934, 17, 'k9053'), (2936, 18, 'k6965'), (2938, 19, 'k4877'), (2940, 20, 'k2789'), (2942, 21, 'k701'), (2944, 22, 'k8620'), (2946, 23, 'k6532'), (2948, 24, 'k4444'), (2950, 25, 'k2356');
+INSERT INTO t VALUES (2952, 26, 'k268'), (2954, 27, 'k8187'), (2956, 28, 'k6099'), (2958, 29, 'k4011'), (2960, 30, 'k1923'), (2962, 31, 'k9842'), (2964, 32, 'k7754'), (2966, 33, 'k5666'), (2968, 34, 'k3578'), (2970, 35, 'k1490'), (2972, 36, 'k9409'), (2974, 37, 'k7321'), (2976, 38, 'k5233'), (2978, 39, 'k3145'), (2980, 40, 'k1057'), (2982, 41, 'k8976'), (2984, 42, 'k6888'), (2986, 43, 'k4800'), (2988, 44, 'k2712'), (2990, 45, 'k624'), (2992, 46, 'k8543'), (2994, 47, 'k6455'), (2996, 48, 'k4367'), (2998, 49, 'k2279'), (3000, 0, 'k191');
+INSERT INTO t VALUES (3002, 1, 'k8110'), (3004, 2, 'k6022'), (3006, 3, 'k3934'), (3008, 4, 'k1846'), (3010, 5, 'k9765'), (3012, 6, 'k7677'), (3014, 7, 'k5589'), (3016, 8, 'k3501'), (3018, 9, 'k1413'), (3020, 10, 'k9332'), (3022, 11, 'k7244'), (3024, 12, 'k5156'), (3026, 13, 'k3068'), (3028, 14, 'k980'), (3030, 15, 'k8899'), (3032, 16, 'k6811'), (3034, 17, 'k4723'), (3036, 18, 'k2635'), (3038, 19, 'k547'), (3040, 20, 'k8466'), (3042, 21, 'k6378'), (3044, 22, 'k4290'), (3046, 23, 'k2202'), (3048, 24, 'k114'), (3050, 25, 'k8033');
+INSERT INTO t VALUES (3052, 26, 'k5945'), (3054, 27, 'k3857'), (3056, 28, 'k1769'), (3058, 29, 'k9688'), (3060, 30, 'k7600'), (3062, 31, 'k5512'), (3064, 32, 'k3424'), (3066, 33, 'k1336'), (3068, 34, 'k9255'), (3070, 35, 'k7167'), (3072, 36, 'k5079'), (3074, 37, 'k2991'), (3076, 38, 'k903'), (3078, 39, 'k8822'), (3080, 40, 'k6734'), (3082, 41, 'k4646'), (3084, 42, 'k2558'), (3086, 43, 'k470'), (3088, 44, 'k8389'), (3090, 45, 'k6301'), (3092, 46, 'k4213'), (3094, 47, 'k2125'), (3096, 48, 'k37'), (3098, 49, 'k7956'), (3100, 0, 'k5868');
+INSERT INTO t VALUES (3102, 1, 'k3780'), (3104, 2, 'k1692'), (3106, 3, 'k9611'), (3108, 4, 'k7523'), (3110, 5, 'k5435'), (3112, 6, 'k3347'), (3114, 7, 'k1259'), (3116, 8, 'k9178'), (3118, 9, 'k7090'), (3120, 10, 'k5002'), (3122, 11, 'k2914'), (3124, 12, 'k826'), (3126, 13, 'k8745'), (3128, 14, 'k6657'), (3130, 15, 'k4569'), (3132, 16, 'k2481'), (3134, 17, 'k393'), (3136, 18, 'k8312'), (3138, 19, 'k6224'), (3140, 20, 'k4136'), (3142, 21, 'k2048'), (3144, 22, 'k9967'), (3146, 23, 'k7879'), (3148, 24, 'k5791'), (3150, 25, 'k3703');
+INSERT INTO t VALUES (3152, 26, 'k1615'), (3154, 27, 'k9534'), (3156, 28, 'k7446'), (3158, 29, 'k5358'), (3160, 30, 'k3270'), (3162, 31, 'k1182'), (3164, 32, 'k9101'), (3166, 33, 'k7013'), (3168, 34, 'k4925'), (3170, 35, 'k2837'), (3172, 36, 'k749'), (3174, 37, 'k8668'), (3176, 38, 'k6580'), (3178, 39, 'k4492'), (3180, 40, 'k2404'), (3182, 41, 'k316'), (3184, 42, 'k8235'), (3186, 43, 'k6147'), (3188, 44, 'k4059'), (3190, 45, 'k1971'), (3192, 46, 'k9890'), (3194, 47, 'k7802'), (3196, 48, 'k5714'), (3198, 49, 'k3626'), (3200, 0, 'k1538');
+INSERT INTO t VALUES (3202, 1, 'k9457'), (3204, 2, 'k7369'), (3206, 3, 'k5281'), (3208, 4, 'k3193'), (3210, 5, 'k1105'), (3212, 6, 'k9024'), (3214, 7, 'k6936'), (3216, 8, 'k4848'), (3218, 9, 'k2760'), (3220, 10, 'k672'), (3222, 11, 'k8591'), (3224, 12, 'k6503'), (3226, 13, 'k4415'), (3228, 14, 'k2327'), (3230, 15, 'k239'), (3232, 16, 'k8158'), (3234, 17, 'k6070'), (3236, 18, 'k3982'), (3238, 19, 'k1894'), (3240, 20, 'k9813'), (3242, 21, 'k7725'), (3244, 22, 'k5637'), (3246, 23, 'k3549'), (3248, 24, 'k1461'), (3250, 25, 'k9380');
+INSERT INTO t VALUES (3252, 26, 'k7292'), (3254, 27, 'k5204'), (3256, 28, 'k3116'), (3258, 29, 'k1028'), (3260, 30, 'k8947'), (3262, 31, 'k6859'), (3264, 32, 'k4771'), (3266, 33, 'k2683'), (3268, 34, 'k595'), (3270, 35, 'k8514'), (3272, 36, 'k6426'), (3274, 37, 'k4338'), (3276, 38, 'k2250'), (3278, 39, 'k162'), (3280, 40, 'k8081'), (3282, 41, 'k5993'), (3284, 42, 'k3905'), (3286, 43, 'k1817'), (3288, 44, 'k9736'), (3290, 45, 'k7648'), (3292, 46, 'k5560'), (3294, 47, 'k3472'), (3296, 48, 'k1384'), (3298, 49, 'k9303'), (3300, 0, 'k7215');
+INSERT INTO t VALUES (3302, 1, 'k5127'), (3304, 2, 'k3039'), (3306, 3, 'k951'), (3308, 4, 'k8870'), (3310, 5, 'k6782'), (3312, 6, 'k4694'), (3314, 7, 'k2606'), (3316, 8, 'k518'), (3318, 9, 'k8437'), (3320, 10, 'k6349'), (3322, 11, 'k4261'), (3324, 12, 'k2173'), (3326, 13, 'k85'), (3328, 14, 'k8004'), (3330, 15, 'k5916'), (3332, 16, 'k3828'), (3334, 17, 'k1740'), (3336, 18, 'k9659'), (3338, 19, 'k7571'), (3340, 20, 'k5483'), (3342, 21, 'k3395'), (3344, 22, 'k1307'), (3346, 23, 'k9226'), (3348, 24, 'k7138'), (3350, 25, 'k5050');
+INSERT INTO t VALUES (3352, 26, 'k2962'), (3354, 27, 'k874'), (3356, 28, 'k8793'), (3358, 29, 'k6705'), (3360, 30, 'k4617'), (3362, 31, 'k2529'), (3364, 32, 'k441'), (3366, 33, 'k8360'), (3368, 34, 'k6272'), (3370, 35, 'k4184'), (3372, 36, 'k2096'), (3374, 37, 'k8'), (3376, 38, 'k7927'), (3378, 39, 'k5839'), (3380, 40, 'k3751'), (3382, 41, 'k1663'), (3384, 42, 'k9582'), (3386, 43, 'k7494'), (3388, 44, 'k5406'), (3390, 45, 'k3318'), (3392, 46, 'k1230'), (3394, 47, 'k9149'), (3396, 48, 'k7061'), (3398, 49, 'k4973'), (3400, 0, 'k2885');
+INSERT INTO t VALUES (3402, 1, 'k797'), (3404, 2, 'k8716'), (3406, 3, 'k6628'), (3408, 4, 'k4540'), (3410, 5, 'k2452'), (3412, 6, 'k364'), (3414, 7, 'k8283'), (3416, 8, 'k6195'), (3418, 9, 'k4107'), (3420, 10, 'k2019'), (3422, 11, 'k9938'), (3424, 12, 'k7850'), (3426, 13, 'k5762'), (3428, 14, 'k3674'), (3430, 15, 'k1586'), (3432, 16, 'k9505'), (3434, 17, 'k7417'), (3436, 18, 'k5329'), (3438, 19, 'k3241'), (3440, 20, 'k1153'), (3442, 21, 'k9072'), (3444, 22, 'k6984'), (3446, 23, 'k4896'), (3448, 24, 'k2808'), (3450, 25, 'k720');
+INSERT INTO t VALUES (3452, 26, 'k8639'), (3454, 27, 'k6551'), (3456, 28, 'k4463'), (3458, 29, 'k2375'), (3460, 30, 'k287'), (3462, 31, 'k8206'), (3464, 32, 'k6118'), (3466, 33, 'k4030'), (3468, 34, 'k1942'), (3470, 35, 'k9861'), (3472, 36, 'k7773'), (3474, 37, 'k5685'), (3476, 38, 'k3597'), (3478, 39, 'k1509'), (3480, 40, 'k9428'), (3482, 41, 'k7340'), (3484, 42, 'k5252'), (3486, 43, 'k3164'), (3488, 44, 'k1076'), (3490, 45, 'k8995'), (3492, 46, 'k6907'), (3494, 47, 'k4819'), (3496, 48, 'k2731'), (3498, 49, 'k643'), (3500, 0, 'k8562');
+INSERT INTO t VALUES (3502, 1, 'k6474'), (3504, 2, 'k4386'), (3506, 3, 'k2298'), (3508, 4, 'k210'), (3510, 5, 'k8129'), (3512, 6, 'k6041'), (3514, 7, 'k3953'), (3516, 8, 'k1865'), (3518, 9, 'k9784'), (3520, 10, 'k7696'), (3522, 11, 'k5608'), (3524, 12, 'k3520'), (3526, 13, 'k1432'), (3528, 14, 'k9351'), (3530, 15, 'k7263'), (3532, 16, 'k5175'), (3534, 17, 'k3087'), (3536, 18, 'k999'), (3538, 19, 'k8918'), (3540, 20, 'k6830'), (3542, 21, 'k4742'), (3544, 22, 'k2654'), (3546, 23, 'k566'), (3548, 24, 'k8485'), (3550, 25, 'k6397');
+INSERT INTO t VALUES (3552, 26, 'k4309'), (3554, 27, 'k2221'), (3556, 28, 'k133'), (3558, 29, 'k8052'), (3560, 30, 'k5964'), (3562, 31, 'k3876'), (3564, 32, 'k1788'), (3566, 33, 'k9707'), (3568, 34, 'k7619'), (3570, 35, 'k5531'), (3572, 36, 'k3443'), (3574, 37, 'k1355'), (3576, 38, 'k9274'), (3578, 39, 'k7186'), (3580, 40, 'k5098'), (3582, 41, 'k3010'), (3584, 42, 'k922'), (3586, 43, 'k8841'), (3588, 44, 'k6753'), (3590, 45, 'k4665'), (3592, 46, 'k2577'), (3594, 47, 'k489'), (3596, 48, 'k8408'), (3598, 49, 'k6320'), (3600, 0, 'k4232');
+INSERT INTO t VALUES (3602, 1, 'k2144'), (3604, 2, 'k56'), (3606, 3, 'k7975'), (3608, 4, 'k5887'), (3610, 5, 'k3799'), (3612, 6, 'k1711'), (3614, 7, 'k9630'), (3616, 8, 'k7542'), (3618, 9, 'k5454'), (3620, 10, 'k3366'), (3622, 11, 'k1278'), (3624, 12, 'k9197'), (3626, 13, 'k7109'), (3628, 14, 'k5021'), (3630, 15, 'k2933'), (3632, 16, 'k845'), (3634, 17, 'k8764'), (3636, 18, 'k6676'), (3638, 19, 'k4588'), (3640, 20, 'k2500'), (3642, 21, 'k412'), (3644, 22, 'k8331'), (3646, 23, 'k6243'), (3648, 24, 'k4155'), (3650, 25, 'k2067');
+INSERT INTO t VALUES (3652, 26, 'k9986'), (3654, 27, 'k7898'), (3656, 28, 'k5810'), (3658, 29, 'k3722'), (3660, 30, 'k1634'), (3662, 31, 'k9553'), (3664, 32, 'k7465'), (3666, 33, 'k5377'), (3668, 34, 'k3289'), (3670, 35, 'k1201'), (3672, 36, 'k9120'), (3674, 37, 'k7032'), (3676, 38, 'k4944'), (3678, 39, 'k2856'), (3680, 40, 'k768'), (3682, 41, 'k8687'), (3684, 42, 'k6599'), (3686, 43, 'k4511'), (3688, 44, 'k2423'), (3690, 45, 'k335'), (3692, 46, 'k8254'), (3694, 47, 'k6166'), (3696, 48, 'k4078'), (3698, 49, 'k1990'), (3700, 0, 'k9909');
+INSERT INTO t VALUES (3702, 1, 'k7821'), (3704, 2, 'k5733'), (3706, 3, 'k3645'), (3708, 4, 'k1557'), (3710, 5, 'k9476'), (3712, 6, 'k7388'), (3714, 7, 'k5300'), (3716, 8, 'k3212'), (3718, 9, 'k1124'), (3720, 10, 'k9043'), (3722, 11, 'k6955'), (3724, 12, 'k4867'), (3726, 13, 'k2779'), (3728, 14, 'k691'), (3730, 15, 'k8610'), (3732, 16, 'k6522'), (3734, 17, 'k4434'), (3736, 18, 'k2346'), (3738, 19, 'k258'), (3740, 20, 'k8177'), (3742, 21, 'k6089'), (3744, 22, 'k4001'), (3746, 23, 'k1913'), (3748, 24, 'k9832'), (3750, 25, 'k7744');
+INSERT INTO t VALUES (3752, 26, 'k5656'), (3754, 27, 'k3568'), (3756, 28, 'k1480'), (3758, 29, 'k9399'), (3760, 30, 'k7311'), (3762, 31, 'k5223'), (3764, 32, 'k3135'), (3766, 33, 'k1047'), (3768, 34, 'k8966'), (3770, 35, 'k6878'), (3772, 36, 'k4790'), (3774, 37, 'k2702'), (3776, 38, 'k614'), (3778, 39, 'k8533'), (3780, 40, 'k6445'), (3782, 41, 'k4357'), (3784, 42, 'k2269'), (3786, 43, 'k181'), (3788, 44, 'k8100'), (3790, 45, 'k6012'), (3792, 46, 'k3924'), (3794, 47, 'k1836'), (3796, 48, 'k9755'), (3798, 49, 'k7667'), (3800, 0, 'k5579');
+INSERT INTO t VALUES (3802, 1, 'k3491'), (3804, 2, 'k1403'), (3806, 3, 'k9322'), (3808, 4, 'k7234'), (3810, 5, 'k5146'), (3812, 6, 'k3058'), (3814, 7, 'k970'), (3816, 8, 'k8889'), (3818, 9, 'k6801'), (3820, 10, 'k4713'), (3822, 11, 'k2625'), (3824, 12, 'k537'), (3826, 13, 'k8456'), (3828, 14, 'k6368'), (3830, 15, 'k4280'), (3832, 16, 'k2192'), (3834, 17, 'k104'), (3836, 18, 'k8023'), (3838, 19, 'k5935'), (3840, 20, 'k3847'), (3842, 21, 'k1759'), (3844, 22, 'k9678'), (3846, 23, 'k7590'), (3848, 24, 'k5502'), (3850, 25, 'k3414');
+INSERT INTO t VALUES (3852, 26, 'k1326'), (3854, 27, 'k9245'), (3856, 28, 'k7157'), (3858, 29, 'k5069'), (3860, 30, 'k2981'), (3862, 31, 'k893'), (3864, 32, 'k8812'), (3866, 33, 'k6724'), (3868, 34, 'k4636'), (3870, 35, 'k2548'), (3872, 36, 'k460'), (3874, 37, 'k8379'), (3876, 38, 'k6291'), (3878, 39, 'k4203'), (3880, 40, 'k2115'), (3882, 41, 'k27'), (3884, 42, 'k7946'), (3886, 43, 'k5858'), (3888, 44, 'k3770'), (3890, 45, 'k1682'), (3892, 46, 'k9601'), (3894, 47, 'k7513'), (3896, 48, 'k5425'), (3898, 49, 'k3337'), (3900, 0, 'k1249');
+INSERT INTO t VALUES (3902, 1, 'k9168'), (3904, 2, 'k7080'), (3906, 3, 'k4992'), (3908, 4, 'k2904'), (3910, 5, 'k816'), (3912, 6, 'k8735'), (3914, 7, 'k6647'), (3916, 8, 'k4559'), (3918, 9, 'k2471'), (3920, 10, 'k383'), (3922, 11, 'k8302'), (3924, 12, 'k6214'), (3926, 13, 'k4126'), (3928, 14, 'k2038'), (3930, 15, 'k9957'), (3932, 16, 'k7869'), (3934, 17, 'k5781'), (3936, 18, 'k3693'), (3938, 19, 'k1605'), (3940, 20, 'k9524'), (3942, 21, 'k7436'), (3944, 22, 'k5348'), (3946, 23, 'k3260'), (3948, 24, 'k1172'), (3950, 25, 'k9091');
+INSERT INTO t VALUES (3952, 26, 'k7003'), (3954, 27, 'k4915'), (3956, 28, 'k2827'), (3958, 29, 'k739'), (3960, 30, 'k8658'), (3962, 31, 'k6570'), (3964, 32, 'k4482'), (3966, 33, 'k2394'), (3968, 34, 'k306'), (3970, 35, 'k8225'), (3972, 36, 'k6137'), (3974, 37, 'k4049'), (3976, 38, 'k1961'), (3978, 39, 'k9880'), (3980, 40, 'k7792'), (3982, 41, 'k5704'), (3984, 42, 'k3616'), (3986, 43, 'k1528'), (3988, 44, 'k9447'), (3990, 45, 'k7359'), (3992, 46, 'k5271'), (3994, 47, 'k3183'), (3996, 48, 'k1095'), (3998, 49, 'k9014'), (4000, 0, 'k6926');
+INSERT INTO t VALUES (4002, 1, 'k4838'), (4004, 2, 'k2750'), (4006, 3, 'k662'), (4008, 4, 'k8581'), (4010, 5, 'k6493'), (4012, 6, 'k4405'), (4014, 7, 'k2317'), (4016, 8, 'k229'), (4018, 9, 'k8148'), (4020, 10, 'k6060'), (4022, 11, 'k3972'), (4024, 12, 'k1884'), (4026, 13, 'k9803'), (4028, 14, 'k7715'), (4030, 15, 'k5627'), (4032, 16, 'k3539'), (4034, 17, 'k1451'), (4036, 18, 'k9370'), (4038, 19, 'k7282'), (4040, 20, 'k5194'), (4042, 21, 'k3106'), (4044, 22, 'k1018'), (4046, 23, 'k8937'), (4048, 24, 'k6849'), (4050, 25, 'k4761');
+INSERT INTO t VALUES (4052, 26, 'k2673'), (4054, 27, 'k585'), (4056, 28, 'k8504'), (4058, 29, 'k6416'), (4060, 30, 'k4328'), (4062, 31, 'k2240'), (4064, 32, 'k152'), (4066, 33, 'k8071'), (4068, 34, 'k5983'), (4070, 35, 'k3895'), (4072, 36, 'k1807'), (4074, 37, 'k9726'), (4076, 38, 'k7638'), (4078, 39, 'k5550'), (4080, 40, 'k3462'), (4082, 41, 'k1374'), (4084, 42, 'k9293'), (4086, 43, 'k7205'), (4088, 44, 'k5117'), (4090, 45, 'k3029'), (4092, 46, 'k941'), (4094, 47, 'k8860'), (4096, 48, 'k6772'), (4098, 49, 'k4684'), (4100, 0, 'k2596');
+INSERT INTO t VALUES (4102, 1, 'k508'), (4104, 2, 'k8427'), (4106, 3, 'k6339'), (4108, 4, 'k4251'), (4110, 5, 'k2163'), (4112, 6, 'k75'), (4114, 7, 'k7994'), (4116, 8, 'k5906'), (4118, 9, 'k3818'), (4120, 10, 'k1730'), (4122, 11, 'k9649'), (4124, 12, 'k7561'), (4126, 13, 'k5473'), (4128, 14, 'k3385'), (4130, 15, 'k1297'), (4132, 16, 'k9216'), (4134, 17, 'k7128'), (4136, 18, 'k5040'), (4138, 19, 'k2952'), (4140, 20, 'k864'), (4142, 21, 'k8783'), (4144, 22, 'k6695'), (4146, 23, 'k4607'), (4148, 24, 'k2519'), (4150, 25, 'k431');
+INSERT INTO t VALUES (4152, 26, 'k8350'), (4154, 27, 'k6262'), (4156, 28, 'k4174'), (4158, 29, 'k2086'), (4160, 30, 'k10005'), (4162, 31, 'k7917'), (4164, 32, 'k5829'), (4166, 33, 'k3741'), (4168, 34, 'k1653'), (4170, 35, 'k9572'), (4172, 36, 'k7484'), (4174, 37, 'k5396'), (4176, 38, 'k3308'), (4178, 39, 'k1220'), (4180, 40, 'k9139'), (4182, 41, 'k7051'), (4184, 42, 'k4963'), (4186, 43, 'k2875'), (4188, 44, 'k787'), (4190, 45, 'k8706'), (4192, 46, 'k6618'), (4194, 47, 'k4530'), (4196, 48, 'k2442'), (4198, 49, 'k354'), (4200, 0, 'k8273');
+INSERT INTO t VALUES (4202, 1, 'k6185'), (4204, 2, 'k4097'), (4206, 3, 'k2009'), (4208, 4, 'k9928'), (4210, 5, 'k7840'), (4212, 6, 'k5752'), (4214, 7, 'k3664'), (4216, 8, 'k1576'), (4218, 9, 'k9495'), (4220, 10, 'k7407'), (4222, 11, 'k5319'), (4224, 12, 'k3231'), (4226, 13, 'k1143'), (4228, 14, 'k9062'), (4230, 15, 'k6974'), (4232, 16, 'k4886'), (4234, 17, 'k2798'), (4236, 18, 'k710'), (4238, 19, 'k8629'), (4240, 20, 'k6541'), (4242, 21, 'k4453'), (4244, 22, 'k2365'), (4246, 23, 'k277'), (4248, 24, 'k8196'), (4250, 25, 'k6108');
+INSERT INTO t VALUES (4252, 26, 'k4020'), (4254, 27, 'k1932'), (4256, 28, 'k9851'), (4258, 29, 'k7763'), (4260, 30, 'k5675'), (4262, 31, 'k3587'), (4264, 32, 'k1499'), (4266, 33, 'k9418'), (4268, 34, 'k7330'), (4270, 35, 'k5242'), (4272, 36, 'k3154'), (4274, 37, 'k1066'), (4276, 38, 'k8985'), (4278, 39, 'k6897'), (4280, 40, 'k4809'), (4282, 41, 'k2721'), (4284, 42, 'k633'), (4286, 43, 'k8552'), (4288, 44, 'k6464'), (4290, 45, 'k4376'), (4292, 46, 'k2288'), (4294, 47, 'k200'), (4296, 48, 'k8119'), (4298, 49, 'k6031'), (4300, 0, 'k3943');
+INSERT INTO t VALUES (4302, 1, 'k1855'), (4304, 2, 'k9774'), (4306, 3, 'k7686'), (4308, 4, 'k5598'), (4310, 5, 'k3510'), (4312, 6, 'k1422'), (4314, 7, 'k9341'), (4316, 8, 'k7253'), (4318, 9, 'k5165'), (4320, 10, 'k3077'), (4322, 11, 'k989'), (4324, 12, 'k8908'), (4326, 13, 'k6820'), (4328, 14, 'k4732'), (4330, 15, 'k2644'), (4332, 16, 'k556'), (4334, 17, 'k8475'), (4336, 18, 'k6387'), (4338, 19, 'k4299'), (4340, 20, 'k2211'), (4342, 21, 'k123'), (4344, 22, 'k8042'), (4346, 23, 'k5954'), (4348, 24, 'k3866'), (4350, 25, 'k1778');
+INSERT INTO t VALUES (4352, 26, 'k9697'), (4354, 27, 'k7609'), (4356, 28, 'k5521'), (4358, 29, 'k3433'), (4360, 30, 'k1345'), (4362, 31, 'k9264'), (4364, 32, 'k7176'), (4366, 33, 'k5088'), (4368, 34, 'k3000'), (4370, 35, 'k912'), (4372, 36, 'k8831'), (4374, 37, 'k6743'), (4376, 38, 'k4655'), (4378, 39, 'k2567'), (4380, 40, 'k479'), (4382, 41, 'k8398'), (4384, 42, 'k6310'), (4386, 43, 'k4222'), (4388, 44, 'k2134'), (4390, 45, 'k46'), (4392, 46, 'k7965'), (4394, 47, 'k5877'), (4396, 48, 'k3789'), (4398, 49, 'k1701'), (4400, 0, 'k9620');
+INSERT INTO t VALUES (4402, 1, 'k7532'), (4404, 2, 'k5444'), (4406, 3, 'k3356'), (4408, 4, 'k1268'), (4410, 5, 'k9187'), (4412, 6, 'k7099'), (4414, 7, 'k5011'), (4416, 8, 'k2923'), (4418, 9, 'k835'), (4420, 10, 'k8754'), (4422, 11, 'k6666'), (4424, 12, 'k4578'), (4426, 13, 'k2490'), (4428, 14, 'k402'), (4430, 15, 'k8321'), (4432, 16, 'k6233'), (4434, 17, 'k4145'), (4436, 18, 'k2057'), (4438, 19, 'k9976'), (4440, 20, 'k7888'), (4442, 21, 'k5800'), (4444, 22, 'k3712'), (4446, 23, 'k1624'), (4448, 24, 'k9543'), (4450, 25, 'k7455');
+INSERT INTO t VALUES (4452, 26, 'k5367'), (4454, 27, 'k3279'), (4456, 28, 'k1191'), (4458, 29, 'k9110'), (4460, 30, 'k7022'), (4462, 31, 'k4934'), (4464, 32, 'k2846'), (4466, 33, 'k758'), (4468, 34, 'k8677'), (4470, 35, 'k6589'), (4472, 36, 'k4501'), (4474, 37, 'k2413'), (4476, 38, 'k325'), (4478, 39, 'k8244'), (4480, 40, 'k6156'), (4482, 41, 'k4068'), (4484, 42, 'k1980'), (4486, 43, 'k9899'), (4488, 44, 'k7811'), (4490, 45, 'k5723'), (4492, 46, 'k3635'), (4494, 47, 'k1547'), (4496, 48, 'k9466'), (4498, 49, 'k7378'), (4500, 0, 'k5290');
+INSERT INTO t VALUES (4502, 1, 'k3202'), (4504, 2, 'k1114'), (4506, 3, 'k9033'), (4508, 4, 'k6945'), (4510, 5, 'k4857'), (4512, 6, 'k2769'), (4514, 7, 'k681'), (4516, 8, 'k8600'), (4518, 9, 'k6512'), (4520, 10, 'k4424'), (4522, 11, 'k2336'), (4524, 12, 'k248'), (4526, 13, 'k8167'), (4528, 14, 'k6079'), (4530, 15, 'k3991'), (4532, 16, 'k1903'), (4534, 17, 'k9822'), (4536, 18, 'k7734'), (4538, 19, 'k5646'), (4540, 20, 'k3558'), (4542, 21, 'k1470'), (4544, 22, 'k9389'), (4546, 23, 'k7301'), (4548, 24, 'k5213'), (4550, 25, 'k3125');
+INSERT INTO t VALUES (4552, 26, 'k1037'), (4554, 27, 'k8956'), (4556, 28, 'k6868'), (4558, 29, 'k4780'), (4560, 30, 'k2692'), (4562, 31, 'k604'), (4564, 32, 'k8523'), (4566, 33, 'k6435'), (4568, 34, 'k4347'), (4570, 35, 'k2259'), (4572, 36, 'k171'), (4574, 37, 'k8090'), (4576, 38, 'k6002'), (4578, 39, 'k3914'), (4580, 40, 'k1826'), (4582, 41, 'k9745'), (4584, 42, 'k7657'), (4586, 43, 'k5569'), (4588, 44, 'k3481'), (4590, 45, 'k1393'), (4592, 46, 'k9312'), (4594, 47, 'k7224'), (4596, 48, 'k5136'), (4598, 49, 'k3048'), (4600, 0, 'k960');
+INSERT INTO t VALUES (4602, 1, 'k8879'), (4604, 2, 'k6791'), (4606, 3, 'k4703'), (4608, 4, 'k2615'), (4610, 5, 'k527'), (4612, 6, 'k8446'), (4614, 7, 'k6358'), (4616, 8, 'k4270'), (4618, 9, 'k2182'), (4620, 10, 'k94'), (4622, 11, 'k8013'), (4624, 12, 'k5925'), (4626, 13, 'k3837'), (4628, 14, 'k1749'), (4630, 15, 'k9668'), (4632, 16, 'k7580'), (4634, 17, 'k5492'), (4636, 18, 'k3404'), (4638, 19, 'k1316'), (4640, 20, 'k9235'), (4642, 21, 'k7147'), (4644, 22, 'k5059'), (4646, 23, 'k2971'), (4648, 24, 'k883'), (4650, 25, 'k8802');
+INSERT INTO t VALUES (4652, 26, 'k6714'), (4654, 27, 'k4626'), (4656, 28, 'k2538'), (4658, 29, 'k450'), (4660, 30, 'k8369'), (4662, 31, 'k6281'), (4664, 32, 'k4193'), (4666, 33, 'k2105'), (4668, 34, 'k17'), (4670, 35, 'k7936'), (4672, 36, 'k5848'), (4674, 37, 'k3760'), (4676, 38, 'k1672'), (4678, 39, 'k9591'), (4680, 40, 'k7503'), (4682, 41, 'k5415'), (4684, 42, 'k3327'), (4686, 43, 'k1239'), (4688, 44, 'k9158'), (4690, 45, 'k7070'), (4692, 46, 'k4982'), (4694, 47, 'k2894'), (4696, 48, 'k806'), (4698, 49, 'k8725'), (4700, 0, 'k6637');
+INSERT INTO t VALUES (4702, 1, 'k4549'), (4704, 2, 'k2461'), (4706, 3, 'k373'), (4708, 4, 'k8292'), (4710, 5, 'k6204'), (4712, 6, 'k4116'), (4714, 7, 'k2028'), (4716, 8, 'k9947'), (4718, 9, 'k7859'), (4720, 10, 'k5771'), (4722, 11, 'k3683'), (4724, 12, 'k1595'), (4726, 13, 'k9514'), (4728, 14, 'k7426'), (4730, 15, 'k5338'), (4732, 16, 'k3250'), (4734, 17, 'k1162'), (4736, 18, 'k9081'), (4738, 19, 'k6993'), (4740, 20, 'k4905'), (4742, 21, 'k2817'), (4744, 22, 'k729'), (4746, 23, 'k8648'), (4748, 24, 'k6560'), (4750, 25, 'k4472');
+INSERT INTO t VALUES (4752, 26, 'k2384'), (4754, 27, 'k296'), (4756, 28, 'k8215'), (4758, 29, 'k6127'), (4760, 30, 'k4039'), (4762, 31, 'k1951'), (4764, 32, 'k9870'), (4766, 33, 'k7782'), (4768, 34, 'k5694'), (4770, 35, 'k3606'), (4772, 36, 'k1518'), (4774, 37, 'k9437'), (4776, 38, 'k7349'), (4778, 39, 'k5261'), (4780, 40, 'k3173'), (4782, 41, 'k1085'), (4784, 42, 'k9004'), (4786, 43, 'k6916'), (4788, 44, 'k4828'), (4790, 45, 'k2740'), (4792, 46, 'k652'), (4794, 47, 'k8571'), (4796, 48, 'k6483'), (4798, 49, 'k4395'), (4800, 0, 'k2307');
+INSERT INTO t VALUES (4802, 1, 'k219'), (4804, 2, 'k8138'), (4806, 3, 'k6050'), (4808, 4, 'k3962'), (4810, 5, 'k1874'), (4812, 6, 'k9793'), (4814, 7, 'k7705'), (4816, 8, 'k5617'), (4818, 9, 'k3529'), (4820, 10, 'k1441'), (4822, 11, 'k9360'), (4824, 12, 'k7272'), (4826, 13, 'k5184'), (4828, 14, 'k3096'), (4830, 15, 'k1008'), (4832, 16, 'k8927'), (4834, 17, 'k6839'), (4836, 18, 'k4751'), (4838, 19, 'k2663'), (4840, 20, 'k575'), (4842, 21, 'k8494'), (4844, 22, 'k6406'), (4846, 23, 'k4318'), (4848, 24, 'k2230'), (4850, 25, 'k142');
+INSERT INTO t VALUES (4852, 26, 'k8061'), (4854, 27, 'k5973'), (4856, 28, 'k3885'), (4858, 29, 'k1797'), (4860, 30, 'k9716'), (4862, 31, 'k7628'), (4864, 32, 'k5540'), (4866, 33, 'k3452'), (4868, 34, 'k1364'), (4870, 35, 'k9283'), (4872, 36, 'k7195'), (4874, 37, 'k5107'), (4876, 38, 'k3019'), (4878, 39, 'k931'), (4880, 40, 'k8850'), (4882, 41, 'k6762'), (4884, 42, 'k4674'), (4886, 43, 'k2586'), (4888, 44, 'k498'), (4890, 45, 'k8417'), (4892, 46, 'k6329'), (4894, 47, 'k4241'), (4896, 48, 'k2153'), (4898, 49, 'k65'), (4900, 0, 'k7984');
+INSERT INTO t VALUES (4902, 1, 'k5896'), (4904, 2, 'k3808'), (4906, 3, 'k1720'), (4908, 4, 'k9639'), (4910, 5, 'k7551'), (4912, 6, 'k5463'), (4914, 7, 'k3375'), (4916, 8, 'k1287'), (4918, 9, 'k9206'), (4920, 10, 'k7118'), (4922, 11, 'k5030'), (4924, 12, 'k2942'), (4926, 13, 'k854'), (4928, 14, 'k8773'), (4930, 15, 'k6685'), (4932, 16, 'k4597'), (4934, 17, 'k2509'), (4936, 18, 'k421'), (4938, 19, 'k8340'), (4940, 20, 'k6252'), (4942, 21, 'k4164'), (4944, 22, 'k2076'), (4946, 23, 'k9995'), (4948, 24, 'k7907'), (4950, 25, 'k5819');
+INSERT INTO t VALUES (4952, 26, 'k3731'), (4954, 27, 'k1643'), (4956, 28, 'k9562'), (4958, 29, 'k7474'), (4960, 30, 'k5386'), (4962, 31, 'k3298'), (4964, 32, 'k1210'), (4966, 33, 'k9129'), (4968, 34, 'k7041'), (4970, 35, 'k4953'), (4972, 36, 'k2865'), (4974, 37, 'k777'), (4976, 38, 'k8696'), (4978, 39, 'k6608'), (4980, 40, 'k4520'), (4982, 41, 'k2432'), (4984, 42, 'k344'), (4986, 43, 'k8263'), (4988, 44, 'k6175'), (4990, 45, 'k4087'), (4992, 46, 'k1999'), (4994, 47, 'k9918'), (4996, 48, 'k7830'), (4998, 49, 'k5742'), (5000, 0, 'k3654');
+INSERT INTO t VALUES (5002, 1, 'k1566'), (5004, 2, 'k9485'), (5006, 3, 'k7397'), (5008, 4, 'k5309'), (5010, 5, 'k3221'), (5012, 6, 'k1133'), (5014, 7, 'k9052'), (5016, 8, 'k6964'), (5018, 9, 'k4876'), (5020, 10, 'k2788'), (5022, 11, 'k700'), (5024, 12, 'k8619'), (5026, 13, 'k6531'), (5028, 14, 'k4443'), (5030, 15, 'k2355'), (5032, 16, 'k267'), (5034, 17, 'k8186'), (5036, 18, 'k6098'), (5038, 19, 'k4010'), (5040, 20, 'k1922'), (5042, 21, 'k9841'), (5044, 22, 'k7753'), (5046, 23, 'k5665'), (5048, 24, 'k3577'), (5050, 25, 'k1489');
+INSERT INTO t VALUES (5052, 26, 'k9408'), (5054, 27, 'k7320'), (5056, 28, 'k5232'), (5058, 29, 'k3144'), (5060, 30, 'k1056'), (5062, 31, 'k8975'), (5064, 32, 'k6887'), (5066, 33, 'k4799'), (5068, 34, 'k2711'), (5070, 35, 'k623'), (5072, 36, 'k8542'), (5074, 37, 'k6454'), (5076, 38, 'k4366'), (5078, 39, 'k2278'), (5080, 40, 'k190'), (5082, 41, 'k8109'), (5084, 42, 'k6021'), (5086, 43, 'k3933'), (5088, 44, 'k1845'), (5090, 45, 'k9764'), (5092, 46, 'k7676'), (5094, 47, 'k5588'), (5096, 48, 'k3500'), (5098, 49, 'k1412'), (5100, 0, 'k9331');
+INSERT INTO t VALUES (5102, 1, 'k7243'), (5104, 2, 'k5155'), (5106, 3, 'k3067'), (5108, 4, 'k979'), (5110, 5, 'k8898'), (5112, 6, 'k6810'), (5114, 7, 'k4722'), (5116, 8, 'k2634'), (5118, 9, 'k546'), (5120, 10, 'k8465'), (5122, 11, 'k6377'), (5124, 12, 'k4289'), (5126, 13, 'k2201'), (5128, 14, 'k113'), (5130, 15, 'k8032'), (5132, 16, 'k5944'), (5134, 17, 'k3856'), (5136, 18, 'k1768'), (5138, 19, 'k9687'), (5140, 20, 'k7599'), (5142, 21, 'k5511'), (5144, 22, 'k3423'), (5146, 23, 'k1335'), (5148, 24, 'k9254'), (5150, 25, 'k7166');
+INSERT INTO t VALUES (5152, 26, 'k5078'), (5154, 27, 'k2990'), (5156, 28, 'k902'), (5158, 29, 'k8821'), (5160, 30, 'k6733'), (5162, 31, 'k4645'), (5164, 32, 'k2557'), (5166, 33, 'k469'), (5168, 34, 'k8388'), (5170, 35, 'k6300'), (5172, 36, 'k4212'), (5174, 37, 'k2124'), (5176, 38, 'k36'), (5178, 39, 'k7955'), (5180, 40, 'k5867'), (5182, 41, 'k3779'), (5184, 42, 'k1691'), (5186, 43, 'k9610'), (5188, 44, 'k7522'), (5190, 45, 'k5434'), (5192, 46, 'k3346'), (5194, 47, 'k1258'), (5196, 48, 'k9177'), (5198, 49, 'k7089'), (5200, 0, 'k5001');
+INSERT INTO t VALUES (5202, 1, 'k2913'), (5204, 2, 'k825'), (5206, 3, 'k8744'), (5208, 4, 'k6656'), (5210, 5, 'k4568'), (5212, 6, 'k2480'), (5214, 7, 'k392'), (5216, 8, 'k8311'), (5218, 9, 'k6223'), (5220, 10, 'k4135'), (5222, 11, 'k2047'), (5224, 12, 'k9966'), (5226, 13, 'k7878'), (5228, 14, 'k5790'), (5230, 15, 'k3702'), (5232, 16, 'k1614'), (5234, 17, 'k9533'), (5236, 18, 'k7445'), (5238, 19, 'k5357'), (5240, 20, 'k3269'), (5242, 21, 'k1181'), (5244, 22, 'k9100'), (5246, 23, 'k7012'), (5248, 24, 'k4924'), (5250, 25, 'k2836');
+INSERT INTO t VALUES (5252, 26, 'k748'), (5254, 27, 'k8667'), (5256, 28, 'k6579'), (5258, 29, 'k4491'), (5260, 30, 'k2403'), (5262, 31, 'k315'), (5264, 32, 'k8234'), (5266, 33, 'k6146'), (5268, 34, 'k4058'), (5270, 35, 'k1970'), (5272, 36, 'k9889'), (5274, 37, 'k7801'), (5276, 38, 'k5713'), (5278, 39, 'k3625'), (5280, 40, 'k1537'), (5282, 41, 'k9456'), (5284, 42, 'k7368'), (5286, 43, 'k5280'), (5288, 44, 'k3192'), (5290, 45, 'k1104'), (5292, 46, 'k9023'), (5294, 47, 'k6935'), (5296, 48, 'k4847'), (5298, 49, 'k2759'), (5300, 0, 'k671');
+INSERT INTO t VALUES (5302, 1, 'k8590'), (5304, 2, 'k6502'), (5306, 3, 'k4414'), (5308, 4, 'k2326'), (5310, 5, 'k238'), (5312, 6, 'k8157'), (5314, 7, 'k6069'), (5316, 8, 'k3981'), (5318, 9, 'k1893'), (5320, 10, 'k9812'), (5322, 11, 'k7724'), (5324, 12, 'k5636'), (5326, 13, 'k3548'), (5328, 14, 'k1460'), (5330, 15, 'k9379'), (5332, 16, 'k7291'), (5334, 17, 'k5203'), (5336, 18, 'k3115'), (5338, 19, 'k1027'), (5340, 20, 'k8946'), (5342, 21, 'k6858'), (5344, 22, 'k4770'), (5346, 23, 'k2682'), (5348, 24, 'k594'), (5350, 25, 'k8513');
+INSERT INTO t VALUES (5352, 26, 'k6425'), (5354, 27, 'k4337'), (5356, 28, 'k2249'), (5358, 29, 'k161'), (5360, 30, 'k8080'), (5362, 31, 'k5992'), (5364, 32, 'k3904'), (5366, 33, 'k1816'), (5368, 34, 'k9735'), (5370, 35, 'k7647'), (5372, 36, 'k5559'), (5374, 37, 'k3471'), (5376, 38, 'k1383'), (5378, 39, 'k9302'), (5380, 40, 'k7214'), (5382, 41, 'k5126'), (5384, 42, 'k3038'), (5386, 43, 'k950'), (5388, 44, 'k8869'), (5390, 45, 'k6781'), (5392, 46, 'k4693'), (5394, 47, 'k2605'), (5396, 48, 'k517'), (5398, 49, 'k8436'), (5400, 0, 'k6348');
+INSERT INTO t VALUES (5402, 1, 'k4260'), (5404, 2, 'k2172'), (5406, 3, 'k84'), (5408, 4, 'k8003'), (5410, 5, 'k5915'), (5412, 6, 'k3827'), (5414, 7, 'k1739'), (5416, 8, 'k9658'), (5418, 9, 'k7570'), (5420, 10, 'k5482'), (5422, 11, 'k3394'), (5424, 12, 'k1306'), (5426, 13, 'k9225'), (5428, 14, 'k7137'), (5430, 15, 'k5049'), (5432, 16, 'k2961'), (5434, 17, 'k873'), (5436, 18, 'k8792'), (5438, 19, 'k6704'), (5440, 20, 'k4616'), (5442, 21, 'k2528'), (5444, 22, 'k440'), (5446, 23, 'k8359'), (5448, 24, 'k6271'), (5450, 25, 'k4183');
+INSERT INTO t VALUES (5452, 26, 'k2095'), (5454, 27, 'k7'), (5456, 28, 'k7926'), (5458, 29, 'k5838'), (5460, 30, 'k3750'), (5462, 31, 'k1662'), (5464, 32, 'k9581'), (5466, 33, 'k7493'), (5468, 34, 'k5405'), (5470, 35, 'k3317'), (5472, 36, 'k1229'), (5474, 37, 'k9148'), (5476, 38, 'k7060'), (5478, 39, 'k4972'), (5480, 40, 'k2884'), (5482, 41, 'k796'), (5484, 42, 'k8715'), (5486, 43, 'k6627'), (5488, 44, 'k4539'), (5490, 45, 'k2451'), (5492, 46, 'k363'), (5494, 47, 'k8282'), (5496, 48, 'k6194'), (5498, 49, 'k4106'), (5500, 0, 'k2018');
+INSERT INTO t VALUES (5502, 1, 'k9937'), (5504, 2, 'k7849'), (5506, 3, 'k5761'), (5508, 4, 'k3673'), (5510, 5, 'k1585'), (5512, 6, 'k9504'), (5514, 7, 'k7416'), (5516, 8, 'k5328'), (5518, 9, 'k3240'), (5520, 10, 'k1152'), (5522, 11, 'k9071'), (5524, 12, 'k6983'), (5526, 13, 'k4895'), (5528, 14, 'k2807'), (5530, 15, 'k719'), (5532, 16, 'k8638'), (5534, 17, 'k6550'), (5536, 18, 'k4462'), (5538, 19, 'k2374'), (5540, 20, 'k286'), (5542, 21, 'k8205'), (5544, 22, 'k6117'), (5546, 23, 'k4029'), (5548, 24, 'k1941'), (5550, 25, 'k9860');
+INSERT INTO t VALUES (5552, 26, 'k7772'), (5554, 27, 'k5684'), (5556, 28, 'k3596'), (5558, 29, 'k1508'), (5560, 30, 'k9427'), (5562, 31, 'k7339'), (5564, 32, 'k5251'), (5566, 33, 'k3163'), (5568, 34, 'k1075'), (5570, 35, 'k8994'), (5572, 36, 'k6906'), (5574, 37, 'k4818'), (5576, 38, 'k2730'), (5578, 39, 'k642'), (5580, 40, 'k8561'), (5582, 41, 'k6473'), (5584, 42, 'k4385'), (5586, 43, 'k2297'), (5588, 44, 'k209'), (5590, 45, 'k8128'), (5592, 46, 'k6040'), (5594, 47, 'k3952'), (5596, 48, 'k1864'), (5598, 49, 'k9783'), (5600, 0, 'k7695');
+INSERT INTO t VALUES (5602, 1, 'k5607'), (5604, 2, 'k3519'), (5606, 3, 'k1431'), (5608, 4, 'k9350'), (5610, 5, 'k7262'), (5612, 6, 'k5174'), (5614, 7, 'k3086'), (5616, 8, 'k998'), (5618, 9, 'k8917'), (5620, 10, 'k6829'), (5622, 11, 'k4741'), (5624, 12, 'k2653'), (5626, 13, 'k565'), (5628, 14, 'k8484'), (5630, 15, 'k6396'), (5632, 16, 'k4308'), (5634, 17, 'k2220'), (5636, 18, 'k132'), (5638, 19, 'k8051'), (5640, 20, 'k5963'), (5642, 21, 'k3875'), (5644, 22, 'k1787'), (5646, 23, 'k9706'), (5648, 24, 'k7618'), (5650, 25, 'k5530');
+INSERT INTO t VALUES (5652, 26, 'k3442'), (5654, 27, 'k1354'), (5656, 28, 'k9273'), (5658, 29, 'k7185'), (5660, 30, 'k5097'), (5662, 31, 'k3009'), (5664, 32, 'k921'), (5666, 33, 'k8840'), (5668, 34, 'k6752'), (5670, 35, 'k4664'), (5672, 36, 'k2576'), (5674, 37, 'k488'), (5676, 38, 'k8407'), (5678, 39, 'k6319'), (5680, 40, 'k4231'), (5682, 41, 'k2143'), (5684, 42, 'k55'), (5686, 43, 'k7974'), (5688, 44, 'k5886'), (5690, 45, 'k3798'), (5692, 46, 'k1710'), (5694, 47, 'k9629'), (5696, 48, 'k7541'), (5698, 49, 'k5453'), (5700, 0, 'k3365');
+INSERT INTO t VALUES (5702, 1, 'k1277'), (5704, 2, 'k9196'), (5706, 3, 'k7108'), (5708, 4, 'k5020'), (5710, 5, 'k2932'), (5712, 6, 'k844'), (5714, 7, 'k8763'), (5716, 8, 'k6675'), (5718, 9, 'k4587'), (5720, 10, 'k2499'), (5722, 11, 'k411'), (5724, 12, 'k8330'), (5726, 13, 'k6242'), (5728, 14, 'k4154'), (5730, 15, 'k2066'), (5732, 16, 'k9985'), (5734, 17, 'k7897'), (5736, 18, 'k5809'), (5738, 19, 'k3721'), (5740, 20, 'k1633'), (5742, 21, 'k9552'), (5744, 22, 'k7464'), (5746, 23, 'k5376'), (5748, 24, 'k3288'), (5750, 25, 'k1200');
+INSERT INTO t VALUES (5752, 26, 'k9119'), (5754, 27, 'k7031'), (5756, 28, 'k4943'), (5758, 29, 'k2855'), (5760, 30, 'k767'), (5762, 31, 'k8686'), (5764, 32, 'k6598'), (5766, 33, 'k4510'), (5768, 34, 'k2422'), (5770, 35, 'k334'), (5772, 36, 'k8253'), (5774, 37, 'k6165'), (5776, 38, 'k4077'), (5778, 39, 'k1989'), (5780, 40, 'k9908'), (5782, 41, 'k7820'), (5784, 42, 'k5732'), (5786, 43, 'k3644'), (5788, 44, 'k1556'), (5790, 45, 'k9475'), (5792, 46, 'k7387'), (5794, 47, 'k5299'), (5796, 48, 'k3211'), (5798, 49, 'k1123'), (5800, 0, 'k9042');
+INSERT INTO t VALUES (5802, 1, 'k6954'), (5804, 2, 'k4866'), (5806, 3, 'k2778'), (5808, 4, 'k690'), (5810, 5, 'k8609'), (5812, 6, 'k6521'), (5814, 7, 'k4433'), (5816, 8, 'k2345'), (5818, 9, 'k257'), (5820, 10, 'k8176'), (5822, 11, 'k6088'), (5824, 12, 'k4000'), (5826, 13, 'k1912'), (5828, 14, 'k9831'), (5830, 15, 'k7743'), (5832, 16, 'k5655'), (5834, 17, 'k3567'), (5836, 18, 'k1479'), (5838, 19, 'k9398'), (5840, 20, 'k7310'), (5842, 21, 'k5222'), (5844, 22, 'k3134'), (5846, 23, 'k1046'), (5848, 24, 'k8965'), (5850, 25, 'k6877');
+INSERT INTO t VALUES (5852, 26, 'k4789'), (5854, 27, 'k2701'), (5856, 28, 'k613'), (5858, 29, 'k8532'), (5860, 30, 'k6444'), (5862, 31, 'k4356'), (5864, 32, 'k2268'), (5866, 33, 'k180'), (5868, 34, 'k8099'), (5870, 35, 'k6011'), (5872, 36, 'k3923'), (5874, 37, 'k1835'), (5876, 38, 'k9754'), (5878, 39, 'k7666'), (5880, 40, 'k5578'), (5882, 41, 'k3490'), (5884, 42, 'k1402'), (5886, 43, 'k9321'), (5888, 44, 'k7233'), (5890, 45, 'k5145'), (5892, 46, 'k3057'), (5894, 47, 'k969'), (5896, 48, 'k8888'), (5898, 49, 'k6800'), (5900, 0, 'k4712');
+INSERT INTO t VALUES (5902, 1, 'k2624'), (5904, 2, 'k536'), (5906, 3, 'k8455'), (5908, 4, 'k6367'), (5910, 5, 'k4279'), (5912, 6, 'k2191'), (5914, 7, 'k103'), (5916, 8, 'k8022'), (5918, 9, 'k5934'), (5920, 10, 'k3846'), (5922, 11, 'k1758'), (5924, 12, 'k9677'), (5926, 13, 'k7589'), (5928, 14, 'k5501'), (5930, 15, 'k3413'), (5932, 16, 'k1325'), (5934, 17, 'k9244'), (5936, 18, 'k7156'), (5938, 19, 'k5068'), (5940, 20, 'k2980'), (5942, 21, 'k892'), (5944, 22, 'k8811'), (5946, 23, 'k6723'), (5948, 24, 'k4635'), (5950, 25, 'k2547');
+INSERT INTO t VALUES (5952, 26, 'k459'), (5954, 27, 'k8378'), (5956, 28, 'k6290'), (5958, 29, 'k4202'), (5960, 30, 'k2114'), (5962, 31, 'k26'), (5964, 32, 'k7945'), (5966, 33, 'k5857'), (5968, 34, 'k3769'), (5970, 35, 'k1681'), (5972, 36, 'k9600'), (5974, 37, 'k7512'), (5976, 38, 'k5424'), (5978, 39, 'k3336'), (5980, 40, 'k1248'), (5982, 41, 'k9167'), (5984, 42, 'k7079'), (5986, 43, 'k4991'), (5988, 44, 'k2903'), (5990, 45, 'k815'), (5992, 46, 'k8734'), (5994, 47, 'k6646'), (5996, 48, 'k4558'), (5998, 49, 'k2470'), (6000, 0, 'k382');
+INSERT INTO t VALUES (6002, 1, 'k8301'), (6004, 2, 'k6213'), (6006, 3, 'k4125'), (6008, 4, 'k2037'), (6010, 5, 'k9956'), (6012, 6, 'k7868'), (6014, 7, 'k5780'), (6016, 8, 'k3692'), (6018, 9, 'k1604'), (6020, 10, 'k9523'), (6022, 11, 'k7435'), (6024, 12, 'k5347'), (6026, 13, 'k3259'), (6028, 14, 'k1171'), (6030, 15, 'k9090'), (6032, 16, 'k7002'), (6034, 17, 'k4914'), (6036, 18, 'k2826'), (6038, 19, 'k738'), (6040, 20, 'k8657'), (6042, 21, 'k6569'), (6044, 22, 'k4481'), (6046, 23, 'k2393'), (6048, 24, 'k305'), (6050, 25, 'k8224');
+INSERT INTO t VALUES (6052, 26, 'k6136'), (6054, 27, 'k4048'), (6056, 28, 'k1960'), (6058, 29, 'k9879'), (6060, 30, 'k7791'), (6062, 31, 'k5703'), (6064, 32, 'k3615'), (6066, 33, 'k1527'), (6068, 34, 'k9446'), (6070, 35, 'k7358'), (6072, 36, 'k5270'), (6074, 37, 'k3182'), (6076, 38, 'k1094'), (6078, 39, 'k9013'), (6080, 40, 'k6925'), (6082, 41, 'k4837'), (6084, 42, 'k2749'), (6086, 43, 'k661'), (6088, 44, 'k8580'), (6090, 45, 'k6492'), (6092, 46, 'k4404'), (6094, 47, 'k2316'), (6096, 48, 'k228'), (6098, 49, 'k8147'), (6100, 0, 'k6059');
+INSERT INTO t VALUES (6102, 1, 'k3971'), (6104, 2, 'k1883'), (6106, 3, 'k9802'), (6108, 4, 'k7714'), (6110, 5, 'k5626'), (6112, 6, 'k3538'), (6114, 7, 'k1450'), (6116, 8, 'k9369'), (6118, 9, 'k7281'), (6120, 10, 'k5193'), (6122, 11, 'k3105'), (6124, 12, 'k1017'), (6126, 13, 'k8936'), (6128, 14, 'k6848'), (6130, 15, 'k4760'), (6132, 16, 'k2672'), (6134, 17, 'k584'), (6136, 18, 'k8503'), (6138, 19, 'k6415'), (6140, 20, 'k4327'), (6142, 21, 'k2239'), (6144, 22, 'k151'), (6146, 23, 'k8070'), (6148, 24, 'k5982'), (6150, 25, 'k3894');
+INSERT INTO t VALUES (6152, 26, 'k1806'), (6154, 27, 'k9725'), (6156, 28, 'k7637'), (6158, 29, 'k5549'), (6160, 30, 'k3461'), (6162, 31, 'k1373'), (6164, 32, 'k9292'), (6166, 33, 'k7204'), (6168, 34, 'k5116'), (6170, 35, 'k3028'), (6172, 36, 'k940'), (6174, 37, 'k8859'), (6176, 38, 'k6771'), (6178, 39, 'k4683'), (6180, 40, 'k2595'), (6182, 41, 'k507'), (6184, 42, 'k8426'), (6186, 43, 'k6338'), (6188, 44, 'k4250'), (6190, 45, 'k2162'), (6192, 46, 'k74'), (6194, 47, 'k7993'), (6196, 48, 'k5905'), (6198, 49, 'k3817'), (6200, 0, 'k1729');
+INSERT INTO t VALUES (6202, 1, 'k9648'), (6204, 2, 'k7560'), (6206, 3, 'k5472'), (6208, 4, 'k3384'), (6210, 5, 'k1296'), (6212, 6, 'k9215'), (6214, 7, 'k7127'), (6216, 8, 'k5039'), (6218, 9, 'k2951'), (6220, 10, 'k863'), (6222, 11, 'k8782'), (6224, 12, 'k6694'), (6226, 13, 'k4606'), (6228, 14, 'k2518'), (6230, 15, 'k430'), (6232, 16, 'k8349'), (6234, 17, 'k6261'), (6236, 18, 'k4173'), (6238, 19, 'k2085'), (6240, 20, 'k10004'), (6242, 21, 'k7916'), (6244, 22, 'k5828'), (6246, 23, 'k3740'), (6248, 24, 'k1652'), (6250, 25, 'k9571');
+INSERT INTO t VALUES (6252, 26, 'k7483'), (6254, 27, 'k5395'), (6256, 28, 'k3307'), (6258, 29, 'k1219'), (6260, 30, 'k9138'), (6262, 31, 'k7050'), (6264, 32, 'k4962'), (6266, 33, 'k2874'), (6268, 34, 'k786'), (6270, 35, 'k8705'), (6272, 36, 'k6617'), (6274, 37, 'k4529'), (6276, 38, 'k2441'), (6278, 39, 'k353'), (6280, 40, 'k8272'), (6282, 41, 'k6184'), (6284, 42, 'k4096'), (6286, 43, 'k2008'), (6288, 44, 'k9927'), (6290, 45, 'k7839'), (6292, 46, 'k5751'), (6294, 47, 'k3663'), (6296, 48, 'k1575'), (6298, 49, 'k9494'), (6300, 0, 'k7406');
+INSERT INTO t VALUES (6302, 1, 'k5318'), (6304, 2, 'k3230'), (6306, 3, 'k1142'), (6308, 4, 'k9061'), (6310, 5, 'k6973'), (6312, 6, 'k4885'), (6314, 7, 'k2797'), (6316, 8, 'k709'), (6318, 9, 'k8628'), (6320, 10, 'k6540'), (6322, 11, 'k4452'), (6324, 12, 'k2364'), (6326, 13, 'k276'), (6328, 14, 'k8195'), (6330, 15, 'k6107'), (6332, 16, 'k4019'), (6334, 17, 'k1931'), (6336, 18, 'k9850'), (6338, 19, 'k7762'), (6340, 20, 'k5674'), (6342, 21, 'k3586'), (6344, 22, 'k1498'), (6346, 23, 'k9417'), (6348, 24, 'k7329'), (6350, 25, 'k5241');
+INSERT INTO t VALUES (6352, 26, 'k3153'), (6354, 27, 'k1065'), (6356, 28, 'k8984'), (6358, 29, 'k6896'), (6360, 30, 'k4808'), (6362, 31, 'k2720'), (6364, 32, 'k632'), (6366, 33, 'k8551'), (6368, 34, 'k6463'), (6370, 35, 'k4375'), (6372, 36, 'k2287'), (6374, 37, 'k199'), (6376, 38, 'k8118'), (6378, 39, 'k6030'), (6380, 40, 'k3942'), (6382, 41, 'k1854'), (6384, 42, 'k9773'), (6386, 43, 'k7685'), (6388, 44, 'k5597'), (6390, 45, 'k3509'), (6392, 46, 'k1421'), (6394, 47, 'k9340'), (6396, 48, 'k7252'), (6398, 49, 'k5164'), (6400, 0, 'k3076');
+INSERT INTO t VALUES (6402, 1, 'k988'), (6404, 2, 'k8907'), (6406, 3, 'k6819'), (6408, 4, 'k4731'), (6410, 5, 'k2643'), (6412, 6, 'k555'), (6414, 7, 'k8474'), (6416, 8, 'k6386'), (6418, 9, 'k4298'), (6420, 10, 'k2210'), (6422, 11, 'k122'), (6424, 12, 'k8041'), (6426, 13, 'k5953'), (6428, 14, 'k3865'), (6430, 15, 'k1777'), (6432, 16, 'k9696'), (6434, 17, 'k7608'), (6436, 18, 'k5520'), (6438, 19, 'k3432'), (6440, 20, 'k1344'), (6442, 21, 'k9263'), (6444, 22, 'k7175'), (6446, 23, 'k5087'), (6448, 24, 'k2999'), (6450, 25, 'k911');
+INSERT INTO t VALUES (6452, 26, 'k8830'), (6454, 27, 'k6742'), (6456, 28, 'k4654'), (6458, 29, 'k2566'), (6460, 30, 'k478'), (6462, 31, 'k8397'), (6464, 32, 'k6309'), (6466, 33, 'k4221'), (6468, 34, 'k2133'), (6470, 35, 'k45'), (6472, 36, 'k7964'), (6474, 37, 'k5876'), (6476, 38, 'k3788'), (6478, 39, 'k1700'), (6480, 40, 'k9619'), (6482, 41, 'k7531'), (6484, 42, 'k5443'), (6486, 43, 'k3355'), (6488, 44, 'k1267'), (6490, 45, 'k9186'), (6492, 46, 'k7098'), (6494, 47, 'k5010'), (6496, 48, 'k2922'), (6498, 49, 'k834'), (6500, 0, 'k8753');
+INSERT INTO t VALUES (6502, 1, 'k6665'), (6504, 2, 'k4577'), (6506, 3, 'k2489'), (6508, 4, 'k401'), (6510, 5, 'k8320'), (6512, 6, 'k6232'), (6514, 7, 'k4144'), (6516, 8, 'k2056'), (6518, 9, 'k9975'), (6520, 10, 'k7887'), (6522, 11, 'k5799'), (6524, 12, 'k3711'), (6526, 13, 'k1623'), (6528, 14, 'k9542'), (6530, 15, 'k7454'), (6532, 16, 'k5366'), (6534, 17, 'k3278'), (6536, 18, 'k1190'), (6538, 19, 'k9109'), (6540, 20, 'k7021'), (6542, 21, 'k4933'), (6544, 22, 'k2845'), (6546, 23, 'k757'), (6548, 24, 'k8676'), (6550, 25, 'k6588');
+INSERT INTO t VALUES (6552, 26, 'k4500'), (6554, 27, 'k2412'), (6556, 28, 'k324'), (6558, 29, 'k8243'), (6560, 30, 'k6155'), (6562, 31, 'k4067'), (6564, 32, 'k1979'), (6566, 33, 'k9898'), (6568, 34, 'k7810'), (6570, 35, 'k5722'), (6572, 36, 'k3634'), (6574, 37, 'k1546'), (6576, 38, 'k9465'), (6578, 39, 'k7377'), (6580, 40, 'k5289'), (6582, 41, 'k3201'), (6584, 42, 'k1113'), (6586, 43, 'k9032'), (6588, 44, 'k6944'), (6590, 45, 'k4856'), (6592, 46, 'k2768'), (6594, 47, 'k680'), (6596, 48, 'k8599'), (6598, 49, 'k6511'), (6600, 0, 'k4423');
+INSERT INTO t VALUES (6602, 1, 'k2335'), (6604, 2, 'k247'), (6606, 3, 'k8166'), (6608, 4, 'k6078'), (6610, 5, 'k3990'), (6612, 6, 'k1902'), (6614, 7, 'k9821'), (6616, 8, 'k7733'), (6618, 9, 'k5645'), (6620, 10, 'k3557'), (6622, 11, 'k1469'), (6624, 12, 'k9388'), (6626, 13, 'k7300'), (6628, 14, 'k5212'), (6630, 15, 'k3124'), (6632, 16, 'k1036'), (6634, 17, 'k8955'), (6636, 18, 'k6867'), (6638, 19, 'k4779'), (6640, 20, 'k2691'), (6642, 21, 'k603'), (6644, 22, 'k8522'), (6646, 23, 'k6434'), (6648, 24, 'k4346'), (6650, 25, 'k2258');
+INSERT INTO t VALUES (6652, 26, 'k170'), (6654, 27, 'k8089'), (6656, 28, 'k6001'), (6658, 29, 'k3913'), (6660, 30, 'k1825'), (6662, 31, 'k9744'), (6664, 32, 'k7656'), (6666, 33, 'k5568'), (6668, 34, 'k3480'), (6670, 35, 'k1392'), (6672, 36, 'k9311'), (6674, 37, 'k7223'), (6676, 38, 'k5135'), (6678, 39, 'k3047'), (6680, 40, 'k959'), (6682, 41, 'k8878'), (6684, 42, 'k6790'), (6686, 43, 'k4702'), (6688, 44, 'k2614'), (6690, 45, 'k526'), (6692, 46, 'k8445'), (6694, 47, 'k6357'), (6696, 48, 'k4269'), (6698, 49, 'k2181'), (6700, 0, 'k93');
+INSERT INTO t VALUES (6702, 1, 'k8012'), (6704, 2, 'k5924'), (6706, 3, 'k3836'), (6708, 4, 'k1748'), (6710, 5, 'k9667'), (6712, 6, 'k7579'), (6714, 7, 'k5491'), (6716, 8, 'k3403'), (6718, 9, 'k1315'), (6720, 10, 'k9234'), (6722, 11, 'k7146'), (6724, 12, 'k5058'), (6726, 13, 'k2970'), (6728, 14, 'k882'), (6730, 15, 'k8801'), (6732, 16, 'k6713'), (6734, 17, 'k4625'), (6736, 18, 'k2537'), (6738, 19, 'k449'), (6740, 20, 'k8368'), (6742, 21, 'k6280'), (6744, 22, 'k4192'), (6746, 23, 'k2104'), (6748, 24, 'k16'), (6750, 25, 'k7935');
+INSERT INTO t VALUES (6752, 26, 'k5847'), (6754, 27, 'k3759'), (6756, 28, 'k1671'), (6758, 29, 'k9590'), (6760, 30, 'k7502'), (6762, 31, 'k5414'), (6764, 32, 'k3326'), (6766, 33, 'k1238'), (6768, 34, 'k9157'), (6770, 35, 'k7069'), (6772, 36, 'k4981'), (6774, 37, 'k2893'), (6776, 38, 'k805'), (6778, 39, 'k8724'), (6780, 40, 'k6636'), (6782, 41, 'k4548'), (6784, 42, 'k2460'), (6786, 43, 'k372'), (6788, 44, 'k8291'), (6790, 45, 'k6203'), (6792, 46, 'k4115'), (6794, 47, 'k2027'), (6796, 48, 'k9946'), (6798, 49, 'k7858'), (6800, 0, 'k5770');
+INSERT INTO t VALUES (6802, 1, 'k3682'), (6804, 2, 'k1594'), (6806, 3, 'k9513'), (6808, 4, 'k7425'), (6810, 5, 'k5337'), (6812, 6, 'k3249'), (6814, 7, 'k1161'), (6816, 8, 'k9080'), (6818, 9, 'k6992'), (6820, 10, 'k4904'), (6822, 11, 'k2816'), (6824, 12, 'k728'), (6826, 13, 'k8647'), (6828, 14, 'k6559'), (6830, 15, 'k4471'), (6832, 16, 'k2383'), (6834, 17, 'k295'), (6836, 18, 'k8214'), (6838, 19, 'k6126'), (6840, 20, 'k4038'), (6842, 21, 'k1950'), (6844, 22, 'k9869'), (6846, 23, 'k7781'), (6848, 24, 'k5693'), (6850, 25, 'k3605');
+INSERT INTO t VALUES (6852, 26, 'k1517'), (6854, 27, 'k9436'), (6856, 28, 'k7348'), (6858, 29, 'k5260'), (6860, 30, 'k3172'), (6862, 31, 'k1084'), (6864, 32, 'k9003'), (6866, 33, 'k6915'), (6868, 34, 'k4827'), (6870, 35, 'k2739'), (6872, 36, 'k651'), (6874, 37, 'k8570'), (6876, 38, 'k6482'), (6878, 39, 'k4394'), (6880, 40, 'k2306'), (6882, 41, 'k218'), (6884, 42, 'k8137'), (6886, 43, 'k6049'), (6888, 44, 'k3961'), (6890, 45, 'k1873'), (6892, 46, 'k9792'), (6894, 47, 'k7704'), (6896, 48, 'k5616'), (6898, 49, 'k3528'), (6900, 0, 'k1440');
+INSERT INTO t VALUES (6902, 1, 'k9359'), (6904, 2, 'k7271'), (6906, 3, 'k5183'), (6908, 4, 'k3095'), (6910, 5, 'k1007'), (6912, 6, 'k8926'), (6914, 7, 'k6838'), (6916, 8, 'k4750'), (6918, 9, 'k2662'), (6920, 10, 'k574'), (6922, 11, 'k8493'), (6924, 12, 'k6405'), (6926, 13, 'k4317'), (6928, 14, 'k2229'), (6930, 15, 'k141'), (6932, 16, 'k8060'), (6934, 17, 'k5972'), (6936, 18, 'k3884'), (6938, 19, 'k1796'), (6940, 20, 'k9715'), (6942, 21, 'k7627'), (6944, 22, 'k5539'), (6946, 23, 'k3451'), (6948, 24, 'k1363'), (6950, 25, 'k9282');
+INSERT INTO t VALUES (6952, 26, 'k7194'), (6954, 27, 'k5106'), (6956, 28, 'k3018'), (6958, 29, 'k930'), (6960, 30, 'k8849'), (6962, 31, 'k6761'), (6964, 32, 'k4673'), (6966, 33, 'k2585'), (6968, 34, 'k497'), (6970, 35, 'k8416'), (6972, 36, 'k6328'), (6974, 37, 'k4240'), (6976, 38, 'k2152'), (6978, 39, 'k64'), (6980, 40, 'k7983'), (6982, 41, 'k5895'), (6984, 42, 'k3807'), (6986, 43, 'k1719'), (6988, 44, 'k9638'), (6990, 45, 'k7550'), (6992, 46, 'k5462'), (6994, 47, 'k3374'), (6996, 48, 'k1286'), (6998, 49, 'k9205'), (7000, 0, 'k7117');
+INSERT INTO t VALUES (7002, 1, 'k5029'), (7004, 2, 'k2941'), (7006, 3, 'k853'), (7008, 4, 'k8772'), (7010, 5, 'k6684'), (7012, 6, 'k4596'), (7014, 7, 'k2508'), (7016, 8, 'k420'), (7018, 9, 'k8339'), (7020, 10, 'k6251'), (7022, 11, 'k4163'), (7024, 12, 'k2075'), (7026, 13, 'k9994'), (7028, 14, 'k7906'), (7030, 15, 'k5818'), (7032, 16, 'k3730'), (7034, 17, 'k1642'), (7036, 18, 'k9561'), (7038, 19, 'k7473'), (7040, 20, 'k5385'), (7042, 21, 'k3297'), (7044, 22, 'k1209'), (7046, 23, 'k9128'), (7048, 24, 'k7040'), (7050, 25, 'k4952');
+INSERT INTO t VALUES (7052, 26, 'k2864'), (7054, 27, 'k776'), (7056, 28, 'k8695'), (7058, 29, 'k6607'), (7060, 30, 'k4519'), (7062, 31, 'k2431'), (7064, 32, 'k343'), (7066, 33, 'k8262'), (7068, 34, 'k6174'), (7070, 35, 'k4086'), (7072, 36, 'k1998'), (7074, 37, 'k9917'), (7076, 38, 'k7829'), (7078, 39, 'k5741'), (7080, 40, 'k3653'), (7082, 41, 'k1565'), (7084, 42, 'k9484'), (7086, 43, 'k7396'), (7088, 44, 'k5308'), (7090, 45, 'k3220'), (7092, 46, 'k1132'), (7094, 47, 'k9051'), (7096, 48, 'k6963'), (7098, 49, 'k4875'), (7100, 0, 'k2787');
+INSERT INTO t VALUES (7102, 1, 'k699'), (7104, 2, 'k8618'), (7106, 3, 'k6530'), (7108, 4, 'k4442'), (7110, 5, 'k2354'), (7112, 6, 'k266'), (7114, 7, 'k8185'), (7116, 8, 'k6097'), (7118, 9, 'k4009'), (7120, 10, 'k1921'), (7122, 11, 'k9840'), (7124, 12, 'k7752'), (7126, 13, 'k5664'), (7128, 14, 'k3576'), (7130, 15, 'k1488'), (7132, 16, 'k9407'), (7134, 17, 'k7319'), (7136, 18, 'k5231'), (7138, 19, 'k3143'), (7140, 20, 'k1055'), (7142, 21, 'k8974'), (7144, 22, 'k6886'), (7146, 23, 'k4798'), (7148, 24, 'k2710'), (7150, 25, 'k622');
+INSERT INTO t VALUES (7152, 26, 'k8541'), (7154, 27, 'k6453'), (7156, 28, 'k4365'), (7158, 29, 'k2277'), (7160, 30, 'k189'), (7162, 31, 'k8108'), (7164, 32, 'k6020'), (7166, 33, 'k3932'), (7168, 34, 'k1844'), (7170, 35, 'k9763'), (7172, 36, 'k7675'), (7174, 37, 'k5587'), (7176, 38, 'k3499'), (7178, 39, 'k1411'), (7180, 40, 'k9330'), (7182, 41, 'k7242'), (7184, 42, 'k5154'), (7186, 43, 'k3066'), (7188, 44, 'k978'), (7190, 45, 'k8897'), (7192, 46, 'k6809'), (7194, 47, 'k4721'), (7196, 48, 'k2633'), (7198, 49, 'k545'), (7200, 0, 'k8464');
+INSERT INTO t VALUES (7202, 1, 'k6376'), (7204, 2, 'k4288'), (7206, 3, 'k2200'), (7208, 4, 'k112'), (7210, 5, 'k8031'), (7212, 6, 'k5943'), (7214, 7, 'k3855'), (7216, 8, 'k1767'), (7218, 9, 'k9686'), (7220, 10, 'k7598'), (7222, 11, 'k5510'), (7224, 12, 'k3422'), (7226, 13, 'k1334'), (7228, 14, 'k9253'), (7230, 15, 'k7165'), (7232, 16, 'k5077'), (7234, 17, 'k2989'), (7236, 18, 'k901'), (7238, 19, 'k8820'), (7240, 20, 'k6732'), (7242, 21, 'k4644'), (7244, 22, 'k2556'), (7246, 23, 'k468'), (7248, 24, 'k8387'), (7250, 25, 'k6299');
+INSERT INTO t VALUES (7252, 26, 'k4211'), (7254, 27, 'k2123'), (7256, 28, 'k35'), (7258, 29, 'k7954'), (7260, 30, 'k5866'), (7262, 31, 'k3778'), (7264, 32, 'k1690'), (7266, 33, 'k9609'), (7268, 34, 'k7521'), (7270, 35, 'k5433'), (7272, 36, 'k3345'), (7274, 37, 'k1257'), (7276, 38, 'k9176'), (7278, 39, 'k7088'), (7280, 40, 'k5000'), (7282, 41, 'k2912'), (7284, 42, 'k824'), (7286, 43, 'k8743'), (7288, 44, 'k6655'), (7290, 45, 'k4567'), (7292, 46, 'k2479'), (7294, 47, 'k391'), (7296, 48, 'k8310'), (7298, 49, 'k6222'), (7300, 0, 'k4134');
+INSERT INTO t VALUES (7302, 1, 'k2046'), (7304, 2, 'k9965'), (7306, 3, 'k7877'), (7308, 4, 'k5789'), (7310, 5, 'k3701'), (7312, 6, 'k1613'), (7314, 7, 'k9532'), (7316, 8, 'k7444'), (7318, 9, 'k5356'), (7320, 10, 'k3268'), (7322, 11, 'k1180'), (7324, 12, 'k9099'), (7326, 13, 'k7011'), (7328, 14, 'k4923'), (7330, 15, 'k2835'), (7332, 16, 'k747'), (7334, 17, 'k8666'), (7336, 18, 'k6578'), (7338, 19, 'k4490'), (7340, 20, 'k2402'), (7342, 21, 'k314'), (7344, 22, 'k8233'), (7346, 23, 'k6145'), (7348, 24, 'k4057'), (7350, 25, 'k1969');
+INSERT INTO t VALUES (7352, 26, 'k9888'), (7354, 27, 'k7800'), (7356, 28, 'k5712'), (7358, 29, 'k3624'), (7360, 30, 'k1536'), (7362, 31, 'k9455'), (7364, 32, 'k7367'), (7366, 33, 'k5279'), (7368, 34, 'k3191'), (7370, 35, 'k1103'), (7372, 36, 'k9022'), (7374, 37, 'k6934'), (7376, 38, 'k4846'), (7378, 39, 'k2758'), (7380, 40, 'k670'), (7382, 41, 'k8589'), (7384, 42, 'k6501'), (7386, 43, 'k4413'), (7388, 44, 'k2325'), (7390, 45, 'k237'), (7392, 46, 'k8156'), (7394, 47, 'k6068'), (7396, 48, 'k3980'), (7398, 49, 'k1892'), (7400, 0, 'k9811');
+INSERT INTO t VALUES (7402, 1, 'k7723'), (7404, 2, 'k5635'), (7406, 3, 'k3547'), (7408, 4, 'k1459'), (7410, 5, 'k9378'), (7412, 6, 'k7290'), (7414, 7, 'k5202'), (7416, 8, 'k3114'), (7418, 9, 'k1026'), (7420, 10, 'k8945'), (7422, 11, 'k6857'), (7424, 12, 'k4769'), (7426, 13, 'k2681'), (7428, 14, 'k593'), (7430, 15, 'k8512'), (7432, 16, 'k6424'), (7434, 17, 'k4336'), (7436, 18, 'k2248'), (7438, 19, 'k160'), (7440, 20, 'k8079'), (7442, 21, 'k5991'), (7444, 22, 'k3903'), (7446, 23, 'k1815'), (7448, 24, 'k9734'), (7450, 25, 'k7646');
+INSERT INTO t VALUES (7452, 26, 'k5558'), (7454, 27, 'k3470'), (7456, 28, 'k1382'), (7458, 29, 'k9301'), (7460, 30, 'k7213'), (7462, 31, 'k5125'), (7464, 32, 'k3037'), (7466, 33, 'k949'), (7468, 34, 'k8868'), (7470, 35, 'k6780'), (7472, 36, 'k4692'), (7474, 37, 'k2604'), (7476, 38, 'k516'), (7478, 39, 'k8435'), (7480, 40, 'k6347'), (7482, 41, 'k4259'), (7484, 42, 'k2171'), (7486, 43, 'k83'), (7488, 44, 'k8002'), (7490, 45, 'k5914'), (7492, 46, 'k3826'), (7494, 47, 'k1738'), (7496, 48, 'k9657'), (7498, 49, 'k7569'), (7500, 0, 'k5481');
+INSERT INTO t VALUES (7502, 1, 'k3393'), (7504, 2, 'k1305'), (7506, 3, 'k9224'), (7508, 4, 'k7136'), (7510, 5, 'k5048'), (7512, 6, 'k2960'), (7514, 7, 'k872'), (7516, 8, 'k8791'), (7518, 9, 'k6703'), (7520, 10, 'k4615'), (7522, 11, 'k2527'), (7524, 12, 'k439'), (7526, 13, 'k8358'), (7528, 14, 'k6270'), (7530, 15, 'k4182'), (7532, 16, 'k2094'), (7534, 17, 'k6'), (7536, 18, 'k7925'), (7538, 19, 'k5837'), (7540, 20, 'k3749'), (7542, 21, 'k1661'), (7544, 22, 'k9580'), (7546, 23, 'k7492'), (7548, 24, 'k5404'), (7550, 25, 'k3316');
+INSERT INTO t VALUES (7552, 26, 'k1228'), (7554, 27, 'k9147'), (7556, 28, 'k7059'), (7558, 29, 'k4971'), (7560, 30, 'k2883'), (7562, 31, 'k795'), (7564, 32, 'k8714'), (7566, 33, 'k6626'), (7568, 34, 'k4538'), (7570, 35, 'k2450'), (7572, 36, 'k362'), (7574, 37, 'k8281'), (7576, 38, 'k6193'), (7578, 39, 'k4105'), (7580, 40, 'k2017'), (7582, 41, 'k9936'), (7584, 42, 'k7848'), (7586, 43, 'k5760'), (7588, 44, 'k3672'), (7590, 45, 'k1584'), (7592, 46, 'k9503'), (7594, 47, 'k7415'), (7596, 48, 'k5327'), (7598, 49, 'k3239'), (7600, 0, 'k1151');
+INSERT INTO t VALUES (7602, 1, 'k9070'), (7604, 2, 'k6982'), (7606, 3, 'k4894'), (7608, 4, 'k2806'), (7610, 5, 'k718'), (7612, 6, 'k8637'), (7614, 7, 'k6549'), (7616, 8, 'k4461'), (7618, 9, 'k2373'), (7620, 10, 'k285'), (7622, 11, 'k8204'), (7624, 12, 'k6116'), (7626, 13, 'k4028'), (7628, 14, 'k1940'), (7630, 15, 'k9859'), (7632, 16, 'k7771'), (7634, 17, 'k5683'), (7636, 18, 'k3595'), (7638, 19, 'k1507'), (7640, 20, 'k9426'), (7642, 21, 'k7338'), (7644, 22, 'k5250'), (7646, 23, 'k3162'), (7648, 24, 'k1074'), (7650, 25, 'k8993');
+INSERT INTO t VALUES (7652, 26, 'k6905'), (7654, 27, 'k4817'), (7656, 28, 'k2729'), (7658, 29, 'k641'), (7660, 30, 'k8560'), (7662, 31, 'k6472'), (7664, 32, 'k4384'), (7666, 33, 'k2296'), (7668, 34, 'k208'), (7670, 35, 'k8127'), (7672, 36, 'k6039'), (7674, 37, 'k3951'), (7676, 38, 'k1863'), (7678, 39, 'k9782'), (7680, 40, 'k7694'), (7682, 41, 'k5606'), (7684, 42, 'k3518'), (7686, 43, 'k1430'), (7688, 44, 'k9349'), (7690, 45, 'k7261'), (7692, 46, 'k5173'), (7694, 47, 'k3085'), (7696, 48, 'k997'), (7698, 49, 'k8916'), (7700, 0, 'k6828');
+INSERT INTO t VALUES (7702, 1, 'k4740'), (7704, 2, 'k2652'), (7706, 3, 'k564'), (7708, 4, 'k8483'), (7710, 5, 'k6395'), (7712, 6, 'k4307'), (7714, 7, 'k2219'), (7716, 8, 'k131'), (7718, 9, 'k8050'), (7720, 10, 'k5962'), (7722, 11, 'k3874'), (7724, 12, 'k1786'), (7726, 13, 'k9705'), (7728, 14, 'k7617'), (7730, 15, 'k5529'), (7732, 16, 'k3441'), (7734, 17, 'k1353'), (7736, 18, 'k9272'), (7738, 19, 'k7184'), (7740, 20, 'k5096'), (7742, 21, 'k3008'), (7744, 22, 'k920'), (7746, 23, 'k8839'), (7748, 24, 'k6751'), (7750, 25, 'k4663');
+INSERT INTO t VALUES (7752, 26, 'k2575'), (7754, 27, 'k487'), (7756, 28, 'k8406'), (7758, 29, 'k6318'), (7760, 30, 'k4230'), (7762, 31, 'k2142'), (7764, 32, 'k54'), (7766, 33, 'k7973'), (7768, 34, 'k5885'), (7770, 35, 'k3797'), (7772, 36, 'k1709'), (7774, 37, 'k9628'), (7776, 38, 'k7540'), (7778, 39, 'k5452'), (7780, 40, 'k3364'), (7782, 41, 'k1276'), (7784, 42, 'k9195'), (7786, 43, 'k7107'), (7788, 44, 'k5019'), (7790, 45, 'k2931'), (7792, 46, 'k843'), (7794, 47, 'k8762'), (7796, 48, 'k6674'), (7798, 49, 'k4586'), (7800, 0, 'k2498');
+INSERT INTO t VALUES (7802, 1, 'k410'), (7804, 2, 'k8329'), (7806, 3, 'k6241'), (7808, 4, 'k4153'), (7810, 5, 'k2065'), (7812, 6, 'k9984'), (7814, 7, 'k7896'), (7816, 8, 'k5808'), (7818, 9, 'k3720'), (7820, 10, 'k1632'), (7822, 11, 'k9551'), (7824, 12, 'k7463'), (7826, 13, 'k5375'), (7828, 14, 'k3287'), (7830, 15, 'k1199'), (7832, 16, 'k9118'), (7834, 17, 'k7030'), (7836, 18, 'k4942'), (7838, 19, 'k2854'), (7840, 20, 'k766'), (7842, 21, 'k8685'), (7844, 22, 'k6597'), (7846, 23, 'k4509'), (7848, 24, 'k2421'), (7850, 25, 'k333');
+INSERT INTO t VALUES (7852, 26, 'k8252'), (7854, 27, 'k6164'), (7856, 28, 'k4076'), (7858, 29, 'k1988'), (7860, 30, 'k9907'), (7862, 31, 'k7819'), (7864, 32, 'k5731'), (7866, 33, 'k3643'), (7868, 34, 'k1555'), (7870, 35, 'k9474'), (7872, 36, 'k7386'), (7874, 37, 'k5298'), (7876, 38, 'k3210'), (7878, 39, 'k1122'), (7880, 40, 'k9041'), (7882, 41, 'k6953'), (7884, 42, 'k4865'), (7886, 43, 'k2777'), (7888, 44, 'k689'), (7890, 45, 'k8608'), (7892, 46, 'k6520'), (7894, 47, 'k4432'), (7896, 48, 'k2344'), (7898, 49, 'k256'), (7900, 0, 'k8175');
+INSERT INTO t VALUES (7902, 1, 'k6087'), (7904, 2, 'k3999'), (7906, 3, 'k1911'), (7908, 4, 'k9830'), (7910, 5, 'k7742'), (7912, 6, 'k5654'), (7914, 7, 'k3566'), (7916, 8, 'k1478'), (7918, 9, 'k9397'), (7920, 10, 'k7309'), (7922, 11, 'k5221'), (7924, 12, 'k3133'), (7926, 13, 'k1045'), (7928, 14, 'k8964'), (7930, 15, 'k6876'), (7932, 16, 'k4788'), (7934, 17, 'k2700'), (7936, 18, 'k612'), (7938, 19, 'k8531'), (7940, 20, 'k6443'), (7942, 21, 'k4355'), (7944, 22, 'k2267'), (7946, 23, 'k179'), (7948, 24, 'k8098'), (7950, 25, 'k6010');
+INSERT INTO t VALUES (7952, 26, 'k3922'), (7954, 27, 'k1834'), (7956, 28, 'k9753'), (7958, 29, 'k7665'), (7960, 30, 'k5577'), (7962, 31, 'k3489'), (7964, 32, 'k1401'), (7966, 33, 'k9320'), (7968, 34, 'k7232'), (7970, 35, 'k5144'), (7972, 36, 'k3056'), (7974, 37, 'k968'), (7976, 38, 'k8887'), (7978, 39, 'k6799'), (7980, 40, 'k4711'), (7982, 41, 'k2623'), (7984, 42, 'k535'), (7986, 43, 'k8454'), (7988, 44, 'k6366'), (7990, 45, 'k4278'), (7992, 46, 'k2190'), (7994, 47, 'k102'), (7996, 48, 'k8021'), (7998, 49, 'k5933'), (8000, 0, 'k3845');
+CREATE INDEX t("s BLOOM");
+-- keys of the first and of the last filters, and keys never inserted
+SELECT id, a, s FROM t WHERE id = 2;
+SELECT id, a, s FROM t WHERE id = 1500;
+SELECT id, a, s FROM t WHERE id = 2048;
+SELECT id, a, s FROM t WHERE id = 4002;
+SELECT id, a, s FROM t WHERE id = 7998;
+SELECT id, a, s FROM t WHERE id = 8000;
+SELECT id, a, s FROM t WHERE id = 0;
+SELECT id, a, s FROM t WHERE id = 1;
+SELECT id, a, s FROM t WHERE id = 3999;
+SELECT id, a, s FROM t WHERE id = 8002;
+SELECT id, a, s FROM t WHERE id = 100000;
+SELECT id, s FROM t WHERE s = 'k7919';
+SELECT id, s FROM t WHERE s = 'k6926';
+SELECT id, s FROM t WHERE s = 'k3845';
+SELECT id, s FROM t WHERE s = 'k10007';
+SELECT id, s FROM t WHERE s = 'zz';
+SELECT id, s FROM t WHERE s = 'k';
+SELECT NUM(id), SUM(a) FROM t;
+-- duplicate keys are still found
+INSERT INTO t VALUES (2, 0, 'dup');
+INSERT INTO t VALUES (8000, 0, 'dup');
+-- deleted keys keep their bits, the index still answers for them
+DELETE FROM t WHERE id < 1600;
+DELETE FROM t WHERE s = 'k3845';
+INSERT INTO t VALUES (1500, 1, 'back'), (8002, 2, 'k10007'), (1, 3, 'zz');
+-- keys of the first and of the last filters, and keys never inserted
+SELECT id, a, s FROM t WHERE id = 2;
+SELECT id, a, s FROM t WHERE id = 1500;
+SELECT id, a, s FROM t WHERE id = 2048;
+SELECT id, a, s FROM t WHERE id = 4002;
+SELECT id, a, s FROM t WHERE id = 7998;
+SELECT id, a, s FROM t WHERE id = 8000;
+SELECT id, a, s FROM t WHERE id = 0;
+SELECT id, a, s FROM t WHERE id = 1;
+SELECT id, a, s FROM t WHERE id = 3999;
+SELECT id, a, s FROM t WHERE id = 8002;
+SELECT id, a, s FROM t WHERE id = 100000;
+SELECT id, s FROM t WHERE s = 'k7919';
+SELECT id, s FROM t WHERE s = 'k6926';
+SELECT id, s FROM t WHERE s = 'k3845';
+SELECT id, s FROM t WHERE s = 'k10007';
+SELECT id, s FROM t WHERE s = 'zz';
+SELECT id, s FROM t WHERE s = 'k';
+SELECT NUM(id), SUM(a) FROM t;
+CREATE INDEX t("id REBUILD");
+CREATE INDEX t("s REBUILD");
+-- keys of the first and of the last filters, and keys never inserted
+SELECT id, a, s FROM t WHERE id = 2;
+SELECT id, a, s FROM t WHERE id = 1500;
+SELECT id, a, s FROM t WHERE id = 2048;
+SELECT id, a, s FROM t WHERE id = 4002;
+SELECT id, a, s FROM t WHERE id = 7998;
+SELECT id, a, s FROM t WHERE id = 8000;
+SELECT id, a, s FROM t WHERE id = 0;
+SELECT id, a, s FROM t WHERE id = 1;
+SELECT id, a, s FROM t WHERE id = 3999;
+SELECT id, a, s FROM t WHERE id = 8002;
+SELECT id, a, s FROM t WHERE id = 100000;
+SELECT id, s FROM t WHERE s = 'k7919';
+SELECT id, s FROM t WHERE s = 'k6926';
+SELECT id, s FROM t WHERE s = 'k3845';
+SELECT id, s FROM t WHERE s = 'k10007';
+SELECT id, s FROM t WHERE s = 'zz';
+SELECT id, s FROM t WHERE s = 'k';
+SELECT NUM(id), SUM(a) FROM t;
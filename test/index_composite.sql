@@ -0,0 +1,115 @@
+-- composite indexes on (a, b) and (a, s), see run_sql.sh
+CREATE DATABASE ic;
+USE DATABASE ic;
+CREATE TABLE t(id int(10) NOT NULL, a int(10), b int(10), s varchar(10), PRIMARY KEY(id));
+CREATE INDEX t("a, b");
+INSERT INTO t VALUES (1, 7, 13, 'ab1'), (2, 14, 26, 'ab2'), (3, 1, 39, 'abc3'), (4, 8, 52, 'abc4'), (5, 15, 65, 'abc5'), (6, 2, 78, 'b6'), (7, 9, 91, 'b7'), (8, 16, 7, 'b8'), (9, 3, 20, 'x0'), (10, 10, 33, 'x1'), (11, 17, 46, 'x2'), (12, 4, 59, 'ab3'), (13, 11, 72, 'ab4'), (14, 18, 85, 'ab5'), (15, 5, 1, 'abc6'), (16, 12, 14, 'abc7'), (17, 19, 27, 'abc8'), (18, 6, 40, 'b0'), (19, 13, 53, 'b1'), (20, 0, 66, 'b2'), (21, 7, 79, 'x3'), (22, 14, 92, 'x4'), (23, 1, 8, 'x5'), (24, 8, 21, 'ab6'), (25, 15, 34, 'ab7');
+INSERT INTO t VALUES (26, 2, 47, 'ab8'), (27, 9, 60, 'abc0'), (28, 16, 73, 'abc1'), (29, 3, 86, 'abc2'), (30, 10, 2, 'b3'), (31, NULL, 15, 'b4'), (32, 4, 28, 'b5'), (33, 11, 41, 'x6'), (34, 18, 54, 'x7'), (35, 5, 67, 'x8'), (36, 12, 80, 'ab0'), (37, 19, NULL, 'ab1'), (38, 6, 9, 'ab2'), (39, 13, 22, 'abc3'), (40, 0, 35, 'abc4'), (41, 7, 48, 'abc5'), (42, 14, 61, 'b6'), (43, 1, 74, 'b7'), (44, 8, 87, 'b8'), (45, 15, 3, 'x0'), (46, 2, 16, 'x1'), (47, 9, 29, 'x2'), (48, 16, 42, 'ab3'), (49, 3, 55, 'ab4'), (50, 10, 68, 'ab5');
+INSERT INTO t VALUES (51, 17, 81, 'abc6'), (52, 4, 94, 'abc7'), (53, 11, 10, 'abc8'), (54, 18, 23, 'b0'), (55, 5, 36, 'b1'), (56, 12, 49, 'b2'), (57, 19, 62, 'x3'), (58, 6, 75, 'x4'), (59, 13, 88, 'x5'), (60, 0, 4, 'ab6'), (61, 7, 17, 'ab7'), (62, NULL, 30, 'ab8'), (63, 1, 43, 'abc0'), (64, 8, 56, 'abc1'), (65, 15, 69, 'abc2'), (66, 2, 82, 'b3'), (67, 9, 95, 'b4'), (68, 16, 11, 'b5'), (69, 3, 24, 'x6'), (70, 10, 37, 'x7'), (71, 17, 50, 'x8'), (72, 4, 63, 'ab0'), (73, 11, 76, 'ab1'), (74, 18, NULL, 'ab2'), (75, 5, 5, 'abc3');
+INSERT INTO t VALUES (76, 12, 18, 'abc4'), (77, 19, 31, 'abc5'), (78, 6, 44, 'b6'), (79, 13, 57, 'b7'), (80, 0, 70, 'b8'), (81, 7, 83, 'x0'), (82, 14, 96, 'x1'), (83, 1, 12, 'x2'), (84, 8, 25, 'ab3'), (85, 15, 38, 'ab4'), (86, 2, 51, 'ab5'), (87, 9, 64, 'abc6'), (88, 16, 77, 'abc7'), (89, 3, 90, 'abc8'), (90, 10, 6, 'b0'), (91, 17, 19, 'b1'), (92, 4, 32, 'b2'), (93, NULL, 45, 'x3'), (94, 18, 58, 'x4'), (95, 5, 71, 'x5'), (96, 12, 84, 'ab6'), (97, 19, 0, 'ab7'), (98, 6, 13, 'ab8'), (99, 13, 26, 'abc0'), (100, 0, 39, 'abc1');
+INSERT INTO t VALUES (101, 7, 52, 'abc2'), (102, 14, 65, 'b3'), (103, 1, 78, 'b4'), (104, 8, 91, 'b5'), (105, 15, 7, 'x6'), (106, 2, 20, 'x7'), (107, 9, 33, 'x8'), (108, 16, 46, 'ab0'), (109, 3, 59, 'ab1'), (110, 10, 72, 'ab2'), (111, 17, NULL, 'abc3'), (112, 4, 1, 'abc4'), (113, 11, 14, 'abc5'), (114, 18, 27, 'b6'), (115, 5, 40, 'b7'), (116, 12, 53, 'b8'), (117, 19, 66, 'x0'), (118, 6, 79, 'x1'), (119, 13, 92, 'x2'), (120, 0, 8, 'ab3'), (121, 7, 21, 'ab4'), (122, 14, 34, 'ab5'), (123, 1, 47, 'abc6'), (124, NULL, 60, 'abc7'), (125, 15, 73, 'abc8');
+INSERT INTO t VALUES (126, 2, 86, 'b0'), (127, 9, 2, 'b1'), (128, 16, 15, 'b2'), (129, 3, 28, 'x3'), (130, 10, 41, 'x4'), (131, 17, 54, 'x5'), (132, 4, 67, 'ab6'), (133, 11, 80, 'ab7'), (134, 18, 93, 'ab8'), (135, 5, 9, 'abc0'), (136, 12, 22, 'abc1'), (137, 19, 35, 'abc2'), (138, 6, 48, 'b3'), (139, 13, 61, 'b4'), (140, 0, 74, 'b5'), (141, 7, 87, 'x6'), (142, 14, 3, 'x7'), (143, 1, 16, 'x8'), (144, 8, 29, 'ab0'), (145, 15, 42, 'ab1'), (146, 2, 55, 'ab2'), (147, 9, 68, 'abc3'), (148, 16, NULL, 'abc4'), (149, 3, 94, 'abc5'), (150, 10, 10, 'b6');
+INSERT INTO t VALUES (151, 17, 23, 'b7'), (152, 4, 36, 'b8'), (153, 11, 49, 'x0'), (154, 18, 62, 'x1'), (155, NULL, 75, 'x2'), (156, 12, 88, 'ab3'), (157, 19, 4, 'ab4'), (158, 6, 17, 'ab5'), (159, 13, 30, 'abc6'), (160, 0, 43, 'abc7'), (161, 7, 56, 'abc8'), (162, 14, 69, 'b0'), (163, 1, 82, 'b1'), (164, 8, 95, 'b2'), (165, 15, 11, 'x3'), (166, 2, 24, 'x4'), (167, 9, 37, 'x5'), (168, 16, 50, 'ab6'), (169, 3, 63, 'ab7'), (170, 10, 76, 'ab8'), (171, 17, 89, 'abc0'), (172, 4, 5, 'abc1'), (173, 11, 18, 'abc2'), (174, 18, 31, 'b3'), (175, 5, 44, 'b4');
+INSERT INTO t VALUES (176, 12, 57, 'b5'), (177, 19, 70, 'x6'), (178, 6, 83, 'x7'), (179, 13, 96, 'x8'), (180, 0, 12, 'ab0'), (181, 7, 25, 'ab1'), (182, 14, 38, 'ab2'), (183, 1, 51, 'abc3'), (184, 8, 64, 'abc4'), (185, 15, NULL, 'abc5'), (186, NULL, 90, 'b6'), (187, 9, 6, 'b7'), (188, 16, 19, 'b8'), (189, 3, 32, 'x0'), (190, 10, 45, 'x1'), (191, 17, 58, 'x2'), (192, 4, 71, 'ab3'), (193, 11, 84, 'ab4'), (194, 18, 0, 'ab5'), (195, 5, 13, 'abc6'), (196, 12, 26, 'abc7'), (197, 19, 39, 'abc8'), (198, 6, 52, 'b0'), (199, 13, 65, 'b1'), (200, 0, 78, 'b2');
+INSERT INTO t VALUES (201, 7, 91, 'x3'), (202, 14, 7, 'x4'), (203, 1, 20, 'x5'), (204, 8, 33, 'ab6'), (205, 15, 46, 'ab7'), (206, 2, 59, 'ab8'), (207, 9, 72, 'abc0'), (208, 16, 85, 'abc1'), (209, 3, 1, 'abc2'), (210, 10, 14, 'b3'), (211, 17, 27, 'b4'), (212, 4, 40, 'b5'), (213, 11, 53, 'x6'), (214, 18, 66, 'x7'), (215, 5, 79, 'x8'), (216, 12, 92, 'ab0'), (217, NULL, 8, 'ab1'), (218, 6, 21, 'ab2'), (219, 13, 34, 'abc3'), (220, 0, 47, 'abc4'), (221, 7, 60, 'abc5'), (222, 14, NULL, 'b6'), (223, 1, 86, 'b7'), (224, 8, 2, 'b8'), (225, 15, 15, 'x0');
+INSERT INTO t VALUES (226, 2, 28, 'x1'), (227, 9, 41, 'x2'), (228, 16, 54, 'ab3'), (229, 3, 67, 'ab4'), (230, 10, 80, 'ab5'), (231, 17, 93, 'abc6'), (232, 4, 9, 'abc7'), (233, 11, 22, 'abc8'), (234, 18, 35, 'b0'), (235, 5, 48, 'b1'), (236, 12, 61, 'b2'), (237, 19, 74, 'x3'), (238, 6, 87, 'x4'), (239, 13, 3, 'x5'), (240, 0, 16, 'ab6'), (241, 7, 29, 'ab7'), (242, 14, 42, 'ab8'), (243, 1, 55, 'abc0'), (244, 8, 68, 'abc1'), (245, 15, 81, 'abc2'), (246, 2, 94, 'b3'), (247, 9, 10, 'b4'), (248, NULL, 23, 'b5'), (249, 3, 36, 'x6'), (250, 10, 49, 'x7');
+INSERT INTO t VALUES (251, 17, 62, 'x8'), (252, 4, 75, 'ab0'), (253, 11, 88, 'ab1'), (254, 18, 4, 'ab2'), (255, 5, 17, 'abc3'), (256, 12, 30, 'abc4'), (257, 19, 43, 'abc5'), (258, 6, 56, 'b6'), (259, 13, NULL, 'b7'), (260, 0, 82, 'b8'), (261, 7, 95, 'x0'), (262, 14, 11, 'x1'), (263, 1, 24, 'x2'), (264, 8, 37, 'ab3'), (265, 15, 50, 'ab4'), (266, 2, 63, 'ab5'), (267, 9, 76, 'abc6'), (268, 16, 89, 'abc7'), (269, 3, 5, 'abc8'), (270, 10, 18, 'b0'), (271, 17, 31, 'b1'), (272, 4, 44, 'b2'), (273, 11, 57, 'x3'), (274, 18, 70, 'x4'), (275, 5, 83, 'x5');
+INSERT INTO t VALUES (276, 12, 96, 'ab6'), (277, 19, 12, 'ab7'), (278, 6, 25, 'ab8'), (279, NULL, 38, 'abc0'), (280, 0, 51, 'abc1'), (281, 7, 64, 'abc2'), (282, 14, 77, 'b3'), (283, 1, 90, 'b4'), (284, 8, 6, 'b5'), (285, 15, 19, 'x6'), (286, 2, 32, 'x7'), (287, 9, 45, 'x8'), (288, 16, 58, 'ab0'), (289, 3, 71, 'ab1'), (290, 10, 84, 'ab2'), (291, 17, 0, 'abc3'), (292, 4, 13, 'abc4'), (293, 11, 26, 'abc5'), (294, 18, 39, 'b6'), (295, 5, 52, 'b7'), (296, 12, NULL, 'b8'), (297, 19, 78, 'x0'), (298, 6, 91, 'x1'), (299, 13, 7, 'x2'), (300, 0, 20, 'ab3');
+INSERT INTO t VALUES (301, 7, 33, 'ab4'), (302, 14, 46, 'ab5'), (303, 1, 59, 'abc6'), (304, 8, 72, 'abc7'), (305, 15, 85, 'abc8'), (306, 2, 1, 'b0'), (307, 9, 14, 'b1'), (308, 16, 27, 'b2'), (309, 3, 40, 'x3'), (310, NULL, 53, 'x4'), (311, 17, 66, 'x5'), (312, 4, 79, 'ab6'), (313, 11, 92, 'ab7'), (314, 18, 8, 'ab8'), (315, 5, 21, 'abc0'), (316, 12, 34, 'abc1'), (317, 19, 47, 'abc2'), (318, 6, 60, 'b3'), (319, 13, 73, 'b4'), (320, 0, 86, 'b5'), (321, 7, 2, 'x6'), (322, 14, 15, 'x7'), (323, 1, 28, 'x8'), (324, 8, 41, 'ab0'), (325, 15, 54, 'ab1');
+INSERT INTO t VALUES (326, 2, 67, 'ab2'), (327, 9, 80, 'abc3'), (328, 16, 93, 'abc4'), (329, 3, 9, 'abc5'), (330, 10, 22, 'b6'), (331, 17, 35, 'b7'), (332, 4, 48, 'b8'), (333, 11, NULL, 'x0'), (334, 18, 74, 'x1'), (335, 5, 87, 'x2'), (336, 12, 3, 'ab3'), (337, 19, 16, 'ab4'), (338, 6, 29, 'ab5'), (339, 13, 42, 'abc6'), (340, 0, 55, 'abc7'), (341, NULL, 68, 'abc8'), (342, 14, 81, 'b0'), (343, 1, 94, 'b1'), (344, 8, 10, 'b2'), (345, 15, 23, 'x3'), (346, 2, 36, 'x4'), (347, 9, 49, 'x5'), (348, 16, 62, 'ab6'), (349, 3, 75, 'ab7'), (350, 10, 88, 'ab8');
+INSERT INTO t VALUES (351, 17, 4, 'abc0'), (352, 4, 17, 'abc1'), (353, 11, 30, 'abc2'), (354, 18, 43, 'b3'), (355, 5, 56, 'b4'), (356, 12, 69, 'b5'), (357, 19, 82, 'x6'), (358, 6, 95, 'x7'), (359, 13, 11, 'x8'), (360, 0, 24, 'ab0'), (361, 7, 37, 'ab1'), (362, 14, 50, 'ab2'), (363, 1, 63, 'abc3'), (364, 8, 76, 'abc4'), (365, 15, 89, 'abc5'), (366, 2, 5, 'b6'), (367, 9, 18, 'b7'), (368, 16, 31, 'b8'), (369, 3, 44, 'x0'), (370, 10, NULL, 'x1'), (371, 17, 70, 'x2'), (372, NULL, 83, 'ab3'), (373, 11, 96, 'ab4'), (374, 18, 12, 'ab5'), (375, 5, 25, 'abc6');
+INSERT INTO t VALUES (376, 12, 38, 'abc7'), (377, 19, 51, 'abc8'), (378, 6, 64, 'b0'), (379, 13, 77, 'b1'), (380, 0, 90, 'b2'), (381, 7, 6, 'x3'), (382, 14, 19, 'x4'), (383, 1, 32, 'x5'), (384, 8, 45, 'ab6'), (385, 15, 58, 'ab7'), (386, 2, 71, 'ab8'), (387, 9, 84, 'abc0'), (388, 16, 0, 'abc1'), (389, 3, 13, 'abc2'), (390, 10, 26, 'b3'), (391, 17, 39, 'b4'), (392, 4, 52, 'b5'), (393, 11, 65, 'x6'), (394, 18, 78, 'x7'), (395, 5, 91, 'x8'), (396, 12, 7, 'ab0'), (397, 19, 20, 'ab1'), (398, 6, 33, 'ab2'), (399, 13, 46, 'abc3'), (400, 0, 59, 'abc4');
+INSERT INTO t VALUES (401, 7, 72, 'abc5'), (402, 14, 85, 'b6'), (403, NULL, 1, 'b7'), (404, 8, 14, 'b8'), (405, 15, 27, 'x0'), (406, 2, 40, 'x1'), (407, 9, NULL, 'x2'), (408, 16, 66, 'ab3'), (409, 3, 79, 'ab4'), (410, 10, 92, 'ab5'), (411, 17, 8, 'abc6'), (412, 4, 21, 'abc7'), (413, 11, 34, 'abc8'), (414, 18, 47, 'b0'), (415, 5, 60, 'b1'), (416, 12, 73, 'b2'), (417, 19, 86, 'x3'), (418, 6, 2, 'x4'), (419, 13, 15, 'x5'), (420, 0, 28, 'ab6'), (421, 7, 41, 'ab7'), (422, 14, 54, 'ab8'), (423, 1, 67, 'abc0'), (424, 8, 80, 'abc1'), (425, 15, 93, 'abc2');
+INSERT INTO t VALUES (426, 2, 9, 'b3'), (427, 9, 22, 'b4'), (428, 16, 35, 'b5'), (429, 3, 48, 'x6'), (430, 10, 61, 'x7'), (431, 17, 74, 'x8'), (432, 4, 87, 'ab0'), (433, 11, 3, 'ab1'), (434, NULL, 16, 'ab2'), (435, 5, 29, 'abc3'), (436, 12, 42, 'abc4'), (437, 19, 55, 'abc5'), (438, 6, 68, 'b6'), (439, 13, 81, 'b7'), (440, 0, 94, 'b8'), (441, 7, 10, 'x0'), (442, 14, 23, 'x1'), (443, 1, 36, 'x2'), (444, 8, NULL, 'ab3'), (445, 15, 62, 'ab4'), (446, 2, 75, 'ab5'), (447, 9, 88, 'abc6'), (448, 16, 4, 'abc7'), (449, 3, 17, 'abc8'), (450, 10, 30, 'b0');
+INSERT INTO t VALUES (451, 17, 43, 'b1'), (452, 4, 56, 'b2'), (453, 11, 69, 'x3'), (454, 18, 82, 'x4'), (455, 5, 95, 'x5'), (456, 12, 11, 'ab6'), (457, 19, 24, 'ab7'), (458, 6, 37, 'ab8'), (459, 13, 50, 'abc0'), (460, 0, 63, 'abc1'), (461, 7, 76, 'abc2'), (462, 14, 89, 'b3'), (463, 1, 5, 'b4'), (464, 8, 18, 'b5'), (465, NULL, 31, 'x6'), (466, 2, 44, 'x7'), (467, 9, 57, 'x8'), (468, 16, 70, 'ab0'), (469, 3, 83, 'ab1'), (470, 10, 96, 'ab2'), (471, 17, 12, 'abc3'), (472, 4, 25, 'abc4'), (473, 11, 38, 'abc5'), (474, 18, 51, 'b6'), (475, 5, 64, 'b7');
+INSERT INTO t VALUES (476, 12, 77, 'b8'), (477, 19, 90, 'x0'), (478, 6, 6, 'x1'), (479, 13, 19, 'x2'), (480, 0, 32, 'ab3'), (481, 7, NULL, 'ab4'), (482, 14, 58, 'ab5'), (483, 1, 71, 'abc6'), (484, 8, 84, 'abc7'), (485, 15, 0, 'abc8'), (486, 2, 13, 'b0'), (487, 9, 26, 'b1'), (488, 16, 39, 'b2'), (489, 3, 52, 'x3'), (490, 10, 65, 'x4'), (491, 17, 78, 'x5'), (492, 4, 91, 'ab6'), (493, 11, 7, 'ab7'), (494, 18, 20, 'ab8'), (495, 5, 33, 'abc0'), (496, NULL, 46, 'abc1'), (497, 19, 59, 'abc2'), (498, 6, 72, 'b3'), (499, 13, 85, 'b4'), (500, 0, 1, 'b5');
+INSERT INTO t VALUES (501, 7, 14, 'x6'), (502, 14, 27, 'x7'), (503, 1, 40, 'x8'), (504, 8, 53, 'ab0'), (505, 15, 66, 'ab1'), (506, 2, 79, 'ab2'), (507, 9, 92, 'abc3'), (508, 16, 8, 'abc4'), (509, 3, 21, 'abc5'), (510, 10, 34, 'b6'), (511, 17, 47, 'b7'), (512, 4, 60, 'b8'), (513, 11, 73, 'x0'), (514, 18, 86, 'x1'), (515, 5, 2, 'x2'), (516, 12, 15, 'ab3'), (517, 19, 28, 'ab4'), (518, 6, NULL, 'ab5'), (519, 13, 54, 'abc6'), (520, 0, 67, 'abc7'), (521, 7, 80, 'abc8'), (522, 14, 93, 'b0'), (523, 1, 9, 'b1'), (524, 8, 22, 'b2'), (525, 15, 35, 'x3');
+INSERT INTO t VALUES (526, 2, 48, 'x4'), (527, NULL, 61, 'x5'), (528, 16, 74, 'ab6'), (529, 3, 87, 'ab7'), (530, 10, 3, 'ab8'), (531, 17, 16, 'abc0'), (532, 4, 29, 'abc1'), (533, 11, 42, 'abc2'), (534, 18, 55, 'b3'), (535, 5, 68, 'b4'), (536, 12, 81, 'b5'), (537, 19, 94, 'x6'), (538, 6, 10, 'x7'), (539, 13, 23, 'x8'), (540, 0, 36, 'ab0'), (541, 7, 49, 'ab1'), (542, 14, 62, 'ab2'), (543, 1, 75, 'abc3'), (544, 8, 88, 'abc4'), (545, 15, 4, 'abc5'), (546, 2, 17, 'b6'), (547, 9, 30, 'b7'), (548, 16, 43, 'b8'), (549, 3, 56, 'x0'), (550, 10, 69, 'x1');
+INSERT INTO t VALUES (551, 17, 82, 'x2'), (552, 4, 95, 'ab3'), (553, 11, 11, 'ab4'), (554, 18, 24, 'ab5'), (555, 5, NULL, 'abc6'), (556, 12, 50, 'abc7'), (557, 19, 63, 'abc8'), (558, NULL, 76, 'b0'), (559, 13, 89, 'b1'), (560, 0, 5, 'b2'), (561, 7, 18, 'x3'), (562, 14, 31, 'x4'), (563, 1, 44, 'x5'), (564, 8, 57, 'ab6'), (565, 15, 70, 'ab7'), (566, 2, 83, 'ab8'), (567, 9, 96, 'abc0'), (568, 16, 12, 'abc1'), (569, 3, 25, 'abc2'), (570, 10, 38, 'b3'), (571, 17, 51, 'b4'), (572, 4, 64, 'b5'), (573, 11, 77, 'x6'), (574, 18, 90, 'x7'), (575, 5, 6, 'x8');
+INSERT INTO t VALUES (576, 12, 19, 'ab0'), (577, 19, 32, 'ab1'), (578, 6, 45, 'ab2'), (579, 13, 58, 'abc3'), (580, 0, 71, 'abc4'), (581, 7, 84, 'abc5'), (582, 14, 0, 'b6'), (583, 1, 13, 'b7'), (584, 8, 26, 'b8'), (585, 15, 39, 'x0'), (586, 2, 52, 'x1'), (587, 9, 65, 'x2'), (588, 16, 78, 'ab3'), (589, NULL, 91, 'ab4'), (590, 10, 7, 'ab5'), (591, 17, 20, 'abc6'), (592, 4, NULL, 'abc7'), (593, 11, 46, 'abc8'), (594, 18, 59, 'b0'), (595, 5, 72, 'b1'), (596, 12, 85, 'b2'), (597, 19, 1, 'x3'), (598, 6, 14, 'x4'), (599, 13, 27, 'x5'), (600, 0, 40, 'ab6');
+INSERT INTO t VALUES (601, 7, 53, 'ab7'), (602, 14, 66, 'ab8'), (603, 1, 79, 'abc0'), (604, 8, 92, 'abc1'), (605, 15, 8, 'abc2'), (606, 2, 21, 'b3'), (607, 9, 34, 'b4'), (608, 16, 47, 'b5'), (609, 3, 60, 'x6'), (610, 10, 73, 'x7'), (611, 17, 86, 'x8'), (612, 4, 2, 'ab0'), (613, 11, 15, 'ab1'), (614, 18, 28, 'ab2'), (615, 5, 41, 'abc3'), (616, 12, 54, 'abc4'), (617, 19, 67, 'abc5'), (618, 6, 80, 'b6'), (619, 13, 93, 'b7'), (620, NULL, 9, 'b8'), (621, 7, 22, 'x0'), (622, 14, 35, 'x1'), (623, 1, 48, 'x2'), (624, 8, 61, 'ab3'), (625, 15, 74, 'ab4');
+INSERT INTO t VALUES (626, 2, 87, 'ab5'), (627, 9, 3, 'abc6'), (628, 16, 16, 'abc7'), (629, 3, NULL, 'abc8'), (630, 10, 42, 'b0'), (631, 17, 55, 'b1'), (632, 4, 68, 'b2'), (633, 11, 81, 'x3'), (634, 18, 94, 'x4'), (635, 5, 10, 'x5'), (636, 12, 23, 'ab6'), (637, 19, 36, 'ab7'), (638, 6, 49, 'ab8'), (639, 13, 62, 'abc0'), (640, 0, 75, 'abc1'), (641, 7, 88, 'abc2'), (642, 14, 4, 'b3'), (643, 1, 17, 'b4'), (644, 8, 30, 'b5'), (645, 15, 43, 'x6'), (646, 2, 56, 'x7'), (647, 9, 69, 'x8'), (648, 16, 82, 'ab0'), (649, 3, 95, 'ab1'), (650, 10, 11, 'ab2');
+INSERT INTO t VALUES (651, NULL, 24, 'abc3'), (652, 4, 37, 'abc4'), (653, 11, 50, 'abc5'), (654, 18, 63, 'b6'), (655, 5, 76, 'b7'), (656, 12, 89, 'b8'), (657, 19, 5, 'x0'), (658, 6, 18, 'x1'), (659, 13, 31, 'x2'), (660, 0, 44, 'ab3'), (661, 7, 57, 'ab4'), (662, 14, 70, 'ab5'), (663, 1, 83, 'abc6'), (664, 8, 96, 'abc7'), (665, 15, 12, 'abc8'), (666, 2, NULL, 'b0'), (667, 9, 38, 'b1'), (668, 16, 51, 'b2'), (669, 3, 64, 'x3'), (670, 10, 77, 'x4'), (671, 17, 90, 'x5'), (672, 4, 6, 'ab6'), (673, 11, 19, 'ab7'), (674, 18, 32, 'ab8'), (675, 5, 45, 'abc0');
+INSERT INTO t VALUES (676, 12, 58, 'abc1'), (677, 19, 71, 'abc2'), (678, 6, 84, 'b3'), (679, 13, 0, 'b4'), (680, 0, 13, 'b5'), (681, 7, 26, 'x6'), (682, NULL, 39, 'x7'), (683, 1, 52, 'x8'), (684, 8, 65, 'ab0'), (685, 15, 78, 'ab1'), (686, 2, 91, 'ab2'), (687, 9, 7, 'abc3'), (688, 16, 20, 'abc4'), (689, 3, 33, 'abc5'), (690, 10, 46, 'b6'), (691, 17, 59, 'b7'), (692, 4, 72, 'b8'), (693, 11, 85, 'x0'), (694, 18, 1, 'x1'), (695, 5, 14, 'x2'), (696, 12, 27, 'ab3'), (697, 19, 40, 'ab4'), (698, 6, 53, 'ab5'), (699, 13, 66, 'abc6'), (700, 0, 79, 'abc7');
+INSERT INTO t VALUES (701, 7, 92, 'abc8'), (702, 14, 8, 'b0'), (703, 1, NULL, 'b1'), (704, 8, 34, 'b2'), (705, 15, 47, 'x3'), (706, 2, 60, 'x4'), (707, 9, 73, 'x5'), (708, 16, 86, 'ab6'), (709, 3, 2, 'ab7'), (710, 10, 15, 'ab8'), (711, 17, 28, 'abc0'), (712, 4, 41, 'abc1'), (713, NULL, 54, 'abc2'), (714, 18, 67, 'b3'), (715, 5, 80, 'b4'), (716, 12, 93, 'b5'), (717, 19, 9, 'x6'), (718, 6, 22, 'x7'), (719, 13, 35, 'x8'), (720, 0, 48, 'ab0'), (721, 7, 61, 'ab1'), (722, 14, 74, 'ab2'), (723, 1, 87, 'abc3'), (724, 8, 3, 'abc4'), (725, 15, 16, 'abc5');
+INSERT INTO t VALUES (726, 2, 29, 'b6'), (727, 9, 42, 'b7'), (728, 16, 55, 'b8'), (729, 3, 68, 'x0'), (730, 10, 81, 'x1'), (731, 17, 94, 'x2'), (732, 4, 10, 'ab3'), (733, 11, 23, 'ab4'), (734, 18, 36, 'ab5'), (735, 5, 49, 'abc6'), (736, 12, 62, 'abc7'), (737, 19, 75, 'abc8'), (738, 6, 88, 'b0'), (739, 13, 4, 'b1'), (740, 0, NULL, 'b2'), (741, 7, 30, 'x3'), (742, 14, 43, 'x4'), (743, 1, 56, 'x5'), (744, NULL, 69, 'ab6'), (745, 15, 82, 'ab7'), (746, 2, 95, 'ab8'), (747, 9, 11, 'abc0'), (748, 16, 24, 'abc1'), (749, 3, 37, 'abc2'), (750, 10, 50, 'b3');
+INSERT INTO t VALUES (751, 17, 63, 'b4'), (752, 4, 76, 'b5'), (753, 11, 89, 'x6'), (754, 18, 5, 'x7'), (755, 5, 18, 'x8'), (756, 12, 31, 'ab0'), (757, 19, 44, 'ab1'), (758, 6, 57, 'ab2'), (759, 13, 70, 'abc3'), (760, 0, 83, 'abc4'), (761, 7, 96, 'abc5'), (762, 14, 12, 'b6'), (763, 1, 25, 'b7'), (764, 8, 38, 'b8'), (765, 15, 51, 'x0'), (766, 2, 64, 'x1'), (767, 9, 77, 'x2'), (768, 16, 90, 'ab3'), (769, 3, 6, 'ab4'), (770, 10, 19, 'ab5'), (771, 17, 32, 'abc6'), (772, 4, 45, 'abc7'), (773, 11, 58, 'abc8'), (774, 18, 71, 'b0'), (775, NULL, 84, 'b1');
+INSERT INTO t VALUES (776, 12, 0, 'b2'), (777, 19, NULL, 'x3'), (778, 6, 26, 'x4'), (779, 13, 39, 'x5'), (780, 0, 52, 'ab6'), (781, 7, 65, 'ab7'), (782, 14, 78, 'ab8'), (783, 1, 91, 'abc0'), (784, 8, 7, 'abc1'), (785, 15, 20, 'abc2'), (786, 2, 33, 'b3'), (787, 9, 46, 'b4'), (788, 16, 59, 'b5'), (789, 3, 72, 'x6'), (790, 10, 85, 'x7'), (791, 17, 1, 'x8'), (792, 4, 14, 'ab0'), (793, 11, 27, 'ab1'), (794, 18, 40, 'ab2'), (795, 5, 53, 'abc3'), (796, 12, 66, 'abc4'), (797, 19, 79, 'abc5'), (798, 6, 92, 'b6'), (799, 13, 8, 'b7'), (800, 0, 21, 'b8');
+INSERT INTO t VALUES (801, 7, 34, 'x0'), (802, 14, 47, 'x1'), (803, 1, 60, 'x2'), (804, 8, 73, 'ab3'), (805, 15, 86, 'ab4'), (806, NULL, 2, 'ab5'), (807, 9, 15, 'abc6'), (808, 16, 28, 'abc7'), (809, 3, 41, 'abc8'), (810, 10, 54, 'b0'), (811, 17, 67, 'b1'), (812, 4, 80, 'b2'), (813, 11, 93, 'x3'), (814, 18, NULL, 'x4'), (815, 5, 22, 'x5'), (816, 12, 35, 'ab6'), (817, 19, 48, 'ab7'), (818, 6, 61, 'ab8'), (819, 13, 74, 'abc0'), (820, 0, 87, 'abc1'), (821, 7, 3, 'abc2'), (822, 14, 16, 'b3'), (823, 1, 29, 'b4'), (824, 8, 42, 'b5'), (825, 15, 55, 'x6');
+INSERT INTO t VALUES (826, 2, 68, 'x7'), (827, 9, 81, 'x8'), (828, 16, 94, 'ab0'), (829, 3, 10, 'ab1'), (830, 10, 23, 'ab2'), (831, 17, 36, 'abc3'), (832, 4, 49, 'abc4'), (833, 11, 62, 'abc5'), (834, 18, 75, 'b6'), (835, 5, 88, 'b7'), (836, 12, 4, 'b8'), (837, NULL, 17, 'x0'), (838, 6, 30, 'x1'), (839, 13, 43, 'x2'), (840, 0, 56, 'ab3'), (841, 7, 69, 'ab4'), (842, 14, 82, 'ab5'), (843, 1, 95, 'abc6'), (844, 8, 11, 'abc7'), (845, 15, 24, 'abc8'), (846, 2, 37, 'b0'), (847, 9, 50, 'b1'), (848, 16, 63, 'b2'), (849, 3, 76, 'x3'), (850, 10, 89, 'x4');
+INSERT INTO t VALUES (851, 17, NULL, 'x5'), (852, 4, 18, 'ab6'), (853, 11, 31, 'ab7'), (854, 18, 44, 'ab8'), (855, 5, 57, 'abc0'), (856, 12, 70, 'abc1'), (857, 19, 83, 'abc2'), (858, 6, 96, 'b3'), (859, 13, 12, 'b4'), (860, 0, 25, 'b5'), (861, 7, 38, 'x6'), (862, 14, 51, 'x7'), (863, 1, 64, 'x8'), (864, 8, 77, 'ab0'), (865, 15, 90, 'ab1'), (866, 2, 6, 'ab2'), (867, 9, 19, 'abc3'), (868, NULL, 32, 'abc4'), (869, 3, 45, 'abc5'), (870, 10, 58, 'b6'), (871, 17, 71, 'b7'), (872, 4, 84, 'b8'), (873, 11, 0, 'x0'), (874, 18, 13, 'x1'), (875, 5, 26, 'x2');
+INSERT INTO t VALUES (876, 12, 39, 'ab3'), (877, 19, 52, 'ab4'), (878, 6, 65, 'ab5'), (879, 13, 78, 'abc6'), (880, 0, 91, 'abc7'), (881, 7, 7, 'abc8'), (882, 14, 20, 'b0'), (883, 1, 33, 'b1'), (884, 8, 46, 'b2'), (885, 15, 59, 'x3'), (886, 2, 72, 'x4'), (887, 9, 85, 'x5'), (888, 16, NULL, 'ab6'), (889, 3, 14, 'ab7'), (890, 10, 27, 'ab8'), (891, 17, 40, 'abc0'), (892, 4, 53, 'abc1'), (893, 11, 66, 'abc2'), (894, 18, 79, 'b3'), (895, 5, 92, 'b4'), (896, 12, 8, 'b5'), (897, 19, 21, 'x6'), (898, 6, 34, 'x7'), (899, NULL, 47, 'x8'), (900, 0, 60, 'ab0');
+INSERT INTO t VALUES (901, 7, 73, 'ab1'), (902, 14, 86, 'ab2'), (903, 1, 2, 'abc3'), (904, 8, 15, 'abc4'), (905, 15, 28, 'abc5'), (906, 2, 41, 'b6'), (907, 9, 54, 'b7'), (908, 16, 67, 'b8'), (909, 3, 80, 'x0'), (910, 10, 93, 'x1'), (911, 17, 9, 'x2'), (912, 4, 22, 'ab3'), (913, 11, 35, 'ab4'), (914, 18, 48, 'ab5'), (915, 5, 61, 'abc6'), (916, 12, 74, 'abc7'), (917, 19, 87, 'abc8'), (918, 6, 3, 'b0'), (919, 13, 16, 'b1'), (920, 0, 29, 'b2'), (921, 7, 42, 'x3'), (922, 14, 55, 'x4'), (923, 1, 68, 'x5'), (924, 8, 81, 'ab6'), (925, 15, NULL, 'ab7');
+INSERT INTO t VALUES (926, 2, 10, 'ab8'), (927, 9, 23, 'abc0'), (928, 16, 36, 'abc1'), (929, 3, 49, 'abc2'), (930, NULL, 62, 'b3'), (931, 17, 75, 'b4'), (932, 4, 88, 'b5'), (933, 11, 4, 'x6'), (934, 18, 17, 'x7'), (935, 5, 30, 'x8'), (936, 12, 43, 'ab0'), (937, 19, 56, 'ab1'), (938, 6, 69, 'ab2'), (939, 13, 82, 'abc3'), (940, 0, 95, 'abc4'), (941, 7, 11, 'abc5'), (942, 14, 24, 'b6'), (943, 1, 37, 'b7'), (944, 8, 50, 'b8'), (945, 15, 63, 'x0'), (946, 2, 76, 'x1'), (947, 9, 89, 'x2'), (948, 16, 5, 'ab3'), (949, 3, 18, 'ab4'), (950, 10, 31, 'ab5');
+INSERT INTO t VALUES (951, 17, 44, 'abc6'), (952, 4, 57, 'abc7'), (953, 11, 70, 'abc8'), (954, 18, 83, 'b0'), (955, 5, 96, 'b1'), (956, 12, 12, 'b2'), (957, 19, 25, 'x3'), (958, 6, 38, 'x4'), (959, 13, 51, 'x5'), (960, 0, 64, 'ab6'), (961, NULL, 77, 'ab7'), (962, 14, NULL, 'ab8'), (963, 1, 6, 'abc0'), (964, 8, 19, 'abc1'), (965, 15, 32, 'abc2'), (966, 2, 45, 'b3'), (967, 9, 58, 'b4'), (968, 16, 71, 'b5'), (969, 3, 84, 'x6'), (970, 10, 0, 'x7'), (971, 17, 13, 'x8'), (972, 4, 26, 'ab0'), (973, 11, 39, 'ab1'), (974, 18, 52, 'ab2'), (975, 5, 65, 'abc3');
+INSERT INTO t VALUES (976, 12, 78, 'abc4'), (977, 19, 91, 'abc5'), (978, 6, 7, 'b6'), (979, 13, 20, 'b7'), (980, 0, 33, 'b8'), (981, 7, 46, 'x0'), (982, 14, 59, 'x1'), (983, 1, 72, 'x2'), (984, 8, 85, 'ab3'), (985, 15, 1, 'ab4'), (986, 2, 14, 'ab5'), (987, 9, 27, 'abc6'), (988, 16, 40, 'abc7'), (989, 3, 53, 'abc8'), (990, 10, 66, 'b0'), (991, 17, 79, 'b1'), (992, NULL, 92, 'b2'), (993, 11, 8, 'x3'), (994, 18, 21, 'x4'), (995, 5, 34, 'x5'), (996, 12, 47, 'ab6'), (997, 19, 60, 'ab7'), (998, 6, 73, 'ab8'), (999, 13, NULL, 'abc0'), (1000, 0, 2, 'abc1');
+INSERT INTO t VALUES (1001, 7, 15, 'abc2'), (1002, 14, 28, 'b3'), (1003, 1, 41, 'b4'), (1004, 8, 54, 'b5'), (1005, 15, 67, 'x6'), (1006, 2, 80, 'x7'), (1007, 9, 93, 'x8'), (1008, 16, 9, 'ab0'), (1009, 3, 22, 'ab1'), (1010, 10, 35, 'ab2'), (1011, 17, 48, 'abc3'), (1012, 4, 61, 'abc4'), (1013, 11, 74, 'abc5'), (1014, 18, 87, 'b6'), (1015, 5, 3, 'b7'), (1016, 12, 16, 'b8'), (1017, 19, 29, 'x0'), (1018, 6, 42, 'x1'), (1019, 13, 55, 'x2'), (1020, 0, 68, 'ab3'), (1021, 7, 81, 'ab4'), (1022, 14, 94, 'ab5'), (1023, NULL, 10, 'abc6'), (1024, 8, 23, 'abc7'), (1025, 15, 36, 'abc8');
+INSERT INTO t VALUES (1026, 2, 49, 'b0'), (1027, 9, 62, 'b1'), (1028, 16, 75, 'b2'), (1029, 3, 88, 'x3'), (1030, 10, 4, 'x4'), (1031, 17, 17, 'x5'), (1032, 4, 30, 'ab6'), (1033, 11, 43, 'ab7'), (1034, 18, 56, 'ab8'), (1035, 5, 69, 'abc0'), (1036, 12, NULL, 'abc1'), (1037, 19, 95, 'abc2'), (1038, 6, 11, 'b3'), (1039, 13, 24, 'b4'), (1040, 0, 37, 'b5'), (1041, 7, 50, 'x6'), (1042, 14, 63, 'x7'), (1043, 1, 76, 'x8'), (1044, 8, 89, 'ab0'), (1045, 15, 5, 'ab1'), (1046, 2, 18, 'ab2'), (1047, 9, 31, 'abc3'), (1048, 16, 44, 'abc4'), (1049, 3, 57, 'abc5'), (1050, 10, 70, 'b6');
+INSERT INTO t VALUES (1051, 17, 83, 'b7'), (1052, 4, 96, 'b8'), (1053, 11, 12, 'x0'), (1054, NULL, 25, 'x1'), (1055, 5, 38, 'x2'), (1056, 12, 51, 'ab3'), (1057, 19, 64, 'ab4'), (1058, 6, 77, 'ab5'), (1059, 13, 90, 'abc6'), (1060, 0, 6, 'abc7'), (1061, 7, 19, 'abc8'), (1062, 14, 32, 'b0'), (1063, 1, 45, 'b1'), (1064, 8, 58, 'b2'), (1065, 15, 71, 'x3'), (1066, 2, 84, 'x4'), (1067, 9, 0, 'x5'), (1068, 16, 13, 'ab6'), (1069, 3, 26, 'ab7'), (1070, 10, 39, 'ab8'), (1071, 17, 52, 'abc0'), (1072, 4, 65, 'abc1'), (1073, 11, NULL, 'abc2'), (1074, 18, 91, 'b3'), (1075, 5, 7, 'b4');
+INSERT INTO t VALUES (1076, 12, 20, 'b5'), (1077, 19, 33, 'x6'), (1078, 6, 46, 'x7'), (1079, 13, 59, 'x8'), (1080, 0, 72, 'ab0'), (1081, 7, 85, 'ab1'), (1082, 14, 1, 'ab2'), (1083, 1, 14, 'abc3'), (1084, 8, 27, 'abc4'), (1085, NULL, 40, 'abc5'), (1086, 2, 53, 'b6'), (1087, 9, 66, 'b7'), (1088, 16, 79, 'b8'), (1089, 3, 92, 'x0'), (1090, 10, 8, 'x1'), (1091, 17, 21, 'x2'), (1092, 4, 34, 'ab3'), (1093, 11, 47, 'ab4'), (1094, 18, 60, 'ab5'), (1095, 5, 73, 'abc6'), (1096, 12, 86, 'abc7'), (1097, 19, 2, 'abc8'), (1098, 6, 15, 'b0'), (1099, 13, 28, 'b1'), (1100, 0, 41, 'b2');
+INSERT INTO t VALUES (1101, 7, 54, 'x3'), (1102, 14, 67, 'x4'), (1103, 1, 80, 'x5'), (1104, 8, 93, 'ab6'), (1105, 15, 9, 'ab7'), (1106, 2, 22, 'ab8'), (1107, 9, 35, 'abc0'), (1108, 16, 48, 'abc1'), (1109, 3, 61, 'abc2'), (1110, 10, NULL, 'b3'), (1111, 17, 87, 'b4'), (1112, 4, 3, 'b5'), (1113, 11, 16, 'x6'), (1114, 18, 29, 'x7'), (1115, 5, 42, 'x8'), (1116, NULL, 55, 'ab0'), (1117, 19, 68, 'ab1'), (1118, 6, 81, 'ab2'), (1119, 13, 94, 'abc3'), (1120, 0, 10, 'abc4'), (1121, 7, 23, 'abc5'), (1122, 14, 36, 'b6'), (1123, 1, 49, 'b7'), (1124, 8, 62, 'b8'), (1125, 15, 75, 'x0');
+INSERT INTO t VALUES (1126, 2, 88, 'x1'), (1127, 9, 4, 'x2'), (1128, 16, 17, 'ab3'), (1129, 3, 30, 'ab4'), (1130, 10, 43, 'ab5'), (1131, 17, 56, 'abc6'), (1132, 4, 69, 'abc7'), (1133, 11, 82, 'abc8'), (1134, 18, 95, 'b0'), (1135, 5, 11, 'b1'), (1136, 12, 24, 'b2'), (1137, 19, 37, 'x3'), (1138, 6, 50, 'x4'), (1139, 13, 63, 'x5'), (1140, 0, 76, 'ab6'), (1141, 7, 89, 'ab7'), (1142, 14, 5, 'ab8'), (1143, 1, 18, 'abc0'), (1144, 8, 31, 'abc1'), (1145, 15, 44, 'abc2'), (1146, 2, 57, 'b3'), (1147, NULL, NULL, 'b4'), (1148, 16, 83, 'b5'), (1149, 3, 96, 'x6'), (1150, 10, 12, 'x7');
+INSERT INTO t VALUES (1151, 17, 25, 'x8'), (1152, 4, 38, 'ab0'), (1153, 11, 51, 'ab1'), (1154, 18, 64, 'ab2'), (1155, 5, 77, 'abc3'), (1156, 12, 90, 'abc4'), (1157, 19, 6, 'abc5'), (1158, 6, 19, 'b6'), (1159, 13, 32, 'b7'), (1160, 0, 45, 'b8'), (1161, 7, 58, 'x0'), (1162, 14, 71, 'x1'), (1163, 1, 84, 'x2'), (1164, 8, 0, 'ab3'), (1165, 15, 13, 'ab4'), (1166, 2, 26, 'ab5'), (1167, 9, 39, 'abc6'), (1168, 16, 52, 'abc7'), (1169, 3, 65, 'abc8'), (1170, 10, 78, 'b0'), (1171, 17, 91, 'b1'), (1172, 4, 7, 'b2'), (1173, 11, 20, 'x3'), (1174, 18, 33, 'x4'), (1175, 5, 46, 'x5');
+INSERT INTO t VALUES (1176, 12, 59, 'ab6'), (1177, 19, 72, 'ab7'), (1178, NULL, 85, 'ab8'), (1179, 13, 1, 'abc0'), (1180, 0, 14, 'abc1'), (1181, 7, 27, 'abc2'), (1182, 14, 40, 'b3'), (1183, 1, 53, 'b4'), (1184, 8, NULL, 'b5'), (1185, 15, 79, 'x6'), (1186, 2, 92, 'x7'), (1187, 9, 8, 'x8'), (1188, 16, 21, 'ab0'), (1189, 3, 34, 'ab1'), (1190, 10, 47, 'ab2'), (1191, 17, 60, 'abc3'), (1192, 4, 73, 'abc4'), (1193, 11, 86, 'abc5'), (1194, 18, 2, 'b6'), (1195, 5, 15, 'b7'), (1196, 12, 28, 'b8'), (1197, 19, 41, 'x0'), (1198, 6, 54, 'x1'), (1199, 13, 67, 'x2'), (1200, 0, 80, 'ab3');
+INSERT INTO t VALUES (1201, 7, 93, 'ab4'), (1202, 14, 9, 'ab5'), (1203, 1, 22, 'abc6'), (1204, 8, 35, 'abc7'), (1205, 15, 48, 'abc8'), (1206, 2, 61, 'b0'), (1207, 9, 74, 'b1'), (1208, 16, 87, 'b2'), (1209, NULL, 3, 'x3'), (1210, 10, 16, 'x4'), (1211, 17, 29, 'x5'), (1212, 4, 42, 'ab6'), (1213, 11, 55, 'ab7'), (1214, 18, 68, 'ab8'), (1215, 5, 81, 'abc0'), (1216, 12, 94, 'abc1'), (1217, 19, 10, 'abc2'), (1218, 6, 23, 'b3'), (1219, 13, 36, 'b4'), (1220, 0, 49, 'b5'), (1221, 7, NULL, 'x6'), (1222, 14, 75, 'x7'), (1223, 1, 88, 'x8'), (1224, 8, 4, 'ab0'), (1225, 15, 17, 'ab1');
+INSERT INTO t VALUES (1226, 2, 30, 'ab2'), (1227, 9, 43, 'abc3'), (1228, 16, 56, 'abc4'), (1229, 3, 69, 'abc5'), (1230, 10, 82, 'b6'), (1231, 17, 95, 'b7'), (1232, 4, 11, 'b8'), (1233, 11, 24, 'x0'), (1234, 18, 37, 'x1'), (1235, 5, 50, 'x2'), (1236, 12, 63, 'ab3'), (1237, 19, 76, 'ab4'), (1238, 6, 89, 'ab5'), (1239, 13, 5, 'abc6'), (1240, NULL, 18, 'abc7'), (1241, 7, 31, 'abc8'), (1242, 14, 44, 'b0'), (1243, 1, 57, 'b1'), (1244, 8, 70, 'b2'), (1245, 15, 83, 'x3'), (1246, 2, 96, 'x4'), (1247, 9, 12, 'x5'), (1248, 16, 25, 'ab6'), (1249, 3, 38, 'ab7'), (1250, 10, 51, 'ab8');
+INSERT INTO t VALUES (1251, 17, 64, 'abc0'), (1252, 4, 77, 'abc1'), (1253, 11, 90, 'abc2'), (1254, 18, 6, 'b3'), (1255, 5, 19, 'b4'), (1256, 12, 32, 'b5'), (1257, 19, 45, 'x6'), (1258, 6, NULL, 'x7'), (1259, 13, 71, 'x8'), (1260, 0, 84, 'ab0'), (1261, 7, 0, 'ab1'), (1262, 14, 13, 'ab2'), (1263, 1, 26, 'abc3'), (1264, 8, 39, 'abc4'), (1265, 15, 52, 'abc5'), (1266, 2, 65, 'b6'), (1267, 9, 78, 'b7'), (1268, 16, 91, 'b8'), (1269, 3, 7, 'x0'), (1270, 10, 20, 'x1'), (1271, NULL, 33, 'x2'), (1272, 4, 46, 'ab3'), (1273, 11, 59, 'ab4'), (1274, 18, 72, 'ab5'), (1275, 5, 85, 'abc6');
+INSERT INTO t VALUES (1276, 12, 1, 'abc7'), (1277, 19, 14, 'abc8'), (1278, 6, 27, 'b0'), (1279, 13, 40, 'b1'), (1280, 0, 53, 'b2'), (1281, 7, 66, 'x3'), (1282, 14, 79, 'x4'), (1283, 1, 92, 'x5'), (1284, 8, 8, 'ab6'), (1285, 15, 21, 'ab7'), (1286, 2, 34, 'ab8'), (1287, 9, 47, 'abc0'), (1288, 16, 60, 'abc1'), (1289, 3, 73, 'abc2'), (1290, 10, 86, 'b3'), (1291, 17, 2, 'b4'), (1292, 4, 15, 'b5'), (1293, 11, 28, 'x6'), (1294, 18, 41, 'x7'), (1295, 5, NULL, 'x8'), (1296, 12, 67, 'ab0'), (1297, 19, 80, 'ab1'), (1298, 6, 93, 'ab2'), (1299, 13, 9, 'abc3'), (1300, 0, 22, 'abc4');
+INSERT INTO t VALUES (1301, 7, 35, 'abc5'), (1302, NULL, 48, 'b6'), (1303, 1, 61, 'b7'), (1304, 8, 74, 'b8'), (1305, 15, 87, 'x0'), (1306, 2, 3, 'x1'), (1307, 9, 16, 'x2'), (1308, 16, 29, 'ab3'), (1309, 3, 42, 'ab4'), (1310, 10, 55, 'ab5'), (1311, 17, 68, 'abc6'), (1312, 4, 81, 'abc7'), (1313, 11, 94, 'abc8'), (1314, 18, 10, 'b0'), (1315, 5, 23, 'b1'), (1316, 12, 36, 'b2'), (1317, 19, 49, 'x3'), (1318, 6, 62, 'x4'), (1319, 13, 75, 'x5'), (1320, 0, 88, 'ab6'), (1321, 7, 4, 'ab7'), (1322, 14, 17, 'ab8'), (1323, 1, 30, 'abc0'), (1324, 8, 43, 'abc1'), (1325, 15, 56, 'abc2');
+INSERT INTO t VALUES (1326, 2, 69, 'b3'), (1327, 9, 82, 'b4'), (1328, 16, 95, 'b5'), (1329, 3, 11, 'x6'), (1330, 10, 24, 'x7'), (1331, 17, 37, 'x8'), (1332, 4, NULL, 'ab0'), (1333, NULL, 63, 'ab1'), (1334, 18, 76, 'ab2'), (1335, 5, 89, 'abc3'), (1336, 12, 5, 'abc4'), (1337, 19, 18, 'abc5'), (1338, 6, 31, 'b6'), (1339, 13, 44, 'b7'), (1340, 0, 57, 'b8'), (1341, 7, 70, 'x0'), (1342, 14, 83, 'x1'), (1343, 1, 96, 'x2'), (1344, 8, 12, 'ab3'), (1345, 15, 25, 'ab4'), (1346, 2, 38, 'ab5'), (1347, 9, 51, 'abc6'), (1348, 16, 64, 'abc7'), (1349, 3, 77, 'abc8'), (1350, 10, 90, 'b0');
+INSERT INTO t VALUES (1351, 17, 6, 'b1'), (1352, 4, 19, 'b2'), (1353, 11, 32, 'x3'), (1354, 18, 45, 'x4'), (1355, 5, 58, 'x5'), (1356, 12, 71, 'ab6'), (1357, 19, 84, 'ab7'), (1358, 6, 0, 'ab8'), (1359, 13, 13, 'abc0'), (1360, 0, 26, 'abc1'), (1361, 7, 39, 'abc2'), (1362, 14, 52, 'b3'), (1363, 1, 65, 'b4'), (1364, NULL, 78, 'b5'), (1365, 15, 91, 'x6'), (1366, 2, 7, 'x7'), (1367, 9, 20, 'x8'), (1368, 16, 33, 'ab0'), (1369, 3, NULL, 'ab1'), (1370, 10, 59, 'ab2'), (1371, 17, 72, 'abc3'), (1372, 4, 85, 'abc4'), (1373, 11, 1, 'abc5'), (1374, 18, 14, 'b6'), (1375, 5, 27, 'b7');
+INSERT INTO t VALUES (1376, 12, 40, 'b8'), (1377, 19, 53, 'x0'), (1378, 6, 66, 'x1'), (1379, 13, 79, 'x2'), (1380, 0, 92, 'ab3'), (1381, 7, 8, 'ab4'), (1382, 14, 21, 'ab5'), (1383, 1, 34, 'abc6'), (1384, 8, 47, 'abc7'), (1385, 15, 60, 'abc8'), (1386, 2, 73, 'b0'), (1387, 9, 86, 'b1'), (1388, 16, 2, 'b2'), (1389, 3, 15, 'x3'), (1390, 10, 28, 'x4'), (1391, 17, 41, 'x5'), (1392, 4, 54, 'ab6'), (1393, 11, 67, 'ab7'), (1394, 18, 80, 'ab8'), (1395, NULL, 93, 'abc0'), (1396, 12, 9, 'abc1'), (1397, 19, 22, 'abc2'), (1398, 6, 35, 'b3'), (1399, 13, 48, 'b4'), (1400, 0, 61, 'b5');
+INSERT INTO t VALUES (1401, 7, 74, 'x6'), (1402, 14, 87, 'x7'), (1403, 1, 3, 'x8'), (1404, 8, 16, 'ab0'), (1405, 15, 29, 'ab1'), (1406, 2, NULL, 'ab2'), (1407, 9, 55, 'abc3'), (1408, 16, 68, 'abc4'), (1409, 3, 81, 'abc5'), (1410, 10, 94, 'b6'), (1411, 17, 10, 'b7'), (1412, 4, 23, 'b8'), (1413, 11, 36, 'x0'), (1414, 18, 49, 'x1'), (1415, 5, 62, 'x2'), (1416, 12, 75, 'ab3'), (1417, 19, 88, 'ab4'), (1418, 6, 4, 'ab5'), (1419, 13, 17, 'abc6'), (1420, 0, 30, 'abc7'), (1421, 7, 43, 'abc8'), (1422, 14, 56, 'b0'), (1423, 1, 69, 'b1'), (1424, 8, 82, 'b2'), (1425, 15, 95, 'x3');
+INSERT INTO t VALUES (1426, NULL, 11, 'x4'), (1427, 9, 24, 'x5'), (1428, 16, 37, 'ab6'), (1429, 3, 50, 'ab7'), (1430, 10, 63, 'ab8'), (1431, 17, 76, 'abc0'), (1432, 4, 89, 'abc1'), (1433, 11, 5, 'abc2'), (1434, 18, 18, 'b3'), (1435, 5, 31, 'b4'), (1436, 12, 44, 'b5'), (1437, 19, 57, 'x6'), (1438, 6, 70, 'x7'), (1439, 13, 83, 'x8'), (1440, 0, 96, 'ab0'), (1441, 7, 12, 'ab1'), (1442, 14, 25, 'ab2'), (1443, 1, NULL, 'abc3'), (1444, 8, 51, 'abc4'), (1445, 15, 64, 'abc5'), (1446, 2, 77, 'b6'), (1447, 9, 90, 'b7'), (1448, 16, 6, 'b8'), (1449, 3, 19, 'x0'), (1450, 10, 32, 'x1');
+INSERT INTO t VALUES (1451, 17, 45, 'x2'), (1452, 4, 58, 'ab3'), (1453, 11, 71, 'ab4'), (1454, 18, 84, 'ab5'), (1455, 5, 0, 'abc6'), (1456, 12, 13, 'abc7'), (1457, NULL, 26, 'abc8'), (1458, 6, 39, 'b0'), (1459, 13, 52, 'b1'), (1460, 0, 65, 'b2'), (1461, 7, 78, 'x3'), (1462, 14, 91, 'x4'), (1463, 1, 7, 'x5'), (1464, 8, 20, 'ab6'), (1465, 15, 33, 'ab7'), (1466, 2, 46, 'ab8'), (1467, 9, 59, 'abc0'), (1468, 16, 72, 'abc1'), (1469, 3, 85, 'abc2'), (1470, 10, 1, 'b3'), (1471, 17, 14, 'b4'), (1472, 4, 27, 'b5'), (1473, 11, 40, 'x6'), (1474, 18, 53, 'x7'), (1475, 5, 66, 'x8');
+INSERT INTO t VALUES (1476, 12, 79, 'ab0'), (1477, 19, 92, 'ab1'), (1478, 6, 8, 'ab2'), (1479, 13, 21, 'abc3'), (1480, 0, NULL, 'abc4'), (1481, 7, 47, 'abc5'), (1482, 14, 60, 'b6'), (1483, 1, 73, 'b7'), (1484, 8, 86, 'b8'), (1485, 15, 2, 'x0'), (1486, 2, 15, 'x1'), (1487, 9, 28, 'x2'), (1488, NULL, 41, 'ab3'), (1489, 3, 54, 'ab4'), (1490, 10, 67, 'ab5'), (1491, 17, 80, 'abc6'), (1492, 4, 93, 'abc7'), (1493, 11, 9, 'abc8'), (1494, 18, 22, 'b0'), (1495, 5, 35, 'b1'), (1496, 12, 48, 'b2'), (1497, 19, 61, 'x3'), (1498, 6, 74, 'x4'), (1499, 13, 87, 'x5'), (1500, 0, 3, 'ab6');
+CREATE INDEX t("a, s");
+-- leading column fixed, a range on the next one
+SELECT id, a, b FROM t WHERE a = 3 AND b >= 40 AND b < 46 ORDER BY id;
+SELECT id, a, b FROM t WHERE b = 21 AND a = 3 ORDER BY id;
+SELECT id, a, b FROM t WHERE a = 3 AND b > 95 ORDER BY id;
+SELECT id, a, b FROM t WHERE a = 3 AND b <= 1 ORDER BY id;
+-- only the leading column
+SELECT NUM(id), SUM(b) FROM t WHERE a = 3;
+SELECT NUM(id), SUM(b) FROM t WHERE a = 19 AND id < 500;
+-- NULL key columns
+SELECT id, a, b FROM t WHERE a = NULL AND b = 30 ORDER BY id;
+SELECT id, a, b FROM t WHERE a = 4 AND b = NULL ORDER BY id;
+SELECT NUM(id) FROM t WHERE a = NULL;
+-- a LIKE prefix and an equality on the string column
+SELECT id, a, s FROM t WHERE a = 5 AND s LIKE 'ab%' ORDER BY id;
+SELECT id, a, s FROM t WHERE a = 5 AND s = 'abc3' ORDER BY id;
+-- a bound on the second column only is left to a scan
+SELECT id, a, b FROM t WHERE b = 77 AND id < 300 ORDER BY id;
+SELECT NUM(id) FROM t WHERE a = 7 OR b = 7;
+DELETE FROM t WHERE a = 3 AND b < 50;
+UPDATE t SET b = 45 WHERE a = 3 AND b > 90;
+UPDATE t SET a = 3 WHERE a = 4 AND b = 0;
+UPDATE t SET s = 'abz' WHERE a = 5 AND s = 'abc3';
+INSERT INTO t VALUES (1501, 3, 44, 'ab1'), (1502, NULL, 30, 'b2'), (1503, 5, NULL, 'abq');
+-- leading column fixed, a range on the next one
+SELECT id, a, b FROM t WHERE a = 3 AND b >= 40 AND b < 46 ORDER BY id;
+SELECT id, a, b FROM t WHERE b = 21 AND a = 3 ORDER BY id;
+SELECT id, a, b FROM t WHERE a = 3 AND b > 95 ORDER BY id;
+SELECT id, a, b FROM t WHERE a = 3 AND b <= 1 ORDER BY id;
+-- only the leading column
+SELECT NUM(id), SUM(b) FROM t WHERE a = 3;
+SELECT NUM(id), SUM(b) FROM t WHERE a = 19 AND id < 500;
+-- NULL key columns
+SELECT id, a, b FROM t WHERE a = NULL AND b = 30 ORDER BY id;
+SELECT id, a, b FROM t WHERE a = 4 AND b = NULL ORDER BY id;
+SELECT NUM(id) FROM t WHERE a = NULL;
+-- a LIKE prefix and an equality on the string column
+SELECT id, a, s FROM t WHERE a = 5 AND s LIKE 'ab%' ORDER BY id;
+SELECT id, a, s FROM t WHERE a = 5 AND s = 'abc3' ORDER BY id;
+-- a bound on the second column only is left to a scan
+SELECT id, a, b FROM t WHERE b = 77 AND id < 300 ORDER BY id;
+SELECT NUM(id) FROM t WHERE a = 7 OR b = 7;
+DROP INDEX t("a, b");
+-- leading column fixed, a range on the next one
+SELECT id, a, b FROM t WHERE a = 3 AND b >= 40 AND b < 46 ORDER BY id;
+SELECT id, a, b FROM t WHERE b = 21 AND a = 3 ORDER BY id;
+SELECT id, a, b FROM t WHERE a = 3 AND b > 95 ORDER BY id;
+SELECT id, a, b FROM t WHERE a = 3 AND b <= 1 ORDER BY id;
+-- only the leading column
+SELECT NUM(id), SUM(b) FROM t WHERE a = 3;
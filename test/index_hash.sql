@@ -0,0 +1,140 @@
+-- hash indexes, the primary key switched to one and back, see run_sql.sh
+CREATE DATABASE ih;
+USE DATABASE ih;
+CREATE TABLE t(id int(10) NOT NULL, a int(10), s varchar(10), PRIMARY KEY(id));
+CREATE INDEX t("id USING HASH");
+CREATE INDEX t("a USING HASH");
+-- a few rows, then enough for the table to split many times
+INSERT INTO t VALUES (3, 7, 'n1'), (6, 14, 'n2'), (9, 21, 'n3'), (12, 28, 'n4'), (15, 35, 'n5'), (18, 42, 'n6'), (21, 49, 'n7'), (24, 56, 'n8'), (27, 63, 'n9'), (30, 70, 'n10'), (33, 77, 'n11'), (36, 84, 'n12'), (39, 91, 'n13'), (42, 98, 'n14'), (45, 105, 'n15'), (48, 112, 'n16'), (51, 119, 'n0'), (54, 126, 'n1'), (57, 133, 'n2'), (60, 140, 'n3'), (63, 147, 'n4'), (66, 154, 'n5'), (69, NULL, 'n6'), (72, 168, 'n7'), (75, 175, 'n8');
+INSERT INTO t VALUES (78, 182, 'n9'), (81, 189, 'n10'), (84, 196, 'n11'), (87, 203, 'n12'), (90, 210, 'n13'), (93, 217, 'n14'), (96, 224, 'n15'), (99, 231, 'n16'), (102, 238, 'n0'), (105, 245, 'n1'), (108, 252, 'n2'), (111, 259, 'n3'), (114, 266, 'n4'), (117, 273, 'n5'), (120, 280, 'n6');
+SELECT id, a, s FROM t WHERE id = 30;
+SELECT id, a, s FROM t WHERE id = 31;
+SELECT id, a FROM t WHERE a = 70 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a = 299;
+SELECT NUM(id) FROM t WHERE a = NULL;
+SELECT id, a FROM t WHERE a = 7 AND id > 3000 ORDER BY id;
+-- ranges are left to a scan
+SELECT NUM(id), SUM(a) FROM t WHERE a < 10;
+SELECT NUM(id), SUM(a) FROM t WHERE id >= 600 AND id < 900;
+SELECT NUM(id), SUM(a) FROM t;
+INSERT INTO t VALUES (123, 287, 'n7'), (126, 294, 'n8'), (129, 1, 'n9'), (132, 8, 'n10'), (135, 15, 'n11'), (138, NULL, 'n12'), (141, 29, 'n13'), (144, 36, 'n14'), (147, 43, 'n15'), (150, 50, 'n16'), (153, 57, 'n0'), (156, 64, 'n1'), (159, 71, 'n2'), (162, 78, 'n3'), (165, 85, 'n4'), (168, 92, 'n5'), (171, 99, 'n6'), (174, 106, 'n7'), (177, 113, 'n8'), (180, 120, 'n9'), (183, 127, 'n10'), (186, 134, 'n11'), (189, 141, 'n12'), (192, 148, 'n13'), (195, 155, 'n14');
+INSERT INTO t VALUES (198, 162, 'n15'), (201, 169, 'n16'), (204, 176, 'n0'), (207, NULL, 'n1'), (210, 190, 'n2'), (213, 197, 'n3'), (216, 204, 'n4'), (219, 211, 'n5'), (222, 218, 'n6'), (225, 225, 'n7'), (228, 232, 'n8'), (231, 239, 'n9'), (234, 246, 'n10'), (237, 253, 'n11'), (240, 260, 'n12'), (243, 267, 'n13'), (246, 274, 'n14'), (249, 281, 'n15'), (252, 288, 'n16'), (255, 295, 'n0'), (258, 2, 'n1'), (261, 9, 'n2'), (264, 16, 'n3'), (267, 23, 'n4'), (270, 30, 'n5');
+INSERT INTO t VALUES (273, 37, 'n6'), (276, NULL, 'n7'), (279, 51, 'n8'), (282, 58, 'n9'), (285, 65, 'n10'), (288, 72, 'n11'), (291, 79, 'n12'), (294, 86, 'n13'), (297, 93, 'n14'), (300, 100, 'n15'), (303, 107, 'n16'), (306, 114, 'n0'), (309, 121, 'n1'), (312, 128, 'n2'), (315, 135, 'n3'), (318, 142, 'n4'), (321, 149, 'n5'), (324, 156, 'n6'), (327, 163, 'n7'), (330, 170, 'n8'), (333, 177, 'n9'), (336, 184, 'n10'), (339, 191, 'n11'), (342, 198, 'n12'), (345, NULL, 'n13');
+INSERT INTO t VALUES (348, 212, 'n14'), (351, 219, 'n15'), (354, 226, 'n16'), (357, 233, 'n0'), (360, 240, 'n1'), (363, 247, 'n2'), (366, 254, 'n3'), (369, 261, 'n4'), (372, 268, 'n5'), (375, 275, 'n6'), (378, 282, 'n7'), (381, 289, 'n8'), (384, 296, 'n9'), (387, 3, 'n10'), (390, 10, 'n11'), (393, 17, 'n12'), (396, 24, 'n13'), (399, 31, 'n14'), (402, 38, 'n15'), (405, 45, 'n16'), (408, 52, 'n0'), (411, 59, 'n1'), (414, NULL, 'n2'), (417, 73, 'n3'), (420, 80, 'n4');
+INSERT INTO t VALUES (423, 87, 'n5'), (426, 94, 'n6'), (429, 101, 'n7'), (432, 108, 'n8'), (435, 115, 'n9'), (438, 122, 'n10'), (441, 129, 'n11'), (444, 136, 'n12'), (447, 143, 'n13'), (450, 150, 'n14'), (453, 157, 'n15'), (456, 164, 'n16'), (459, 171, 'n0'), (462, 178, 'n1'), (465, 185, 'n2'), (468, 192, 'n3'), (471, 199, 'n4'), (474, 206, 'n5'), (477, 213, 'n6'), (480, 220, 'n7'), (483, NULL, 'n8'), (486, 234, 'n9'), (489, 241, 'n10'), (492, 248, 'n11'), (495, 255, 'n12');
+INSERT INTO t VALUES (498, 262, 'n13'), (501, 269, 'n14'), (504, 276, 'n15'), (507, 283, 'n16'), (510, 290, 'n0'), (513, 297, 'n1'), (516, 4, 'n2'), (519, 11, 'n3'), (522, 18, 'n4'), (525, 25, 'n5'), (528, 32, 'n6'), (531, 39, 'n7'), (534, 46, 'n8'), (537, 53, 'n9'), (540, 60, 'n10'), (543, 67, 'n11'), (546, 74, 'n12'), (549, 81, 'n13'), (552, NULL, 'n14'), (555, 95, 'n15'), (558, 102, 'n16'), (561, 109, 'n0'), (564, 116, 'n1'), (567, 123, 'n2'), (570, 130, 'n3');
+INSERT INTO t VALUES (573, 137, 'n4'), (576, 144, 'n5'), (579, 151, 'n6'), (582, 158, 'n7'), (585, 165, 'n8'), (588, 172, 'n9'), (591, 179, 'n10'), (594, 186, 'n11'), (597, 193, 'n12'), (600, 200, 'n13'), (603, 207, 'n14'), (606, 214, 'n15'), (609, 221, 'n16'), (612, 228, 'n0'), (615, 235, 'n1'), (618, 242, 'n2'), (621, NULL, 'n3'), (624, 256, 'n4'), (627, 263, 'n5'), (630, 270, 'n6'), (633, 277, 'n7'), (636, 284, 'n8'), (639, 291, 'n9'), (642, 298, 'n10'), (645, 5, 'n11');
+INSERT INTO t VALUES (648, 12, 'n12'), (651, 19, 'n13'), (654, 26, 'n14'), (657, 33, 'n15'), (660, 40, 'n16'), (663, 47, 'n0'), (666, 54, 'n1'), (669, 61, 'n2'), (672, 68, 'n3'), (675, 75, 'n4'), (678, 82, 'n5'), (681, 89, 'n6'), (684, 96, 'n7'), (687, 103, 'n8'), (690, NULL, 'n9'), (693, 117, 'n10'), (696, 124, 'n11'), (699, 131, 'n12'), (702, 138, 'n13'), (705, 145, 'n14'), (708, 152, 'n15'), (711, 159, 'n16'), (714, 166, 'n0'), (717, 173, 'n1'), (720, 180, 'n2');
+INSERT INTO t VALUES (723, 187, 'n3'), (726, 194, 'n4'), (729, 201, 'n5'), (732, 208, 'n6'), (735, 215, 'n7'), (738, 222, 'n8'), (741, 229, 'n9'), (744, 236, 'n10'), (747, 243, 'n11'), (750, 250, 'n12'), (753, 257, 'n13'), (756, 264, 'n14'), (759, NULL, 'n15'), (762, 278, 'n16'), (765, 285, 'n0'), (768, 292, 'n1'), (771, 299, 'n2'), (774, 6, 'n3'), (777, 13, 'n4'), (780, 20, 'n5'), (783, 27, 'n6'), (786, 34, 'n7'), (789, 41, 'n8'), (792, 48, 'n9'), (795, 55, 'n10');
+INSERT INTO t VALUES (798, 62, 'n11'), (801, 69, 'n12'), (804, 76, 'n13'), (807, 83, 'n14'), (810, 90, 'n15'), (813, 97, 'n16'), (816, 104, 'n0'), (819, 111, 'n1'), (822, 118, 'n2'), (825, 125, 'n3'), (828, NULL, 'n4'), (831, 139, 'n5'), (834, 146, 'n6'), (837, 153, 'n7'), (840, 160, 'n8'), (843, 167, 'n9'), (846, 174, 'n10'), (849, 181, 'n11'), (852, 188, 'n12'), (855, 195, 'n13'), (858, 202, 'n14'), (861, 209, 'n15'), (864, 216, 'n16'), (867, 223, 'n0'), (870, 230, 'n1');
+INSERT INTO t VALUES (873, 237, 'n2'), (876, 244, 'n3'), (879, 251, 'n4'), (882, 258, 'n5'), (885, 265, 'n6'), (888, 272, 'n7'), (891, 279, 'n8'), (894, 286, 'n9'), (897, NULL, 'n10'), (900, 0, 'n11'), (903, 7, 'n12'), (906, 14, 'n13'), (909, 21, 'n14'), (912, 28, 'n15'), (915, 35, 'n16'), (918, 42, 'n0'), (921, 49, 'n1'), (924, 56, 'n2'), (927, 63, 'n3'), (930, 70, 'n4'), (933, 77, 'n5'), (936, 84, 'n6'), (939, 91, 'n7'), (942, 98, 'n8'), (945, 105, 'n9');
+INSERT INTO t VALUES (948, 112, 'n10'), (951, 119, 'n11'), (954, 126, 'n12'), (957, 133, 'n13'), (960, 140, 'n14'), (963, 147, 'n15'), (966, NULL, 'n16'), (969, 161, 'n0'), (972, 168, 'n1'), (975, 175, 'n2'), (978, 182, 'n3'), (981, 189, 'n4'), (984, 196, 'n5'), (987, 203, 'n6'), (990, 210, 'n7'), (993, 217, 'n8'), (996, 224, 'n9'), (999, 231, 'n10'), (1002, 238, 'n11'), (1005, 245, 'n12'), (1008, 252, 'n13'), (1011, 259, 'n14'), (1014, 266, 'n15'), (1017, 273, 'n16'), (1020, 280, 'n0');
+INSERT INTO t VALUES (1023, 287, 'n1'), (1026, 294, 'n2'), (1029, 1, 'n3'), (1032, 8, 'n4'), (1035, NULL, 'n5'), (1038, 22, 'n6'), (1041, 29, 'n7'), (1044, 36, 'n8'), (1047, 43, 'n9'), (1050, 50, 'n10'), (1053, 57, 'n11'), (1056, 64, 'n12'), (1059, 71, 'n13'), (1062, 78, 'n14'), (1065, 85, 'n15'), (1068, 92, 'n16'), (1071, 99, 'n0'), (1074, 106, 'n1'), (1077, 113, 'n2'), (1080, 120, 'n3'), (1083, 127, 'n4'), (1086, 134, 'n5'), (1089, 141, 'n6'), (1092, 148, 'n7'), (1095, 155, 'n8');
+INSERT INTO t VALUES (1098, 162, 'n9'), (1101, 169, 'n10'), (1104, NULL, 'n11'), (1107, 183, 'n12'), (1110, 190, 'n13'), (1113, 197, 'n14'), (1116, 204, 'n15'), (1119, 211, 'n16'), (1122, 218, 'n0'), (1125, 225, 'n1'), (1128, 232, 'n2'), (1131, 239, 'n3'), (1134, 246, 'n4'), (1137, 253, 'n5'), (1140, 260, 'n6'), (1143, 267, 'n7'), (1146, 274, 'n8'), (1149, 281, 'n9'), (1152, 288, 'n10'), (1155, 295, 'n11'), (1158, 2, 'n12'), (1161, 9, 'n13'), (1164, 16, 'n14'), (1167, 23, 'n15'), (1170, 30, 'n16');
+INSERT INTO t VALUES (1173, NULL, 'n0'), (1176, 44, 'n1'), (1179, 51, 'n2'), (1182, 58, 'n3'), (1185, 65, 'n4'), (1188, 72, 'n5'), (1191, 79, 'n6'), (1194, 86, 'n7'), (1197, 93, 'n8'), (1200, 100, 'n9'), (1203, 107, 'n10'), (1206, 114, 'n11'), (1209, 121, 'n12'), (1212, 128, 'n13'), (1215, 135, 'n14'), (1218, 142, 'n15'), (1221, 149, 'n16'), (1224, 156, 'n0'), (1227, 163, 'n1'), (1230, 170, 'n2'), (1233, 177, 'n3'), (1236, 184, 'n4'), (1239, 191, 'n5'), (1242, NULL, 'n6'), (1245, 205, 'n7');
+INSERT INTO t VALUES (1248, 212, 'n8'), (1251, 219, 'n9'), (1254, 226, 'n10'), (1257, 233, 'n11'), (1260, 240, 'n12'), (1263, 247, 'n13'), (1266, 254, 'n14'), (1269, 261, 'n15'), (1272, 268, 'n16'), (1275, 275, 'n0'), (1278, 282, 'n1'), (1281, 289, 'n2'), (1284, 296, 'n3'), (1287, 3, 'n4'), (1290, 10, 'n5'), (1293, 17, 'n6'), (1296, 24, 'n7'), (1299, 31, 'n8'), (1302, 38, 'n9'), (1305, 45, 'n10'), (1308, 52, 'n11'), (1311, NULL, 'n12'), (1314, 66, 'n13'), (1317, 73, 'n14'), (1320, 80, 'n15');
+INSERT INTO t VALUES (1323, 87, 'n16'), (1326, 94, 'n0'), (1329, 101, 'n1'), (1332, 108, 'n2'), (1335, 115, 'n3'), (1338, 122, 'n4'), (1341, 129, 'n5'), (1344, 136, 'n6'), (1347, 143, 'n7'), (1350, 150, 'n8'), (1353, 157, 'n9'), (1356, 164, 'n10'), (1359, 171, 'n11'), (1362, 178, 'n12'), (1365, 185, 'n13'), (1368, 192, 'n14'), (1371, 199, 'n15'), (1374, 206, 'n16'), (1377, 213, 'n0'), (1380, NULL, 'n1'), (1383, 227, 'n2'), (1386, 234, 'n3'), (1389, 241, 'n4'), (1392, 248, 'n5'), (1395, 255, 'n6');
+INSERT INTO t VALUES (1398, 262, 'n7'), (1401, 269, 'n8'), (1404, 276, 'n9'), (1407, 283, 'n10'), (1410, 290, 'n11'), (1413, 297, 'n12'), (1416, 4, 'n13'), (1419, 11, 'n14'), (1422, 18, 'n15'), (1425, 25, 'n16'), (1428, 32, 'n0'), (1431, 39, 'n1'), (1434, 46, 'n2'), (1437, 53, 'n3'), (1440, 60, 'n4'), (1443, 67, 'n5'), (1446, 74, 'n6'), (1449, NULL, 'n7'), (1452, 88, 'n8'), (1455, 95, 'n9'), (1458, 102, 'n10'), (1461, 109, 'n11'), (1464, 116, 'n12'), (1467, 123, 'n13'), (1470, 130, 'n14');
+INSERT INTO t VALUES (1473, 137, 'n15'), (1476, 144, 'n16'), (1479, 151, 'n0'), (1482, 158, 'n1'), (1485, 165, 'n2'), (1488, 172, 'n3'), (1491, 179, 'n4'), (1494, 186, 'n5'), (1497, 193, 'n6'), (1500, 200, 'n7'), (1503, 207, 'n8'), (1506, 214, 'n9'), (1509, 221, 'n10'), (1512, 228, 'n11'), (1515, 235, 'n12'), (1518, NULL, 'n13'), (1521, 249, 'n14'), (1524, 256, 'n15'), (1527, 263, 'n16'), (1530, 270, 'n0'), (1533, 277, 'n1'), (1536, 284, 'n2'), (1539, 291, 'n3'), (1542, 298, 'n4'), (1545, 5, 'n5');
+INSERT INTO t VALUES (1548, 12, 'n6'), (1551, 19, 'n7'), (1554, 26, 'n8'), (1557, 33, 'n9'), (1560, 40, 'n10'), (1563, 47, 'n11'), (1566, 54, 'n12'), (1569, 61, 'n13'), (1572, 68, 'n14'), (1575, 75, 'n15'), (1578, 82, 'n16'), (1581, 89, 'n0'), (1584, 96, 'n1'), (1587, NULL, 'n2'), (1590, 110, 'n3'), (1593, 117, 'n4'), (1596, 124, 'n5'), (1599, 131, 'n6'), (1602, 138, 'n7'), (1605, 145, 'n8'), (1608, 152, 'n9'), (1611, 159, 'n10'), (1614, 166, 'n11'), (1617, 173, 'n12'), (1620, 180, 'n13');
+INSERT INTO t VALUES (1623, 187, 'n14'), (1626, 194, 'n15'), (1629, 201, 'n16'), (1632, 208, 'n0'), (1635, 215, 'n1'), (1638, 222, 'n2'), (1641, 229, 'n3'), (1644, 236, 'n4'), (1647, 243, 'n5'), (1650, 250, 'n6'), (1653, 257, 'n7'), (1656, NULL, 'n8'), (1659, 271, 'n9'), (1662, 278, 'n10'), (1665, 285, 'n11'), (1668, 292, 'n12'), (1671, 299, 'n13'), (1674, 6, 'n14'), (1677, 13, 'n15'), (1680, 20, 'n16'), (1683, 27, 'n0'), (1686, 34, 'n1'), (1689, 41, 'n2'), (1692, 48, 'n3'), (1695, 55, 'n4');
+INSERT INTO t VALUES (1698, 62, 'n5'), (1701, 69, 'n6'), (1704, 76, 'n7'), (1707, 83, 'n8'), (1710, 90, 'n9'), (1713, 97, 'n10'), (1716, 104, 'n11'), (1719, 111, 'n12'), (1722, 118, 'n13'), (1725, NULL, 'n14'), (1728, 132, 'n15'), (1731, 139, 'n16'), (1734, 146, 'n0'), (1737, 153, 'n1'), (1740, 160, 'n2'), (1743, 167, 'n3'), (1746, 174, 'n4'), (1749, 181, 'n5'), (1752, 188, 'n6'), (1755, 195, 'n7'), (1758, 202, 'n8'), (1761, 209, 'n9'), (1764, 216, 'n10'), (1767, 223, 'n11'), (1770, 230, 'n12');
+INSERT INTO t VALUES (1773, 237, 'n13'), (1776, 244, 'n14'), (1779, 251, 'n15'), (1782, 258, 'n16'), (1785, 265, 'n0'), (1788, 272, 'n1'), (1791, 279, 'n2'), (1794, NULL, 'n3'), (1797, 293, 'n4'), (1800, 0, 'n5'), (1803, 7, 'n6'), (1806, 14, 'n7'), (1809, 21, 'n8'), (1812, 28, 'n9'), (1815, 35, 'n10'), (1818, 42, 'n11'), (1821, 49, 'n12'), (1824, 56, 'n13'), (1827, 63, 'n14'), (1830, 70, 'n15'), (1833, 77, 'n16'), (1836, 84, 'n0'), (1839, 91, 'n1'), (1842, 98, 'n2'), (1845, 105, 'n3');
+INSERT INTO t VALUES (1848, 112, 'n4'), (1851, 119, 'n5'), (1854, 126, 'n6'), (1857, 133, 'n7'), (1860, 140, 'n8'), (1863, NULL, 'n9'), (1866, 154, 'n10'), (1869, 161, 'n11'), (1872, 168, 'n12'), (1875, 175, 'n13'), (1878, 182, 'n14'), (1881, 189, 'n15'), (1884, 196, 'n16'), (1887, 203, 'n0'), (1890, 210, 'n1'), (1893, 217, 'n2'), (1896, 224, 'n3'), (1899, 231, 'n4'), (1902, 238, 'n5'), (1905, 245, 'n6'), (1908, 252, 'n7'), (1911, 259, 'n8'), (1914, 266, 'n9'), (1917, 273, 'n10'), (1920, 280, 'n11');
+INSERT INTO t VALUES (1923, 287, 'n12'), (1926, 294, 'n13'), (1929, 1, 'n14'), (1932, NULL, 'n15'), (1935, 15, 'n16'), (1938, 22, 'n0'), (1941, 29, 'n1'), (1944, 36, 'n2'), (1947, 43, 'n3'), (1950, 50, 'n4'), (1953, 57, 'n5'), (1956, 64, 'n6'), (1959, 71, 'n7'), (1962, 78, 'n8'), (1965, 85, 'n9'), (1968, 92, 'n10'), (1971, 99, 'n11'), (1974, 106, 'n12'), (1977, 113, 'n13'), (1980, 120, 'n14'), (1983, 127, 'n15'), (1986, 134, 'n16'), (1989, 141, 'n0'), (1992, 148, 'n1'), (1995, 155, 'n2');
+INSERT INTO t VALUES (1998, 162, 'n3'), (2001, NULL, 'n4'), (2004, 176, 'n5'), (2007, 183, 'n6'), (2010, 190, 'n7'), (2013, 197, 'n8'), (2016, 204, 'n9'), (2019, 211, 'n10'), (2022, 218, 'n11'), (2025, 225, 'n12'), (2028, 232, 'n13'), (2031, 239, 'n14'), (2034, 246, 'n15'), (2037, 253, 'n16'), (2040, 260, 'n0'), (2043, 267, 'n1'), (2046, 274, 'n2'), (2049, 281, 'n3'), (2052, 288, 'n4'), (2055, 295, 'n5'), (2058, 2, 'n6'), (2061, 9, 'n7'), (2064, 16, 'n8'), (2067, 23, 'n9'), (2070, NULL, 'n10');
+INSERT INTO t VALUES (2073, 37, 'n11'), (2076, 44, 'n12'), (2079, 51, 'n13'), (2082, 58, 'n14'), (2085, 65, 'n15'), (2088, 72, 'n16'), (2091, 79, 'n0'), (2094, 86, 'n1'), (2097, 93, 'n2'), (2100, 100, 'n3'), (2103, 107, 'n4'), (2106, 114, 'n5'), (2109, 121, 'n6'), (2112, 128, 'n7'), (2115, 135, 'n8'), (2118, 142, 'n9'), (2121, 149, 'n10'), (2124, 156, 'n11'), (2127, 163, 'n12'), (2130, 170, 'n13'), (2133, 177, 'n14'), (2136, 184, 'n15'), (2139, NULL, 'n16'), (2142, 198, 'n0'), (2145, 205, 'n1');
+INSERT INTO t VALUES (2148, 212, 'n2'), (2151, 219, 'n3'), (2154, 226, 'n4'), (2157, 233, 'n5'), (2160, 240, 'n6'), (2163, 247, 'n7'), (2166, 254, 'n8'), (2169, 261, 'n9'), (2172, 268, 'n10'), (2175, 275, 'n11'), (2178, 282, 'n12'), (2181, 289, 'n13'), (2184, 296, 'n14'), (2187, 3, 'n15'), (2190, 10, 'n16'), (2193, 17, 'n0'), (2196, 24, 'n1'), (2199, 31, 'n2'), (2202, 38, 'n3'), (2205, 45, 'n4'), (2208, NULL, 'n5'), (2211, 59, 'n6'), (2214, 66, 'n7'), (2217, 73, 'n8'), (2220, 80, 'n9');
+INSERT INTO t VALUES (2223, 87, 'n10'), (2226, 94, 'n11'), (2229, 101, 'n12'), (2232, 108, 'n13'), (2235, 115, 'n14'), (2238, 122, 'n15'), (2241, 129, 'n16'), (2244, 136, 'n0'), (2247, 143, 'n1'), (2250, 150, 'n2'), (2253, 157, 'n3'), (2256, 164, 'n4'), (2259, 171, 'n5'), (2262, 178, 'n6'), (2265, 185, 'n7'), (2268, 192, 'n8'), (2271, 199, 'n9'), (2274, 206, 'n10'), (2277, NULL, 'n11'), (2280, 220, 'n12'), (2283, 227, 'n13'), (2286, 234, 'n14'), (2289, 241, 'n15'), (2292, 248, 'n16'), (2295, 255, 'n0');
+INSERT INTO t VALUES (2298, 262, 'n1'), (2301, 269, 'n2'), (2304, 276, 'n3'), (2307, 283, 'n4'), (2310, 290, 'n5'), (2313, 297, 'n6'), (2316, 4, 'n7'), (2319, 11, 'n8'), (2322, 18, 'n9'), (2325, 25, 'n10'), (2328, 32, 'n11'), (2331, 39, 'n12'), (2334, 46, 'n13'), (2337, 53, 'n14'), (2340, 60, 'n15'), (2343, 67, 'n16'), (2346, NULL, 'n0'), (2349, 81, 'n1'), (2352, 88, 'n2'), (2355, 95, 'n3'), (2358, 102, 'n4'), (2361, 109, 'n5'), (2364, 116, 'n6'), (2367, 123, 'n7'), (2370, 130, 'n8');
+INSERT INTO t VALUES (2373, 137, 'n9'), (2376, 144, 'n10'), (2379, 151, 'n11'), (2382, 158, 'n12'), (2385, 165, 'n13'), (2388, 172, 'n14'), (2391, 179, 'n15'), (2394, 186, 'n16'), (2397, 193, 'n0'), (2400, 200, 'n1'), (2403, 207, 'n2'), (2406, 214, 'n3'), (2409, 221, 'n4'), (2412, 228, 'n5'), (2415, NULL, 'n6'), (2418, 242, 'n7'), (2421, 249, 'n8'), (2424, 256, 'n9'), (2427, 263, 'n10'), (2430, 270, 'n11'), (2433, 277, 'n12'), (2436, 284, 'n13'), (2439, 291, 'n14'), (2442, 298, 'n15'), (2445, 5, 'n16');
+INSERT INTO t VALUES (2448, 12, 'n0'), (2451, 19, 'n1'), (2454, 26, 'n2'), (2457, 33, 'n3'), (2460, 40, 'n4'), (2463, 47, 'n5'), (2466, 54, 'n6'), (2469, 61, 'n7'), (2472, 68, 'n8'), (2475, 75, 'n9'), (2478, 82, 'n10'), (2481, 89, 'n11'), (2484, NULL, 'n12'), (2487, 103, 'n13'), (2490, 110, 'n14'), (2493, 117, 'n15'), (2496, 124, 'n16'), (2499, 131, 'n0'), (2502, 138, 'n1'), (2505, 145, 'n2'), (2508, 152, 'n3'), (2511, 159, 'n4'), (2514, 166, 'n5'), (2517, 173, 'n6'), (2520, 180, 'n7');
+INSERT INTO t VALUES (2523, 187, 'n8'), (2526, 194, 'n9'), (2529, 201, 'n10'), (2532, 208, 'n11'), (2535, 215, 'n12'), (2538, 222, 'n13'), (2541, 229, 'n14'), (2544, 236, 'n15'), (2547, 243, 'n16'), (2550, 250, 'n0'), (2553, NULL, 'n1'), (2556, 264, 'n2'), (2559, 271, 'n3'), (2562, 278, 'n4'), (2565, 285, 'n5'), (2568, 292, 'n6'), (2571, 299, 'n7'), (2574, 6, 'n8'), (2577, 13, 'n9'), (2580, 20, 'n10'), (2583, 27, 'n11'), (2586, 34, 'n12'), (2589, 41, 'n13'), (2592, 48, 'n14'), (2595, 55, 'n15');
+INSERT INTO t VALUES (2598, 62, 'n16'), (2601, 69, 'n0'), (2604, 76, 'n1'), (2607, 83, 'n2'), (2610, 90, 'n3'), (2613, 97, 'n4'), (2616, 104, 'n5'), (2619, 111, 'n6'), (2622, NULL, 'n7'), (2625, 125, 'n8'), (2628, 132, 'n9'), (2631, 139, 'n10'), (2634, 146, 'n11'), (2637, 153, 'n12'), (2640, 160, 'n13'), (2643, 167, 'n14'), (2646, 174, 'n15'), (2649, 181, 'n16'), (2652, 188, 'n0'), (2655, 195, 'n1'), (2658, 202, 'n2'), (2661, 209, 'n3'), (2664, 216, 'n4'), (2667, 223, 'n5'), (2670, 230, 'n6');
+INSERT INTO t VALUES (2673, 237, 'n7'), (2676, 244, 'n8'), (2679, 251, 'n9'), (2682, 258, 'n10'), (2685, 265, 'n11'), (2688, 272, 'n12'), (2691, NULL, 'n13'), (2694, 286, 'n14'), (2697, 293, 'n15'), (2700, 0, 'n16'), (2703, 7, 'n0'), (2706, 14, 'n1'), (2709, 21, 'n2'), (2712, 28, 'n3'), (2715, 35, 'n4'), (2718, 42, 'n5'), (2721, 49, 'n6'), (2724, 56, 'n7'), (2727, 63, 'n8'), (2730, 70, 'n9'), (2733, 77, 'n10'), (2736, 84, 'n11'), (2739, 91, 'n12'), (2742, 98, 'n13'), (2745, 105, 'n14');
+INSERT INTO t VALUES (2748, 112, 'n15'), (2751, 119, 'n16'), (2754, 126, 'n0'), (2757, 133, 'n1'), (2760, NULL, 'n2'), (2763, 147, 'n3'), (2766, 154, 'n4'), (2769, 161, 'n5'), (2772, 168, 'n6'), (2775, 175, 'n7'), (2778, 182, 'n8'), (2781, 189, 'n9'), (2784, 196, 'n10'), (2787, 203, 'n11'), (2790, 210, 'n12'), (2793, 217, 'n13'), (2796, 224, 'n14'), (2799, 231, 'n15'), (2802, 238, 'n16'), (2805, 245, 'n0'), (2808, 252, 'n1'), (2811, 259, 'n2'), (2814, 266, 'n3'), (2817, 273, 'n4'), (2820, 280, 'n5');
+INSERT INTO t VALUES (2823, 287, 'n6'), (2826, 294, 'n7'), (2829, NULL, 'n8'), (2832, 8, 'n9'), (2835, 15, 'n10'), (2838, 22, 'n11'), (2841, 29, 'n12'), (2844, 36, 'n13'), (2847, 43, 'n14'), (2850, 50, 'n15'), (2853, 57, 'n16'), (2856, 64, 'n0'), (2859, 71, 'n1'), (2862, 78, 'n2'), (2865, 85, 'n3'), (2868, 92, 'n4'), (2871, 99, 'n5'), (2874, 106, 'n6'), (2877, 113, 'n7'), (2880, 120, 'n8'), (2883, 127, 'n9'), (2886, 134, 'n10'), (2889, 141, 'n11'), (2892, 148, 'n12'), (2895, 155, 'n13');
+INSERT INTO t VALUES (2898, NULL, 'n14'), (2901, 169, 'n15'), (2904, 176, 'n16'), (2907, 183, 'n0'), (2910, 190, 'n1'), (2913, 197, 'n2'), (2916, 204, 'n3'), (2919, 211, 'n4'), (2922, 218, 'n5'), (2925, 225, 'n6'), (2928, 232, 'n7'), (2931, 239, 'n8'), (2934, 246, 'n9'), (2937, 253, 'n10'), (2940, 260, 'n11'), (2943, 267, 'n12'), (2946, 274, 'n13'), (2949, 281, 'n14'), (2952, 288, 'n15'), (2955, 295, 'n16'), (2958, 2, 'n0'), (2961, 9, 'n1'), (2964, 16, 'n2'), (2967, NULL, 'n3'), (2970, 30, 'n4');
+INSERT INTO t VALUES (2973, 37, 'n5'), (2976, 44, 'n6'), (2979, 51, 'n7'), (2982, 58, 'n8'), (2985, 65, 'n9'), (2988, 72, 'n10'), (2991, 79, 'n11'), (2994, 86, 'n12'), (2997, 93, 'n13'), (3000, 100, 'n14'), (3003, 107, 'n15'), (3006, 114, 'n16'), (3009, 121, 'n0'), (3012, 128, 'n1'), (3015, 135, 'n2'), (3018, 142, 'n3'), (3021, 149, 'n4'), (3024, 156, 'n5'), (3027, 163, 'n6'), (3030, 170, 'n7'), (3033, 177, 'n8'), (3036, NULL, 'n9'), (3039, 191, 'n10'), (3042, 198, 'n11'), (3045, 205, 'n12');
+INSERT INTO t VALUES (3048, 212, 'n13'), (3051, 219, 'n14'), (3054, 226, 'n15'), (3057, 233, 'n16'), (3060, 240, 'n0'), (3063, 247, 'n1'), (3066, 254, 'n2'), (3069, 261, 'n3'), (3072, 268, 'n4'), (3075, 275, 'n5'), (3078, 282, 'n6'), (3081, 289, 'n7'), (3084, 296, 'n8'), (3087, 3, 'n9'), (3090, 10, 'n10'), (3093, 17, 'n11'), (3096, 24, 'n12'), (3099, 31, 'n13'), (3102, 38, 'n14'), (3105, NULL, 'n15'), (3108, 52, 'n16'), (3111, 59, 'n0'), (3114, 66, 'n1'), (3117, 73, 'n2'), (3120, 80, 'n3');
+INSERT INTO t VALUES (3123, 87, 'n4'), (3126, 94, 'n5'), (3129, 101, 'n6'), (3132, 108, 'n7'), (3135, 115, 'n8'), (3138, 122, 'n9'), (3141, 129, 'n10'), (3144, 136, 'n11'), (3147, 143, 'n12'), (3150, 150, 'n13'), (3153, 157, 'n14'), (3156, 164, 'n15'), (3159, 171, 'n16'), (3162, 178, 'n0'), (3165, 185, 'n1'), (3168, 192, 'n2'), (3171, 199, 'n3'), (3174, NULL, 'n4'), (3177, 213, 'n5'), (3180, 220, 'n6'), (3183, 227, 'n7'), (3186, 234, 'n8'), (3189, 241, 'n9'), (3192, 248, 'n10'), (3195, 255, 'n11');
+INSERT INTO t VALUES (3198, 262, 'n12'), (3201, 269, 'n13'), (3204, 276, 'n14'), (3207, 283, 'n15'), (3210, 290, 'n16'), (3213, 297, 'n0'), (3216, 4, 'n1'), (3219, 11, 'n2'), (3222, 18, 'n3'), (3225, 25, 'n4'), (3228, 32, 'n5'), (3231, 39, 'n6'), (3234, 46, 'n7'), (3237, 53, 'n8'), (3240, 60, 'n9'), (3243, NULL, 'n10'), (3246, 74, 'n11'), (3249, 81, 'n12'), (3252, 88, 'n13'), (3255, 95, 'n14'), (3258, 102, 'n15'), (3261, 109, 'n16'), (3264, 116, 'n0'), (3267, 123, 'n1'), (3270, 130, 'n2');
+INSERT INTO t VALUES (3273, 137, 'n3'), (3276, 144, 'n4'), (3279, 151, 'n5'), (3282, 158, 'n6'), (3285, 165, 'n7'), (3288, 172, 'n8'), (3291, 179, 'n9'), (3294, 186, 'n10'), (3297, 193, 'n11'), (3300, 200, 'n12'), (3303, 207, 'n13'), (3306, 214, 'n14'), (3309, 221, 'n15'), (3312, NULL, 'n16'), (3315, 235, 'n0'), (3318, 242, 'n1'), (3321, 249, 'n2'), (3324, 256, 'n3'), (3327, 263, 'n4'), (3330, 270, 'n5'), (3333, 277, 'n6'), (3336, 284, 'n7'), (3339, 291, 'n8'), (3342, 298, 'n9'), (3345, 5, 'n10');
+INSERT INTO t VALUES (3348, 12, 'n11'), (3351, 19, 'n12'), (3354, 26, 'n13'), (3357, 33, 'n14'), (3360, 40, 'n15'), (3363, 47, 'n16'), (3366, 54, 'n0'), (3369, 61, 'n1'), (3372, 68, 'n2'), (3375, 75, 'n3'), (3378, 82, 'n4'), (3381, NULL, 'n5'), (3384, 96, 'n6'), (3387, 103, 'n7'), (3390, 110, 'n8'), (3393, 117, 'n9'), (3396, 124, 'n10'), (3399, 131, 'n11'), (3402, 138, 'n12'), (3405, 145, 'n13'), (3408, 152, 'n14'), (3411, 159, 'n15'), (3414, 166, 'n16'), (3417, 173, 'n0'), (3420, 180, 'n1');
+INSERT INTO t VALUES (3423, 187, 'n2'), (3426, 194, 'n3'), (3429, 201, 'n4'), (3432, 208, 'n5'), (3435, 215, 'n6'), (3438, 222, 'n7'), (3441, 229, 'n8'), (3444, 236, 'n9'), (3447, 243, 'n10'), (3450, NULL, 'n11'), (3453, 257, 'n12'), (3456, 264, 'n13'), (3459, 271, 'n14'), (3462, 278, 'n15'), (3465, 285, 'n16'), (3468, 292, 'n0'), (3471, 299, 'n1'), (3474, 6, 'n2'), (3477, 13, 'n3'), (3480, 20, 'n4'), (3483, 27, 'n5'), (3486, 34, 'n6'), (3489, 41, 'n7'), (3492, 48, 'n8'), (3495, 55, 'n9');
+INSERT INTO t VALUES (3498, 62, 'n10'), (3501, 69, 'n11'), (3504, 76, 'n12'), (3507, 83, 'n13'), (3510, 90, 'n14'), (3513, 97, 'n15'), (3516, 104, 'n16'), (3519, NULL, 'n0'), (3522, 118, 'n1'), (3525, 125, 'n2'), (3528, 132, 'n3'), (3531, 139, 'n4'), (3534, 146, 'n5'), (3537, 153, 'n6'), (3540, 160, 'n7'), (3543, 167, 'n8'), (3546, 174, 'n9'), (3549, 181, 'n10'), (3552, 188, 'n11'), (3555, 195, 'n12'), (3558, 202, 'n13'), (3561, 209, 'n14'), (3564, 216, 'n15'), (3567, 223, 'n16'), (3570, 230, 'n0');
+INSERT INTO t VALUES (3573, 237, 'n1'), (3576, 244, 'n2'), (3579, 251, 'n3'), (3582, 258, 'n4'), (3585, 265, 'n5'), (3588, NULL, 'n6'), (3591, 279, 'n7'), (3594, 286, 'n8'), (3597, 293, 'n9'), (3600, 0, 'n10'), (3603, 7, 'n11'), (3606, 14, 'n12'), (3609, 21, 'n13'), (3612, 28, 'n14'), (3615, 35, 'n15'), (3618, 42, 'n16'), (3621, 49, 'n0'), (3624, 56, 'n1'), (3627, 63, 'n2'), (3630, 70, 'n3'), (3633, 77, 'n4'), (3636, 84, 'n5'), (3639, 91, 'n6'), (3642, 98, 'n7'), (3645, 105, 'n8');
+INSERT INTO t VALUES (3648, 112, 'n9'), (3651, 119, 'n10'), (3654, 126, 'n11'), (3657, NULL, 'n12'), (3660, 140, 'n13'), (3663, 147, 'n14'), (3666, 154, 'n15'), (3669, 161, 'n16'), (3672, 168, 'n0'), (3675, 175, 'n1'), (3678, 182, 'n2'), (3681, 189, 'n3'), (3684, 196, 'n4'), (3687, 203, 'n5'), (3690, 210, 'n6'), (3693, 217, 'n7'), (3696, 224, 'n8'), (3699, 231, 'n9'), (3702, 238, 'n10'), (3705, 245, 'n11'), (3708, 252, 'n12'), (3711, 259, 'n13'), (3714, 266, 'n14'), (3717, 273, 'n15'), (3720, 280, 'n16');
+INSERT INTO t VALUES (3723, 287, 'n0'), (3726, NULL, 'n1'), (3729, 1, 'n2'), (3732, 8, 'n3'), (3735, 15, 'n4'), (3738, 22, 'n5'), (3741, 29, 'n6'), (3744, 36, 'n7'), (3747, 43, 'n8'), (3750, 50, 'n9'), (3753, 57, 'n10'), (3756, 64, 'n11'), (3759, 71, 'n12'), (3762, 78, 'n13'), (3765, 85, 'n14'), (3768, 92, 'n15'), (3771, 99, 'n16'), (3774, 106, 'n0'), (3777, 113, 'n1'), (3780, 120, 'n2'), (3783, 127, 'n3'), (3786, 134, 'n4'), (3789, 141, 'n5'), (3792, 148, 'n6'), (3795, NULL, 'n7');
+INSERT INTO t VALUES (3798, 162, 'n8'), (3801, 169, 'n9'), (3804, 176, 'n10'), (3807, 183, 'n11'), (3810, 190, 'n12'), (3813, 197, 'n13'), (3816, 204, 'n14'), (3819, 211, 'n15'), (3822, 218, 'n16'), (3825, 225, 'n0'), (3828, 232, 'n1'), (3831, 239, 'n2'), (3834, 246, 'n3'), (3837, 253, 'n4'), (3840, 260, 'n5'), (3843, 267, 'n6'), (3846, 274, 'n7'), (3849, 281, 'n8'), (3852, 288, 'n9'), (3855, 295, 'n10'), (3858, 2, 'n11'), (3861, 9, 'n12'), (3864, NULL, 'n13'), (3867, 23, 'n14'), (3870, 30, 'n15');
+INSERT INTO t VALUES (3873, 37, 'n16'), (3876, 44, 'n0'), (3879, 51, 'n1'), (3882, 58, 'n2'), (3885, 65, 'n3'), (3888, 72, 'n4'), (3891, 79, 'n5'), (3894, 86, 'n6'), (3897, 93, 'n7'), (3900, 100, 'n8'), (3903, 107, 'n9'), (3906, 114, 'n10'), (3909, 121, 'n11'), (3912, 128, 'n12'), (3915, 135, 'n13'), (3918, 142, 'n14'), (3921, 149, 'n15'), (3924, 156, 'n16'), (3927, 163, 'n0'), (3930, 170, 'n1'), (3933, NULL, 'n2'), (3936, 184, 'n3'), (3939, 191, 'n4'), (3942, 198, 'n5'), (3945, 205, 'n6');
+INSERT INTO t VALUES (3948, 212, 'n7'), (3951, 219, 'n8'), (3954, 226, 'n9'), (3957, 233, 'n10'), (3960, 240, 'n11'), (3963, 247, 'n12'), (3966, 254, 'n13'), (3969, 261, 'n14'), (3972, 268, 'n15'), (3975, 275, 'n16'), (3978, 282, 'n0'), (3981, 289, 'n1'), (3984, 296, 'n2'), (3987, 3, 'n3'), (3990, 10, 'n4'), (3993, 17, 'n5'), (3996, 24, 'n6'), (3999, 31, 'n7'), (4002, NULL, 'n8'), (4005, 45, 'n9'), (4008, 52, 'n10'), (4011, 59, 'n11'), (4014, 66, 'n12'), (4017, 73, 'n13'), (4020, 80, 'n14');
+INSERT INTO t VALUES (4023, 87, 'n15'), (4026, 94, 'n16'), (4029, 101, 'n0'), (4032, 108, 'n1'), (4035, 115, 'n2'), (4038, 122, 'n3'), (4041, 129, 'n4'), (4044, 136, 'n5'), (4047, 143, 'n6'), (4050, 150, 'n7'), (4053, 157, 'n8'), (4056, 164, 'n9'), (4059, 171, 'n10'), (4062, 178, 'n11'), (4065, 185, 'n12'), (4068, 192, 'n13'), (4071, NULL, 'n14'), (4074, 206, 'n15'), (4077, 213, 'n16'), (4080, 220, 'n0'), (4083, 227, 'n1'), (4086, 234, 'n2'), (4089, 241, 'n3'), (4092, 248, 'n4'), (4095, 255, 'n5');
+INSERT INTO t VALUES (4098, 262, 'n6'), (4101, 269, 'n7'), (4104, 276, 'n8'), (4107, 283, 'n9'), (4110, 290, 'n10'), (4113, 297, 'n11'), (4116, 4, 'n12'), (4119, 11, 'n13'), (4122, 18, 'n14'), (4125, 25, 'n15'), (4128, 32, 'n16'), (4131, 39, 'n0'), (4134, 46, 'n1'), (4137, 53, 'n2'), (4140, NULL, 'n3'), (4143, 67, 'n4'), (4146, 74, 'n5'), (4149, 81, 'n6'), (4152, 88, 'n7'), (4155, 95, 'n8'), (4158, 102, 'n9'), (4161, 109, 'n10'), (4164, 116, 'n11'), (4167, 123, 'n12'), (4170, 130, 'n13');
+INSERT INTO t VALUES (4173, 137, 'n14'), (4176, 144, 'n15'), (4179, 151, 'n16'), (4182, 158, 'n0'), (4185, 165, 'n1'), (4188, 172, 'n2'), (4191, 179, 'n3'), (4194, 186, 'n4'), (4197, 193, 'n5'), (4200, 200, 'n6'), (4203, 207, 'n7'), (4206, 214, 'n8'), (4209, NULL, 'n9'), (4212, 228, 'n10'), (4215, 235, 'n11'), (4218, 242, 'n12'), (4221, 249, 'n13'), (4224, 256, 'n14'), (4227, 263, 'n15'), (4230, 270, 'n16'), (4233, 277, 'n0'), (4236, 284, 'n1'), (4239, 291, 'n2'), (4242, 298, 'n3'), (4245, 5, 'n4');
+INSERT INTO t VALUES (4248, 12, 'n5'), (4251, 19, 'n6'), (4254, 26, 'n7'), (4257, 33, 'n8'), (4260, 40, 'n9'), (4263, 47, 'n10'), (4266, 54, 'n11'), (4269, 61, 'n12'), (4272, 68, 'n13'), (4275, 75, 'n14'), (4278, NULL, 'n15'), (4281, 89, 'n16'), (4284, 96, 'n0'), (4287, 103, 'n1'), (4290, 110, 'n2'), (4293, 117, 'n3'), (4296, 124, 'n4'), (4299, 131, 'n5'), (4302, 138, 'n6'), (4305, 145, 'n7'), (4308, 152, 'n8'), (4311, 159, 'n9'), (4314, 166, 'n10'), (4317, 173, 'n11'), (4320, 180, 'n12');
+INSERT INTO t VALUES (4323, 187, 'n13'), (4326, 194, 'n14'), (4329, 201, 'n15'), (4332, 208, 'n16'), (4335, 215, 'n0'), (4338, 222, 'n1'), (4341, 229, 'n2'), (4344, 236, 'n3'), (4347, NULL, 'n4'), (4350, 250, 'n5'), (4353, 257, 'n6'), (4356, 264, 'n7'), (4359, 271, 'n8'), (4362, 278, 'n9'), (4365, 285, 'n10'), (4368, 292, 'n11'), (4371, 299, 'n12'), (4374, 6, 'n13'), (4377, 13, 'n14'), (4380, 20, 'n15'), (4383, 27, 'n16'), (4386, 34, 'n0'), (4389, 41, 'n1'), (4392, 48, 'n2'), (4395, 55, 'n3');
+INSERT INTO t VALUES (4398, 62, 'n4'), (4401, 69, 'n5'), (4404, 76, 'n6'), (4407, 83, 'n7'), (4410, 90, 'n8'), (4413, 97, 'n9'), (4416, NULL, 'n10'), (4419, 111, 'n11'), (4422, 118, 'n12'), (4425, 125, 'n13'), (4428, 132, 'n14'), (4431, 139, 'n15'), (4434, 146, 'n16'), (4437, 153, 'n0'), (4440, 160, 'n1'), (4443, 167, 'n2'), (4446, 174, 'n3'), (4449, 181, 'n4'), (4452, 188, 'n5'), (4455, 195, 'n6'), (4458, 202, 'n7'), (4461, 209, 'n8'), (4464, 216, 'n9'), (4467, 223, 'n10'), (4470, 230, 'n11');
+INSERT INTO t VALUES (4473, 237, 'n12'), (4476, 244, 'n13'), (4479, 251, 'n14'), (4482, 258, 'n15'), (4485, NULL, 'n16'), (4488, 272, 'n0'), (4491, 279, 'n1'), (4494, 286, 'n2'), (4497, 293, 'n3'), (4500, 0, 'n4'), (4503, 7, 'n5'), (4506, 14, 'n6'), (4509, 21, 'n7'), (4512, 28, 'n8'), (4515, 35, 'n9'), (4518, 42, 'n10'), (4521, 49, 'n11'), (4524, 56, 'n12'), (4527, 63, 'n13'), (4530, 70, 'n14'), (4533, 77, 'n15'), (4536, 84, 'n16'), (4539, 91, 'n0'), (4542, 98, 'n1'), (4545, 105, 'n2');
+INSERT INTO t VALUES (4548, 112, 'n3'), (4551, 119, 'n4'), (4554, NULL, 'n5'), (4557, 133, 'n6'), (4560, 140, 'n7'), (4563, 147, 'n8'), (4566, 154, 'n9'), (4569, 161, 'n10'), (4572, 168, 'n11'), (4575, 175, 'n12'), (4578, 182, 'n13'), (4581, 189, 'n14'), (4584, 196, 'n15'), (4587, 203, 'n16'), (4590, 210, 'n0'), (4593, 217, 'n1'), (4596, 224, 'n2'), (4599, 231, 'n3'), (4602, 238, 'n4'), (4605, 245, 'n5'), (4608, 252, 'n6'), (4611, 259, 'n7'), (4614, 266, 'n8'), (4617, 273, 'n9'), (4620, 280, 'n10');
+INSERT INTO t VALUES (4623, NULL, 'n11'), (4626, 294, 'n12'), (4629, 1, 'n13'), (4632, 8, 'n14'), (4635, 15, 'n15'), (4638, 22, 'n16'), (4641, 29, 'n0'), (4644, 36, 'n1'), (4647, 43, 'n2'), (4650, 50, 'n3'), (4653, 57, 'n4'), (4656, 64, 'n5'), (4659, 71, 'n6'), (4662, 78, 'n7'), (4665, 85, 'n8'), (4668, 92, 'n9'), (4671, 99, 'n10'), (4674, 106, 'n11'), (4677, 113, 'n12'), (4680, 120, 'n13'), (4683, 127, 'n14'), (4686, 134, 'n15'), (4689, 141, 'n16'), (4692, NULL, 'n0'), (4695, 155, 'n1');
+INSERT INTO t VALUES (4698, 162, 'n2'), (4701, 169, 'n3'), (4704, 176, 'n4'), (4707, 183, 'n5'), (4710, 190, 'n6'), (4713, 197, 'n7'), (4716, 204, 'n8'), (4719, 211, 'n9'), (4722, 218, 'n10'), (4725, 225, 'n11'), (4728, 232, 'n12'), (4731, 239, 'n13'), (4734, 246, 'n14'), (4737, 253, 'n15'), (4740, 260, 'n16'), (4743, 267, 'n0'), (4746, 274, 'n1'), (4749, 281, 'n2'), (4752, 288, 'n3'), (4755, 295, 'n4'), (4758, 2, 'n5'), (4761, NULL, 'n6'), (4764, 16, 'n7'), (4767, 23, 'n8'), (4770, 30, 'n9');
+INSERT INTO t VALUES (4773, 37, 'n10'), (4776, 44, 'n11'), (4779, 51, 'n12'), (4782, 58, 'n13'), (4785, 65, 'n14'), (4788, 72, 'n15'), (4791, 79, 'n16'), (4794, 86, 'n0'), (4797, 93, 'n1'), (4800, 100, 'n2'), (4803, 107, 'n3'), (4806, 114, 'n4'), (4809, 121, 'n5'), (4812, 128, 'n6'), (4815, 135, 'n7'), (4818, 142, 'n8'), (4821, 149, 'n9'), (4824, 156, 'n10'), (4827, 163, 'n11'), (4830, NULL, 'n12'), (4833, 177, 'n13'), (4836, 184, 'n14'), (4839, 191, 'n15'), (4842, 198, 'n16'), (4845, 205, 'n0');
+INSERT INTO t VALUES (4848, 212, 'n1'), (4851, 219, 'n2'), (4854, 226, 'n3'), (4857, 233, 'n4'), (4860, 240, 'n5'), (4863, 247, 'n6'), (4866, 254, 'n7'), (4869, 261, 'n8'), (4872, 268, 'n9'), (4875, 275, 'n10'), (4878, 282, 'n11'), (4881, 289, 'n12'), (4884, 296, 'n13'), (4887, 3, 'n14'), (4890, 10, 'n15'), (4893, 17, 'n16'), (4896, 24, 'n0'), (4899, NULL, 'n1'), (4902, 38, 'n2'), (4905, 45, 'n3'), (4908, 52, 'n4'), (4911, 59, 'n5'), (4914, 66, 'n6'), (4917, 73, 'n7'), (4920, 80, 'n8');
+INSERT INTO t VALUES (4923, 87, 'n9'), (4926, 94, 'n10'), (4929, 101, 'n11'), (4932, 108, 'n12'), (4935, 115, 'n13'), (4938, 122, 'n14'), (4941, 129, 'n15'), (4944, 136, 'n16'), (4947, 143, 'n0'), (4950, 150, 'n1'), (4953, 157, 'n2'), (4956, 164, 'n3'), (4959, 171, 'n4'), (4962, 178, 'n5'), (4965, 185, 'n6'), (4968, NULL, 'n7'), (4971, 199, 'n8'), (4974, 206, 'n9'), (4977, 213, 'n10'), (4980, 220, 'n11'), (4983, 227, 'n12'), (4986, 234, 'n13'), (4989, 241, 'n14'), (4992, 248, 'n15'), (4995, 255, 'n16');
+INSERT INTO t VALUES (4998, 262, 'n0'), (5001, 269, 'n1'), (5004, 276, 'n2'), (5007, 283, 'n3'), (5010, 290, 'n4'), (5013, 297, 'n5'), (5016, 4, 'n6'), (5019, 11, 'n7'), (5022, 18, 'n8'), (5025, 25, 'n9'), (5028, 32, 'n10'), (5031, 39, 'n11'), (5034, 46, 'n12'), (5037, NULL, 'n13'), (5040, 60, 'n14'), (5043, 67, 'n15'), (5046, 74, 'n16'), (5049, 81, 'n0'), (5052, 88, 'n1'), (5055, 95, 'n2'), (5058, 102, 'n3'), (5061, 109, 'n4'), (5064, 116, 'n5'), (5067, 123, 'n6'), (5070, 130, 'n7');
+INSERT INTO t VALUES (5073, 137, 'n8'), (5076, 144, 'n9'), (5079, 151, 'n10'), (5082, 158, 'n11'), (5085, 165, 'n12'), (5088, 172, 'n13'), (5091, 179, 'n14'), (5094, 186, 'n15'), (5097, 193, 'n16'), (5100, 200, 'n0'), (5103, 207, 'n1'), (5106, NULL, 'n2'), (5109, 221, 'n3'), (5112, 228, 'n4'), (5115, 235, 'n5'), (5118, 242, 'n6'), (5121, 249, 'n7'), (5124, 256, 'n8'), (5127, 263, 'n9'), (5130, 270, 'n10'), (5133, 277, 'n11'), (5136, 284, 'n12'), (5139, 291, 'n13'), (5142, 298, 'n14'), (5145, 5, 'n15');
+INSERT INTO t VALUES (5148, 12, 'n16'), (5151, 19, 'n0'), (5154, 26, 'n1'), (5157, 33, 'n2'), (5160, 40, 'n3'), (5163, 47, 'n4'), (5166, 54, 'n5'), (5169, 61, 'n6'), (5172, 68, 'n7'), (5175, NULL, 'n8'), (5178, 82, 'n9'), (5181, 89, 'n10'), (5184, 96, 'n11'), (5187, 103, 'n12'), (5190, 110, 'n13'), (5193, 117, 'n14'), (5196, 124, 'n15'), (5199, 131, 'n16'), (5202, 138, 'n0'), (5205, 145, 'n1'), (5208, 152, 'n2'), (5211, 159, 'n3'), (5214, 166, 'n4'), (5217, 173, 'n5'), (5220, 180, 'n6');
+INSERT INTO t VALUES (5223, 187, 'n7'), (5226, 194, 'n8'), (5229, 201, 'n9'), (5232, 208, 'n10'), (5235, 215, 'n11'), (5238, 222, 'n12'), (5241, 229, 'n13'), (5244, NULL, 'n14'), (5247, 243, 'n15'), (5250, 250, 'n16'), (5253, 257, 'n0'), (5256, 264, 'n1'), (5259, 271, 'n2'), (5262, 278, 'n3'), (5265, 285, 'n4'), (5268, 292, 'n5'), (5271, 299, 'n6'), (5274, 6, 'n7'), (5277, 13, 'n8'), (5280, 20, 'n9'), (5283, 27, 'n10'), (5286, 34, 'n11'), (5289, 41, 'n12'), (5292, 48, 'n13'), (5295, 55, 'n14');
+INSERT INTO t VALUES (5298, 62, 'n15'), (5301, 69, 'n16'), (5304, 76, 'n0'), (5307, 83, 'n1'), (5310, 90, 'n2'), (5313, NULL, 'n3'), (5316, 104, 'n4'), (5319, 111, 'n5'), (5322, 118, 'n6'), (5325, 125, 'n7'), (5328, 132, 'n8'), (5331, 139, 'n9'), (5334, 146, 'n10'), (5337, 153, 'n11'), (5340, 160, 'n12'), (5343, 167, 'n13'), (5346, 174, 'n14'), (5349, 181, 'n15'), (5352, 188, 'n16'), (5355, 195, 'n0'), (5358, 202, 'n1'), (5361, 209, 'n2'), (5364, 216, 'n3'), (5367, 223, 'n4'), (5370, 230, 'n5');
+INSERT INTO t VALUES (5373, 237, 'n6'), (5376, 244, 'n7'), (5379, 251, 'n8'), (5382, NULL, 'n9'), (5385, 265, 'n10'), (5388, 272, 'n11'), (5391, 279, 'n12'), (5394, 286, 'n13'), (5397, 293, 'n14'), (5400, 0, 'n15'), (5403, 7, 'n16'), (5406, 14, 'n0'), (5409, 21, 'n1'), (5412, 28, 'n2'), (5415, 35, 'n3'), (5418, 42, 'n4'), (5421, 49, 'n5'), (5424, 56, 'n6'), (5427, 63, 'n7'), (5430, 70, 'n8'), (5433, 77, 'n9'), (5436, 84, 'n10'), (5439, 91, 'n11'), (5442, 98, 'n12'), (5445, 105, 'n13');
+INSERT INTO t VALUES (5448, 112, 'n14'), (5451, NULL, 'n15'), (5454, 126, 'n16'), (5457, 133, 'n0'), (5460, 140, 'n1'), (5463, 147, 'n2'), (5466, 154, 'n3'), (5469, 161, 'n4'), (5472, 168, 'n5'), (5475, 175, 'n6'), (5478, 182, 'n7'), (5481, 189, 'n8'), (5484, 196, 'n9'), (5487, 203, 'n10'), (5490, 210, 'n11'), (5493, 217, 'n12'), (5496, 224, 'n13'), (5499, 231, 'n14'), (5502, 238, 'n15'), (5505, 245, 'n16'), (5508, 252, 'n0'), (5511, 259, 'n1'), (5514, 266, 'n2'), (5517, 273, 'n3'), (5520, NULL, 'n4');
+INSERT INTO t VALUES (5523, 287, 'n5'), (5526, 294, 'n6'), (5529, 1, 'n7'), (5532, 8, 'n8'), (5535, 15, 'n9'), (5538, 22, 'n10'), (5541, 29, 'n11'), (5544, 36, 'n12'), (5547, 43, 'n13'), (5550, 50, 'n14'), (5553, 57, 'n15'), (5556, 64, 'n16'), (5559, 71, 'n0'), (5562, 78, 'n1'), (5565, 85, 'n2'), (5568, 92, 'n3'), (5571, 99, 'n4'), (5574, 106, 'n5'), (5577, 113, 'n6'), (5580, 120, 'n7'), (5583, 127, 'n8'), (5586, 134, 'n9'), (5589, NULL, 'n10'), (5592, 148, 'n11'), (5595, 155, 'n12');
+INSERT INTO t VALUES (5598, 162, 'n13'), (5601, 169, 'n14'), (5604, 176, 'n15'), (5607, 183, 'n16'), (5610, 190, 'n0'), (5613, 197, 'n1'), (5616, 204, 'n2'), (5619, 211, 'n3'), (5622, 218, 'n4'), (5625, 225, 'n5'), (5628, 232, 'n6'), (5631, 239, 'n7'), (5634, 246, 'n8'), (5637, 253, 'n9'), (5640, 260, 'n10'), (5643, 267, 'n11'), (5646, 274, 'n12'), (5649, 281, 'n13'), (5652, 288, 'n14'), (5655, 295, 'n15'), (5658, NULL, 'n16'), (5661, 9, 'n0'), (5664, 16, 'n1'), (5667, 23, 'n2'), (5670, 30, 'n3');
+INSERT INTO t VALUES (5673, 37, 'n4'), (5676, 44, 'n5'), (5679, 51, 'n6'), (5682, 58, 'n7'), (5685, 65, 'n8'), (5688, 72, 'n9'), (5691, 79, 'n10'), (5694, 86, 'n11'), (5697, 93, 'n12'), (5700, 100, 'n13'), (5703, 107, 'n14'), (5706, 114, 'n15'), (5709, 121, 'n16'), (5712, 128, 'n0'), (5715, 135, 'n1'), (5718, 142, 'n2'), (5721, 149, 'n3'), (5724, 156, 'n4'), (5727, NULL, 'n5'), (5730, 170, 'n6'), (5733, 177, 'n7'), (5736, 184, 'n8'), (5739, 191, 'n9'), (5742, 198, 'n10'), (5745, 205, 'n11');
+INSERT INTO t VALUES (5748, 212, 'n12'), (5751, 219, 'n13'), (5754, 226, 'n14'), (5757, 233, 'n15'), (5760, 240, 'n16'), (5763, 247, 'n0'), (5766, 254, 'n1'), (5769, 261, 'n2'), (5772, 268, 'n3'), (5775, 275, 'n4'), (5778, 282, 'n5'), (5781, 289, 'n6'), (5784, 296, 'n7'), (5787, 3, 'n8'), (5790, 10, 'n9'), (5793, 17, 'n10'), (5796, NULL, 'n11'), (5799, 31, 'n12'), (5802, 38, 'n13'), (5805, 45, 'n14'), (5808, 52, 'n15'), (5811, 59, 'n16'), (5814, 66, 'n0'), (5817, 73, 'n1'), (5820, 80, 'n2');
+INSERT INTO t VALUES (5823, 87, 'n3'), (5826, 94, 'n4'), (5829, 101, 'n5'), (5832, 108, 'n6'), (5835, 115, 'n7'), (5838, 122, 'n8'), (5841, 129, 'n9'), (5844, 136, 'n10'), (5847, 143, 'n11'), (5850, 150, 'n12'), (5853, 157, 'n13'), (5856, 164, 'n14'), (5859, 171, 'n15'), (5862, 178, 'n16'), (5865, NULL, 'n0'), (5868, 192, 'n1'), (5871, 199, 'n2'), (5874, 206, 'n3'), (5877, 213, 'n4'), (5880, 220, 'n5'), (5883, 227, 'n6'), (5886, 234, 'n7'), (5889, 241, 'n8'), (5892, 248, 'n9'), (5895, 255, 'n10');
+INSERT INTO t VALUES (5898, 262, 'n11'), (5901, 269, 'n12'), (5904, 276, 'n13'), (5907, 283, 'n14'), (5910, 290, 'n15'), (5913, 297, 'n16'), (5916, 4, 'n0'), (5919, 11, 'n1'), (5922, 18, 'n2'), (5925, 25, 'n3'), (5928, 32, 'n4'), (5931, 39, 'n5'), (5934, NULL, 'n6'), (5937, 53, 'n7'), (5940, 60, 'n8'), (5943, 67, 'n9'), (5946, 74, 'n10'), (5949, 81, 'n11'), (5952, 88, 'n12'), (5955, 95, 'n13'), (5958, 102, 'n14'), (5961, 109, 'n15'), (5964, 116, 'n16'), (5967, 123, 'n0'), (5970, 130, 'n1');
+INSERT INTO t VALUES (5973, 137, 'n2'), (5976, 144, 'n3'), (5979, 151, 'n4'), (5982, 158, 'n5'), (5985, 165, 'n6'), (5988, 172, 'n7'), (5991, 179, 'n8'), (5994, 186, 'n9'), (5997, 193, 'n10'), (6000, 200, 'n11');
+SELECT id, a, s FROM t WHERE id = 30;
+SELECT id, a, s FROM t WHERE id = 31;
+SELECT id, a FROM t WHERE a = 70 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a = 299;
+SELECT NUM(id) FROM t WHERE a = NULL;
+SELECT id, a FROM t WHERE a = 7 AND id > 3000 ORDER BY id;
+-- ranges are left to a scan
+SELECT NUM(id), SUM(a) FROM t WHERE a < 10;
+SELECT NUM(id), SUM(a) FROM t WHERE id >= 600 AND id < 900;
+SELECT NUM(id), SUM(a) FROM t;
+-- duplicate primary keys are found through the hash index
+INSERT INTO t VALUES (30, 1, 'dup');
+INSERT INTO t VALUES (5997, 2, 'dup');
+INSERT INTO t VALUES (6001, 3, 'new');
+DELETE FROM t WHERE a = 70;
+DELETE FROM t WHERE id > 3000 AND a < 150;
+UPDATE t SET a = 70 WHERE a = 299;
+SELECT id, a, s FROM t WHERE id = 30;
+SELECT id, a, s FROM t WHERE id = 31;
+SELECT id, a FROM t WHERE a = 70 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a = 299;
+SELECT NUM(id) FROM t WHERE a = NULL;
+SELECT id, a FROM t WHERE a = 7 AND id > 3000 ORDER BY id;
+-- ranges are left to a scan
+SELECT NUM(id), SUM(a) FROM t WHERE a < 10;
+SELECT NUM(id), SUM(a) FROM t WHERE id >= 600 AND id < 900;
+SELECT NUM(id), SUM(a) FROM t;
+-- back to B+ trees
+CREATE INDEX t("id USING BTREE");
+CREATE INDEX t("a USING BTREE");
+INSERT INTO t VALUES (30, 1, 'dup');
+INSERT INTO t VALUES (6004, 70, 'new');
+SELECT id, a, s FROM t WHERE id = 30;
+SELECT id, a, s FROM t WHERE id = 31;
+SELECT id, a FROM t WHERE a = 70 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a = 299;
+SELECT NUM(id) FROM t WHERE a = NULL;
+SELECT id, a FROM t WHERE a = 7 AND id > 3000 ORDER BY id;
+-- ranges are left to a scan
+SELECT NUM(id), SUM(a) FROM t WHERE a < 10;
+SELECT NUM(id), SUM(a) FROM t WHERE id >= 600 AND id < 900;
+SELECT NUM(id), SUM(a) FROM t;
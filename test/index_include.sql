@@ -0,0 +1,86 @@
+-- an index on (a, b) that also carries c, queries reading only
+-- those columns are answered from its entries, see run_sql.sh
+CREATE DATABASE ii;
+USE DATABASE ii;
+CREATE TABLE t(id int(10) NOT NULL, a int(10), b int(10), c varchar(10), d int(10), PRIMARY KEY(id));
+INSERT INTO t VALUES (1, 7, 13, 'c1', 3), (2, 14, 26, 'c2', 6), (3, 1, 39, 'c3', 9), (4, 8, 52, 'c4', 12), (5, 15, 65, 'c5', 15), (6, 2, 78, 'c6', 18), (7, 9, 91, 'c7', 21), (8, 16, 7, 'c8', 24), (9, 3, 20, 'c9', 27), (10, 10, 33, 'c10', 30), (11, 17, 46, NULL, 33), (12, 4, 59, 'c12', 36), (13, 11, 72, 'c0', 39), (14, 18, 85, 'c1', 42), (15, 5, 1, 'c2', 45), (16, 12, 14, 'c3', 48), (17, 19, 27, 'c4', 51), (18, 6, 40, 'c5', 54), (19, 13, 53, 'c6', 57), (20, 0, 66, 'c7', 60), (21, 7, 79, 'c8', 63), (22, 14, 92, NULL, 66), (23, 1, 8, 'c10', 69), (24, 8, 21, 'c11', 72), (25, 15, 34, 'c12', 75);
+INSERT INTO t VALUES (26, 2, 47, 'c0', 78), (27, 9, 60, 'c1', 81), (28, 16, 73, 'c2', 84), (29, NULL, 86, 'c3', 87), (30, 10, 2, 'c4', 90), (31, 17, 15, 'c5', 93), (32, 4, 28, 'c6', 96), (33, 11, 41, NULL, 99), (34, 18, 54, 'c8', 102), (35, 5, 67, 'c9', 105), (36, 12, 80, 'c10', 108), (37, 19, 93, 'c11', 111), (38, 6, 9, 'c12', 114), (39, 13, 22, 'c0', 117), (40, 0, 35, 'c1', 120), (41, 7, 48, 'c2', 123), (42, 14, 61, 'c3', 126), (43, 1, 74, 'c4', 129), (44, 8, 87, NULL, 132), (45, 15, 3, 'c6', 135), (46, 2, 16, 'c7', 138), (47, 9, 29, 'c8', 141), (48, 16, 42, 'c9', 144), (49, 3, 55, 'c10', 147), (50, 10, 68, 'c11', 150);
+INSERT INTO t VALUES (51, 17, 81, 'c12', 153), (52, 4, 94, 'c0', 156), (53, 11, 10, 'c1', 159), (54, 18, 23, 'c2', 162), (55, 5, 36, NULL, 165), (56, 12, 49, 'c4', 168), (57, 19, 62, 'c5', 171), (58, NULL, 75, 'c6', 174), (59, 13, 88, 'c7', 177), (60, 0, 4, 'c8', 180), (61, 7, 17, 'c9', 183), (62, 14, 30, 'c10', 186), (63, 1, 43, 'c11', 189), (64, 8, 56, 'c12', 192), (65, 15, 69, 'c0', 195), (66, 2, 82, NULL, 198), (67, 9, 95, 'c2', 201), (68, 16, 11, 'c3', 204), (69, 3, 24, 'c4', 207), (70, 10, 37, 'c5', 210), (71, 17, 50, 'c6', 213), (72, 4, 63, 'c7', 216), (73, 11, 76, 'c8', 219), (74, 18, 89, 'c9', 222), (75, 5, 5, 'c10', 225);
+INSERT INTO t VALUES (76, 12, 18, 'c11', 228), (77, 19, 31, NULL, 231), (78, 6, 44, 'c0', 234), (79, 13, 57, 'c1', 237), (80, 0, 70, 'c2', 240), (81, 7, 83, 'c3', 243), (82, 14, 96, 'c4', 246), (83, 1, 12, 'c5', 249), (84, 8, 25, 'c6', 252), (85, 15, 38, 'c7', 255), (86, 2, 51, 'c8', 258), (87, NULL, 64, 'c9', 261), (88, 16, 77, NULL, 264), (89, 3, 90, 'c11', 267), (90, 10, 6, 'c12', 270), (91, 17, 19, 'c0', 273), (92, 4, 32, 'c1', 276), (93, 11, 45, 'c2', 279), (94, 18, 58, 'c3', 282), (95, 5, 71, 'c4', 285), (96, 12, 84, 'c5', 288), (97, 19, 0, 'c6', 291), (98, 6, 13, 'c7', 294), (99, 13, 26, NULL, 297), (100, 0, 39, 'c9', 300);
+INSERT INTO t VALUES (101, 7, 52, 'c10', 303), (102, 14, 65, 'c11', 306), (103, 1, 78, 'c12', 309), (104, 8, 91, 'c0', 312), (105, 15, 7, 'c1', 315), (106, 2, 20, 'c2', 318), (107, 9, 33, 'c3', 321), (108, 16, 46, 'c4', 324), (109, 3, 59, 'c5', 327), (110, 10, 72, NULL, 330), (111, 17, 85, 'c7', 333), (112, 4, 1, 'c8', 336), (113, 11, 14, 'c9', 339), (114, 18, 27, 'c10', 342), (115, 5, 40, 'c11', 345), (116, NULL, 53, 'c12', 348), (117, 19, 66, 'c0', 351), (118, 6, 79, 'c1', 354), (119, 13, 92, 'c2', 357), (120, 0, 8, 'c3', 360), (121, 7, 21, NULL, 363), (122, 14, 34, 'c5', 366), (123, 1, 47, 'c6', 369), (124, 8, 60, 'c7', 372), (125, 15, 73, 'c8', 375);
+INSERT INTO t VALUES (126, 2, 86, 'c9', 378), (127, 9, 2, 'c10', 381), (128, 16, 15, 'c11', 384), (129, 3, 28, 'c12', 387), (130, 10, 41, 'c0', 390), (131, 17, 54, 'c1', 393), (132, 4, 67, NULL, 396), (133, 11, 80, 'c3', 399), (134, 18, 93, 'c4', 402), (135, 5, 9, 'c5', 405), (136, 12, 22, 'c6', 408), (137, 19, 35, 'c7', 411), (138, 6, 48, 'c8', 414), (139, 13, 61, 'c9', 417), (140, 0, 74, 'c10', 420), (141, 7, 87, 'c11', 423), (142, 14, 3, 'c12', 426), (143, 1, 16, NULL, 429), (144, 8, 29, 'c1', 432), (145, NULL, 42, 'c2', 435), (146, 2, 55, 'c3', 438), (147, 9, 68, 'c4', 441), (148, 16, 81, 'c5', 444), (149, 3, 94, 'c6', 447), (150, 10, 10, 'c7', 450);
+INSERT INTO t VALUES (151, 17, 23, 'c8', 453), (152, 4, 36, 'c9', 456), (153, 11, 49, 'c10', 459), (154, 18, 62, NULL, 462), (155, 5, 75, 'c12', 465), (156, 12, 88, 'c0', 468), (157, 19, 4, 'c1', 471), (158, 6, 17, 'c2', 474), (159, 13, 30, 'c3', 477), (160, 0, 43, 'c4', 480), (161, 7, 56, 'c5', 483), (162, 14, 69, 'c6', 486), (163, 1, 82, 'c7', 489), (164, 8, 95, 'c8', 492), (165, 15, 11, NULL, 495), (166, 2, 24, 'c10', 498), (167, 9, 37, 'c11', 501), (168, 16, 50, 'c12', 504), (169, 3, 63, 'c0', 507), (170, 10, 76, 'c1', 510), (171, 17, 89, 'c2', 513), (172, 4, 5, 'c3', 516), (173, 11, 18, 'c4', 519), (174, NULL, 31, 'c5', 522), (175, 5, 44, 'c6', 525);
+INSERT INTO t VALUES (176, 12, 57, NULL, 528), (177, 19, 70, 'c8', 531), (178, 6, 83, 'c9', 534), (179, 13, 96, 'c10', 537), (180, 0, 12, 'c11', 540), (181, 7, 25, 'c12', 543), (182, 14, 38, 'c0', 546), (183, 1, 51, 'c1', 549), (184, 8, 64, 'c2', 552), (185, 15, 77, 'c3', 555), (186, 2, 90, 'c4', 558), (187, 9, 6, NULL, 561), (188, 16, 19, 'c6', 564), (189, 3, 32, 'c7', 567), (190, 10, 45, 'c8', 570), (191, 17, 58, 'c9', 573), (192, 4, 71, 'c10', 576), (193, 11, 84, 'c11', 579), (194, 18, 0, 'c12', 582), (195, 5, 13, 'c0', 585), (196, 12, 26, 'c1', 588), (197, 19, 39, 'c2', 591), (198, 6, 52, NULL, 594), (199, 13, 65, 'c4', 597), (200, 0, 78, 'c5', 600);
+INSERT INTO t VALUES (201, 7, 91, 'c6', 603), (202, 14, 7, 'c7', 606), (203, NULL, 20, 'c8', 609), (204, 8, 33, 'c9', 612), (205, 15, 46, 'c10', 615), (206, 2, 59, 'c11', 618), (207, 9, 72, 'c12', 621), (208, 16, 85, 'c0', 624), (209, 3, 1, NULL, 627), (210, 10, 14, 'c2', 630), (211, 17, 27, 'c3', 633), (212, 4, 40, 'c4', 636), (213, 11, 53, 'c5', 639), (214, 18, 66, 'c6', 642), (215, 5, 79, 'c7', 645), (216, 12, 92, 'c8', 648), (217, 19, 8, 'c9', 651), (218, 6, 21, 'c10', 654), (219, 13, 34, 'c11', 657), (220, 0, 47, NULL, 660), (221, 7, 60, 'c0', 663), (222, 14, 73, 'c1', 666), (223, 1, 86, 'c2', 669), (224, 8, 2, 'c3', 672), (225, 15, 15, 'c4', 675);
+INSERT INTO t VALUES (226, 2, 28, 'c5', 678), (227, 9, 41, 'c6', 681), (228, 16, 54, 'c7', 684), (229, 3, 67, 'c8', 687), (230, 10, 80, 'c9', 690), (231, 17, 93, NULL, 693), (232, NULL, 9, 'c11', 696), (233, 11, 22, 'c12', 699), (234, 18, 35, 'c0', 702), (235, 5, 48, 'c1', 705), (236, 12, 61, 'c2', 708), (237, 19, 74, 'c3', 711), (238, 6, 87, 'c4', 714), (239, 13, 3, 'c5', 717), (240, 0, 16, 'c6', 720), (241, 7, 29, 'c7', 723), (242, 14, 42, NULL, 726), (243, 1, 55, 'c9', 729), (244, 8, 68, 'c10', 732), (245, 15, 81, 'c11', 735), (246, 2, 94, 'c12', 738), (247, 9, 10, 'c0', 741), (248, 16, 23, 'c1', 744), (249, 3, 36, 'c2', 747), (250, 10, 49, 'c3', 750);
+INSERT INTO t VALUES (251, 17, 62, 'c4', 753), (252, 4, 75, 'c5', 756), (253, 11, 88, NULL, 759), (254, 18, 4, 'c7', 762), (255, 5, 17, 'c8', 765), (256, 12, 30, 'c9', 768), (257, 19, 43, 'c10', 771), (258, 6, 56, 'c11', 774), (259, 13, 69, 'c12', 777), (260, 0, 82, 'c0', 780), (261, NULL, 95, 'c1', 783), (262, 14, 11, 'c2', 786), (263, 1, 24, 'c3', 789), (264, 8, 37, NULL, 792), (265, 15, 50, 'c5', 795), (266, 2, 63, 'c6', 798), (267, 9, 76, 'c7', 801), (268, 16, 89, 'c8', 804), (269, 3, 5, 'c9', 807), (270, 10, 18, 'c10', 810), (271, 17, 31, 'c11', 813), (272, 4, 44, 'c12', 816), (273, 11, 57, 'c0', 819), (274, 18, 70, 'c1', 822), (275, 5, 83, NULL, 825);
+INSERT INTO t VALUES (276, 12, 96, 'c3', 828), (277, 19, 12, 'c4', 831), (278, 6, 25, 'c5', 834), (279, 13, 38, 'c6', 837), (280, 0, 51, 'c7', 840), (281, 7, 64, 'c8', 843), (282, 14, 77, 'c9', 846), (283, 1, 90, 'c10', 849), (284, 8, 6, 'c11', 852), (285, 15, 19, 'c12', 855), (286, 2, 32, NULL, 858), (287, 9, 45, 'c1', 861), (288, 16, 58, 'c2', 864), (289, 3, 71, 'c3', 867), (290, NULL, 84, 'c4', 870), (291, 17, 0, 'c5', 873), (292, 4, 13, 'c6', 876), (293, 11, 26, 'c7', 879), (294, 18, 39, 'c8', 882), (295, 5, 52, 'c9', 885), (296, 12, 65, 'c10', 888), (297, 19, 78, NULL, 891), (298, 6, 91, 'c12', 894), (299, 13, 7, 'c0', 897), (300, 0, 20, 'c1', 900);
+INSERT INTO t VALUES (301, 7, 33, 'c2', 903), (302, 14, 46, 'c3', 906), (303, 1, 59, 'c4', 909), (304, 8, 72, 'c5', 912), (305, 15, 85, 'c6', 915), (306, 2, 1, 'c7', 918), (307, 9, 14, 'c8', 921), (308, 16, 27, NULL, 924), (309, 3, 40, 'c10', 927), (310, 10, 53, 'c11', 930), (311, 17, 66, 'c12', 933), (312, 4, 79, 'c0', 936), (313, 11, 92, 'c1', 939), (314, 18, 8, 'c2', 942), (315, 5, 21, 'c3', 945), (316, 12, 34, 'c4', 948), (317, 19, 47, 'c5', 951), (318, 6, 60, 'c6', 954), (319, NULL, 73, NULL, 957), (320, 0, 86, 'c8', 960), (321, 7, 2, 'c9', 963), (322, 14, 15, 'c10', 966), (323, 1, 28, 'c11', 969), (324, 8, 41, 'c12', 972), (325, 15, 54, 'c0', 975);
+INSERT INTO t VALUES (326, 2, 67, 'c1', 978), (327, 9, 80, 'c2', 981), (328, 16, 93, 'c3', 984), (329, 3, 9, 'c4', 987), (330, 10, 22, NULL, 990), (331, 17, 35, 'c6', 993), (332, 4, 48, 'c7', 996), (333, 11, 61, 'c8', 999), (334, 18, 74, 'c9', 2), (335, 5, 87, 'c10', 5), (336, 12, 3, 'c11', 8), (337, 19, 16, 'c12', 11), (338, 6, 29, 'c0', 14), (339, 13, 42, 'c1', 17), (340, 0, 55, 'c2', 20), (341, 7, 68, NULL, 23), (342, 14, 81, 'c4', 26), (343, 1, 94, 'c5', 29), (344, 8, 10, 'c6', 32), (345, 15, 23, 'c7', 35), (346, 2, 36, 'c8', 38), (347, 9, 49, 'c9', 41), (348, NULL, 62, 'c10', 44), (349, 3, 75, 'c11', 47), (350, 10, 88, 'c12', 50);
+INSERT INTO t VALUES (351, 17, 4, 'c0', 53), (352, 4, 17, NULL, 56), (353, 11, 30, 'c2', 59), (354, 18, 43, 'c3', 62), (355, 5, 56, 'c4', 65), (356, 12, 69, 'c5', 68), (357, 19, 82, 'c6', 71), (358, 6, 95, 'c7', 74), (359, 13, 11, 'c8', 77), (360, 0, 24, 'c9', 80), (361, 7, 37, 'c10', 83), (362, 14, 50, 'c11', 86), (363, 1, 63, NULL, 89), (364, 8, 76, 'c0', 92), (365, 15, 89, 'c1', 95), (366, 2, 5, 'c2', 98), (367, 9, 18, 'c3', 101), (368, 16, 31, 'c4', 104), (369, 3, 44, 'c5', 107), (370, 10, 57, 'c6', 110), (371, 17, 70, 'c7', 113), (372, 4, 83, 'c8', 116), (373, 11, 96, 'c9', 119), (374, 18, 12, NULL, 122), (375, 5, 25, 'c11', 125);
+INSERT INTO t VALUES (376, 12, 38, 'c12', 128), (377, NULL, 51, 'c0', 131), (378, 6, 64, 'c1', 134), (379, 13, 77, 'c2', 137), (380, 0, 90, 'c3', 140), (381, 7, 6, 'c4', 143), (382, 14, 19, 'c5', 146), (383, 1, 32, 'c6', 149), (384, 8, 45, 'c7', 152), (385, 15, 58, NULL, 155), (386, 2, 71, 'c9', 158), (387, 9, 84, 'c10', 161), (388, 16, 0, 'c11', 164), (389, 3, 13, 'c12', 167), (390, 10, 26, 'c0', 170), (391, 17, 39, 'c1', 173), (392, 4, 52, 'c2', 176), (393, 11, 65, 'c3', 179), (394, 18, 78, 'c4', 182), (395, 5, 91, 'c5', 185), (396, 12, 7, NULL, 188), (397, 19, 20, 'c7', 191), (398, 6, 33, 'c8', 194), (399, 13, 46, 'c9', 197), (400, 0, 59, 'c10', 200);
+INSERT INTO t VALUES (401, 7, 72, 'c11', 203), (402, 14, 85, 'c12', 206), (403, 1, 1, 'c0', 209), (404, 8, 14, 'c1', 212), (405, 15, 27, 'c2', 215), (406, NULL, 40, 'c3', 218), (407, 9, 53, NULL, 221), (408, 16, 66, 'c5', 224), (409, 3, 79, 'c6', 227), (410, 10, 92, 'c7', 230), (411, 17, 8, 'c8', 233), (412, 4, 21, 'c9', 236), (413, 11, 34, 'c10', 239), (414, 18, 47, 'c11', 242), (415, 5, 60, 'c12', 245), (416, 12, 73, 'c0', 248), (417, 19, 86, 'c1', 251), (418, 6, 2, NULL, 254), (419, 13, 15, 'c3', 257), (420, 0, 28, 'c4', 260), (421, 7, 41, 'c5', 263), (422, 14, 54, 'c6', 266), (423, 1, 67, 'c7', 269), (424, 8, 80, 'c8', 272), (425, 15, 93, 'c9', 275);
+INSERT INTO t VALUES (426, 2, 9, 'c10', 278), (427, 9, 22, 'c11', 281), (428, 16, 35, 'c12', 284), (429, 3, 48, NULL, 287), (430, 10, 61, 'c1', 290), (431, 17, 74, 'c2', 293), (432, 4, 87, 'c3', 296), (433, 11, 3, 'c4', 299), (434, 18, 16, 'c5', 302), (435, NULL, 29, 'c6', 305), (436, 12, 42, 'c7', 308), (437, 19, 55, 'c8', 311), (438, 6, 68, 'c9', 314), (439, 13, 81, 'c10', 317), (440, 0, 94, NULL, 320), (441, 7, 10, 'c12', 323), (442, 14, 23, 'c0', 326), (443, 1, 36, 'c1', 329), (444, 8, 49, 'c2', 332), (445, 15, 62, 'c3', 335), (446, 2, 75, 'c4', 338), (447, 9, 88, 'c5', 341), (448, 16, 4, 'c6', 344), (449, 3, 17, 'c7', 347), (450, 10, 30, 'c8', 350);
+INSERT INTO t VALUES (451, 17, 43, NULL, 353), (452, 4, 56, 'c10', 356), (453, 11, 69, 'c11', 359), (454, 18, 82, 'c12', 362), (455, 5, 95, 'c0', 365), (456, 12, 11, 'c1', 368), (457, 19, 24, 'c2', 371), (458, 6, 37, 'c3', 374), (459, 13, 50, 'c4', 377), (460, 0, 63, 'c5', 380), (461, 7, 76, 'c6', 383), (462, 14, 89, NULL, 386), (463, 1, 5, 'c8', 389), (464, NULL, 18, 'c9', 392), (465, 15, 31, 'c10', 395), (466, 2, 44, 'c11', 398), (467, 9, 57, 'c12', 401), (468, 16, 70, 'c0', 404), (469, 3, 83, 'c1', 407), (470, 10, 96, 'c2', 410), (471, 17, 12, 'c3', 413), (472, 4, 25, 'c4', 416), (473, 11, 38, NULL, 419), (474, 18, 51, 'c6', 422), (475, 5, 64, 'c7', 425);
+INSERT INTO t VALUES (476, 12, 77, 'c8', 428), (477, 19, 90, 'c9', 431), (478, 6, 6, 'c10', 434), (479, 13, 19, 'c11', 437), (480, 0, 32, 'c12', 440), (481, 7, 45, 'c0', 443), (482, 14, 58, 'c1', 446), (483, 1, 71, 'c2', 449), (484, 8, 84, NULL, 452), (485, 15, 0, 'c4', 455), (486, 2, 13, 'c5', 458), (487, 9, 26, 'c6', 461), (488, 16, 39, 'c7', 464), (489, 3, 52, 'c8', 467), (490, 10, 65, 'c9', 470), (491, 17, 78, 'c10', 473), (492, 4, 91, 'c11', 476), (493, NULL, 7, 'c12', 479), (494, 18, 20, 'c0', 482), (495, 5, 33, NULL, 485), (496, 12, 46, 'c2', 488), (497, 19, 59, 'c3', 491), (498, 6, 72, 'c4', 494), (499, 13, 85, 'c5', 497), (500, 0, 1, 'c6', 500);
+INSERT INTO t VALUES (501, 7, 14, 'c7', 503), (502, 14, 27, 'c8', 506), (503, 1, 40, 'c9', 509), (504, 8, 53, 'c10', 512), (505, 15, 66, 'c11', 515), (506, 2, 79, NULL, 518), (507, 9, 92, 'c0', 521), (508, 16, 8, 'c1', 524), (509, 3, 21, 'c2', 527), (510, 10, 34, 'c3', 530), (511, 17, 47, 'c4', 533), (512, 4, 60, 'c5', 536), (513, 11, 73, 'c6', 539), (514, 18, 86, 'c7', 542), (515, 5, 2, 'c8', 545), (516, 12, 15, 'c9', 548), (517, 19, 28, NULL, 551), (518, 6, 41, 'c11', 554), (519, 13, 54, 'c12', 557), (520, 0, 67, 'c0', 560), (521, 7, 80, 'c1', 563), (522, NULL, 93, 'c2', 566), (523, 1, 9, 'c3', 569), (524, 8, 22, 'c4', 572), (525, 15, 35, 'c5', 575);
+INSERT INTO t VALUES (526, 2, 48, 'c6', 578), (527, 9, 61, 'c7', 581), (528, 16, 74, NULL, 584), (529, 3, 87, 'c9', 587), (530, 10, 3, 'c10', 590), (531, 17, 16, 'c11', 593), (532, 4, 29, 'c12', 596), (533, 11, 42, 'c0', 599), (534, 18, 55, 'c1', 602), (535, 5, 68, 'c2', 605), (536, 12, 81, 'c3', 608), (537, 19, 94, 'c4', 611), (538, 6, 10, 'c5', 614), (539, 13, 23, NULL, 617), (540, 0, 36, 'c7', 620), (541, 7, 49, 'c8', 623), (542, 14, 62, 'c9', 626), (543, 1, 75, 'c10', 629), (544, 8, 88, 'c11', 632), (545, 15, 4, 'c12', 635), (546, 2, 17, 'c0', 638), (547, 9, 30, 'c1', 641), (548, 16, 43, 'c2', 644), (549, 3, 56, 'c3', 647), (550, 10, 69, NULL, 650);
+INSERT INTO t VALUES (551, NULL, 82, 'c5', 653), (552, 4, 95, 'c6', 656), (553, 11, 11, 'c7', 659), (554, 18, 24, 'c8', 662), (555, 5, 37, 'c9', 665), (556, 12, 50, 'c10', 668), (557, 19, 63, 'c11', 671), (558, 6, 76, 'c12', 674), (559, 13, 89, 'c0', 677), (560, 0, 5, 'c1', 680), (561, 7, 18, NULL, 683), (562, 14, 31, 'c3', 686), (563, 1, 44, 'c4', 689), (564, 8, 57, 'c5', 692), (565, 15, 70, 'c6', 695), (566, 2, 83, 'c7', 698), (567, 9, 96, 'c8', 701), (568, 16, 12, 'c9', 704), (569, 3, 25, 'c10', 707), (570, 10, 38, 'c11', 710), (571, 17, 51, 'c12', 713), (572, 4, 64, NULL, 716), (573, 11, 77, 'c1', 719), (574, 18, 90, 'c2', 722), (575, 5, 6, 'c3', 725);
+INSERT INTO t VALUES (576, 12, 19, 'c4', 728), (577, 19, 32, 'c5', 731), (578, 6, 45, 'c6', 734), (579, 13, 58, 'c7', 737), (580, NULL, 71, 'c8', 740), (581, 7, 84, 'c9', 743), (582, 14, 0, 'c10', 746), (583, 1, 13, NULL, 749), (584, 8, 26, 'c12', 752), (585, 15, 39, 'c0', 755), (586, 2, 52, 'c1', 758), (587, 9, 65, 'c2', 761), (588, 16, 78, 'c3', 764), (589, 3, 91, 'c4', 767), (590, 10, 7, 'c5', 770), (591, 17, 20, 'c6', 773), (592, 4, 33, 'c7', 776), (593, 11, 46, 'c8', 779), (594, 18, 59, NULL, 782), (595, 5, 72, 'c10', 785), (596, 12, 85, 'c11', 788), (597, 19, 1, 'c12', 791), (598, 6, 14, 'c0', 794), (599, 13, 27, 'c1', 797), (600, 0, 40, 'c2', 800);
+INSERT INTO t VALUES (601, 7, 53, 'c3', 803), (602, 14, 66, 'c4', 806), (603, 1, 79, 'c5', 809), (604, 8, 92, 'c6', 812), (605, 15, 8, NULL, 815), (606, 2, 21, 'c8', 818), (607, 9, 34, 'c9', 821), (608, 16, 47, 'c10', 824), (609, NULL, 60, 'c11', 827), (610, 10, 73, 'c12', 830), (611, 17, 86, 'c0', 833), (612, 4, 2, 'c1', 836), (613, 11, 15, 'c2', 839), (614, 18, 28, 'c3', 842), (615, 5, 41, 'c4', 845), (616, 12, 54, NULL, 848), (617, 19, 67, 'c6', 851), (618, 6, 80, 'c7', 854), (619, 13, 93, 'c8', 857), (620, 0, 9, 'c9', 860), (621, 7, 22, 'c10', 863), (622, 14, 35, 'c11', 866), (623, 1, 48, 'c12', 869), (624, 8, 61, 'c0', 872), (625, 15, 74, 'c1', 875);
+INSERT INTO t VALUES (626, 2, 87, 'c2', 878), (627, 9, 3, NULL, 881), (628, 16, 16, 'c4', 884), (629, 3, 29, 'c5', 887), (630, 10, 42, 'c6', 890), (631, 17, 55, 'c7', 893), (632, 4, 68, 'c8', 896), (633, 11, 81, 'c9', 899), (634, 18, 94, 'c10', 902), (635, 5, 10, 'c11', 905), (636, 12, 23, 'c12', 908), (637, 19, 36, 'c0', 911), (638, NULL, 49, NULL, 914), (639, 13, 62, 'c2', 917), (640, 0, 75, 'c3', 920), (641, 7, 88, 'c4', 923), (642, 14, 4, 'c5', 926), (643, 1, 17, 'c6', 929), (644, 8, 30, 'c7', 932), (645, 15, 43, 'c8', 935), (646, 2, 56, 'c9', 938), (647, 9, 69, 'c10', 941), (648, 16, 82, 'c11', 944), (649, 3, 95, NULL, 947), (650, 10, 11, 'c0', 950);
+INSERT INTO t VALUES (651, 17, 24, 'c1', 953), (652, 4, 37, 'c2', 956), (653, 11, 50, 'c3', 959), (654, 18, 63, 'c4', 962), (655, 5, 76, 'c5', 965), (656, 12, 89, 'c6', 968), (657, 19, 5, 'c7', 971), (658, 6, 18, 'c8', 974), (659, 13, 31, 'c9', 977), (660, 0, 44, NULL, 980), (661, 7, 57, 'c11', 983), (662, 14, 70, 'c12', 986), (663, 1, 83, 'c0', 989), (664, 8, 96, 'c1', 992), (665, 15, 12, 'c2', 995), (666, 2, 25, 'c3', 998), (667, NULL, 38, 'c4', 1), (668, 16, 51, 'c5', 4), (669, 3, 64, 'c6', 7), (670, 10, 77, 'c7', 10), (671, 17, 90, NULL, 13), (672, 4, 6, 'c9', 16), (673, 11, 19, 'c10', 19), (674, 18, 32, 'c11', 22), (675, 5, 45, 'c12', 25);
+INSERT INTO t VALUES (676, 12, 58, 'c0', 28), (677, 19, 71, 'c1', 31), (678, 6, 84, 'c2', 34), (679, 13, 0, 'c3', 37), (680, 0, 13, 'c4', 40), (681, 7, 26, 'c5', 43), (682, 14, 39, NULL, 46), (683, 1, 52, 'c7', 49), (684, 8, 65, 'c8', 52), (685, 15, 78, 'c9', 55), (686, 2, 91, 'c10', 58), (687, 9, 7, 'c11', 61), (688, 16, 20, 'c12', 64), (689, 3, 33, 'c0', 67), (690, 10, 46, 'c1', 70), (691, 17, 59, 'c2', 73), (692, 4, 72, 'c3', 76), (693, 11, 85, NULL, 79), (694, 18, 1, 'c5', 82), (695, 5, 14, 'c6', 85), (696, NULL, 27, 'c7', 88), (697, 19, 40, 'c8', 91), (698, 6, 53, 'c9', 94), (699, 13, 66, 'c10', 97), (700, 0, 79, 'c11', 100);
+INSERT INTO t VALUES (701, 7, 92, 'c12', 103), (702, 14, 8, 'c0', 106), (703, 1, 21, 'c1', 109), (704, 8, 34, NULL, 112), (705, 15, 47, 'c3', 115), (706, 2, 60, 'c4', 118), (707, 9, 73, 'c5', 121), (708, 16, 86, 'c6', 124), (709, 3, 2, 'c7', 127), (710, 10, 15, 'c8', 130), (711, 17, 28, 'c9', 133), (712, 4, 41, 'c10', 136), (713, 11, 54, 'c11', 139), (714, 18, 67, 'c12', 142), (715, 5, 80, NULL, 145), (716, 12, 93, 'c1', 148), (717, 19, 9, 'c2', 151), (718, 6, 22, 'c3', 154), (719, 13, 35, 'c4', 157), (720, 0, 48, 'c5', 160), (721, 7, 61, 'c6', 163), (722, 14, 74, 'c7', 166), (723, 1, 87, 'c8', 169), (724, 8, 3, 'c9', 172), (725, NULL, 16, 'c10', 175);
+INSERT INTO t VALUES (726, 2, 29, NULL, 178), (727, 9, 42, 'c12', 181), (728, 16, 55, 'c0', 184), (729, 3, 68, 'c1', 187), (730, 10, 81, 'c2', 190), (731, 17, 94, 'c3', 193), (732, 4, 10, 'c4', 196), (733, 11, 23, 'c5', 199), (734, 18, 36, 'c6', 202), (735, 5, 49, 'c7', 205), (736, 12, 62, 'c8', 208), (737, 19, 75, NULL, 211), (738, 6, 88, 'c10', 214), (739, 13, 4, 'c11', 217), (740, 0, 17, 'c12', 220), (741, 7, 30, 'c0', 223), (742, 14, 43, 'c1', 226), (743, 1, 56, 'c2', 229), (744, 8, 69, 'c3', 232), (745, 15, 82, 'c4', 235), (746, 2, 95, 'c5', 238), (747, 9, 11, 'c6', 241), (748, 16, 24, NULL, 244), (749, 3, 37, 'c8', 247), (750, 10, 50, 'c9', 250);
+INSERT INTO t VALUES (751, 17, 63, 'c10', 253), (752, 4, 76, 'c11', 256), (753, 11, 89, 'c12', 259), (754, NULL, 5, 'c0', 262), (755, 5, 18, 'c1', 265), (756, 12, 31, 'c2', 268), (757, 19, 44, 'c3', 271), (758, 6, 57, 'c4', 274), (759, 13, 70, NULL, 277), (760, 0, 83, 'c6', 280), (761, 7, 96, 'c7', 283), (762, 14, 12, 'c8', 286), (763, 1, 25, 'c9', 289), (764, 8, 38, 'c10', 292), (765, 15, 51, 'c11', 295), (766, 2, 64, 'c12', 298), (767, 9, 77, 'c0', 301), (768, 16, 90, 'c1', 304), (769, 3, 6, 'c2', 307), (770, 10, 19, NULL, 310), (771, 17, 32, 'c4', 313), (772, 4, 45, 'c5', 316), (773, 11, 58, 'c6', 319), (774, 18, 71, 'c7', 322), (775, 5, 84, 'c8', 325);
+INSERT INTO t VALUES (776, 12, 0, 'c9', 328), (777, 19, 13, 'c10', 331), (778, 6, 26, 'c11', 334), (779, 13, 39, 'c12', 337), (780, 0, 52, 'c0', 340), (781, 7, 65, NULL, 343), (782, 14, 78, 'c2', 346), (783, NULL, 91, 'c3', 349), (784, 8, 7, 'c4', 352), (785, 15, 20, 'c5', 355), (786, 2, 33, 'c6', 358), (787, 9, 46, 'c7', 361), (788, 16, 59, 'c8', 364), (789, 3, 72, 'c9', 367), (790, 10, 85, 'c10', 370), (791, 17, 1, 'c11', 373), (792, 4, 14, NULL, 376), (793, 11, 27, 'c0', 379), (794, 18, 40, 'c1', 382), (795, 5, 53, 'c2', 385), (796, 12, 66, 'c3', 388), (797, 19, 79, 'c4', 391), (798, 6, 92, 'c5', 394), (799, 13, 8, 'c6', 397), (800, 0, 21, 'c7', 400);
+INSERT INTO t VALUES (801, 7, 34, 'c8', 403), (802, 14, 47, 'c9', 406), (803, 1, 60, NULL, 409), (804, 8, 73, 'c11', 412), (805, 15, 86, 'c12', 415), (806, 2, 2, 'c0', 418), (807, 9, 15, 'c1', 421), (808, 16, 28, 'c2', 424), (809, 3, 41, 'c3', 427), (810, 10, 54, 'c4', 430), (811, 17, 67, 'c5', 433), (812, NULL, 80, 'c6', 436), (813, 11, 93, 'c7', 439), (814, 18, 9, NULL, 442), (815, 5, 22, 'c9', 445), (816, 12, 35, 'c10', 448), (817, 19, 48, 'c11', 451), (818, 6, 61, 'c12', 454), (819, 13, 74, 'c0', 457), (820, 0, 87, 'c1', 460), (821, 7, 3, 'c2', 463), (822, 14, 16, 'c3', 466), (823, 1, 29, 'c4', 469), (824, 8, 42, 'c5', 472), (825, 15, 55, NULL, 475);
+INSERT INTO t VALUES (826, 2, 68, 'c7', 478), (827, 9, 81, 'c8', 481), (828, 16, 94, 'c9', 484), (829, 3, 10, 'c10', 487), (830, 10, 23, 'c11', 490), (831, 17, 36, 'c12', 493), (832, 4, 49, 'c0', 496), (833, 11, 62, 'c1', 499), (834, 18, 75, 'c2', 502), (835, 5, 88, 'c3', 505), (836, 12, 4, NULL, 508), (837, 19, 17, 'c5', 511), (838, 6, 30, 'c6', 514), (839, 13, 43, 'c7', 517), (840, 0, 56, 'c8', 520), (841, NULL, 69, 'c9', 523), (842, 14, 82, 'c10', 526), (843, 1, 95, 'c11', 529), (844, 8, 11, 'c12', 532), (845, 15, 24, 'c0', 535), (846, 2, 37, 'c1', 538), (847, 9, 50, NULL, 541), (848, 16, 63, 'c3', 544), (849, 3, 76, 'c4', 547), (850, 10, 89, 'c5', 550);
+INSERT INTO t VALUES (851, 17, 5, 'c6', 553), (852, 4, 18, 'c7', 556), (853, 11, 31, 'c8', 559), (854, 18, 44, 'c9', 562), (855, 5, 57, 'c10', 565), (856, 12, 70, 'c11', 568), (857, 19, 83, 'c12', 571), (858, 6, 96, NULL, 574), (859, 13, 12, 'c1', 577), (860, 0, 25, 'c2', 580), (861, 7, 38, 'c3', 583), (862, 14, 51, 'c4', 586), (863, 1, 64, 'c5', 589), (864, 8, 77, 'c6', 592), (865, 15, 90, 'c7', 595), (866, 2, 6, 'c8', 598), (867, 9, 19, 'c9', 601), (868, 16, 32, 'c10', 604), (869, 3, 45, NULL, 607), (870, NULL, 58, 'c12', 610), (871, 17, 71, 'c0', 613), (872, 4, 84, 'c1', 616), (873, 11, 0, 'c2', 619), (874, 18, 13, 'c3', 622), (875, 5, 26, 'c4', 625);
+INSERT INTO t VALUES (876, 12, 39, 'c5', 628), (877, 19, 52, 'c6', 631), (878, 6, 65, 'c7', 634), (879, 13, 78, 'c8', 637), (880, 0, 91, NULL, 640), (881, 7, 7, 'c10', 643), (882, 14, 20, 'c11', 646), (883, 1, 33, 'c12', 649), (884, 8, 46, 'c0', 652), (885, 15, 59, 'c1', 655), (886, 2, 72, 'c2', 658), (887, 9, 85, 'c3', 661), (888, 16, 1, 'c4', 664), (889, 3, 14, 'c5', 667), (890, 10, 27, 'c6', 670), (891, 17, 40, NULL, 673), (892, 4, 53, 'c8', 676), (893, 11, 66, 'c9', 679), (894, 18, 79, 'c10', 682), (895, 5, 92, 'c11', 685), (896, 12, 8, 'c12', 688), (897, 19, 21, 'c0', 691), (898, 6, 34, 'c1', 694), (899, NULL, 47, 'c2', 697), (900, 0, 60, 'c3', 700);
+INSERT INTO t VALUES (901, 7, 73, 'c4', 703), (902, 14, 86, NULL, 706), (903, 1, 2, 'c6', 709), (904, 8, 15, 'c7', 712), (905, 15, 28, 'c8', 715), (906, 2, 41, 'c9', 718), (907, 9, 54, 'c10', 721), (908, 16, 67, 'c11', 724), (909, 3, 80, 'c12', 727), (910, 10, 93, 'c0', 730), (911, 17, 9, 'c1', 733), (912, 4, 22, 'c2', 736), (913, 11, 35, NULL, 739), (914, 18, 48, 'c4', 742), (915, 5, 61, 'c5', 745), (916, 12, 74, 'c6', 748), (917, 19, 87, 'c7', 751), (918, 6, 3, 'c8', 754), (919, 13, 16, 'c9', 757), (920, 0, 29, 'c10', 760), (921, 7, 42, 'c11', 763), (922, 14, 55, 'c12', 766), (923, 1, 68, 'c0', 769), (924, 8, 81, NULL, 772), (925, 15, 94, 'c2', 775);
+INSERT INTO t VALUES (926, 2, 10, 'c3', 778), (927, 9, 23, 'c4', 781), (928, NULL, 36, 'c5', 784), (929, 3, 49, 'c6', 787), (930, 10, 62, 'c7', 790), (931, 17, 75, 'c8', 793), (932, 4, 88, 'c9', 796), (933, 11, 4, 'c10', 799), (934, 18, 17, 'c11', 802), (935, 5, 30, NULL, 805), (936, 12, 43, 'c0', 808), (937, 19, 56, 'c1', 811), (938, 6, 69, 'c2', 814), (939, 13, 82, 'c3', 817), (940, 0, 95, 'c4', 820), (941, 7, 11, 'c5', 823), (942, 14, 24, 'c6', 826), (943, 1, 37, 'c7', 829), (944, 8, 50, 'c8', 832), (945, 15, 63, 'c9', 835), (946, 2, 76, NULL, 838), (947, 9, 89, 'c11', 841), (948, 16, 5, 'c12', 844), (949, 3, 18, 'c0', 847), (950, 10, 31, 'c1', 850);
+INSERT INTO t VALUES (951, 17, 44, 'c2', 853), (952, 4, 57, 'c3', 856), (953, 11, 70, 'c4', 859), (954, 18, 83, 'c5', 862), (955, 5, 96, 'c6', 865), (956, 12, 12, 'c7', 868), (957, NULL, 25, NULL, 871), (958, 6, 38, 'c9', 874), (959, 13, 51, 'c10', 877), (960, 0, 64, 'c11', 880), (961, 7, 77, 'c12', 883), (962, 14, 90, 'c0', 886), (963, 1, 6, 'c1', 889), (964, 8, 19, 'c2', 892), (965, 15, 32, 'c3', 895), (966, 2, 45, 'c4', 898), (967, 9, 58, 'c5', 901), (968, 16, 71, NULL, 904), (969, 3, 84, 'c7', 907), (970, 10, 0, 'c8', 910), (971, 17, 13, 'c9', 913), (972, 4, 26, 'c10', 916), (973, 11, 39, 'c11', 919), (974, 18, 52, 'c12', 922), (975, 5, 65, 'c0', 925);
+INSERT INTO t VALUES (976, 12, 78, 'c1', 928), (977, 19, 91, 'c2', 931), (978, 6, 7, 'c3', 934), (979, 13, 20, NULL, 937), (980, 0, 33, 'c5', 940), (981, 7, 46, 'c6', 943), (982, 14, 59, 'c7', 946), (983, 1, 72, 'c8', 949), (984, 8, 85, 'c9', 952), (985, 15, 1, 'c10', 955), (986, NULL, 14, 'c11', 958), (987, 9, 27, 'c12', 961), (988, 16, 40, 'c0', 964), (989, 3, 53, 'c1', 967), (990, 10, 66, NULL, 970), (991, 17, 79, 'c3', 973), (992, 4, 92, 'c4', 976), (993, 11, 8, 'c5', 979), (994, 18, 21, 'c6', 982), (995, 5, 34, 'c7', 985), (996, 12, 47, 'c8', 988), (997, 19, 60, 'c9', 991), (998, 6, 73, 'c10', 994), (999, 13, 86, 'c11', 997), (1000, 0, 2, 'c12', 0);
+INSERT INTO t VALUES (1001, 7, 15, NULL, 3), (1002, 14, 28, 'c1', 6), (1003, 1, 41, 'c2', 9), (1004, 8, 54, 'c3', 12), (1005, 15, 67, 'c4', 15), (1006, 2, 80, 'c5', 18), (1007, 9, 93, 'c6', 21), (1008, 16, 9, 'c7', 24), (1009, 3, 22, 'c8', 27), (1010, 10, 35, 'c9', 30), (1011, 17, 48, 'c10', 33), (1012, 4, 61, NULL, 36), (1013, 11, 74, 'c12', 39), (1014, 18, 87, 'c0', 42), (1015, NULL, 3, 'c1', 45), (1016, 12, 16, 'c2', 48), (1017, 19, 29, 'c3', 51), (1018, 6, 42, 'c4', 54), (1019, 13, 55, 'c5', 57), (1020, 0, 68, 'c6', 60), (1021, 7, 81, 'c7', 63), (1022, 14, 94, 'c8', 66), (1023, 1, 10, NULL, 69), (1024, 8, 23, 'c10', 72), (1025, 15, 36, 'c11', 75);
+INSERT INTO t VALUES (1026, 2, 49, 'c12', 78), (1027, 9, 62, 'c0', 81), (1028, 16, 75, 'c1', 84), (1029, 3, 88, 'c2', 87), (1030, 10, 4, 'c3', 90), (1031, 17, 17, 'c4', 93), (1032, 4, 30, 'c5', 96), (1033, 11, 43, 'c6', 99), (1034, 18, 56, NULL, 102), (1035, 5, 69, 'c8', 105), (1036, 12, 82, 'c9', 108), (1037, 19, 95, 'c10', 111), (1038, 6, 11, 'c11', 114), (1039, 13, 24, 'c12', 117), (1040, 0, 37, 'c0', 120), (1041, 7, 50, 'c1', 123), (1042, 14, 63, 'c2', 126), (1043, 1, 76, 'c3', 129), (1044, NULL, 89, 'c4', 132), (1045, 15, 5, NULL, 135), (1046, 2, 18, 'c6', 138), (1047, 9, 31, 'c7', 141), (1048, 16, 44, 'c8', 144), (1049, 3, 57, 'c9', 147), (1050, 10, 70, 'c10', 150);
+INSERT INTO t VALUES (1051, 17, 83, 'c11', 153), (1052, 4, 96, 'c12', 156), (1053, 11, 12, 'c0', 159), (1054, 18, 25, 'c1', 162), (1055, 5, 38, 'c2', 165), (1056, 12, 51, NULL, 168), (1057, 19, 64, 'c4', 171), (1058, 6, 77, 'c5', 174), (1059, 13, 90, 'c6', 177), (1060, 0, 6, 'c7', 180), (1061, 7, 19, 'c8', 183), (1062, 14, 32, 'c9', 186), (1063, 1, 45, 'c10', 189), (1064, 8, 58, 'c11', 192), (1065, 15, 71, 'c12', 195), (1066, 2, 84, 'c0', 198), (1067, 9, 0, NULL, 201), (1068, 16, 13, 'c2', 204), (1069, 3, 26, 'c3', 207), (1070, 10, 39, 'c4', 210), (1071, 17, 52, 'c5', 213), (1072, 4, 65, 'c6', 216), (1073, NULL, 78, 'c7', 219), (1074, 18, 91, 'c8', 222), (1075, 5, 7, 'c9', 225);
+INSERT INTO t VALUES (1076, 12, 20, 'c10', 228), (1077, 19, 33, 'c11', 231), (1078, 6, 46, NULL, 234), (1079, 13, 59, 'c0', 237), (1080, 0, 72, 'c1', 240), (1081, 7, 85, 'c2', 243), (1082, 14, 1, 'c3', 246), (1083, 1, 14, 'c4', 249), (1084, 8, 27, 'c5', 252), (1085, 15, 40, 'c6', 255), (1086, 2, 53, 'c7', 258), (1087, 9, 66, 'c8', 261), (1088, 16, 79, 'c9', 264), (1089, 3, 92, NULL, 267), (1090, 10, 8, 'c11', 270), (1091, 17, 21, 'c12', 273), (1092, 4, 34, 'c0', 276), (1093, 11, 47, 'c1', 279), (1094, 18, 60, 'c2', 282), (1095, 5, 73, 'c3', 285), (1096, 12, 86, 'c4', 288), (1097, 19, 2, 'c5', 291), (1098, 6, 15, 'c6', 294), (1099, 13, 28, 'c7', 297), (1100, 0, 41, NULL, 300);
+INSERT INTO t VALUES (1101, 7, 54, 'c9', 303), (1102, NULL, 67, 'c10', 306), (1103, 1, 80, 'c11', 309), (1104, 8, 93, 'c12', 312), (1105, 15, 9, 'c0', 315), (1106, 2, 22, 'c1', 318), (1107, 9, 35, 'c2', 321), (1108, 16, 48, 'c3', 324), (1109, 3, 61, 'c4', 327), (1110, 10, 74, 'c5', 330), (1111, 17, 87, NULL, 333), (1112, 4, 3, 'c7', 336), (1113, 11, 16, 'c8', 339), (1114, 18, 29, 'c9', 342), (1115, 5, 42, 'c10', 345), (1116, 12, 55, 'c11', 348), (1117, 19, 68, 'c12', 351), (1118, 6, 81, 'c0', 354), (1119, 13, 94, 'c1', 357), (1120, 0, 10, 'c2', 360), (1121, 7, 23, 'c3', 363), (1122, 14, 36, NULL, 366), (1123, 1, 49, 'c5', 369), (1124, 8, 62, 'c6', 372), (1125, 15, 75, 'c7', 375);
+INSERT INTO t VALUES (1126, 2, 88, 'c8', 378), (1127, 9, 4, 'c9', 381), (1128, 16, 17, 'c10', 384), (1129, 3, 30, 'c11', 387), (1130, 10, 43, 'c12', 390), (1131, NULL, 56, 'c0', 393), (1132, 4, 69, 'c1', 396), (1133, 11, 82, NULL, 399), (1134, 18, 95, 'c3', 402), (1135, 5, 11, 'c4', 405), (1136, 12, 24, 'c5', 408), (1137, 19, 37, 'c6', 411), (1138, 6, 50, 'c7', 414), (1139, 13, 63, 'c8', 417), (1140, 0, 76, 'c9', 420), (1141, 7, 89, 'c10', 423), (1142, 14, 5, 'c11', 426), (1143, 1, 18, 'c12', 429), (1144, 8, 31, NULL, 432), (1145, 15, 44, 'c1', 435), (1146, 2, 57, 'c2', 438), (1147, 9, 70, 'c3', 441), (1148, 16, 83, 'c4', 444), (1149, 3, 96, 'c5', 447), (1150, 10, 12, 'c6', 450);
+INSERT INTO t VALUES (1151, 17, 25, 'c7', 453), (1152, 4, 38, 'c8', 456), (1153, 11, 51, 'c9', 459), (1154, 18, 64, 'c10', 462), (1155, 5, 77, NULL, 465), (1156, 12, 90, 'c12', 468), (1157, 19, 6, 'c0', 471), (1158, 6, 19, 'c1', 474), (1159, 13, 32, 'c2', 477), (1160, NULL, 45, 'c3', 480), (1161, 7, 58, 'c4', 483), (1162, 14, 71, 'c5', 486), (1163, 1, 84, 'c6', 489), (1164, 8, 0, 'c7', 492), (1165, 15, 13, 'c8', 495), (1166, 2, 26, NULL, 498), (1167, 9, 39, 'c10', 501), (1168, 16, 52, 'c11', 504), (1169, 3, 65, 'c12', 507), (1170, 10, 78, 'c0', 510), (1171, 17, 91, 'c1', 513), (1172, 4, 7, 'c2', 516), (1173, 11, 20, 'c3', 519), (1174, 18, 33, 'c4', 522), (1175, 5, 46, 'c5', 525);
+INSERT INTO t VALUES (1176, 12, 59, 'c6', 528), (1177, 19, 72, NULL, 531), (1178, 6, 85, 'c8', 534), (1179, 13, 1, 'c9', 537), (1180, 0, 14, 'c10', 540), (1181, 7, 27, 'c11', 543), (1182, 14, 40, 'c12', 546), (1183, 1, 53, 'c0', 549), (1184, 8, 66, 'c1', 552), (1185, 15, 79, 'c2', 555), (1186, 2, 92, 'c3', 558), (1187, 9, 8, 'c4', 561), (1188, 16, 21, NULL, 564), (1189, NULL, 34, 'c6', 567), (1190, 10, 47, 'c7', 570), (1191, 17, 60, 'c8', 573), (1192, 4, 73, 'c9', 576), (1193, 11, 86, 'c10', 579), (1194, 18, 2, 'c11', 582), (1195, 5, 15, 'c12', 585), (1196, 12, 28, 'c0', 588), (1197, 19, 41, 'c1', 591), (1198, 6, 54, 'c2', 594), (1199, 13, 67, NULL, 597), (1200, 0, 80, 'c4', 600);
+CREATE INDEX t("a, b INCLUDE c");
+-- covered
+SELECT a, b, c FROM t WHERE a = 3 AND b < 20 ORDER BY b;
+SELECT c, b FROM t WHERE a = 17 AND b >= 90 ORDER BY b;
+SELECT NUM(a), SUM(b) FROM t WHERE a = 6;
+SELECT b, c FROM t WHERE a = 9 AND c = 'c4' ORDER BY b;
+SELECT a, b, c FROM t WHERE a = NULL AND b < 30 ORDER BY b;
+SELECT a, b, c FROM t WHERE a > 17 AND c = NULL ORDER BY b;
+-- d and id are not in the index, the rows are read
+SELECT id, a, b, d FROM t WHERE a = 3 AND b < 20 ORDER BY id;
+SELECT id, c FROM t WHERE a = 17 AND b >= 90 ORDER BY id;
+SELECT a, b, c FROM t WHERE a = 9 AND d < 100 ORDER BY b;
+-- changes to included and key columns show in covered reads
+UPDATE t SET c = 'new' WHERE a = 3 AND b < 10;
+UPDATE t SET b = 95 WHERE a = 17 AND b = 90;
+UPDATE t SET c = NULL WHERE a = 9 AND c = 'c4';
+DELETE FROM t WHERE a = 6 AND b > 50;
+INSERT INTO t VALUES (1201, 3, 1, 'ins', 5), (1202, 17, 99, NULL, 6), (1203, 6, 0, 'c0', 7);
+-- covered
+SELECT a, b, c FROM t WHERE a = 3 AND b < 20 ORDER BY b;
+SELECT c, b FROM t WHERE a = 17 AND b >= 90 ORDER BY b;
+SELECT NUM(a), SUM(b) FROM t WHERE a = 6;
+SELECT b, c FROM t WHERE a = 9 AND c = 'c4' ORDER BY b;
+SELECT a, b, c FROM t WHERE a = NULL AND b < 30 ORDER BY b;
+SELECT a, b, c FROM t WHERE a > 17 AND c = NULL ORDER BY b;
+-- d and id are not in the index, the rows are read
+SELECT id, a, b, d FROM t WHERE a = 3 AND b < 20 ORDER BY id;
+SELECT id, c FROM t WHERE a = 17 AND b >= 90 ORDER BY id;
+SELECT a, b, c FROM t WHERE a = 9 AND d < 100 ORDER BY b;
+DROP INDEX t("a, b INCLUDE c");
+SELECT a, b, c FROM t WHERE a = 3 AND b < 20 ORDER BY b;
+SELECT c, b FROM t WHERE a = 17 AND b >= 90 ORDER BY b;
+SELECT NUM(a), SUM(b) FROM t WHERE a = 6;
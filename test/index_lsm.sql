@@ -0,0 +1,83 @@
+-- LSM indexes through SQL, see run_sql.sh; runs, merges and deletions
+-- held over older runs are checked by test/lsm_test.cpp
+CREATE DATABASE il;
+USE DATABASE il;
+CREATE TABLE t(id int(10) NOT NULL, a int(10), s varchar(10), PRIMARY KEY(id));
+CREATE INDEX t("a USING LSM");
+INSERT INTO t VALUES (1, 7, 'v31'), (2, 14, 'v62'), (3, 21, 'v93'), (4, 28, 'v124'), (5, 35, 'v155'), (6, 42, 'v186'), (7, 49, 'v6'), (8, 56, 'v37'), (9, 63, 'v68'), (10, 70, 'v99'), (11, 77, 'v130'), (12, 84, 'v161'), (13, 91, 'v192'), (14, 98, 'v12'), (15, 5, 'v43'), (16, 12, 'v74'), (17, NULL, 'v105'), (18, 26, 'v136'), (19, 33, 'v167'), (20, 40, 'v198'), (21, 47, 'v18'), (22, 54, 'v49'), (23, 61, 'v80'), (24, 68, 'v111'), (25, 75, 'v142');
+INSERT INTO t VALUES (26, 82, 'v173'), (27, 89, 'v204'), (28, 96, 'v24'), (29, 3, 'v55'), (30, 10, 'v86'), (31, 17, 'v117'), (32, 24, 'v148'), (33, 31, 'v179'), (34, NULL, 'v210'), (35, 45, 'v30'), (36, 52, 'v61'), (37, 59, 'v92'), (38, 66, 'v123'), (39, 73, 'v154'), (40, 80, 'v185'), (41, 87, 'v5'), (42, 94, 'v36'), (43, 1, 'v67'), (44, 8, 'v98'), (45, 15, 'v129'), (46, 22, 'v160'), (47, 29, 'v191'), (48, 36, 'v11'), (49, 43, 'v42'), (50, 50, 'v73');
+INSERT INTO t VALUES (51, NULL, 'v104'), (52, 64, 'v135'), (53, 71, 'v166'), (54, 78, 'v197'), (55, 85, 'v17'), (56, 92, 'v48'), (57, 99, 'v79'), (58, 6, 'v110'), (59, 13, 'v141'), (60, 20, 'v172'), (61, 27, 'v203'), (62, 34, 'v23'), (63, 41, 'v54'), (64, 48, 'v85'), (65, 55, 'v116'), (66, 62, 'v147'), (67, 69, 'v178'), (68, NULL, 'v209'), (69, 83, 'v29'), (70, 90, 'v60'), (71, 97, 'v91'), (72, 4, 'v122'), (73, 11, 'v153'), (74, 18, 'v184'), (75, 25, 'v4');
+INSERT INTO t VALUES (76, 32, 'v35'), (77, 39, 'v66'), (78, 46, 'v97'), (79, 53, 'v128'), (80, 60, 'v159'), (81, 67, 'v190'), (82, 74, 'v10'), (83, 81, 'v41'), (84, 88, 'v72'), (85, NULL, 'v103'), (86, 2, 'v134'), (87, 9, 'v165'), (88, 16, 'v196'), (89, 23, 'v16'), (90, 30, 'v47'), (91, 37, 'v78'), (92, 44, 'v109'), (93, 51, 'v140'), (94, 58, 'v171'), (95, 65, 'v202'), (96, 72, 'v22'), (97, 79, 'v53'), (98, 86, 'v84'), (99, 93, 'v115'), (100, 0, 'v146');
+INSERT INTO t VALUES (101, 7, 'v177'), (102, NULL, 'v208'), (103, 21, 'v28'), (104, 28, 'v59'), (105, 35, 'v90'), (106, 42, 'v121'), (107, 49, 'v152'), (108, 56, 'v183'), (109, 63, 'v3'), (110, 70, 'v34'), (111, 77, 'v65'), (112, 84, 'v96'), (113, 91, 'v127'), (114, 98, 'v158'), (115, 5, 'v189'), (116, 12, 'v9'), (117, 19, 'v40'), (118, 26, 'v71'), (119, NULL, 'v102'), (120, 40, 'v133'), (121, 47, 'v164'), (122, 54, 'v195'), (123, 61, 'v15'), (124, 68, 'v46'), (125, 75, 'v77');
+INSERT INTO t VALUES (126, 82, 'v108'), (127, 89, 'v139'), (128, 96, 'v170'), (129, 3, 'v201'), (130, 10, 'v21'), (131, 17, 'v52'), (132, 24, 'v83'), (133, 31, 'v114'), (134, 38, 'v145'), (135, 45, 'v176'), (136, NULL, 'v207'), (137, 59, 'v27'), (138, 66, 'v58'), (139, 73, 'v89'), (140, 80, 'v120'), (141, 87, 'v151'), (142, 94, 'v182'), (143, 1, 'v2'), (144, 8, 'v33'), (145, 15, 'v64'), (146, 22, 'v95'), (147, 29, 'v126'), (148, 36, 'v157'), (149, 43, 'v188'), (150, 50, 'v8');
+INSERT INTO t VALUES (151, 57, 'v39'), (152, 64, 'v70'), (153, NULL, 'v101'), (154, 78, 'v132'), (155, 85, 'v163'), (156, 92, 'v194'), (157, 99, 'v14'), (158, 6, 'v45'), (159, 13, 'v76'), (160, 20, 'v107'), (161, 27, 'v138'), (162, 34, 'v169'), (163, 41, 'v200'), (164, 48, 'v20'), (165, 55, 'v51'), (166, 62, 'v82'), (167, 69, 'v113'), (168, 76, 'v144'), (169, 83, 'v175'), (170, NULL, 'v206'), (171, 97, 'v26'), (172, 4, 'v57'), (173, 11, 'v88'), (174, 18, 'v119'), (175, 25, 'v150');
+INSERT INTO t VALUES (176, 32, 'v181'), (177, 39, 'v1'), (178, 46, 'v32'), (179, 53, 'v63'), (180, 60, 'v94'), (181, 67, 'v125'), (182, 74, 'v156'), (183, 81, 'v187'), (184, 88, 'v7'), (185, 95, 'v38'), (186, 2, 'v69'), (187, NULL, 'v100'), (188, 16, 'v131'), (189, 23, 'v162'), (190, 30, 'v193'), (191, 37, 'v13'), (192, 44, 'v44'), (193, 51, 'v75'), (194, 58, 'v106'), (195, 65, 'v137'), (196, 72, 'v168'), (197, 79, 'v199'), (198, 86, 'v19'), (199, 93, 'v50'), (200, 0, 'v81');
+INSERT INTO t VALUES (201, 7, 'v112'), (202, 14, 'v143'), (203, 21, 'v174'), (204, NULL, 'v205'), (205, 35, 'v25'), (206, 42, 'v56'), (207, 49, 'v87'), (208, 56, 'v118'), (209, 63, 'v149'), (210, 70, 'v180'), (211, 77, 'v0'), (212, 84, 'v31'), (213, 91, 'v62'), (214, 98, 'v93'), (215, 5, 'v124'), (216, 12, 'v155'), (217, 19, 'v186'), (218, 26, 'v6'), (219, 33, 'v37'), (220, 40, 'v68'), (221, NULL, 'v99'), (222, 54, 'v130'), (223, 61, 'v161'), (224, 68, 'v192'), (225, 75, 'v12');
+INSERT INTO t VALUES (226, 82, 'v43'), (227, 89, 'v74'), (228, 96, 'v105'), (229, 3, 'v136'), (230, 10, 'v167'), (231, 17, 'v198'), (232, 24, 'v18'), (233, 31, 'v49'), (234, 38, 'v80'), (235, 45, 'v111'), (236, 52, 'v142'), (237, 59, 'v173'), (238, NULL, 'v204'), (239, 73, 'v24'), (240, 80, 'v55'), (241, 87, 'v86'), (242, 94, 'v117'), (243, 1, 'v148'), (244, 8, 'v179'), (245, 15, 'v210'), (246, 22, 'v30'), (247, 29, 'v61'), (248, 36, 'v92'), (249, 43, 'v123'), (250, 50, 'v154');
+INSERT INTO t VALUES (251, 57, 'v185'), (252, 64, 'v5'), (253, 71, 'v36'), (254, 78, 'v67'), (255, NULL, 'v98'), (256, 92, 'v129'), (257, 99, 'v160'), (258, 6, 'v191'), (259, 13, 'v11'), (260, 20, 'v42'), (261, 27, 'v73'), (262, 34, 'v104'), (263, 41, 'v135'), (264, 48, 'v166'), (265, 55, 'v197'), (266, 62, 'v17'), (267, 69, 'v48'), (268, 76, 'v79'), (269, 83, 'v110'), (270, 90, 'v141'), (271, 97, 'v172'), (272, NULL, 'v203'), (273, 11, 'v23'), (274, 18, 'v54'), (275, 25, 'v85');
+INSERT INTO t VALUES (276, 32, 'v116'), (277, 39, 'v147'), (278, 46, 'v178'), (279, 53, 'v209'), (280, 60, 'v29'), (281, 67, 'v60'), (282, 74, 'v91'), (283, 81, 'v122'), (284, 88, 'v153'), (285, 95, 'v184'), (286, 2, 'v4'), (287, 9, 'v35'), (288, 16, 'v66'), (289, NULL, 'v97'), (290, 30, 'v128'), (291, 37, 'v159'), (292, 44, 'v190'), (293, 51, 'v10'), (294, 58, 'v41'), (295, 65, 'v72'), (296, 72, 'v103'), (297, 79, 'v134'), (298, 86, 'v165'), (299, 93, 'v196'), (300, 0, 'v16');
+INSERT INTO t VALUES (301, 7, 'v47'), (302, 14, 'v78'), (303, 21, 'v109'), (304, 28, 'v140'), (305, 35, 'v171'), (306, NULL, 'v202'), (307, 49, 'v22'), (308, 56, 'v53'), (309, 63, 'v84'), (310, 70, 'v115'), (311, 77, 'v146'), (312, 84, 'v177'), (313, 91, 'v208'), (314, 98, 'v28'), (315, 5, 'v59'), (316, 12, 'v90'), (317, 19, 'v121'), (318, 26, 'v152'), (319, 33, 'v183'), (320, 40, 'v3'), (321, 47, 'v34'), (322, 54, 'v65'), (323, NULL, 'v96'), (324, 68, 'v127'), (325, 75, 'v158');
+INSERT INTO t VALUES (326, 82, 'v189'), (327, 89, 'v9'), (328, 96, 'v40'), (329, 3, 'v71'), (330, 10, 'v102'), (331, 17, 'v133'), (332, 24, 'v164'), (333, 31, 'v195'), (334, 38, 'v15'), (335, 45, 'v46'), (336, 52, 'v77'), (337, 59, 'v108'), (338, 66, 'v139'), (339, 73, 'v170'), (340, NULL, 'v201'), (341, 87, 'v21'), (342, 94, 'v52'), (343, 1, 'v83'), (344, 8, 'v114'), (345, 15, 'v145'), (346, 22, 'v176'), (347, 29, 'v207'), (348, 36, 'v27'), (349, 43, 'v58'), (350, 50, 'v89');
+INSERT INTO t VALUES (351, 57, 'v120'), (352, 64, 'v151'), (353, 71, 'v182'), (354, 78, 'v2'), (355, 85, 'v33'), (356, 92, 'v64'), (357, NULL, 'v95'), (358, 6, 'v126'), (359, 13, 'v157'), (360, 20, 'v188'), (361, 27, 'v8'), (362, 34, 'v39'), (363, 41, 'v70'), (364, 48, 'v101'), (365, 55, 'v132'), (366, 62, 'v163'), (367, 69, 'v194'), (368, 76, 'v14'), (369, 83, 'v45'), (370, 90, 'v76'), (371, 97, 'v107'), (372, 4, 'v138'), (373, 11, 'v169'), (374, NULL, 'v200'), (375, 25, 'v20');
+INSERT INTO t VALUES (376, 32, 'v51'), (377, 39, 'v82'), (378, 46, 'v113'), (379, 53, 'v144'), (380, 60, 'v175'), (381, 67, 'v206'), (382, 74, 'v26'), (383, 81, 'v57'), (384, 88, 'v88'), (385, 95, 'v119'), (386, 2, 'v150'), (387, 9, 'v181'), (388, 16, 'v1'), (389, 23, 'v32'), (390, 30, 'v63'), (391, NULL, 'v94'), (392, 44, 'v125'), (393, 51, 'v156'), (394, 58, 'v187'), (395, 65, 'v7'), (396, 72, 'v38'), (397, 79, 'v69'), (398, 86, 'v100'), (399, 93, 'v131'), (400, 0, 'v162');
+INSERT INTO t VALUES (401, 7, 'v193'), (402, 14, 'v13'), (403, 21, 'v44'), (404, 28, 'v75'), (405, 35, 'v106'), (406, 42, 'v137'), (407, 49, 'v168'), (408, NULL, 'v199'), (409, 63, 'v19'), (410, 70, 'v50'), (411, 77, 'v81'), (412, 84, 'v112'), (413, 91, 'v143'), (414, 98, 'v174'), (415, 5, 'v205'), (416, 12, 'v25'), (417, 19, 'v56'), (418, 26, 'v87'), (419, 33, 'v118'), (420, 40, 'v149'), (421, 47, 'v180'), (422, 54, 'v0'), (423, 61, 'v31'), (424, 68, 'v62'), (425, NULL, 'v93');
+INSERT INTO t VALUES (426, 82, 'v124'), (427, 89, 'v155'), (428, 96, 'v186'), (429, 3, 'v6'), (430, 10, 'v37'), (431, 17, 'v68'), (432, 24, 'v99'), (433, 31, 'v130'), (434, 38, 'v161'), (435, 45, 'v192'), (436, 52, 'v12'), (437, 59, 'v43'), (438, 66, 'v74'), (439, 73, 'v105'), (440, 80, 'v136'), (441, 87, 'v167'), (442, NULL, 'v198'), (443, 1, 'v18'), (444, 8, 'v49'), (445, 15, 'v80'), (446, 22, 'v111'), (447, 29, 'v142'), (448, 36, 'v173'), (449, 43, 'v204'), (450, 50, 'v24');
+INSERT INTO t VALUES (451, 57, 'v55'), (452, 64, 'v86'), (453, 71, 'v117'), (454, 78, 'v148'), (455, 85, 'v179'), (456, 92, 'v210'), (457, 99, 'v30'), (458, 6, 'v61'), (459, NULL, 'v92'), (460, 20, 'v123'), (461, 27, 'v154'), (462, 34, 'v185'), (463, 41, 'v5'), (464, 48, 'v36'), (465, 55, 'v67'), (466, 62, 'v98'), (467, 69, 'v129'), (468, 76, 'v160'), (469, 83, 'v191'), (470, 90, 'v11'), (471, 97, 'v42'), (472, 4, 'v73'), (473, 11, 'v104'), (474, 18, 'v135'), (475, 25, 'v166');
+INSERT INTO t VALUES (476, NULL, 'v197'), (477, 39, 'v17'), (478, 46, 'v48'), (479, 53, 'v79'), (480, 60, 'v110'), (481, 67, 'v141'), (482, 74, 'v172'), (483, 81, 'v203'), (484, 88, 'v23'), (485, 95, 'v54'), (486, 2, 'v85'), (487, 9, 'v116'), (488, 16, 'v147'), (489, 23, 'v178'), (490, 30, 'v209'), (491, 37, 'v29'), (492, 44, 'v60'), (493, NULL, 'v91'), (494, 58, 'v122'), (495, 65, 'v153'), (496, 72, 'v184'), (497, 79, 'v4'), (498, 86, 'v35'), (499, 93, 'v66'), (500, 0, 'v97');
+INSERT INTO t VALUES (501, 7, 'v128'), (502, 14, 'v159'), (503, 21, 'v190'), (504, 28, 'v10'), (505, 35, 'v41'), (506, 42, 'v72'), (507, 49, 'v103'), (508, 56, 'v134'), (509, 63, 'v165'), (510, NULL, 'v196'), (511, 77, 'v16'), (512, 84, 'v47'), (513, 91, 'v78'), (514, 98, 'v109'), (515, 5, 'v140'), (516, 12, 'v171'), (517, 19, 'v202'), (518, 26, 'v22'), (519, 33, 'v53'), (520, 40, 'v84'), (521, 47, 'v115'), (522, 54, 'v146'), (523, 61, 'v177'), (524, 68, 'v208'), (525, 75, 'v28');
+INSERT INTO t VALUES (526, 82, 'v59'), (527, NULL, 'v90'), (528, 96, 'v121'), (529, 3, 'v152'), (530, 10, 'v183'), (531, 17, 'v3'), (532, 24, 'v34'), (533, 31, 'v65'), (534, 38, 'v96'), (535, 45, 'v127'), (536, 52, 'v158'), (537, 59, 'v189'), (538, 66, 'v9'), (539, 73, 'v40'), (540, 80, 'v71'), (541, 87, 'v102'), (542, 94, 'v133'), (543, 1, 'v164'), (544, NULL, 'v195'), (545, 15, 'v15'), (546, 22, 'v46'), (547, 29, 'v77'), (548, 36, 'v108'), (549, 43, 'v139'), (550, 50, 'v170');
+INSERT INTO t VALUES (551, 57, 'v201'), (552, 64, 'v21'), (553, 71, 'v52'), (554, 78, 'v83'), (555, 85, 'v114'), (556, 92, 'v145'), (557, 99, 'v176'), (558, 6, 'v207'), (559, 13, 'v27'), (560, 20, 'v58'), (561, NULL, 'v89'), (562, 34, 'v120'), (563, 41, 'v151'), (564, 48, 'v182'), (565, 55, 'v2'), (566, 62, 'v33'), (567, 69, 'v64'), (568, 76, 'v95'), (569, 83, 'v126'), (570, 90, 'v157'), (571, 97, 'v188'), (572, 4, 'v8'), (573, 11, 'v39'), (574, 18, 'v70'), (575, 25, 'v101');
+INSERT INTO t VALUES (576, 32, 'v132'), (577, 39, 'v163'), (578, NULL, 'v194'), (579, 53, 'v14'), (580, 60, 'v45'), (581, 67, 'v76'), (582, 74, 'v107'), (583, 81, 'v138'), (584, 88, 'v169'), (585, 95, 'v200'), (586, 2, 'v20'), (587, 9, 'v51'), (588, 16, 'v82'), (589, 23, 'v113'), (590, 30, 'v144'), (591, 37, 'v175'), (592, 44, 'v206'), (593, 51, 'v26'), (594, 58, 'v57'), (595, NULL, 'v88'), (596, 72, 'v119'), (597, 79, 'v150'), (598, 86, 'v181'), (599, 93, 'v1'), (600, 0, 'v32');
+INSERT INTO t VALUES (601, 7, 'v63'), (602, 14, 'v94'), (603, 21, 'v125'), (604, 28, 'v156'), (605, 35, 'v187'), (606, 42, 'v7'), (607, 49, 'v38'), (608, 56, 'v69'), (609, 63, 'v100'), (610, 70, 'v131'), (611, 77, 'v162'), (612, NULL, 'v193'), (613, 91, 'v13'), (614, 98, 'v44'), (615, 5, 'v75'), (616, 12, 'v106'), (617, 19, 'v137'), (618, 26, 'v168'), (619, 33, 'v199'), (620, 40, 'v19'), (621, 47, 'v50'), (622, 54, 'v81'), (623, 61, 'v112'), (624, 68, 'v143'), (625, 75, 'v174');
+INSERT INTO t VALUES (626, 82, 'v205'), (627, 89, 'v25'), (628, 96, 'v56'), (629, NULL, 'v87'), (630, 10, 'v118'), (631, 17, 'v149'), (632, 24, 'v180'), (633, 31, 'v0'), (634, 38, 'v31'), (635, 45, 'v62'), (636, 52, 'v93'), (637, 59, 'v124'), (638, 66, 'v155'), (639, 73, 'v186'), (640, 80, 'v6'), (641, 87, 'v37'), (642, 94, 'v68'), (643, 1, 'v99'), (644, 8, 'v130'), (645, 15, 'v161'), (646, NULL, 'v192'), (647, 29, 'v12'), (648, 36, 'v43'), (649, 43, 'v74'), (650, 50, 'v105');
+INSERT INTO t VALUES (651, 57, 'v136'), (652, 64, 'v167'), (653, 71, 'v198'), (654, 78, 'v18'), (655, 85, 'v49'), (656, 92, 'v80'), (657, 99, 'v111'), (658, 6, 'v142'), (659, 13, 'v173'), (660, 20, 'v204'), (661, 27, 'v24'), (662, 34, 'v55'), (663, NULL, 'v86'), (664, 48, 'v117'), (665, 55, 'v148'), (666, 62, 'v179'), (667, 69, 'v210'), (668, 76, 'v30'), (669, 83, 'v61'), (670, 90, 'v92'), (671, 97, 'v123'), (672, 4, 'v154'), (673, 11, 'v185'), (674, 18, 'v5'), (675, 25, 'v36');
+INSERT INTO t VALUES (676, 32, 'v67'), (677, 39, 'v98'), (678, 46, 'v129'), (679, 53, 'v160'), (680, NULL, 'v191'), (681, 67, 'v11'), (682, 74, 'v42'), (683, 81, 'v73'), (684, 88, 'v104'), (685, 95, 'v135'), (686, 2, 'v166'), (687, 9, 'v197'), (688, 16, 'v17'), (689, 23, 'v48'), (690, 30, 'v79'), (691, 37, 'v110'), (692, 44, 'v141'), (693, 51, 'v172'), (694, 58, 'v203'), (695, 65, 'v23'), (696, 72, 'v54'), (697, NULL, 'v85'), (698, 86, 'v116'), (699, 93, 'v147'), (700, 0, 'v178');
+INSERT INTO t VALUES (701, 7, 'v209'), (702, 14, 'v29'), (703, 21, 'v60'), (704, 28, 'v91'), (705, 35, 'v122'), (706, 42, 'v153'), (707, 49, 'v184'), (708, 56, 'v4'), (709, 63, 'v35'), (710, 70, 'v66'), (711, 77, 'v97'), (712, 84, 'v128'), (713, 91, 'v159'), (714, NULL, 'v190'), (715, 5, 'v10'), (716, 12, 'v41'), (717, 19, 'v72'), (718, 26, 'v103'), (719, 33, 'v134'), (720, 40, 'v165'), (721, 47, 'v196'), (722, 54, 'v16'), (723, 61, 'v47'), (724, 68, 'v78'), (725, 75, 'v109');
+INSERT INTO t VALUES (726, 82, 'v140'), (727, 89, 'v171'), (728, 96, 'v202'), (729, 3, 'v22'), (730, 10, 'v53'), (731, NULL, 'v84'), (732, 24, 'v115'), (733, 31, 'v146'), (734, 38, 'v177'), (735, 45, 'v208'), (736, 52, 'v28'), (737, 59, 'v59'), (738, 66, 'v90'), (739, 73, 'v121'), (740, 80, 'v152'), (741, 87, 'v183'), (742, 94, 'v3'), (743, 1, 'v34'), (744, 8, 'v65'), (745, 15, 'v96'), (746, 22, 'v127'), (747, 29, 'v158'), (748, NULL, 'v189'), (749, 43, 'v9'), (750, 50, 'v40');
+INSERT INTO t VALUES (751, 57, 'v71'), (752, 64, 'v102'), (753, 71, 'v133'), (754, 78, 'v164'), (755, 85, 'v195'), (756, 92, 'v15'), (757, 99, 'v46'), (758, 6, 'v77'), (759, 13, 'v108'), (760, 20, 'v139'), (761, 27, 'v170'), (762, 34, 'v201'), (763, 41, 'v21'), (764, 48, 'v52'), (765, NULL, 'v83'), (766, 62, 'v114'), (767, 69, 'v145'), (768, 76, 'v176'), (769, 83, 'v207'), (770, 90, 'v27'), (771, 97, 'v58'), (772, 4, 'v89'), (773, 11, 'v120'), (774, 18, 'v151'), (775, 25, 'v182');
+INSERT INTO t VALUES (776, 32, 'v2'), (777, 39, 'v33'), (778, 46, 'v64'), (779, 53, 'v95'), (780, 60, 'v126'), (781, 67, 'v157'), (782, NULL, 'v188'), (783, 81, 'v8'), (784, 88, 'v39'), (785, 95, 'v70'), (786, 2, 'v101'), (787, 9, 'v132'), (788, 16, 'v163'), (789, 23, 'v194'), (790, 30, 'v14'), (791, 37, 'v45'), (792, 44, 'v76'), (793, 51, 'v107'), (794, 58, 'v138'), (795, 65, 'v169'), (796, 72, 'v200'), (797, 79, 'v20'), (798, 86, 'v51'), (799, NULL, 'v82'), (800, 0, 'v113');
+INSERT INTO t VALUES (801, 7, 'v144'), (802, 14, 'v175'), (803, 21, 'v206'), (804, 28, 'v26'), (805, 35, 'v57'), (806, 42, 'v88'), (807, 49, 'v119'), (808, 56, 'v150'), (809, 63, 'v181'), (810, 70, 'v1'), (811, 77, 'v32'), (812, 84, 'v63'), (813, 91, 'v94'), (814, 98, 'v125'), (815, 5, 'v156'), (816, NULL, 'v187'), (817, 19, 'v7'), (818, 26, 'v38'), (819, 33, 'v69'), (820, 40, 'v100'), (821, 47, 'v131'), (822, 54, 'v162'), (823, 61, 'v193'), (824, 68, 'v13'), (825, 75, 'v44');
+INSERT INTO t VALUES (826, 82, 'v75'), (827, 89, 'v106'), (828, 96, 'v137'), (829, 3, 'v168'), (830, 10, 'v199'), (831, 17, 'v19'), (832, 24, 'v50'), (833, NULL, 'v81'), (834, 38, 'v112'), (835, 45, 'v143'), (836, 52, 'v174'), (837, 59, 'v205'), (838, 66, 'v25'), (839, 73, 'v56'), (840, 80, 'v87'), (841, 87, 'v118'), (842, 94, 'v149'), (843, 1, 'v180'), (844, 8, 'v0'), (845, 15, 'v31'), (846, 22, 'v62'), (847, 29, 'v93'), (848, 36, 'v124'), (849, 43, 'v155'), (850, NULL, 'v186');
+INSERT INTO t VALUES (851, 57, 'v6'), (852, 64, 'v37'), (853, 71, 'v68'), (854, 78, 'v99'), (855, 85, 'v130'), (856, 92, 'v161'), (857, 99, 'v192'), (858, 6, 'v12'), (859, 13, 'v43'), (860, 20, 'v74'), (861, 27, 'v105'), (862, 34, 'v136'), (863, 41, 'v167'), (864, 48, 'v198'), (865, 55, 'v18'), (866, 62, 'v49'), (867, NULL, 'v80'), (868, 76, 'v111'), (869, 83, 'v142'), (870, 90, 'v173'), (871, 97, 'v204'), (872, 4, 'v24'), (873, 11, 'v55'), (874, 18, 'v86'), (875, 25, 'v117');
+INSERT INTO t VALUES (876, 32, 'v148'), (877, 39, 'v179'), (878, 46, 'v210'), (879, 53, 'v30'), (880, 60, 'v61'), (881, 67, 'v92'), (882, 74, 'v123'), (883, 81, 'v154'), (884, NULL, 'v185'), (885, 95, 'v5'), (886, 2, 'v36'), (887, 9, 'v67'), (888, 16, 'v98'), (889, 23, 'v129'), (890, 30, 'v160'), (891, 37, 'v191'), (892, 44, 'v11'), (893, 51, 'v42'), (894, 58, 'v73'), (895, 65, 'v104'), (896, 72, 'v135'), (897, 79, 'v166'), (898, 86, 'v197'), (899, 93, 'v17'), (900, 0, 'v48');
+INSERT INTO t VALUES (901, NULL, 'v79'), (902, 14, 'v110'), (903, 21, 'v141'), (904, 28, 'v172'), (905, 35, 'v203'), (906, 42, 'v23'), (907, 49, 'v54'), (908, 56, 'v85'), (909, 63, 'v116'), (910, 70, 'v147'), (911, 77, 'v178'), (912, 84, 'v209'), (913, 91, 'v29'), (914, 98, 'v60'), (915, 5, 'v91'), (916, 12, 'v122'), (917, 19, 'v153'), (918, NULL, 'v184'), (919, 33, 'v4'), (920, 40, 'v35'), (921, 47, 'v66'), (922, 54, 'v97'), (923, 61, 'v128'), (924, 68, 'v159'), (925, 75, 'v190');
+INSERT INTO t VALUES (926, 82, 'v10'), (927, 89, 'v41'), (928, 96, 'v72'), (929, 3, 'v103'), (930, 10, 'v134'), (931, 17, 'v165'), (932, 24, 'v196'), (933, 31, 'v16'), (934, 38, 'v47'), (935, NULL, 'v78'), (936, 52, 'v109'), (937, 59, 'v140'), (938, 66, 'v171'), (939, 73, 'v202'), (940, 80, 'v22'), (941, 87, 'v53'), (942, 94, 'v84'), (943, 1, 'v115'), (944, 8, 'v146'), (945, 15, 'v177'), (946, 22, 'v208'), (947, 29, 'v28'), (948, 36, 'v59'), (949, 43, 'v90'), (950, 50, 'v121');
+INSERT INTO t VALUES (951, 57, 'v152'), (952, NULL, 'v183'), (953, 71, 'v3'), (954, 78, 'v34'), (955, 85, 'v65'), (956, 92, 'v96'), (957, 99, 'v127'), (958, 6, 'v158'), (959, 13, 'v189'), (960, 20, 'v9'), (961, 27, 'v40'), (962, 34, 'v71'), (963, 41, 'v102'), (964, 48, 'v133'), (965, 55, 'v164'), (966, 62, 'v195'), (967, 69, 'v15'), (968, 76, 'v46'), (969, NULL, 'v77'), (970, 90, 'v108'), (971, 97, 'v139'), (972, 4, 'v170'), (973, 11, 'v201'), (974, 18, 'v21'), (975, 25, 'v52');
+INSERT INTO t VALUES (976, 32, 'v83'), (977, 39, 'v114'), (978, 46, 'v145'), (979, 53, 'v176'), (980, 60, 'v207'), (981, 67, 'v27'), (982, 74, 'v58'), (983, 81, 'v89'), (984, 88, 'v120'), (985, 95, 'v151'), (986, NULL, 'v182'), (987, 9, 'v2'), (988, 16, 'v33'), (989, 23, 'v64'), (990, 30, 'v95'), (991, 37, 'v126'), (992, 44, 'v157'), (993, 51, 'v188'), (994, 58, 'v8'), (995, 65, 'v39'), (996, 72, 'v70'), (997, 79, 'v101'), (998, 86, 'v132'), (999, 93, 'v163'), (1000, 0, 'v194');
+CREATE INDEX t("s USING LSM");
+SELECT id, a, s FROM t WHERE a = 7 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a >= 90;
+SELECT NUM(a), SUM(id) FROM t WHERE a > 10 AND a <= 12;
+SELECT NUM(id) FROM t WHERE a = NULL;
+SELECT id, s FROM t WHERE s = 'v100' ORDER BY id;
+SELECT NUM(id) FROM t WHERE s LIKE 'v2%';
+SELECT id, a FROM t WHERE a = 7 AND s = 'v12';
+SELECT NUM(id), SUM(a) FROM t;
+DELETE FROM t WHERE a = 7 AND id < 500;
+DELETE FROM t WHERE s = 'v100';
+UPDATE t SET a = 7 WHERE a = 91;
+UPDATE t SET s = 'v100' WHERE id = 3;
+INSERT INTO t VALUES (1001, 7, 'v14'), (1002, 14, 'v45'), (1003, NULL, 'v76'), (1004, 28, 'v107'), (1005, 35, 'v138'), (1006, 42, 'v169'), (1007, 49, 'v200'), (1008, 56, 'v20'), (1009, 63, 'v51'), (1010, 70, 'v82'), (1011, 77, 'v113'), (1012, 84, 'v144'), (1013, 91, 'v175'), (1014, 98, 'v206'), (1015, 5, 'v26'), (1016, 12, 'v57'), (1017, 19, 'v88'), (1018, 26, 'v119'), (1019, 33, 'v150'), (1020, NULL, 'v181'), (1021, 47, 'v1'), (1022, 54, 'v32'), (1023, 61, 'v63'), (1024, 68, 'v94'), (1025, 75, 'v125');
+INSERT INTO t VALUES (1026, 82, 'v156'), (1027, 89, 'v187'), (1028, 96, 'v7'), (1029, 3, 'v38'), (1030, 10, 'v69'), (1031, 17, 'v100'), (1032, 24, 'v131'), (1033, 31, 'v162'), (1034, 38, 'v193'), (1035, 45, 'v13'), (1036, 52, 'v44'), (1037, NULL, 'v75'), (1038, 66, 'v106'), (1039, 73, 'v137'), (1040, 80, 'v168'), (1041, 87, 'v199'), (1042, 94, 'v19'), (1043, 1, 'v50'), (1044, 8, 'v81'), (1045, 15, 'v112'), (1046, 22, 'v143'), (1047, 29, 'v174'), (1048, 36, 'v205'), (1049, 43, 'v25'), (1050, 50, 'v56');
+INSERT INTO t VALUES (1051, 57, 'v87'), (1052, 64, 'v118'), (1053, 71, 'v149'), (1054, NULL, 'v180'), (1055, 85, 'v0'), (1056, 92, 'v31'), (1057, 99, 'v62'), (1058, 6, 'v93'), (1059, 13, 'v124'), (1060, 20, 'v155'), (1061, 27, 'v186'), (1062, 34, 'v6'), (1063, 41, 'v37'), (1064, 48, 'v68'), (1065, 55, 'v99'), (1066, 62, 'v130'), (1067, 69, 'v161'), (1068, 76, 'v192'), (1069, 83, 'v12'), (1070, 90, 'v43'), (1071, NULL, 'v74'), (1072, 4, 'v105'), (1073, 11, 'v136'), (1074, 18, 'v167'), (1075, 25, 'v198');
+INSERT INTO t VALUES (1076, 32, 'v18'), (1077, 39, 'v49'), (1078, 46, 'v80'), (1079, 53, 'v111'), (1080, 60, 'v142'), (1081, 67, 'v173'), (1082, 74, 'v204'), (1083, 81, 'v24'), (1084, 88, 'v55'), (1085, 95, 'v86'), (1086, 2, 'v117'), (1087, 9, 'v148'), (1088, NULL, 'v179'), (1089, 23, 'v210'), (1090, 30, 'v30'), (1091, 37, 'v61'), (1092, 44, 'v92'), (1093, 51, 'v123'), (1094, 58, 'v154'), (1095, 65, 'v185'), (1096, 72, 'v5'), (1097, 79, 'v36'), (1098, 86, 'v67'), (1099, 93, 'v98'), (1100, 0, 'v129');
+SELECT id, a, s FROM t WHERE a = 7 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a >= 90;
+SELECT NUM(a), SUM(id) FROM t WHERE a > 10 AND a <= 12;
+SELECT NUM(id) FROM t WHERE a = NULL;
+SELECT id, s FROM t WHERE s = 'v100' ORDER BY id;
+SELECT NUM(id) FROM t WHERE s LIKE 'v2%';
+SELECT id, a FROM t WHERE a = 7 AND s = 'v12';
+SELECT NUM(id), SUM(a) FROM t;
+-- converted to a B+ tree and back, each time rebuilt from the table
+CREATE INDEX t("a USING BTREE");
+SELECT id, a, s FROM t WHERE a = 7 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a >= 90;
+SELECT NUM(a), SUM(id) FROM t WHERE a > 10 AND a <= 12;
+SELECT NUM(id) FROM t WHERE a = NULL;
+CREATE INDEX t("a USING LSM");
+DELETE FROM t WHERE a = 7;
+SELECT id, a, s FROM t WHERE a = 7 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a >= 90;
+SELECT NUM(a), SUM(id) FROM t WHERE a > 10 AND a <= 12;
+SELECT NUM(id) FROM t WHERE a = NULL;
@@ -0,0 +1,120 @@
+-- a table converted into a tree on its primary key, with a secondary
+-- index that must follow the rows to their new places; see run_sql.sh
+CREATE DATABASE io;
+USE DATABASE io;
+CREATE TABLE t(id int(10) NOT NULL, a int(10), s varchar(10), PRIMARY KEY(id));
+CREATE INDEX t(a);
+INSERT INTO t VALUES (5, 3, 's5'), (3070, 2, 's4'), (6135, 1, 's3'), (9200, 0, 's2'), (2265, 39, 's4'), (5330, 38, 's3'), (8395, 37, 's2'), (1460, 36, 's4'), (4525, 35, 's3'), (7590, 34, 's2'), (655, 33, 's4'), (3720, 32, 's3'), (6785, 31, 's2'), (9850, 30, 's1'), (2915, 29, 's3'), (5980, 28, 's2'), (9045, 27, 's1'), (2110, 26, 's3'), (5175, 25, 's2'), (8240, 24, 's1'), (1305, 23, 's3'), (4370, NULL, 's2'), (7435, 21, 's1'), (500, 20, 's3'), (3565, 19, 's2');
+INSERT INTO t VALUES (6630, 18, 's1'), (9695, 17, 's0'), (2760, 16, 's2'), (5825, 15, 's1'), (8890, 14, 's0'), (1955, 13, 's2'), (5020, 12, 's1'), (8085, 11, 's0'), (1150, 10, 's2'), (4215, 9, 's1'), (7280, 8, 's0'), (345, 7, 's2'), (3410, 6, 's1'), (6475, 5, 's0'), (9540, 4, 's6'), (2605, 3, 's1'), (5670, 2, 's0'), (8735, 1, 's6'), (1800, 0, 's1'), (4865, 39, 's0'), (7930, 38, 's6'), (995, 37, 's1'), (4060, 36, 's0'), (7125, NULL, 's6'), (190, NULL, 's1');
+INSERT INTO t VALUES (3255, 33, 's0'), (6320, 32, 's6'), (9385, 31, 's5'), (2450, 30, 's0'), (5515, 29, 's6'), (8580, 28, 's5'), (1645, 27, 's0'), (4710, 26, 's6'), (7775, 25, 's5'), (840, 24, 's0'), (3905, 23, 's6'), (6970, 22, 's5'), (35, 21, 's0'), (3100, 20, 's6'), (6165, 19, 's5'), (9230, 18, 's4'), (2295, 17, 's6'), (5360, 16, 's5'), (8425, 15, 's4'), (1490, 14, 's6'), (4555, 13, 's5'), (7620, 12, 's4'), (685, 11, 's6'), (3750, 10, 's5'), (6815, 9, 's4');
+INSERT INTO t VALUES (9880, NULL, 's3'), (2945, NULL, 's5'), (6010, 6, 's4'), (9075, 5, 's3'), (2140, 4, 's5'), (5205, 3, 's4'), (8270, 2, 's3'), (1335, 1, 's5'), (4400, 0, 's4'), (7465, 39, 's3'), (530, 38, 's5'), (3595, 37, 's4'), (6660, 36, 's3'), (9725, 35, 's2'), (2790, 34, 's4'), (5855, 33, 's3'), (8920, 32, 's2'), (1985, 31, 's4'), (5050, 30, 's3'), (8115, 29, 's2'), (1180, 28, 's4'), (4245, 27, 's3'), (7310, 26, 's2'), (375, 25, 's4'), (3440, 24, 's3');
+INSERT INTO t VALUES (6505, 23, 's2'), (9570, 22, 's1'), (2635, 21, 's3'), (5700, NULL, 's2'), (8765, 19, 's1'), (1830, 18, 's3'), (4895, 17, 's2'), (7960, 16, 's1'), (1025, 15, 's3'), (4090, 14, 's2'), (7155, 13, 's1'), (220, 12, 's3'), (3285, 11, 's2'), (6350, 10, 's1'), (9415, 9, 's0'), (2480, 8, 's2'), (5545, 7, 's1'), (8610, 6, 's0'), (1675, 5, 's2'), (4740, 4, 's1'), (7805, 3, 's0'), (870, 2, 's2'), (3935, 1, 's1'), (7000, 0, 's0'), (65, 39, 's2');
+INSERT INTO t VALUES (3130, 38, 's1'), (6195, 37, 's0'), (9260, 36, 's6'), (2325, 35, 's1'), (5390, 34, 's0'), (8455, NULL, 's6'), (1520, NULL, 's1'), (4585, 31, 's0'), (7650, 30, 's6'), (715, 29, 's1'), (3780, 28, 's0'), (6845, 27, 's6'), (9910, 26, 's5'), (2975, 25, 's0'), (6040, 24, 's6'), (9105, 23, 's5'), (2170, 22, 's0'), (5235, 21, 's6'), (8300, 20, 's5'), (1365, 19, 's0'), (4430, 18, 's6'), (7495, 17, 's5'), (560, 16, 's0'), (3625, 15, 's6'), (6690, 14, 's5');
+INSERT INTO t VALUES (9755, 13, 's4'), (2820, 12, 's6'), (5885, 11, 's5'), (8950, 10, 's4'), (2015, 9, 's6'), (5080, 8, 's5'), (8145, 7, 's4'), (1210, 6, 's6'), (4275, NULL, 's5'), (7340, 4, 's4'), (405, 3, 's6'), (3470, 2, 's5'), (6535, 1, 's4'), (9600, 0, 's3'), (2665, 39, 's5'), (5730, 38, 's4'), (8795, 37, 's3'), (1860, 36, 's5'), (4925, 35, 's4'), (7990, 34, 's3'), (1055, 33, 's5'), (4120, 32, 's4'), (7185, 31, 's3'), (250, 30, 's5'), (3315, 29, 's4');
+INSERT INTO t VALUES (6380, 28, 's3'), (9445, 27, 's2'), (2510, 26, 's4'), (5575, 25, 's3'), (8640, 24, 's2'), (1705, 23, 's4'), (4770, 22, 's3'), (7835, 21, 's2'), (900, 20, 's4'), (3965, 19, 's3'), (7030, NULL, 's2'), (95, NULL, 's4'), (3160, 16, 's3'), (6225, 15, 's2'), (9290, 14, 's1'), (2355, 13, 's3'), (5420, 12, 's2'), (8485, 11, 's1'), (1550, 10, 's3'), (4615, 9, 's2'), (7680, 8, 's1'), (745, 7, 's3'), (3810, 6, 's2'), (6875, 5, 's1'), (9940, 4, 's0');
+INSERT INTO t VALUES (3005, 3, 's2'), (6070, 2, 's1'), (9135, 1, 's0'), (2200, 0, 's2'), (5265, 39, 's1'), (8330, 38, 's0'), (1395, 37, 's2'), (4460, 36, 's1'), (7525, 35, 's0'), (590, 34, 's2'), (3655, 33, 's1'), (6720, 32, 's0'), (9785, NULL, 's6'), (2850, NULL, 's1'), (5915, 29, 's0'), (8980, 28, 's6'), (2045, 27, 's1'), (5110, 26, 's0'), (8175, 25, 's6'), (1240, 24, 's1'), (4305, 23, 's0'), (7370, 22, 's6'), (435, 21, 's1'), (3500, 20, 's0'), (6565, 19, 's6');
+INSERT INTO t VALUES (9630, 18, 's5'), (2695, 17, 's0'), (5760, 16, 's6'), (8825, 15, 's5'), (1890, 14, 's0'), (4955, 13, 's6'), (8020, 12, 's5'), (1085, 11, 's0'), (4150, 10, 's6'), (7215, 9, 's5'), (280, 8, 's0'), (3345, 7, 's6'), (6410, 6, 's5'), (9475, 5, 's4'), (2540, 4, 's6'), (5605, NULL, 's5'), (8670, 2, 's4'), (1735, 1, 's6'), (4800, 0, 's5'), (7865, 39, 's4'), (930, 38, 's6'), (3995, 37, 's5'), (7060, 36, 's4'), (125, 35, 's6'), (3190, 34, 's5');
+INSERT INTO t VALUES (6255, 33, 's4'), (9320, 32, 's3'), (2385, 31, 's5'), (5450, 30, 's4'), (8515, 29, 's3'), (1580, 28, 's5'), (4645, 27, 's4'), (7710, 26, 's3'), (775, 25, 's5'), (3840, 24, 's4'), (6905, 23, 's3'), (9970, 22, 's2'), (3035, 21, 's4'), (6100, 20, 's3'), (9165, 19, 's2'), (2230, 18, 's4'), (5295, 17, 's3'), (8360, NULL, 's2'), (1425, NULL, 's4'), (4490, 14, 's3'), (7555, 13, 's2'), (620, 12, 's4'), (3685, 11, 's3'), (6750, 10, 's2'), (9815, 9, 's1');
+INSERT INTO t VALUES (2880, 8, 's3'), (5945, 7, 's2'), (9010, 6, 's1'), (2075, 5, 's3'), (5140, 4, 's2'), (8205, 3, 's1'), (1270, 2, 's3'), (4335, 1, 's2'), (7400, 0, 's1'), (465, 39, 's3'), (3530, 38, 's2'), (6595, 37, 's1'), (9660, 36, 's0'), (2725, 35, 's2'), (5790, 34, 's1'), (8855, 33, 's0'), (1920, 32, 's2'), (4985, 31, 's1'), (8050, 30, 's0'), (1115, 29, 's2'), (4180, NULL, 's1'), (7245, 27, 's0'), (310, 26, 's2'), (3375, 25, 's1'), (6440, 24, 's0');
+INSERT INTO t VALUES (9505, 23, 's6'), (2570, 22, 's1'), (5635, 21, 's0'), (8700, 20, 's6'), (1765, 19, 's1'), (4830, 18, 's0'), (7895, 17, 's6'), (960, 16, 's1'), (4025, 15, 's0'), (7090, 14, 's6'), (155, 13, 's1'), (3220, 12, 's0'), (6285, 11, 's6'), (9350, 10, 's5'), (2415, 9, 's0'), (5480, 8, 's6'), (8545, 7, 's5'), (1610, 6, 's0'), (4675, 5, 's6'), (7740, 4, 's5'), (805, 3, 's0'), (3870, 2, 's6'), (6935, NULL, 's5'), (10000, 0, 's4'), (3065, 39, 's6');
+INSERT INTO t VALUES (6130, 38, 's5'), (9195, 37, 's4'), (2260, 36, 's6'), (5325, 35, 's5'), (8390, 34, 's4'), (1455, 33, 's6'), (4520, 32, 's5'), (7585, 31, 's4'), (650, 30, 's6'), (3715, 29, 's5'), (6780, 28, 's4'), (9845, 27, 's3'), (2910, 26, 's5'), (5975, 25, 's4'), (9040, 24, 's3'), (2105, 23, 's5'), (5170, 22, 's4'), (8235, 21, 's3'), (1300, 20, 's5'), (4365, 19, 's4'), (7430, 18, 's3'), (495, 17, 's5'), (3560, 16, 's4'), (6625, 15, 's3'), (9690, NULL, 's2');
+INSERT INTO t VALUES (2755, NULL, 's4'), (5820, 12, 's3'), (8885, 11, 's2'), (1950, 10, 's4'), (5015, 9, 's3'), (8080, 8, 's2'), (1145, 7, 's4'), (4210, 6, 's3'), (7275, 5, 's2'), (340, 4, 's4'), (3405, 3, 's3'), (6470, 2, 's2'), (9535, 1, 's1'), (2600, 0, 's3'), (5665, 39, 's2'), (8730, 38, 's1'), (1795, 37, 's3'), (4860, 36, 's2'), (7925, 35, 's1'), (990, 34, 's3'), (4055, 33, 's2'), (7120, 32, 's1'), (185, 31, 's3'), (3250, 30, 's2'), (6315, 29, 's1');
+INSERT INTO t VALUES (9380, 28, 's0'), (2445, 27, 's2'), (5510, NULL, 's1'), (8575, 25, 's0'), (1640, 24, 's2'), (4705, 23, 's1'), (7770, 22, 's0'), (835, 21, 's2'), (3900, 20, 's1'), (6965, 19, 's0'), (30, 18, 's2'), (3095, 17, 's1'), (6160, 16, 's0'), (9225, 15, 's6'), (2290, 14, 's1'), (5355, 13, 's0'), (8420, 12, 's6'), (1485, 11, 's1'), (4550, 10, 's0'), (7615, 9, 's6'), (680, 8, 's1'), (3745, 7, 's0'), (6810, 6, 's6'), (9875, 5, 's5'), (2940, 4, 's0');
+INSERT INTO t VALUES (6005, 3, 's6'), (9070, 2, 's5'), (2135, 1, 's0'), (5200, 0, 's6'), (8265, NULL, 's5'), (1330, NULL, 's0'), (4395, 37, 's6'), (7460, 36, 's5'), (525, 35, 's0'), (3590, 34, 's6'), (6655, 33, 's5'), (9720, 32, 's4'), (2785, 31, 's6'), (5850, 30, 's5'), (8915, 29, 's4'), (1980, 28, 's6'), (5045, 27, 's5'), (8110, 26, 's4'), (1175, 25, 's6'), (4240, 24, 's5'), (7305, 23, 's4'), (370, 22, 's6'), (3435, 21, 's5'), (6500, 20, 's4'), (9565, 19, 's3');
+INSERT INTO t VALUES (2630, 18, 's5'), (5695, 17, 's4'), (8760, 16, 's3'), (1825, 15, 's5'), (4890, 14, 's4'), (7955, 13, 's3'), (1020, 12, 's5'), (4085, NULL, 's4'), (7150, 10, 's3'), (215, 9, 's5'), (3280, 8, 's4'), (6345, 7, 's3'), (9410, 6, 's2'), (2475, 5, 's4'), (5540, 4, 's3'), (8605, 3, 's2'), (1670, 2, 's4'), (4735, 1, 's3'), (7800, 0, 's2'), (865, 39, 's4'), (3930, 38, 's3'), (6995, 37, 's2'), (60, 36, 's4'), (3125, 35, 's3'), (6190, 34, 's2');
+INSERT INTO t VALUES (9255, 33, 's1'), (2320, 32, 's3'), (5385, 31, 's2'), (8450, 30, 's1'), (1515, 29, 's3'), (4580, 28, 's2'), (7645, 27, 's1'), (710, 26, 's3'), (3775, 25, 's2'), (6840, NULL, 's1'), (9905, 23, 's0'), (2970, 22, 's2'), (6035, 21, 's1'), (9100, 20, 's0'), (2165, 19, 's2'), (5230, 18, 's1'), (8295, 17, 's0'), (1360, 16, 's2'), (4425, 15, 's1'), (7490, 14, 's0'), (555, 13, 's2'), (3620, 12, 's1'), (6685, 11, 's0'), (9750, 10, 's6'), (2815, 9, 's1');
+INSERT INTO t VALUES (5880, 8, 's0'), (8945, 7, 's6'), (2010, 6, 's1'), (5075, 5, 's0'), (8140, 4, 's6'), (1205, 3, 's1'), (4270, 2, 's0'), (7335, 1, 's6'), (400, 0, 's1'), (3465, 39, 's0'), (6530, 38, 's6'), (9595, NULL, 's5'), (2660, NULL, 's0'), (5725, 35, 's6'), (8790, 34, 's5'), (1855, 33, 's0'), (4920, 32, 's6'), (7985, 31, 's5'), (1050, 30, 's0'), (4115, 29, 's6'), (7180, 28, 's5'), (245, 27, 's0'), (3310, 26, 's6'), (6375, 25, 's5'), (9440, 24, 's4');
+INSERT INTO t VALUES (2505, 23, 's6'), (5570, 22, 's5'), (8635, 21, 's4'), (1700, 20, 's6'), (4765, 19, 's5'), (7830, 18, 's4'), (895, 17, 's6'), (3960, 16, 's5'), (7025, 15, 's4'), (90, 14, 's6'), (3155, 13, 's5'), (6220, 12, 's4'), (9285, 11, 's3'), (2350, 10, 's5'), (5415, NULL, 's4'), (8480, 8, 's3'), (1545, 7, 's5'), (4610, 6, 's4'), (7675, 5, 's3'), (740, 4, 's5'), (3805, 3, 's4'), (6870, 2, 's3'), (9935, 1, 's2'), (3000, 0, 's4'), (6065, 39, 's3');
+INSERT INTO t VALUES (9130, 38, 's2'), (2195, 37, 's4'), (5260, 36, 's3'), (8325, 35, 's2'), (1390, 34, 's4'), (4455, 33, 's3'), (7520, 32, 's2'), (585, 31, 's4'), (3650, 30, 's3'), (6715, 29, 's2'), (9780, 28, 's1'), (2845, 27, 's3'), (5910, 26, 's2'), (8975, 25, 's1'), (2040, 24, 's3'), (5105, 23, 's2'), (8170, NULL, 's1'), (1235, NULL, 's3'), (4300, 20, 's2'), (7365, 19, 's1'), (430, 18, 's3'), (3495, 17, 's2'), (6560, 16, 's1'), (9625, 15, 's0'), (2690, 14, 's2');
+INSERT INTO t VALUES (5755, 13, 's1'), (8820, 12, 's0'), (1885, 11, 's2'), (4950, 10, 's1'), (8015, 9, 's0'), (1080, 8, 's2'), (4145, 7, 's1'), (7210, 6, 's0'), (275, 5, 's2'), (3340, 4, 's1'), (6405, 3, 's0'), (9470, 2, 's6'), (2535, 1, 's1'), (5600, 0, 's0'), (8665, 39, 's6'), (1730, 38, 's1'), (4795, 37, 's0'), (7860, 36, 's6'), (925, 35, 's1'), (3990, NULL, 's0'), (7055, 33, 's6'), (120, 32, 's1'), (3185, 31, 's0'), (6250, 30, 's6'), (9315, 29, 's5');
+INSERT INTO t VALUES (2380, 28, 's0'), (5445, 27, 's6'), (8510, 26, 's5'), (1575, 25, 's0'), (4640, 24, 's6'), (7705, 23, 's5'), (770, 22, 's0'), (3835, 21, 's6'), (6900, 20, 's5'), (9965, 19, 's4'), (3030, 18, 's6'), (6095, 17, 's5'), (9160, 16, 's4'), (2225, 15, 's6'), (5290, 14, 's5'), (8355, 13, 's4'), (1420, 12, 's6'), (4485, 11, 's5'), (7550, 10, 's4'), (615, 9, 's6'), (3680, 8, 's5'), (6745, NULL, 's4'), (9810, 6, 's3'), (2875, 5, 's5'), (5940, 4, 's4');
+INSERT INTO t VALUES (9005, 3, 's3'), (2070, 2, 's5'), (5135, 1, 's4'), (8200, 0, 's3'), (1265, 39, 's5'), (4330, 38, 's4'), (7395, 37, 's3'), (460, 36, 's5'), (3525, 35, 's4'), (6590, 34, 's3'), (9655, 33, 's2'), (2720, 32, 's4'), (5785, 31, 's3'), (8850, 30, 's2'), (1915, 29, 's4'), (4980, 28, 's3'), (8045, 27, 's2'), (1110, 26, 's4'), (4175, 25, 's3'), (7240, 24, 's2'), (305, 23, 's4'), (3370, 22, 's3'), (6435, 21, 's2'), (9500, NULL, 's1'), (2565, NULL, 's3');
+INSERT INTO t VALUES (5630, 18, 's2'), (8695, 17, 's1'), (1760, 16, 's3'), (4825, 15, 's2'), (7890, 14, 's1'), (955, 13, 's3'), (4020, 12, 's2'), (7085, 11, 's1'), (150, 10, 's3'), (3215, 9, 's2'), (6280, 8, 's1'), (9345, 7, 's0'), (2410, 6, 's2'), (5475, 5, 's1'), (8540, 4, 's0'), (1605, 3, 's2'), (4670, 2, 's1'), (7735, 1, 's0'), (800, 0, 's2'), (3865, 39, 's1'), (6930, 38, 's0'), (9995, 37, 's6'), (3060, 36, 's1'), (6125, 35, 's0'), (9190, 34, 's6');
+INSERT INTO t VALUES (2255, 33, 's1'), (5320, NULL, 's0'), (8385, 31, 's6'), (1450, 30, 's1'), (4515, 29, 's0'), (7580, 28, 's6'), (645, 27, 's1'), (3710, 26, 's0'), (6775, 25, 's6'), (9840, 24, 's5'), (2905, 23, 's0'), (5970, 22, 's6'), (9035, 21, 's5'), (2100, 20, 's0'), (5165, 19, 's6'), (8230, 18, 's5'), (1295, 17, 's0'), (4360, 16, 's6'), (7425, 15, 's5'), (490, 14, 's0'), (3555, 13, 's6'), (6620, 12, 's5'), (9685, 11, 's4'), (2750, 10, 's6'), (5815, 9, 's5');
+INSERT INTO t VALUES (8880, 8, 's4'), (1945, 7, 's6'), (5010, 6, 's5'), (8075, NULL, 's4'), (1140, NULL, 's6'), (4205, 3, 's5'), (7270, 2, 's4'), (335, 1, 's6'), (3400, 0, 's5'), (6465, 39, 's4'), (9530, 38, 's3'), (2595, 37, 's5'), (5660, 36, 's4'), (8725, 35, 's3'), (1790, 34, 's5'), (4855, 33, 's4'), (7920, 32, 's3'), (985, 31, 's5'), (4050, 30, 's4'), (7115, 29, 's3'), (180, 28, 's5'), (3245, 27, 's4'), (6310, 26, 's3'), (9375, 25, 's2'), (2440, 24, 's4');
+INSERT INTO t VALUES (5505, 23, 's3'), (8570, 22, 's2'), (1635, 21, 's4'), (4700, 20, 's3'), (7765, 19, 's2'), (830, 18, 's4'), (3895, NULL, 's3'), (6960, 16, 's2'), (25, 15, 's4'), (3090, 14, 's3'), (6155, 13, 's2'), (9220, 12, 's1'), (2285, 11, 's3'), (5350, 10, 's2'), (8415, 9, 's1'), (1480, 8, 's3'), (4545, 7, 's2'), (7610, 6, 's1'), (675, 5, 's3'), (3740, 4, 's2'), (6805, 3, 's1'), (9870, 2, 's0'), (2935, 1, 's2'), (6000, 0, 's1'), (9065, 39, 's0');
+INSERT INTO t VALUES (2130, 38, 's2'), (5195, 37, 's1'), (8260, 36, 's0'), (1325, 35, 's2'), (4390, 34, 's1'), (7455, 33, 's0'), (520, 32, 's2'), (3585, 31, 's1'), (6650, NULL, 's0'), (9715, 29, 's6'), (2780, 28, 's1'), (5845, 27, 's0'), (8910, 26, 's6'), (1975, 25, 's1'), (5040, 24, 's0'), (8105, 23, 's6'), (1170, 22, 's1'), (4235, 21, 's0'), (7300, 20, 's6'), (365, 19, 's1'), (3430, 18, 's0'), (6495, 17, 's6'), (9560, 16, 's5'), (2625, 15, 's0'), (5690, 14, 's6');
+INSERT INTO t VALUES (8755, 13, 's5'), (1820, 12, 's0'), (4885, 11, 's6'), (7950, 10, 's5'), (1015, 9, 's0'), (4080, 8, 's6'), (7145, 7, 's5'), (210, 6, 's0'), (3275, 5, 's6'), (6340, 4, 's5'), (9405, NULL, 's4'), (2470, NULL, 's6'), (5535, 1, 's5'), (8600, 0, 's4'), (1665, 39, 's6'), (4730, 38, 's5'), (7795, 37, 's4'), (860, 36, 's6'), (3925, 35, 's5'), (6990, 34, 's4'), (55, 33, 's6'), (3120, 32, 's5'), (6185, 31, 's4'), (9250, 30, 's3'), (2315, 29, 's5');
+INSERT INTO t VALUES (5380, 28, 's4'), (8445, 27, 's3'), (1510, 26, 's5'), (4575, 25, 's4'), (7640, 24, 's3'), (705, 23, 's5'), (3770, 22, 's4'), (6835, 21, 's3'), (9900, 20, 's2'), (2965, 19, 's4'), (6030, 18, 's3'), (9095, 17, 's2'), (2160, 16, 's4'), (5225, NULL, 's3'), (8290, 14, 's2'), (1355, 13, 's4'), (4420, 12, 's3'), (7485, 11, 's2'), (550, 10, 's4'), (3615, 9, 's3'), (6680, 8, 's2'), (9745, 7, 's1'), (2810, 6, 's3'), (5875, 5, 's2'), (8940, 4, 's1');
+INSERT INTO t VALUES (2005, 3, 's3'), (5070, 2, 's2'), (8135, 1, 's1'), (1200, 0, 's3'), (4265, 39, 's2'), (7330, 38, 's1'), (395, 37, 's3'), (3460, 36, 's2'), (6525, 35, 's1'), (9590, 34, 's0'), (2655, 33, 's2'), (5720, 32, 's1'), (8785, 31, 's0'), (1850, 30, 's2'), (4915, 29, 's1'), (7980, NULL, 's0'), (1045, NULL, 's2'), (4110, 26, 's1'), (7175, 25, 's0'), (240, 24, 's2'), (3305, 23, 's1'), (6370, 22, 's0'), (9435, 21, 's6'), (2500, 20, 's1'), (5565, 19, 's0');
+INSERT INTO t VALUES (8630, 18, 's6'), (1695, 17, 's1'), (4760, 16, 's0'), (7825, 15, 's6'), (890, 14, 's1'), (3955, 13, 's0'), (7020, 12, 's6'), (85, 11, 's1'), (3150, 10, 's0'), (6215, 9, 's6'), (9280, 8, 's5'), (2345, 7, 's0'), (5410, 6, 's6'), (8475, 5, 's5'), (1540, 4, 's0'), (4605, 3, 's6'), (7670, 2, 's5'), (735, 1, 's0'), (3800, NULL, 's6'), (6865, 39, 's5'), (9930, 38, 's4'), (2995, 37, 's6'), (6060, 36, 's5'), (9125, 35, 's4'), (2190, 34, 's6');
+INSERT INTO t VALUES (5255, 33, 's5'), (8320, 32, 's4'), (1385, 31, 's6'), (4450, 30, 's5'), (7515, 29, 's4'), (580, 28, 's6'), (3645, 27, 's5'), (6710, 26, 's4'), (9775, 25, 's3'), (2840, 24, 's5'), (5905, 23, 's4'), (8970, 22, 's3'), (2035, 21, 's5'), (5100, 20, 's4'), (8165, 19, 's3'), (1230, 18, 's5'), (4295, 17, 's4'), (7360, 16, 's3'), (425, 15, 's5'), (3490, 14, 's4'), (6555, NULL, 's3'), (9620, 12, 's2'), (2685, 11, 's4'), (5750, 10, 's3'), (8815, 9, 's2');
+INSERT INTO t VALUES (1880, 8, 's4'), (4945, 7, 's3'), (8010, 6, 's2'), (1075, 5, 's4'), (4140, 4, 's3'), (7205, 3, 's2'), (270, 2, 's4'), (3335, 1, 's3'), (6400, 0, 's2'), (9465, 39, 's1'), (2530, 38, 's3'), (5595, 37, 's2'), (8660, 36, 's1'), (1725, 35, 's3'), (4790, 34, 's2'), (7855, 33, 's1'), (920, 32, 's3'), (3985, 31, 's2'), (7050, 30, 's1'), (115, 29, 's3'), (3180, 28, 's2'), (6245, 27, 's1'), (9310, NULL, 's0'), (2375, NULL, 's2'), (5440, 24, 's1');
+INSERT INTO t VALUES (8505, 23, 's0'), (1570, 22, 's2'), (4635, 21, 's1'), (7700, 20, 's0'), (765, 19, 's2'), (3830, 18, 's1'), (6895, 17, 's0'), (9960, 16, 's6'), (3025, 15, 's1'), (6090, 14, 's0'), (9155, 13, 's6'), (2220, 12, 's1'), (5285, 11, 's0'), (8350, 10, 's6'), (1415, 9, 's1'), (4480, 8, 's0'), (7545, 7, 's6'), (610, 6, 's1'), (3675, 5, 's0'), (6740, 4, 's6'), (9805, 3, 's5'), (2870, 2, 's0'), (5935, 1, 's6'), (9000, 0, 's5'), (2065, 39, 's0');
+INSERT INTO t VALUES (5130, NULL, 's6'), (8195, 37, 's5'), (1260, 36, 's0'), (4325, 35, 's6'), (7390, 34, 's5'), (455, 33, 's0'), (3520, 32, 's6'), (6585, 31, 's5'), (9650, 30, 's4'), (2715, 29, 's6'), (5780, 28, 's5'), (8845, 27, 's4'), (1910, 26, 's6'), (4975, 25, 's5'), (8040, 24, 's4'), (1105, 23, 's6'), (4170, 22, 's5'), (7235, 21, 's4'), (300, 20, 's6'), (3365, 19, 's5'), (6430, 18, 's4'), (9495, 17, 's3'), (2560, 16, 's5'), (5625, 15, 's4'), (8690, 14, 's3');
+INSERT INTO t VALUES (1755, 13, 's5'), (4820, 12, 's4'), (7885, NULL, 's3'), (950, NULL, 's5'), (4015, 9, 's4'), (7080, 8, 's3'), (145, 7, 's5'), (3210, 6, 's4'), (6275, 5, 's3'), (9340, 4, 's2'), (2405, 3, 's4'), (5470, 2, 's3'), (8535, 1, 's2'), (1600, 0, 's4'), (4665, 39, 's3'), (7730, 38, 's2'), (795, 37, 's4'), (3860, 36, 's3'), (6925, 35, 's2'), (9990, 34, 's1'), (3055, 33, 's3'), (6120, 32, 's2'), (9185, 31, 's1'), (2250, 30, 's3'), (5315, 29, 's2');
+INSERT INTO t VALUES (8380, 28, 's1'), (1445, 27, 's3'), (4510, 26, 's2'), (7575, 25, 's1'), (640, 24, 's3'), (3705, NULL, 's2'), (6770, 22, 's1'), (9835, 21, 's0'), (2900, 20, 's2'), (5965, 19, 's1'), (9030, 18, 's0'), (2095, 17, 's2'), (5160, 16, 's1'), (8225, 15, 's0'), (1290, 14, 's2'), (4355, 13, 's1'), (7420, 12, 's0'), (485, 11, 's2'), (3550, 10, 's1'), (6615, 9, 's0'), (9680, 8, 's6'), (2745, 7, 's1'), (5810, 6, 's0'), (8875, 5, 's6'), (1940, 4, 's1');
+INSERT INTO t VALUES (5005, 3, 's0'), (8070, 2, 's6'), (1135, 1, 's1'), (4200, 0, 's0'), (7265, 39, 's6'), (330, 38, 's1'), (3395, 37, 's0'), (6460, NULL, 's6'), (9525, 35, 's5'), (2590, 34, 's0'), (5655, 33, 's6'), (8720, 32, 's5'), (1785, 31, 's0'), (4850, 30, 's6'), (7915, 29, 's5'), (980, 28, 's0'), (4045, 27, 's6'), (7110, 26, 's5'), (175, 25, 's0'), (3240, 24, 's6'), (6305, 23, 's5'), (9370, 22, 's4'), (2435, 21, 's6'), (5500, 20, 's5'), (8565, 19, 's4');
+INSERT INTO t VALUES (1630, 18, 's6'), (4695, 17, 's5'), (7760, 16, 's4'), (825, 15, 's6'), (3890, 14, 's5'), (6955, 13, 's4'), (20, 12, 's6'), (3085, 11, 's5'), (6150, 10, 's4'), (9215, NULL, 's3'), (2280, NULL, 's5'), (5345, 7, 's4'), (8410, 6, 's3'), (1475, 5, 's5'), (4540, 4, 's4'), (7605, 3, 's3'), (670, 2, 's5'), (3735, 1, 's4'), (6800, 0, 's3'), (9865, 39, 's2'), (2930, 38, 's4'), (5995, 37, 's3'), (9060, 36, 's2'), (2125, 35, 's4'), (5190, 34, 's3');
+INSERT INTO t VALUES (8255, 33, 's2'), (1320, 32, 's4'), (4385, 31, 's3'), (7450, 30, 's2'), (515, 29, 's4'), (3580, 28, 's3'), (6645, 27, 's2'), (9710, 26, 's1'), (2775, 25, 's3'), (5840, 24, 's2'), (8905, 23, 's1'), (1970, 22, 's3'), (5035, NULL, 's2'), (8100, 20, 's1'), (1165, 19, 's3'), (4230, 18, 's2'), (7295, 17, 's1'), (360, 16, 's3'), (3425, 15, 's2'), (6490, 14, 's1'), (9555, 13, 's0'), (2620, 12, 's2'), (5685, 11, 's1'), (8750, 10, 's0'), (1815, 9, 's2');
+INSERT INTO t VALUES (4880, 8, 's1'), (7945, 7, 's0'), (1010, 6, 's2'), (4075, 5, 's1'), (7140, 4, 's0'), (205, 3, 's2'), (3270, 2, 's1'), (6335, 1, 's0'), (9400, 0, 's6'), (2465, 39, 's1'), (5530, 38, 's0'), (8595, 37, 's6'), (1660, 36, 's1'), (4725, 35, 's0'), (7790, NULL, 's6'), (855, NULL, 's1'), (3920, 32, 's0'), (6985, 31, 's6'), (50, 30, 's1'), (3115, 29, 's0'), (6180, 28, 's6'), (9245, 27, 's5'), (2310, 26, 's0'), (5375, 25, 's6'), (8440, 24, 's5');
+INSERT INTO t VALUES (1505, 23, 's0'), (4570, 22, 's6'), (7635, 21, 's5'), (700, 20, 's0'), (3765, 19, 's6'), (6830, 18, 's5'), (9895, 17, 's4'), (2960, 16, 's6'), (6025, 15, 's5'), (9090, 14, 's4'), (2155, 13, 's6'), (5220, 12, 's5'), (8285, 11, 's4'), (1350, 10, 's6'), (4415, 9, 's5'), (7480, 8, 's4'), (545, 7, 's6'), (3610, NULL, 's5'), (6675, 5, 's4'), (9740, 4, 's3'), (2805, 3, 's5'), (5870, 2, 's4'), (8935, 1, 's3'), (2000, 0, 's5'), (5065, 39, 's4');
+INSERT INTO t VALUES (8130, 38, 's3'), (1195, 37, 's5'), (4260, 36, 's4'), (7325, 35, 's3'), (390, 34, 's5'), (3455, 33, 's4'), (6520, 32, 's3'), (9585, 31, 's2'), (2650, 30, 's4'), (5715, 29, 's3'), (8780, 28, 's2'), (1845, 27, 's4'), (4910, 26, 's3'), (7975, 25, 's2'), (1040, 24, 's4'), (4105, 23, 's3'), (7170, 22, 's2'), (235, 21, 's4'), (3300, 20, 's3'), (6365, NULL, 's2'), (9430, 18, 's1'), (2495, 17, 's3'), (5560, 16, 's2'), (8625, 15, 's1'), (1690, 14, 's3');
+INSERT INTO t VALUES (4755, 13, 's2'), (7820, 12, 's1'), (885, 11, 's3'), (3950, 10, 's2'), (7015, 9, 's1'), (80, 8, 's3'), (3145, 7, 's2'), (6210, 6, 's1'), (9275, 5, 's0'), (2340, 4, 's2'), (5405, 3, 's1'), (8470, 2, 's0'), (1535, 1, 's2'), (4600, 0, 's1'), (7665, 39, 's0'), (730, 38, 's2'), (3795, 37, 's1'), (6860, 36, 's0'), (9925, 35, 's6'), (2990, 34, 's1'), (6055, 33, 's0'), (9120, NULL, 's6'), (2185, NULL, 's1'), (5250, 30, 's0'), (8315, 29, 's6');
+INSERT INTO t VALUES (1380, 28, 's1'), (4445, 27, 's0'), (7510, 26, 's6'), (575, 25, 's1'), (3640, 24, 's0'), (6705, 23, 's6'), (9770, 22, 's5'), (2835, 21, 's0'), (5900, 20, 's6'), (8965, 19, 's5'), (2030, 18, 's0'), (5095, 17, 's6'), (8160, 16, 's5'), (1225, 15, 's0'), (4290, 14, 's6'), (7355, 13, 's5'), (420, 12, 's0'), (3485, 11, 's6'), (6550, 10, 's5'), (9615, 9, 's4'), (2680, 8, 's6'), (5745, 7, 's5'), (8810, 6, 's4'), (1875, 5, 's6'), (4940, NULL, 's5');
+INSERT INTO t VALUES (8005, 3, 's4'), (1070, 2, 's6'), (4135, 1, 's5'), (7200, 0, 's4'), (265, 39, 's6'), (3330, 38, 's5'), (6395, 37, 's4'), (9460, 36, 's3'), (2525, 35, 's5'), (5590, 34, 's4'), (8655, 33, 's3'), (1720, 32, 's5'), (4785, 31, 's4'), (7850, 30, 's3'), (915, 29, 's5'), (3980, 28, 's4'), (7045, 27, 's3'), (110, 26, 's5'), (3175, 25, 's4'), (6240, 24, 's3'), (9305, 23, 's2'), (2370, 22, 's4'), (5435, 21, 's3'), (8500, 20, 's2'), (1565, 19, 's4');
+INSERT INTO t VALUES (4630, 18, 's3'), (7695, NULL, 's2'), (760, NULL, 's4'), (3825, 15, 's3'), (6890, 14, 's2'), (9955, 13, 's1'), (3020, 12, 's3'), (6085, 11, 's2'), (9150, 10, 's1'), (2215, 9, 's3'), (5280, 8, 's2'), (8345, 7, 's1'), (1410, 6, 's3'), (4475, 5, 's2'), (7540, 4, 's1'), (605, 3, 's3'), (3670, 2, 's2'), (6735, 1, 's1'), (9800, 0, 's0'), (2865, 39, 's2'), (5930, 38, 's1'), (8995, 37, 's0'), (2060, 36, 's2'), (5125, 35, 's1'), (8190, 34, 's0');
+INSERT INTO t VALUES (1255, 33, 's2'), (4320, 32, 's1'), (7385, 31, 's0'), (450, 30, 's2'), (3515, NULL, 's1'), (6580, 28, 's0'), (9645, 27, 's6'), (2710, 26, 's1'), (5775, 25, 's0'), (8840, 24, 's6'), (1905, 23, 's1'), (4970, 22, 's0'), (8035, 21, 's6'), (1100, 20, 's1'), (4165, 19, 's0'), (7230, 18, 's6'), (295, 17, 's1'), (3360, 16, 's0'), (6425, 15, 's6'), (9490, 14, 's5'), (2555, 13, 's0'), (5620, 12, 's6'), (8685, 11, 's5'), (1750, 10, 's0'), (4815, 9, 's6');
+INSERT INTO t VALUES (7880, 8, 's5'), (945, 7, 's0'), (4010, 6, 's6'), (7075, 5, 's5'), (140, 4, 's0'), (3205, 3, 's6'), (6270, NULL, 's5'), (9335, 1, 's4'), (2400, 0, 's6'), (5465, 39, 's5'), (8530, 38, 's4'), (1595, 37, 's6'), (4660, 36, 's5'), (7725, 35, 's4'), (790, 34, 's6'), (3855, 33, 's5'), (6920, 32, 's4'), (9985, 31, 's3'), (3050, 30, 's5'), (6115, 29, 's4'), (9180, 28, 's3'), (2245, 27, 's5'), (5310, 26, 's4'), (8375, 25, 's3'), (1440, 24, 's5');
+INSERT INTO t VALUES (4505, 23, 's4'), (7570, 22, 's3'), (635, 21, 's5'), (3700, 20, 's4'), (6765, 19, 's3'), (9830, 18, 's2'), (2895, 17, 's4'), (5960, 16, 's3'), (9025, NULL, 's2'), (2090, NULL, 's4'), (5155, 13, 's3'), (8220, 12, 's2'), (1285, 11, 's4'), (4350, 10, 's3'), (7415, 9, 's2'), (480, 8, 's4'), (3545, 7, 's3'), (6610, 6, 's2'), (9675, 5, 's1'), (2740, 4, 's3'), (5805, 3, 's2'), (8870, 2, 's1'), (1935, 1, 's3'), (5000, 0, 's2'), (8065, 39, 's1');
+INSERT INTO t VALUES (1130, 38, 's3'), (4195, 37, 's2'), (7260, 36, 's1'), (325, 35, 's3'), (3390, 34, 's2'), (6455, 33, 's1'), (9520, 32, 's0'), (2585, 31, 's2'), (5650, 30, 's1'), (8715, 29, 's0'), (1780, 28, 's2'), (4845, NULL, 's1'), (7910, 26, 's0'), (975, 25, 's2'), (4040, 24, 's1'), (7105, 23, 's0'), (170, 22, 's2'), (3235, 21, 's1'), (6300, 20, 's0'), (9365, 19, 's6'), (2430, 18, 's1'), (5495, 17, 's0'), (8560, 16, 's6'), (1625, 15, 's1'), (4690, 14, 's0');
+INSERT INTO t VALUES (7755, 13, 's6'), (820, 12, 's1'), (3885, 11, 's0'), (6950, 10, 's6'), (15, 9, 's1'), (3080, 8, 's0'), (6145, 7, 's6'), (9210, 6, 's5'), (2275, 5, 's0'), (5340, 4, 's6'), (8405, 3, 's5'), (1470, 2, 's0'), (4535, 1, 's6'), (7600, NULL, 's5'), (665, NULL, 's0'), (3730, 38, 's6'), (6795, 37, 's5'), (9860, 36, 's4'), (2925, 35, 's6'), (5990, 34, 's5'), (9055, 33, 's4'), (2120, 32, 's6'), (5185, 31, 's5'), (8250, 30, 's4'), (1315, 29, 's6');
+INSERT INTO t VALUES (4380, 28, 's5'), (7445, 27, 's4'), (510, 26, 's6'), (3575, 25, 's5'), (6640, 24, 's4'), (9705, 23, 's3'), (2770, 22, 's5'), (5835, 21, 's4'), (8900, 20, 's3'), (1965, 19, 's5'), (5030, 18, 's4'), (8095, 17, 's3'), (1160, 16, 's5'), (4225, 15, 's4'), (7290, 14, 's3'), (355, 13, 's5'), (3420, NULL, 's4'), (6485, 11, 's3'), (9550, 10, 's2'), (2615, 9, 's4'), (5680, 8, 's3'), (8745, 7, 's2'), (1810, 6, 's4'), (4875, 5, 's3'), (7940, 4, 's2');
+INSERT INTO t VALUES (1005, 3, 's4'), (4070, 2, 's3'), (7135, 1, 's2'), (200, 0, 's4'), (3265, 39, 's3'), (6330, 38, 's2'), (9395, 37, 's1'), (2460, 36, 's3'), (5525, 35, 's2'), (8590, 34, 's1'), (1655, 33, 's3'), (4720, 32, 's2'), (7785, 31, 's1'), (850, 30, 's3'), (3915, 29, 's2'), (6980, 28, 's1'), (45, 27, 's3'), (3110, 26, 's2'), (6175, NULL, 's1'), (9240, 24, 's0'), (2305, 23, 's2'), (5370, 22, 's1'), (8435, 21, 's0'), (1500, 20, 's2'), (4565, 19, 's1');
+INSERT INTO t VALUES (7630, 18, 's0'), (695, 17, 's2'), (3760, 16, 's1'), (6825, 15, 's0'), (9890, 14, 's6'), (2955, 13, 's1'), (6020, 12, 's0'), (9085, 11, 's6'), (2150, 10, 's1'), (5215, 9, 's0'), (8280, 8, 's6'), (1345, 7, 's1'), (4410, 6, 's0'), (7475, 5, 's6'), (540, 4, 's1'), (3605, 3, 's0'), (6670, 2, 's6'), (9735, 1, 's5'), (2800, 0, 's0'), (5865, 39, 's6'), (8930, NULL, 's5'), (1995, NULL, 's0'), (5060, 36, 's6'), (8125, 35, 's5'), (1190, 34, 's0');
+INSERT INTO t VALUES (4255, 33, 's6'), (7320, 32, 's5'), (385, 31, 's0'), (3450, 30, 's6'), (6515, 29, 's5'), (9580, 28, 's4'), (2645, 27, 's6'), (5710, 26, 's5'), (8775, 25, 's4'), (1840, 24, 's6'), (4905, 23, 's5'), (7970, 22, 's4'), (1035, 21, 's6'), (4100, 20, 's5'), (7165, 19, 's4'), (230, 18, 's6'), (3295, 17, 's5'), (6360, 16, 's4'), (9425, 15, 's3'), (2490, 14, 's5'), (5555, 13, 's4'), (8620, 12, 's3'), (1685, 11, 's5'), (4750, NULL, 's4'), (7815, 9, 's3');
+INSERT INTO t VALUES (880, 8, 's5'), (3945, 7, 's4'), (7010, 6, 's3'), (75, 5, 's5'), (3140, 4, 's4'), (6205, 3, 's3'), (9270, 2, 's2'), (2335, 1, 's4'), (5400, 0, 's3'), (8465, 39, 's2'), (1530, 38, 's4'), (4595, 37, 's3'), (7660, 36, 's2'), (725, 35, 's4'), (3790, 34, 's3'), (6855, 33, 's2'), (9920, 32, 's1'), (2985, 31, 's3'), (6050, 30, 's2'), (9115, 29, 's1'), (2180, 28, 's3'), (5245, 27, 's2'), (8310, 26, 's1'), (1375, 25, 's3'), (4440, 24, 's2');
+CREATE INDEX t("id ORGANIZE");
+INSERT INTO t VALUES (7505, NULL, 's1'), (570, NULL, 's3'), (3635, 21, 's2'), (6700, 20, 's1'), (9765, 19, 's0'), (2830, 18, 's2'), (5895, 17, 's1'), (8960, 16, 's0'), (2025, 15, 's2'), (5090, 14, 's1'), (8155, 13, 's0'), (1220, 12, 's2'), (4285, 11, 's1'), (7350, 10, 's0'), (415, 9, 's2'), (3480, 8, 's1'), (6545, 7, 's0'), (9610, 6, 's6'), (2675, 5, 's1'), (5740, 4, 's0'), (8805, 3, 's6'), (1870, 2, 's1'), (4935, 1, 's0'), (8000, 0, 's6'), (1065, 39, 's1');
+INSERT INTO t VALUES (4130, 38, 's0'), (7195, 37, 's6'), (260, 36, 's1'), (3325, NULL, 's0'), (6390, 34, 's6'), (9455, 33, 's5'), (2520, 32, 's0'), (5585, 31, 's6'), (8650, 30, 's5'), (1715, 29, 's0'), (4780, 28, 's6'), (7845, 27, 's5'), (910, 26, 's0'), (3975, 25, 's6'), (7040, 24, 's5'), (105, 23, 's0'), (3170, 22, 's6'), (6235, 21, 's5'), (9300, 20, 's4'), (2365, 19, 's6'), (5430, 18, 's5'), (8495, 17, 's4'), (1560, 16, 's6'), (4625, 15, 's5'), (7690, 14, 's4');
+INSERT INTO t VALUES (755, 13, 's6'), (3820, 12, 's5'), (6885, 11, 's4'), (9950, 10, 's3'), (3015, 9, 's5'), (6080, NULL, 's4'), (9145, 7, 's3'), (2210, 6, 's5'), (5275, 5, 's4'), (8340, 4, 's3'), (1405, 3, 's5'), (4470, 2, 's4'), (7535, 1, 's3'), (600, 0, 's5'), (3665, 39, 's4'), (6730, 38, 's3'), (9795, 37, 's2'), (2860, 36, 's4'), (5925, 35, 's3'), (8990, 34, 's2'), (2055, 33, 's4'), (5120, 32, 's3'), (8185, 31, 's2'), (1250, 30, 's4'), (4315, 29, 's3');
+INSERT INTO t VALUES (7380, 28, 's2'), (445, 27, 's4'), (3510, 26, 's3'), (6575, 25, 's2'), (9640, 24, 's1'), (2705, 23, 's3'), (5770, 22, 's2'), (8835, NULL, 's1'), (1900, NULL, 's3'), (4965, 19, 's2'), (8030, 18, 's1'), (1095, 17, 's3'), (4160, 16, 's2'), (7225, 15, 's1'), (290, 14, 's3'), (3355, 13, 's2'), (6420, 12, 's1'), (9485, 11, 's0'), (2550, 10, 's2'), (5615, 9, 's1'), (8680, 8, 's0'), (1745, 7, 's2'), (4810, 6, 's1'), (7875, 5, 's0'), (940, 4, 's2');
+INSERT INTO t VALUES (4005, 3, 's1'), (7070, 2, 's0'), (135, 1, 's2'), (3200, 0, 's1'), (6265, 39, 's0'), (9330, 38, 's6'), (2395, 37, 's1'), (5460, 36, 's0'), (8525, 35, 's6'), (1590, 34, 's1'), (4655, NULL, 's0'), (7720, 32, 's6'), (785, 31, 's1'), (3850, 30, 's0'), (6915, 29, 's6'), (9980, 28, 's5'), (3045, 27, 's0'), (6110, 26, 's6'), (9175, 25, 's5'), (2240, 24, 's0'), (5305, 23, 's6'), (8370, 22, 's5'), (1435, 21, 's0'), (4500, 20, 's6'), (7565, 19, 's5');
+INSERT INTO t VALUES (630, 18, 's0'), (3695, 17, 's6'), (6760, 16, 's5'), (9825, 15, 's4'), (2890, 14, 's6'), (5955, 13, 's5'), (9020, 12, 's4'), (2085, 11, 's6'), (5150, 10, 's5'), (8215, 9, 's4'), (1280, 8, 's6'), (4345, 7, 's5'), (7410, NULL, 's4'), (475, NULL, 's6'), (3540, 4, 's5'), (6605, 3, 's4'), (9670, 2, 's3'), (2735, 1, 's5'), (5800, 0, 's4'), (8865, 39, 's3'), (1930, 38, 's5'), (4995, 37, 's4'), (8060, 36, 's3'), (1125, 35, 's5'), (4190, 34, 's4');
+INSERT INTO t VALUES (7255, 33, 's3'), (320, 32, 's5'), (3385, 31, 's4'), (6450, 30, 's3'), (9515, 29, 's2'), (2580, 28, 's4'), (5645, 27, 's3'), (8710, 26, 's2'), (1775, 25, 's4'), (4840, 24, 's3'), (7905, 23, 's2'), (970, 22, 's4'), (4035, 21, 's3'), (7100, 20, 's2'), (165, 19, 's4'), (3230, NULL, 's3'), (6295, 17, 's2'), (9360, 16, 's1'), (2425, 15, 's3'), (5490, 14, 's2'), (8555, 13, 's1'), (1620, 12, 's3'), (4685, 11, 's2'), (7750, 10, 's1'), (815, 9, 's3');
+INSERT INTO t VALUES (3880, 8, 's2'), (6945, 7, 's1'), (10, 6, 's3'), (3075, 5, 's2'), (6140, 4, 's1'), (9205, 3, 's0'), (2270, 2, 's2'), (5335, 1, 's1'), (8400, 0, 's0'), (1465, 39, 's2'), (4530, 38, 's1'), (7595, 37, 's0'), (660, 36, 's2'), (3725, 35, 's1'), (6790, 34, 's0'), (9855, 33, 's6'), (2920, 32, 's1'), (5985, NULL, 's0'), (9050, 30, 's6'), (2115, 29, 's1'), (5180, 28, 's0'), (8245, 27, 's6'), (1310, 26, 's1'), (4375, 25, 's0'), (7440, 24, 's6');
+INSERT INTO t VALUES (505, 23, 's1'), (3570, 22, 's0'), (6635, 21, 's6'), (9700, 20, 's5'), (2765, 19, 's0'), (5830, 18, 's6'), (8895, 17, 's5'), (1960, 16, 's0'), (5025, 15, 's6'), (8090, 14, 's5'), (1155, 13, 's0'), (4220, 12, 's6'), (7285, 11, 's5'), (350, 10, 's0'), (3415, 9, 's6'), (6480, 8, 's5'), (9545, 7, 's4'), (2610, 6, 's6'), (5675, 5, 's5'), (8740, NULL, 's4'), (1805, NULL, 's6'), (4870, 2, 's5'), (7935, 1, 's4'), (1000, 0, 's6'), (4065, 39, 's5');
+INSERT INTO t VALUES (7130, 38, 's4'), (195, 37, 's6'), (3260, 36, 's5'), (6325, 35, 's4'), (9390, 34, 's3'), (2455, 33, 's5'), (5520, 32, 's4'), (8585, 31, 's3'), (1650, 30, 's5'), (4715, 29, 's4'), (7780, 28, 's3'), (845, 27, 's5'), (3910, 26, 's4'), (6975, 25, 's3'), (40, 24, 's5'), (3105, 23, 's4'), (6170, 22, 's3'), (9235, 21, 's2'), (2300, 20, 's4'), (5365, 19, 's3'), (8430, 18, 's2'), (1495, 17, 's4'), (4560, NULL, 's3'), (7625, 15, 's2'), (690, 14, 's4');
+INSERT INTO t VALUES (3755, 13, 's3'), (6820, 12, 's2'), (9885, 11, 's1'), (2950, 10, 's3'), (6015, 9, 's2'), (9080, 8, 's1'), (2145, 7, 's3'), (5210, 6, 's2'), (8275, 5, 's1'), (1340, 4, 's3'), (4405, 3, 's2'), (7470, 2, 's1'), (535, 1, 's3'), (3600, 0, 's2'), (6665, 39, 's1'), (9730, 38, 's0'), (2795, 37, 's2'), (5860, 36, 's1'), (8925, 35, 's0'), (1990, 34, 's2'), (5055, 33, 's1'), (8120, 32, 's0'), (1185, 31, 's2'), (4250, 30, 's1'), (7315, NULL, 's0');
+INSERT INTO t VALUES (380, NULL, 's2'), (3445, 27, 's1'), (6510, 26, 's0'), (9575, 25, 's6'), (2640, 24, 's1'), (5705, 23, 's0'), (8770, 22, 's6'), (1835, 21, 's1'), (4900, 20, 's0'), (7965, 19, 's6'), (1030, 18, 's1'), (4095, 17, 's0'), (7160, 16, 's6'), (225, 15, 's1'), (3290, 14, 's0'), (6355, 13, 's6'), (9420, 12, 's5'), (2485, 11, 's0'), (5550, 10, 's6'), (8615, 9, 's5'), (1680, 8, 's0'), (4745, 7, 's6'), (7810, 6, 's5'), (875, 5, 's0'), (3940, 4, 's6');
+INSERT INTO t VALUES (7005, 3, 's5'), (70, 2, 's0'), (3135, NULL, 's6'), (6200, 0, 's5'), (9265, 39, 's4'), (2330, 38, 's6'), (5395, 37, 's5'), (8460, 36, 's4'), (1525, 35, 's6'), (4590, 34, 's5'), (7655, 33, 's4'), (720, 32, 's6'), (3785, 31, 's5'), (6850, 30, 's4'), (9915, 29, 's3'), (2980, 28, 's5'), (6045, 27, 's4'), (9110, 26, 's3'), (2175, 25, 's5'), (5240, 24, 's4'), (8305, 23, 's3'), (1370, 22, 's5'), (4435, 21, 's4'), (7500, 20, 's3'), (565, 19, 's5');
+INSERT INTO t VALUES (3630, 18, 's4'), (6695, 17, 's3'), (9760, 16, 's2'), (2825, 15, 's4'), (5890, NULL, 's3'), (8955, 13, 's2'), (2020, 12, 's4'), (5085, 11, 's3'), (8150, 10, 's2'), (1215, 9, 's4'), (4280, 8, 's3'), (7345, 7, 's2'), (410, 6, 's4'), (3475, 5, 's3'), (6540, 4, 's2'), (9605, 3, 's1'), (2670, 2, 's3'), (5735, 1, 's2'), (8800, 0, 's1'), (1865, 39, 's3'), (4930, 38, 's2'), (7995, 37, 's1'), (1060, 36, 's3'), (4125, 35, 's2'), (7190, 34, 's1');
+INSERT INTO t VALUES (255, 33, 's3'), (3320, 32, 's2'), (6385, 31, 's1'), (9450, 30, 's0'), (2515, 29, 's2'), (5580, 28, 's1'), (8645, NULL, 's0'), (1710, NULL, 's2'), (4775, 25, 's1'), (7840, 24, 's0'), (905, 23, 's2'), (3970, 22, 's1'), (7035, 21, 's0'), (100, 20, 's2'), (3165, 19, 's1'), (6230, 18, 's0'), (9295, 17, 's6'), (2360, 16, 's1'), (5425, 15, 's0'), (8490, 14, 's6'), (1555, 13, 's1'), (4620, 12, 's0'), (7685, 11, 's6'), (750, 10, 's1'), (3815, 9, 's0');
+INSERT INTO t VALUES (6880, 8, 's6'), (9945, 7, 's5'), (3010, 6, 's0'), (6075, 5, 's6'), (9140, 4, 's5'), (2205, 3, 's0'), (5270, 2, 's6'), (8335, 1, 's5'), (1400, 0, 's0'), (4465, NULL, 's6'), (7530, 38, 's5'), (595, 37, 's0'), (3660, 36, 's6'), (6725, 35, 's5'), (9790, 34, 's4'), (2855, 33, 's6'), (5920, 32, 's5'), (8985, 31, 's4'), (2050, 30, 's6'), (5115, 29, 's5'), (8180, 28, 's4'), (1245, 27, 's6'), (4310, 26, 's5'), (7375, 25, 's4'), (440, 24, 's6');
+INSERT INTO t VALUES (3505, 23, 's5'), (6570, 22, 's4'), (9635, 21, 's3'), (2700, 20, 's5'), (5765, 19, 's4'), (8830, 18, 's3'), (1895, 17, 's5'), (4960, 16, 's4'), (8025, 15, 's3'), (1090, 14, 's5'), (4155, 13, 's4'), (7220, NULL, 's3'), (285, NULL, 's5'), (3350, 10, 's4'), (6415, 9, 's3'), (9480, 8, 's2'), (2545, 7, 's4'), (5610, 6, 's3'), (8675, 5, 's2'), (1740, 4, 's4'), (4805, 3, 's3'), (7870, 2, 's2'), (935, 1, 's4'), (4000, 0, 's3'), (7065, 39, 's2');
+INSERT INTO t VALUES (130, 38, 's4'), (3195, 37, 's3'), (6260, 36, 's2'), (9325, 35, 's1'), (2390, 34, 's3'), (5455, 33, 's2'), (8520, 32, 's1'), (1585, 31, 's3'), (4650, 30, 's2'), (7715, 29, 's1'), (780, 28, 's3'), (3845, 27, 's2'), (6910, 26, 's1'), (9975, NULL, 's0'), (3040, NULL, 's2'), (6105, 23, 's1'), (9170, 22, 's0'), (2235, 21, 's2'), (5300, 20, 's1'), (8365, 19, 's0'), (1430, 18, 's2'), (4495, 17, 's1'), (7560, 16, 's0'), (625, 15, 's2'), (3690, 14, 's1');
+INSERT INTO t VALUES (6755, 13, 's0'), (9820, 12, 's6'), (2885, 11, 's1'), (5950, 10, 's0'), (9015, 9, 's6'), (2080, 8, 's1'), (5145, 7, 's0'), (8210, 6, 's6'), (1275, 5, 's1'), (4340, 4, 's0'), (7405, 3, 's6'), (470, 2, 's1'), (3535, 1, 's0'), (6600, 0, 's6'), (9665, 39, 's5'), (2730, 38, 's0'), (5795, NULL, 's6'), (8860, 36, 's5'), (1925, 35, 's0'), (4990, 34, 's6'), (8055, 33, 's5'), (1120, 32, 's0'), (4185, 31, 's6'), (7250, 30, 's5'), (315, 29, 's0');
+INSERT INTO t VALUES (3380, 28, 's6'), (6445, 27, 's5'), (9510, 26, 's4'), (2575, 25, 's6'), (5640, 24, 's5'), (8705, 23, 's4'), (1770, 22, 's6'), (4835, 21, 's5'), (7900, 20, 's4'), (965, 19, 's6'), (4030, 18, 's5'), (7095, 17, 's4'), (160, 16, 's6'), (3225, 15, 's5'), (6290, 14, 's4'), (9355, 13, 's3'), (2420, 12, 's5'), (5485, 11, 's4'), (8550, NULL, 's3'), (1615, NULL, 's5'), (4680, 8, 's4'), (7745, 7, 's3'), (810, 6, 's5'), (3875, 5, 's4'), (6940, 4, 's3');
+-- key ranges come out in key order
+SELECT id, a, s FROM t WHERE id >= 4990 AND id <= 5030;
+SELECT id, a FROM t WHERE id < 30;
+SELECT id, a FROM t WHERE id > 9980;
+SELECT NUM(id), SUM(a) FROM t WHERE id > 2500 AND id < 7500;
+SELECT id, a FROM t WHERE id = 5000;
+SELECT id, a FROM t WHERE id = 5001;
+-- through the secondary index
+SELECT id, a, s FROM t WHERE a = 7 AND id < 1500 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a = 39;
+SELECT NUM(id) FROM t WHERE a = NULL;
+SELECT NUM(a), SUM(id) FROM t WHERE a = 3 OR s = 's3';
+SELECT NUM(id), SUM(a) FROM t;
+-- rows come and go in the middle of the key range
+DELETE FROM t WHERE id > 4000 AND id < 6000;
+DELETE FROM t WHERE a = 39;
+INSERT INTO t VALUES (5001, 7, 'mid'), (5002, 39, 'mid'), (4996, NULL, 'mid'), (1, 7, 'low'), (20000, 7, 'high');
+INSERT INTO t VALUES (30, 1, 'dup');
+UPDATE t SET a = 39, s = 'upd' WHERE id >= 6000 AND id < 6100;
+UPDATE t SET a = 7 WHERE a = 8 AND id < 2000;
+-- key ranges come out in key order
+SELECT id, a, s FROM t WHERE id >= 4990 AND id <= 5030;
+SELECT id, a FROM t WHERE id < 30;
+SELECT id, a FROM t WHERE id > 9980;
+SELECT NUM(id), SUM(a) FROM t WHERE id > 2500 AND id < 7500;
+SELECT id, a FROM t WHERE id = 5000;
+SELECT id, a FROM t WHERE id = 5001;
+-- through the secondary index
+SELECT id, a, s FROM t WHERE a = 7 AND id < 1500 ORDER BY id;
+SELECT NUM(a), SUM(id) FROM t WHERE a = 39;
+SELECT NUM(id) FROM t WHERE a = NULL;
+SELECT NUM(a), SUM(id) FROM t WHERE a = 3 OR s = 's3';
+SELECT NUM(id), SUM(a) FROM t;
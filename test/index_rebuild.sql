@@ -0,0 +1,171 @@
+-- deletes free most nodes of the indexes, which are rebuilt automatically
+-- and on request, see run_sql.sh
+CREATE DATABASE ir;
+USE DATABASE ir;
+CREATE TABLE t(id int(10) NOT NULL, a int(10), s varchar(20), PRIMARY KEY(id));
+CREATE INDEX t(a);
+CREATE INDEX t(s);
+INSERT INTO t VALUES (1, 37, 'k0053'), (2, 74, 'k0106'), (3, 111, 'k0159'), (4, 148, 'k0212'), (5, 185, 'k0265'), (6, 222, 'k0318'), (7, 259, 'k0371'), (8, 296, 'k0424'), (9, 333, 'k0477'), (10, 370, 'k0530'), (11, 407, 'k0583'), (12, 444, 'k0636'), (13, 481, 'k0689'), (14, 518, 'k0742'), (15, 555, 'k0795'), (16, 592, 'k0848'), (17, 629, 'k0901'), (18, 666, 'k0954'), (19, 703, 'k1007'), (20, 740, 'k1060'), (21, 777, 'k1113'), (22, 814, 'k1166'), (23, 851, 'k1219'), (24, 888, 'k1272'), (25, 925, 'k1325');
+INSERT INTO t VALUES (26, 962, 'k1378'), (27, 999, 'k1431'), (28, 36, 'k1484'), (29, 73, 'k1537'), (30, 110, 'k1590'), (31, 147, 'k1643'), (32, 184, 'k1696'), (33, 221, 'k1749'), (34, 258, 'k1802'), (35, 295, 'k1855'), (36, 332, 'k1908'), (37, 369, 'k1961'), (38, 406, 'k2014'), (39, 443, 'k2067'), (40, 480, 'k2120'), (41, 517, 'k2173'), (42, 554, 'k2226'), (43, 591, 'k2279'), (44, 628, 'k2332'), (45, 665, 'k2385'), (46, 702, 'k2438'), (47, 739, 'k2491'), (48, 776, 'k2544'), (49, 813, 'k2597'), (50, 850, 'k2650');
+INSERT INTO t VALUES (51, 887, 'k2703'), (52, 924, 'k2756'), (53, 961, 'k2809'), (54, 998, 'k2862'), (55, 35, 'k2915'), (56, 72, 'k2968'), (57, 109, 'k0021'), (58, 146, 'k0074'), (59, 183, 'k0127'), (60, 220, 'k0180'), (61, 257, 'k0233'), (62, 294, 'k0286'), (63, 331, 'k0339'), (64, 368, 'k0392'), (65, 405, 'k0445'), (66, 442, 'k0498'), (67, 479, 'k0551'), (68, 516, 'k0604'), (69, 553, 'k0657'), (70, 590, 'k0710'), (71, 627, 'k0763'), (72, 664, 'k0816'), (73, 701, 'k0869'), (74, 738, 'k0922'), (75, 775, 'k0975');
+INSERT INTO t VALUES (76, 812, 'k1028'), (77, 849, 'k1081'), (78, 886, 'k1134'), (79, 923, 'k1187'), (80, 960, 'k1240'), (81, 997, 'k1293'), (82, 34, 'k1346'), (83, 71, 'k1399'), (84, 108, 'k1452'), (85, 145, 'k1505'), (86, 182, 'k1558'), (87, 219, 'k1611'), (88, 256, 'k1664'), (89, 293, 'k1717'), (90, 330, 'k1770'), (91, 367, 'k1823'), (92, 404, 'k1876'), (93, 441, 'k1929'), (94, 478, 'k1982'), (95, 515, 'k2035'), (96, 552, 'k2088'), (97, 589, 'k2141'), (98, 626, 'k2194'), (99, 663, 'k2247'), (100, 700, 'k2300');
+INSERT INTO t VALUES (101, 737, 'k2353'), (102, 774, 'k2406'), (103, 811, 'k2459'), (104, 848, 'k2512'), (105, 885, 'k2565'), (106, 922, 'k2618'), (107, 959, 'k2671'), (108, 996, 'k2724'), (109, 33, 'k2777'), (110, 70, 'k2830'), (111, 107, 'k2883'), (112, 144, 'k2936'), (113, 181, 'k2989'), (114, 218, 'k0042'), (115, 255, 'k0095'), (116, 292, 'k0148'), (117, 329, 'k0201'), (118, 366, 'k0254'), (119, 403, 'k0307'), (120, 440, 'k0360'), (121, 477, 'k0413'), (122, 514, 'k0466'), (123, 551, 'k0519'), (124, 588, 'k0572'), (125, 625, 'k0625');
+INSERT INTO t VALUES (126, 662, 'k0678'), (127, 699, 'k0731'), (128, 736, 'k0784'), (129, 773, 'k0837'), (130, 810, 'k0890'), (131, 847, 'k0943'), (132, 884, 'k0996'), (133, 921, 'k1049'), (134, 958, 'k1102'), (135, 995, 'k1155'), (136, 32, 'k1208'), (137, 69, 'k1261'), (138, 106, 'k1314'), (139, 143, 'k1367'), (140, 180, 'k1420'), (141, 217, 'k1473'), (142, 254, 'k1526'), (143, 291, 'k1579'), (144, 328, 'k1632'), (145, 365, 'k1685'), (146, 402, 'k1738'), (147, 439, 'k1791'), (148, 476, 'k1844'), (149, 513, 'k1897'), (150, 550, 'k1950');
+INSERT INTO t VALUES (151, 587, 'k2003'), (152, 624, 'k2056'), (153, 661, 'k2109'), (154, 698, 'k2162'), (155, 735, 'k2215'), (156, 772, 'k2268'), (157, 809, 'k2321'), (158, 846, 'k2374'), (159, 883, 'k2427'), (160, 920, 'k2480'), (161, 957, 'k2533'), (162, 994, 'k2586'), (163, 31, 'k2639'), (164, 68, 'k2692'), (165, 105, 'k2745'), (166, 142, 'k2798'), (167, 179, 'k2851'), (168, 216, 'k2904'), (169, 253, 'k2957'), (170, 290, 'k0010'), (171, 327, 'k0063'), (172, 364, 'k0116'), (173, 401, 'k0169'), (174, 438, 'k0222'), (175, 475, 'k0275');
+INSERT INTO t VALUES (176, 512, 'k0328'), (177, 549, 'k0381'), (178, 586, 'k0434'), (179, 623, 'k0487'), (180, 660, 'k0540'), (181, 697, 'k0593'), (182, 734, 'k0646'), (183, 771, 'k0699'), (184, 808, 'k0752'), (185, 845, 'k0805'), (186, 882, 'k0858'), (187, 919, 'k0911'), (188, 956, 'k0964'), (189, 993, 'k1017'), (190, 30, 'k1070'), (191, 67, 'k1123'), (192, 104, 'k1176'), (193, 141, 'k1229'), (194, 178, 'k1282'), (195, 215, 'k1335'), (196, 252, 'k1388'), (197, 289, 'k1441'), (198, 326, 'k1494'), (199, 363, 'k1547'), (200, 400, 'k1600');
+INSERT INTO t VALUES (201, 437, 'k1653'), (202, 474, 'k1706'), (203, 511, 'k1759'), (204, 548, 'k1812'), (205, 585, 'k1865'), (206, 622, 'k1918'), (207, 659, 'k1971'), (208, 696, 'k2024'), (209, 733, 'k2077'), (210, 770, 'k2130'), (211, 807, 'k2183'), (212, 844, 'k2236'), (213, 881, 'k2289'), (214, 918, 'k2342'), (215, 955, 'k2395'), (216, 992, 'k2448'), (217, 29, 'k2501'), (218, 66, 'k2554'), (219, 103, 'k2607'), (220, 140, 'k2660'), (221, 177, 'k2713'), (222, 214, 'k2766'), (223, 251, 'k2819'), (224, 288, 'k2872'), (225, 325, 'k2925');
+INSERT INTO t VALUES (226, 362, 'k2978'), (227, 399, 'k0031'), (228, 436, 'k0084'), (229, 473, 'k0137'), (230, 510, 'k0190'), (231, 547, 'k0243'), (232, 584, 'k0296'), (233, 621, 'k0349'), (234, 658, 'k0402'), (235, 695, 'k0455'), (236, 732, 'k0508'), (237, 769, 'k0561'), (238, 806, 'k0614'), (239, 843, 'k0667'), (240, 880, 'k0720'), (241, 917, 'k0773'), (242, 954, 'k0826'), (243, 991, 'k0879'), (244, 28, 'k0932'), (245, 65, 'k0985'), (246, 102, 'k1038'), (247, 139, 'k1091'), (248, 176, 'k1144'), (249, 213, 'k1197'), (250, 250, 'k1250');
+INSERT INTO t VALUES (251, 287, 'k1303'), (252, 324, 'k1356'), (253, 361, 'k1409'), (254, 398, 'k1462'), (255, 435, 'k1515'), (256, 472, 'k1568'), (257, 509, 'k1621'), (258, 546, 'k1674'), (259, 583, 'k1727'), (260, 620, 'k1780'), (261, 657, 'k1833'), (262, 694, 'k1886'), (263, 731, 'k1939'), (264, 768, 'k1992'), (265, 805, 'k2045'), (266, 842, 'k2098'), (267, 879, 'k2151'), (268, 916, 'k2204'), (269, 953, 'k2257'), (270, 990, 'k2310'), (271, 27, 'k2363'), (272, 64, 'k2416'), (273, 101, 'k2469'), (274, 138, 'k2522'), (275, 175, 'k2575');
+INSERT INTO t VALUES (276, 212, 'k2628'), (277, 249, 'k2681'), (278, 286, 'k2734'), (279, 323, 'k2787'), (280, 360, 'k2840'), (281, 397, 'k2893'), (282, 434, 'k2946'), (283, 471, 'k2999'), (284, 508, 'k0052'), (285, 545, 'k0105'), (286, 582, 'k0158'), (287, 619, 'k0211'), (288, 656, 'k0264'), (289, 693, 'k0317'), (290, 730, 'k0370'), (291, 767, 'k0423'), (292, 804, 'k0476'), (293, 841, 'k0529'), (294, 878, 'k0582'), (295, 915, 'k0635'), (296, 952, 'k0688'), (297, 989, 'k0741'), (298, 26, 'k0794'), (299, 63, 'k0847'), (300, 100, 'k0900');
+INSERT INTO t VALUES (301, 137, 'k0953'), (302, 174, 'k1006'), (303, 211, 'k1059'), (304, 248, 'k1112'), (305, 285, 'k1165'), (306, 322, 'k1218'), (307, 359, 'k1271'), (308, 396, 'k1324'), (309, 433, 'k1377'), (310, 470, 'k1430'), (311, 507, 'k1483'), (312, 544, 'k1536'), (313, 581, 'k1589'), (314, 618, 'k1642'), (315, 655, 'k1695'), (316, 692, 'k1748'), (317, 729, 'k1801'), (318, 766, 'k1854'), (319, 803, 'k1907'), (320, 840, 'k1960'), (321, 877, 'k2013'), (322, 914, 'k2066'), (323, 951, 'k2119'), (324, 988, 'k2172'), (325, 25, 'k2225');
+INSERT INTO t VALUES (326, 62, 'k2278'), (327, 99, 'k2331'), (328, 136, 'k2384'), (329, 173, 'k2437'), (330, 210, 'k2490'), (331, 247, 'k2543'), (332, 284, 'k2596'), (333, 321, 'k2649'), (334, 358, 'k2702'), (335, 395, 'k2755'), (336, 432, 'k2808'), (337, 469, 'k2861'), (338, 506, 'k2914'), (339, 543, 'k2967'), (340, 580, 'k0020'), (341, 617, 'k0073'), (342, 654, 'k0126'), (343, 691, 'k0179'), (344, 728, 'k0232'), (345, 765, 'k0285'), (346, 802, 'k0338'), (347, 839, 'k0391'), (348, 876, 'k0444'), (349, 913, 'k0497'), (350, 950, 'k0550');
+INSERT INTO t VALUES (351, 987, 'k0603'), (352, 24, 'k0656'), (353, 61, 'k0709'), (354, 98, 'k0762'), (355, 135, 'k0815'), (356, 172, 'k0868'), (357, 209, 'k0921'), (358, 246, 'k0974'), (359, 283, 'k1027'), (360, 320, 'k1080'), (361, 357, 'k1133'), (362, 394, 'k1186'), (363, 431, 'k1239'), (364, 468, 'k1292'), (365, 505, 'k1345'), (366, 542, 'k1398'), (367, 579, 'k1451'), (368, 616, 'k1504'), (369, 653, 'k1557'), (370, 690, 'k1610'), (371, 727, 'k1663'), (372, 764, 'k1716'), (373, 801, 'k1769'), (374, 838, 'k1822'), (375, 875, 'k1875');
+INSERT INTO t VALUES (376, 912, 'k1928'), (377, 949, 'k1981'), (378, 986, 'k2034'), (379, 23, 'k2087'), (380, 60, 'k2140'), (381, 97, 'k2193'), (382, 134, 'k2246'), (383, 171, 'k2299'), (384, 208, 'k2352'), (385, 245, 'k2405'), (386, 282, 'k2458'), (387, 319, 'k2511'), (388, 356, 'k2564'), (389, 393, 'k2617'), (390, 430, 'k2670'), (391, 467, 'k2723'), (392, 504, 'k2776'), (393, 541, 'k2829'), (394, 578, 'k2882'), (395, 615, 'k2935'), (396, 652, 'k2988'), (397, 689, 'k0041'), (398, 726, 'k0094'), (399, 763, 'k0147'), (400, 800, 'k0200');
+INSERT INTO t VALUES (401, 837, 'k0253'), (402, 874, 'k0306'), (403, 911, 'k0359'), (404, 948, 'k0412'), (405, 985, 'k0465'), (406, 22, 'k0518'), (407, 59, 'k0571'), (408, 96, 'k0624'), (409, 133, 'k0677'), (410, 170, 'k0730'), (411, 207, 'k0783'), (412, 244, 'k0836'), (413, 281, 'k0889'), (414, 318, 'k0942'), (415, 355, 'k0995'), (416, 392, 'k1048'), (417, 429, 'k1101'), (418, 466, 'k1154'), (419, 503, 'k1207'), (420, 540, 'k1260'), (421, 577, 'k1313'), (422, 614, 'k1366'), (423, 651, 'k1419'), (424, 688, 'k1472'), (425, 725, 'k1525');
+INSERT INTO t VALUES (426, 762, 'k1578'), (427, 799, 'k1631'), (428, 836, 'k1684'), (429, 873, 'k1737'), (430, 910, 'k1790'), (431, 947, 'k1843'), (432, 984, 'k1896'), (433, 21, 'k1949'), (434, 58, 'k2002'), (435, 95, 'k2055'), (436, 132, 'k2108'), (437, 169, 'k2161'), (438, 206, 'k2214'), (439, 243, 'k2267'), (440, 280, 'k2320'), (441, 317, 'k2373'), (442, 354, 'k2426'), (443, 391, 'k2479'), (444, 428, 'k2532'), (445, 465, 'k2585'), (446, 502, 'k2638'), (447, 539, 'k2691'), (448, 576, 'k2744'), (449, 613, 'k2797'), (450, 650, 'k2850');
+INSERT INTO t VALUES (451, 687, 'k2903'), (452, 724, 'k2956'), (453, 761, 'k0009'), (454, 798, 'k0062'), (455, 835, 'k0115'), (456, 872, 'k0168'), (457, 909, 'k0221'), (458, 946, 'k0274'), (459, 983, 'k0327'), (460, 20, 'k0380'), (461, 57, 'k0433'), (462, 94, 'k0486'), (463, 131, 'k0539'), (464, 168, 'k0592'), (465, 205, 'k0645'), (466, 242, 'k0698'), (467, 279, 'k0751'), (468, 316, 'k0804'), (469, 353, 'k0857'), (470, 390, 'k0910'), (471, 427, 'k0963'), (472, 464, 'k1016'), (473, 501, 'k1069'), (474, 538, 'k1122'), (475, 575, 'k1175');
+INSERT INTO t VALUES (476, 612, 'k1228'), (477, 649, 'k1281'), (478, 686, 'k1334'), (479, 723, 'k1387'), (480, 760, 'k1440'), (481, 797, 'k1493'), (482, 834, 'k1546'), (483, 871, 'k1599'), (484, 908, 'k1652'), (485, 945, 'k1705'), (486, 982, 'k1758'), (487, 19, 'k1811'), (488, 56, 'k1864'), (489, 93, 'k1917'), (490, 130, 'k1970'), (491, 167, 'k2023'), (492, 204, 'k2076'), (493, 241, 'k2129'), (494, 278, 'k2182'), (495, 315, 'k2235'), (496, 352, 'k2288'), (497, 389, 'k2341'), (498, 426, 'k2394'), (499, 463, 'k2447'), (500, 500, 'k2500');
+INSERT INTO t VALUES (501, 537, 'k2553'), (502, 574, 'k2606'), (503, 611, 'k2659'), (504, 648, 'k2712'), (505, 685, 'k2765'), (506, 722, 'k2818'), (507, 759, 'k2871'), (508, 796, 'k2924'), (509, 833, 'k2977'), (510, 870, 'k0030'), (511, 907, 'k0083'), (512, 944, 'k0136'), (513, 981, 'k0189'), (514, 18, 'k0242'), (515, 55, 'k0295'), (516, 92, 'k0348'), (517, 129, 'k0401'), (518, 166, 'k0454'), (519, 203, 'k0507'), (520, 240, 'k0560'), (521, 277, 'k0613'), (522, 314, 'k0666'), (523, 351, 'k0719'), (524, 388, 'k0772'), (525, 425, 'k0825');
+INSERT INTO t VALUES (526, 462, 'k0878'), (527, 499, 'k0931'), (528, 536, 'k0984'), (529, 573, 'k1037'), (530, 610, 'k1090'), (531, 647, 'k1143'), (532, 684, 'k1196'), (533, 721, 'k1249'), (534, 758, 'k1302'), (535, 795, 'k1355'), (536, 832, 'k1408'), (537, 869, 'k1461'), (538, 906, 'k1514'), (539, 943, 'k1567'), (540, 980, 'k1620'), (541, 17, 'k1673'), (542, 54, 'k1726'), (543, 91, 'k1779'), (544, 128, 'k1832'), (545, 165, 'k1885'), (546, 202, 'k1938'), (547, 239, 'k1991'), (548, 276, 'k2044'), (549, 313, 'k2097'), (550, 350, 'k2150');
+INSERT INTO t VALUES (551, 387, 'k2203'), (552, 424, 'k2256'), (553, 461, 'k2309'), (554, 498, 'k2362'), (555, 535, 'k2415'), (556, 572, 'k2468'), (557, 609, 'k2521'), (558, 646, 'k2574'), (559, 683, 'k2627'), (560, 720, 'k2680'), (561, 757, 'k2733'), (562, 794, 'k2786'), (563, 831, 'k2839'), (564, 868, 'k2892'), (565, 905, 'k2945'), (566, 942, 'k2998'), (567, 979, 'k0051'), (568, 16, 'k0104'), (569, 53, 'k0157'), (570, 90, 'k0210'), (571, 127, 'k0263'), (572, 164, 'k0316'), (573, 201, 'k0369'), (574, 238, 'k0422'), (575, 275, 'k0475');
+INSERT INTO t VALUES (576, 312, 'k0528'), (577, 349, 'k0581'), (578, 386, 'k0634'), (579, 423, 'k0687'), (580, 460, 'k0740'), (581, 497, 'k0793'), (582, 534, 'k0846'), (583, 571, 'k0899'), (584, 608, 'k0952'), (585, 645, 'k1005'), (586, 682, 'k1058'), (587, 719, 'k1111'), (588, 756, 'k1164'), (589, 793, 'k1217'), (590, 830, 'k1270'), (591, 867, 'k1323'), (592, 904, 'k1376'), (593, 941, 'k1429'), (594, 978, 'k1482'), (595, 15, 'k1535'), (596, 52, 'k1588'), (597, 89, 'k1641'), (598, 126, 'k1694'), (599, 163, 'k1747'), (600, 200, 'k1800');
+INSERT INTO t VALUES (601, 237, 'k1853'), (602, 274, 'k1906'), (603, 311, 'k1959'), (604, 348, 'k2012'), (605, 385, 'k2065'), (606, 422, 'k2118'), (607, 459, 'k2171'), (608, 496, 'k2224'), (609, 533, 'k2277'), (610, 570, 'k2330'), (611, 607, 'k2383'), (612, 644, 'k2436'), (613, 681, 'k2489'), (614, 718, 'k2542'), (615, 755, 'k2595'), (616, 792, 'k2648'), (617, 829, 'k2701'), (618, 866, 'k2754'), (619, 903, 'k2807'), (620, 940, 'k2860'), (621, 977, 'k2913'), (622, 14, 'k2966'), (623, 51, 'k0019'), (624, 88, 'k0072'), (625, 125, 'k0125');
+INSERT INTO t VALUES (626, 162, 'k0178'), (627, 199, 'k0231'), (628, 236, 'k0284'), (629, 273, 'k0337'), (630, 310, 'k0390'), (631, 347, 'k0443'), (632, 384, 'k0496'), (633, 421, 'k0549'), (634, 458, 'k0602'), (635, 495, 'k0655'), (636, 532, 'k0708'), (637, 569, 'k0761'), (638, 606, 'k0814'), (639, 643, 'k0867'), (640, 680, 'k0920'), (641, 717, 'k0973'), (642, 754, 'k1026'), (643, 791, 'k1079'), (644, 828, 'k1132'), (645, 865, 'k1185'), (646, 902, 'k1238'), (647, 939, 'k1291'), (648, 976, 'k1344'), (649, 13, 'k1397'), (650, 50, 'k1450');
+INSERT INTO t VALUES (651, 87, 'k1503'), (652, 124, 'k1556'), (653, 161, 'k1609'), (654, 198, 'k1662'), (655, 235, 'k1715'), (656, 272, 'k1768'), (657, 309, 'k1821'), (658, 346, 'k1874'), (659, 383, 'k1927'), (660, 420, 'k1980'), (661, 457, 'k2033'), (662, 494, 'k2086'), (663, 531, 'k2139'), (664, 568, 'k2192'), (665, 605, 'k2245'), (666, 642, 'k2298'), (667, 679, 'k2351'), (668, 716, 'k2404'), (669, 753, 'k2457'), (670, 790, 'k2510'), (671, 827, 'k2563'), (672, 864, 'k2616'), (673, 901, 'k2669'), (674, 938, 'k2722'), (675, 975, 'k2775');
+INSERT INTO t VALUES (676, 12, 'k2828'), (677, 49, 'k2881'), (678, 86, 'k2934'), (679, 123, 'k2987'), (680, 160, 'k0040'), (681, 197, 'k0093'), (682, 234, 'k0146'), (683, 271, 'k0199'), (684, 308, 'k0252'), (685, 345, 'k0305'), (686, 382, 'k0358'), (687, 419, 'k0411'), (688, 456, 'k0464'), (689, 493, 'k0517'), (690, 530, 'k0570'), (691, 567, 'k0623'), (692, 604, 'k0676'), (693, 641, 'k0729'), (694, 678, 'k0782'), (695, 715, 'k0835'), (696, 752, 'k0888'), (697, 789, 'k0941'), (698, 826, 'k0994'), (699, 863, 'k1047'), (700, 900, 'k1100');
+INSERT INTO t VALUES (701, 937, 'k1153'), (702, 974, 'k1206'), (703, 11, 'k1259'), (704, 48, 'k1312'), (705, 85, 'k1365'), (706, 122, 'k1418'), (707, 159, 'k1471'), (708, 196, 'k1524'), (709, 233, 'k1577'), (710, 270, 'k1630'), (711, 307, 'k1683'), (712, 344, 'k1736'), (713, 381, 'k1789'), (714, 418, 'k1842'), (715, 455, 'k1895'), (716, 492, 'k1948'), (717, 529, 'k2001'), (718, 566, 'k2054'), (719, 603, 'k2107'), (720, 640, 'k2160'), (721, 677, 'k2213'), (722, 714, 'k2266'), (723, 751, 'k2319'), (724, 788, 'k2372'), (725, 825, 'k2425');
+INSERT INTO t VALUES (726, 862, 'k2478'), (727, 899, 'k2531'), (728, 936, 'k2584'), (729, 973, 'k2637'), (730, 10, 'k2690'), (731, 47, 'k2743'), (732, 84, 'k2796'), (733, 121, 'k2849'), (734, 158, 'k2902'), (735, 195, 'k2955'), (736, 232, 'k0008'), (737, 269, 'k0061'), (738, 306, 'k0114'), (739, 343, 'k0167'), (740, 380, 'k0220'), (741, 417, 'k0273'), (742, 454, 'k0326'), (743, 491, 'k0379'), (744, 528, 'k0432'), (745, 565, 'k0485'), (746, 602, 'k0538'), (747, 639, 'k0591'), (748, 676, 'k0644'), (749, 713, 'k0697'), (750, 750, 'k0750');
+INSERT INTO t VALUES (751, 787, 'k0803'), (752, 824, 'k0856'), (753, 861, 'k0909'), (754, 898, 'k0962'), (755, 935, 'k1015'), (756, 972, 'k1068'), (757, 9, 'k1121'), (758, 46, 'k1174'), (759, 83, 'k1227'), (760, 120, 'k1280'), (761, 157, 'k1333'), (762, 194, 'k1386'), (763, 231, 'k1439'), (764, 268, 'k1492'), (765, 305, 'k1545'), (766, 342, 'k1598'), (767, 379, 'k1651'), (768, 416, 'k1704'), (769, 453, 'k1757'), (770, 490, 'k1810'), (771, 527, 'k1863'), (772, 564, 'k1916'), (773, 601, 'k1969'), (774, 638, 'k2022'), (775, 675, 'k2075');
+INSERT INTO t VALUES (776, 712, 'k2128'), (777, 749, 'k2181'), (778, 786, 'k2234'), (779, 823, 'k2287'), (780, 860, 'k2340'), (781, 897, 'k2393'), (782, 934, 'k2446'), (783, 971, 'k2499'), (784, 8, 'k2552'), (785, 45, 'k2605'), (786, 82, 'k2658'), (787, 119, 'k2711'), (788, 156, 'k2764'), (789, 193, 'k2817'), (790, 230, 'k2870'), (791, 267, 'k2923'), (792, 304, 'k2976'), (793, 341, 'k0029'), (794, 378, 'k0082'), (795, 415, 'k0135'), (796, 452, 'k0188'), (797, 489, 'k0241'), (798, 526, 'k0294'), (799, 563, 'k0347'), (800, 600, 'k0400');
+INSERT INTO t VALUES (801, 637, 'k0453'), (802, 674, 'k0506'), (803, 711, 'k0559'), (804, 748, 'k0612'), (805, 785, 'k0665'), (806, 822, 'k0718'), (807, 859, 'k0771'), (808, 896, 'k0824'), (809, 933, 'k0877'), (810, 970, 'k0930'), (811, 7, 'k0983'), (812, 44, 'k1036'), (813, 81, 'k1089'), (814, 118, 'k1142'), (815, 155, 'k1195'), (816, 192, 'k1248'), (817, 229, 'k1301'), (818, 266, 'k1354'), (819, 303, 'k1407'), (820, 340, 'k1460'), (821, 377, 'k1513'), (822, 414, 'k1566'), (823, 451, 'k1619'), (824, 488, 'k1672'), (825, 525, 'k1725');
+INSERT INTO t VALUES (826, 562, 'k1778'), (827, 599, 'k1831'), (828, 636, 'k1884'), (829, 673, 'k1937'), (830, 710, 'k1990'), (831, 747, 'k2043'), (832, 784, 'k2096'), (833, 821, 'k2149'), (834, 858, 'k2202'), (835, 895, 'k2255'), (836, 932, 'k2308'), (837, 969, 'k2361'), (838, 6, 'k2414'), (839, 43, 'k2467'), (840, 80, 'k2520'), (841, 117, 'k2573'), (842, 154, 'k2626'), (843, 191, 'k2679'), (844, 228, 'k2732'), (845, 265, 'k2785'), (846, 302, 'k2838'), (847, 339, 'k2891'), (848, 376, 'k2944'), (849, 413, 'k2997'), (850, 450, 'k0050');
+INSERT INTO t VALUES (851, 487, 'k0103'), (852, 524, 'k0156'), (853, 561, 'k0209'), (854, 598, 'k0262'), (855, 635, 'k0315'), (856, 672, 'k0368'), (857, 709, 'k0421'), (858, 746, 'k0474'), (859, 783, 'k0527'), (860, 820, 'k0580'), (861, 857, 'k0633'), (862, 894, 'k0686'), (863, 931, 'k0739'), (864, 968, 'k0792'), (865, 5, 'k0845'), (866, 42, 'k0898'), (867, 79, 'k0951'), (868, 116, 'k1004'), (869, 153, 'k1057'), (870, 190, 'k1110'), (871, 227, 'k1163'), (872, 264, 'k1216'), (873, 301, 'k1269'), (874, 338, 'k1322'), (875, 375, 'k1375');
+INSERT INTO t VALUES (876, 412, 'k1428'), (877, 449, 'k1481'), (878, 486, 'k1534'), (879, 523, 'k1587'), (880, 560, 'k1640'), (881, 597, 'k1693'), (882, 634, 'k1746'), (883, 671, 'k1799'), (884, 708, 'k1852'), (885, 745, 'k1905'), (886, 782, 'k1958'), (887, 819, 'k2011'), (888, 856, 'k2064'), (889, 893, 'k2117'), (890, 930, 'k2170'), (891, 967, 'k2223'), (892, 4, 'k2276'), (893, 41, 'k2329'), (894, 78, 'k2382'), (895, 115, 'k2435'), (896, 152, 'k2488'), (897, 189, 'k2541'), (898, 226, 'k2594'), (899, 263, 'k2647'), (900, 300, 'k2700');
+INSERT INTO t VALUES (901, 337, 'k2753'), (902, 374, 'k2806'), (903, 411, 'k2859'), (904, 448, 'k2912'), (905, 485, 'k2965'), (906, 522, 'k0018'), (907, 559, 'k0071'), (908, 596, 'k0124'), (909, 633, 'k0177'), (910, 670, 'k0230'), (911, 707, 'k0283'), (912, 744, 'k0336'), (913, 781, 'k0389'), (914, 818, 'k0442'), (915, 855, 'k0495'), (916, 892, 'k0548'), (917, 929, 'k0601'), (918, 966, 'k0654'), (919, 3, 'k0707'), (920, 40, 'k0760'), (921, 77, 'k0813'), (922, 114, 'k0866'), (923, 151, 'k0919'), (924, 188, 'k0972'), (925, 225, 'k1025');
+INSERT INTO t VALUES (926, 262, 'k1078'), (927, 299, 'k1131'), (928, 336, 'k1184'), (929, 373, 'k1237'), (930, 410, 'k1290'), (931, 447, 'k1343'), (932, 484, 'k1396'), (933, 521, 'k1449'), (934, 558, 'k1502'), (935, 595, 'k1555'), (936, 632, 'k1608'), (937, 669, 'k1661'), (938, 706, 'k1714'), (939, 743, 'k1767'), (940, 780, 'k1820'), (941, 817, 'k1873'), (942, 854, 'k1926'), (943, 891, 'k1979'), (944, 928, 'k2032'), (945, 965, 'k2085'), (946, 2, 'k2138'), (947, 39, 'k2191'), (948, 76, 'k2244'), (949, 113, 'k2297'), (950, 150, 'k2350');
+INSERT INTO t VALUES (951, 187, 'k2403'), (952, 224, 'k2456'), (953, 261, 'k2509'), (954, 298, 'k2562'), (955, 335, 'k2615'), (956, 372, 'k2668'), (957, 409, 'k2721'), (958, 446, 'k2774'), (959, 483, 'k2827'), (960, 520, 'k2880'), (961, 557, 'k2933'), (962, 594, 'k2986'), (963, 631, 'k0039'), (964, 668, 'k0092'), (965, 705, 'k0145'), (966, 742, 'k0198'), (967, 779, 'k0251'), (968, 816, 'k0304'), (969, 853, 'k0357'), (970, 890, 'k0410'), (971, 927, 'k0463'), (972, 964, 'k0516'), (973, 1, 'k0569'), (974, 38, 'k0622'), (975, 75, 'k0675');
+INSERT INTO t VALUES (976, 112, 'k0728'), (977, 149, 'k0781'), (978, 186, 'k0834'), (979, 223, 'k0887'), (980, 260, 'k0940'), (981, 297, 'k0993'), (982, 334, 'k1046'), (983, 371, 'k1099'), (984, 408, 'k1152'), (985, 445, 'k1205'), (986, 482, 'k1258'), (987, 519, 'k1311'), (988, 556, 'k1364'), (989, 593, 'k1417'), (990, 630, 'k1470'), (991, 667, 'k1523'), (992, 704, 'k1576'), (993, 741, 'k1629'), (994, 778, 'k1682'), (995, 815, 'k1735'), (996, 852, 'k1788'), (997, 889, 'k1841'), (998, 926, 'k1894'), (999, 963, 'k1947'), (1000, 0, 'k2000');
+INSERT INTO t VALUES (1001, 37, 'k2053'), (1002, 74, 'k2106'), (1003, 111, 'k2159'), (1004, 148, 'k2212'), (1005, 185, 'k2265'), (1006, 222, 'k2318'), (1007, 259, 'k2371'), (1008, 296, 'k2424'), (1009, 333, 'k2477'), (1010, 370, 'k2530'), (1011, 407, 'k2583'), (1012, 444, 'k2636'), (1013, 481, 'k2689'), (1014, 518, 'k2742'), (1015, 555, 'k2795'), (1016, 592, 'k2848'), (1017, 629, 'k2901'), (1018, 666, 'k2954'), (1019, 703, 'k0007'), (1020, 740, 'k0060'), (1021, 777, 'k0113'), (1022, 814, 'k0166'), (1023, 851, 'k0219'), (1024, 888, 'k0272'), (1025, 925, 'k0325');
+INSERT INTO t VALUES (1026, 962, 'k0378'), (1027, 999, 'k0431'), (1028, 36, 'k0484'), (1029, 73, 'k0537'), (1030, 110, 'k0590'), (1031, 147, 'k0643'), (1032, 184, 'k0696'), (1033, 221, 'k0749'), (1034, 258, 'k0802'), (1035, 295, 'k0855'), (1036, 332, 'k0908'), (1037, 369, 'k0961'), (1038, 406, 'k1014'), (1039, 443, 'k1067'), (1040, 480, 'k1120'), (1041, 517, 'k1173'), (1042, 554, 'k1226'), (1043, 591, 'k1279'), (1044, 628, 'k1332'), (1045, 665, 'k1385'), (1046, 702, 'k1438'), (1047, 739, 'k1491'), (1048, 776, 'k1544'), (1049, 813, 'k1597'), (1050, 850, 'k1650');
+INSERT INTO t VALUES (1051, 887, 'k1703'), (1052, 924, 'k1756'), (1053, 961, 'k1809'), (1054, 998, 'k1862'), (1055, 35, 'k1915'), (1056, 72, 'k1968'), (1057, 109, 'k2021'), (1058, 146, 'k2074'), (1059, 183, 'k2127'), (1060, 220, 'k2180'), (1061, 257, 'k2233'), (1062, 294, 'k2286'), (1063, 331, 'k2339'), (1064, 368, 'k2392'), (1065, 405, 'k2445'), (1066, 442, 'k2498'), (1067, 479, 'k2551'), (1068, 516, 'k2604'), (1069, 553, 'k2657'), (1070, 590, 'k2710'), (1071, 627, 'k2763'), (1072, 664, 'k2816'), (1073, 701, 'k2869'), (1074, 738, 'k2922'), (1075, 775, 'k2975');
+INSERT INTO t VALUES (1076, 812, 'k0028'), (1077, 849, 'k0081'), (1078, 886, 'k0134'), (1079, 923, 'k0187'), (1080, 960, 'k0240'), (1081, 997, 'k0293'), (1082, 34, 'k0346'), (1083, 71, 'k0399'), (1084, 108, 'k0452'), (1085, 145, 'k0505'), (1086, 182, 'k0558'), (1087, 219, 'k0611'), (1088, 256, 'k0664'), (1089, 293, 'k0717'), (1090, 330, 'k0770'), (1091, 367, 'k0823'), (1092, 404, 'k0876'), (1093, 441, 'k0929'), (1094, 478, 'k0982'), (1095, 515, 'k1035'), (1096, 552, 'k1088'), (1097, 589, 'k1141'), (1098, 626, 'k1194'), (1099, 663, 'k1247'), (1100, 700, 'k1300');
+INSERT INTO t VALUES (1101, 737, 'k1353'), (1102, 774, 'k1406'), (1103, 811, 'k1459'), (1104, 848, 'k1512'), (1105, 885, 'k1565'), (1106, 922, 'k1618'), (1107, 959, 'k1671'), (1108, 996, 'k1724'), (1109, 33, 'k1777'), (1110, 70, 'k1830'), (1111, 107, 'k1883'), (1112, 144, 'k1936'), (1113, 181, 'k1989'), (1114, 218, 'k2042'), (1115, 255, 'k2095'), (1116, 292, 'k2148'), (1117, 329, 'k2201'), (1118, 366, 'k2254'), (1119, 403, 'k2307'), (1120, 440, 'k2360'), (1121, 477, 'k2413'), (1122, 514, 'k2466'), (1123, 551, 'k2519'), (1124, 588, 'k2572'), (1125, 625, 'k2625');
+INSERT INTO t VALUES (1126, 662, 'k2678'), (1127, 699, 'k2731'), (1128, 736, 'k2784'), (1129, 773, 'k2837'), (1130, 810, 'k2890'), (1131, 847, 'k2943'), (1132, 884, 'k2996'), (1133, 921, 'k0049'), (1134, 958, 'k0102'), (1135, 995, 'k0155'), (1136, 32, 'k0208'), (1137, 69, 'k0261'), (1138, 106, 'k0314'), (1139, 143, 'k0367'), (1140, 180, 'k0420'), (1141, 217, 'k0473'), (1142, 254, 'k0526'), (1143, 291, 'k0579'), (1144, 328, 'k0632'), (1145, 365, 'k0685'), (1146, 402, 'k0738'), (1147, 439, 'k0791'), (1148, 476, 'k0844'), (1149, 513, 'k0897'), (1150, 550, 'k0950');
+INSERT INTO t VALUES (1151, 587, 'k1003'), (1152, 624, 'k1056'), (1153, 661, 'k1109'), (1154, 698, 'k1162'), (1155, 735, 'k1215'), (1156, 772, 'k1268'), (1157, 809, 'k1321'), (1158, 846, 'k1374'), (1159, 883, 'k1427'), (1160, 920, 'k1480'), (1161, 957, 'k1533'), (1162, 994, 'k1586'), (1163, 31, 'k1639'), (1164, 68, 'k1692'), (1165, 105, 'k1745'), (1166, 142, 'k1798'), (1167, 179, 'k1851'), (1168, 216, 'k1904'), (1169, 253, 'k1957'), (1170, 290, 'k2010'), (1171, 327, 'k2063'), (1172, 364, 'k2116'), (1173, 401, 'k2169'), (1174, 438, 'k2222'), (1175, 475, 'k2275');
+INSERT INTO t VALUES (1176, 512, 'k2328'), (1177, 549, 'k2381'), (1178, 586, 'k2434'), (1179, 623, 'k2487'), (1180, 660, 'k2540'), (1181, 697, 'k2593'), (1182, 734, 'k2646'), (1183, 771, 'k2699'), (1184, 808, 'k2752'), (1185, 845, 'k2805'), (1186, 882, 'k2858'), (1187, 919, 'k2911'), (1188, 956, 'k2964'), (1189, 993, 'k0017'), (1190, 30, 'k0070'), (1191, 67, 'k0123'), (1192, 104, 'k0176'), (1193, 141, 'k0229'), (1194, 178, 'k0282'), (1195, 215, 'k0335'), (1196, 252, 'k0388'), (1197, 289, 'k0441'), (1198, 326, 'k0494'), (1199, 363, 'k0547'), (1200, 400, 'k0600');
+INSERT INTO t VALUES (1201, 437, 'k0653'), (1202, 474, 'k0706'), (1203, 511, 'k0759'), (1204, 548, 'k0812'), (1205, 585, 'k0865'), (1206, 622, 'k0918'), (1207, 659, 'k0971'), (1208, 696, 'k1024'), (1209, 733, 'k1077'), (1210, 770, 'k1130'), (1211, 807, 'k1183'), (1212, 844, 'k1236'), (1213, 881, 'k1289'), (1214, 918, 'k1342'), (1215, 955, 'k1395'), (1216, 992, 'k1448'), (1217, 29, 'k1501'), (1218, 66, 'k1554'), (1219, 103, 'k1607'), (1220, 140, 'k1660'), (1221, 177, 'k1713'), (1222, 214, 'k1766'), (1223, 251, 'k1819'), (1224, 288, 'k1872'), (1225, 325, 'k1925');
+INSERT INTO t VALUES (1226, 362, 'k1978'), (1227, 399, 'k2031'), (1228, 436, 'k2084'), (1229, 473, 'k2137'), (1230, 510, 'k2190'), (1231, 547, 'k2243'), (1232, 584, 'k2296'), (1233, 621, 'k2349'), (1234, 658, 'k2402'), (1235, 695, 'k2455'), (1236, 732, 'k2508'), (1237, 769, 'k2561'), (1238, 806, 'k2614'), (1239, 843, 'k2667'), (1240, 880, 'k2720'), (1241, 917, 'k2773'), (1242, 954, 'k2826'), (1243, 991, 'k2879'), (1244, 28, 'k2932'), (1245, 65, 'k2985'), (1246, 102, 'k0038'), (1247, 139, 'k0091'), (1248, 176, 'k0144'), (1249, 213, 'k0197'), (1250, 250, 'k0250');
+INSERT INTO t VALUES (1251, 287, 'k0303'), (1252, 324, 'k0356'), (1253, 361, 'k0409'), (1254, 398, 'k0462'), (1255, 435, 'k0515'), (1256, 472, 'k0568'), (1257, 509, 'k0621'), (1258, 546, 'k0674'), (1259, 583, 'k0727'), (1260, 620, 'k0780'), (1261, 657, 'k0833'), (1262, 694, 'k0886'), (1263, 731, 'k0939'), (1264, 768, 'k0992'), (1265, 805, 'k1045'), (1266, 842, 'k1098'), (1267, 879, 'k1151'), (1268, 916, 'k1204'), (1269, 953, 'k1257'), (1270, 990, 'k1310'), (1271, 27, 'k1363'), (1272, 64, 'k1416'), (1273, 101, 'k1469'), (1274, 138, 'k1522'), (1275, 175, 'k1575');
+INSERT INTO t VALUES (1276, 212, 'k1628'), (1277, 249, 'k1681'), (1278, 286, 'k1734'), (1279, 323, 'k1787'), (1280, 360, 'k1840'), (1281, 397, 'k1893'), (1282, 434, 'k1946'), (1283, 471, 'k1999'), (1284, 508, 'k2052'), (1285, 545, 'k2105'), (1286, 582, 'k2158'), (1287, 619, 'k2211'), (1288, 656, 'k2264'), (1289, 693, 'k2317'), (1290, 730, 'k2370'), (1291, 767, 'k2423'), (1292, 804, 'k2476'), (1293, 841, 'k2529'), (1294, 878, 'k2582'), (1295, 915, 'k2635'), (1296, 952, 'k2688'), (1297, 989, 'k2741'), (1298, 26, 'k2794'), (1299, 63, 'k2847'), (1300, 100, 'k2900');
+INSERT INTO t VALUES (1301, 137, 'k2953'), (1302, 174, 'k0006'), (1303, 211, 'k0059'), (1304, 248, 'k0112'), (1305, 285, 'k0165'), (1306, 322, 'k0218'), (1307, 359, 'k0271'), (1308, 396, 'k0324'), (1309, 433, 'k0377'), (1310, 470, 'k0430'), (1311, 507, 'k0483'), (1312, 544, 'k0536'), (1313, 581, 'k0589'), (1314, 618, 'k0642'), (1315, 655, 'k0695'), (1316, 692, 'k0748'), (1317, 729, 'k0801'), (1318, 766, 'k0854'), (1319, 803, 'k0907'), (1320, 840, 'k0960'), (1321, 877, 'k1013'), (1322, 914, 'k1066'), (1323, 951, 'k1119'), (1324, 988, 'k1172'), (1325, 25, 'k1225');
+INSERT INTO t VALUES (1326, 62, 'k1278'), (1327, 99, 'k1331'), (1328, 136, 'k1384'), (1329, 173, 'k1437'), (1330, 210, 'k1490'), (1331, 247, 'k1543'), (1332, 284, 'k1596'), (1333, 321, 'k1649'), (1334, 358, 'k1702'), (1335, 395, 'k1755'), (1336, 432, 'k1808'), (1337, 469, 'k1861'), (1338, 506, 'k1914'), (1339, 543, 'k1967'), (1340, 580, 'k2020'), (1341, 617, 'k2073'), (1342, 654, 'k2126'), (1343, 691, 'k2179'), (1344, 728, 'k2232'), (1345, 765, 'k2285'), (1346, 802, 'k2338'), (1347, 839, 'k2391'), (1348, 876, 'k2444'), (1349, 913, 'k2497'), (1350, 950, 'k2550');
+INSERT INTO t VALUES (1351, 987, 'k2603'), (1352, 24, 'k2656'), (1353, 61, 'k2709'), (1354, 98, 'k2762'), (1355, 135, 'k2815'), (1356, 172, 'k2868'), (1357, 209, 'k2921'), (1358, 246, 'k2974'), (1359, 283, 'k0027'), (1360, 320, 'k0080'), (1361, 357, 'k0133'), (1362, 394, 'k0186'), (1363, 431, 'k0239'), (1364, 468, 'k0292'), (1365, 505, 'k0345'), (1366, 542, 'k0398'), (1367, 579, 'k0451'), (1368, 616, 'k0504'), (1369, 653, 'k0557'), (1370, 690, 'k0610'), (1371, 727, 'k0663'), (1372, 764, 'k0716'), (1373, 801, 'k0769'), (1374, 838, 'k0822'), (1375, 875, 'k0875');
+INSERT INTO t VALUES (1376, 912, 'k0928'), (1377, 949, 'k0981'), (1378, 986, 'k1034'), (1379, 23, 'k1087'), (1380, 60, 'k1140'), (1381, 97, 'k1193'), (1382, 134, 'k1246'), (1383, 171, 'k1299'), (1384, 208, 'k1352'), (1385, 245, 'k1405'), (1386, 282, 'k1458'), (1387, 319, 'k1511'), (1388, 356, 'k1564'), (1389, 393, 'k1617'), (1390, 430, 'k1670'), (1391, 467, 'k1723'), (1392, 504, 'k1776'), (1393, 541, 'k1829'), (1394, 578, 'k1882'), (1395, 615, 'k1935'), (1396, 652, 'k1988'), (1397, 689, 'k2041'), (1398, 726, 'k2094'), (1399, 763, 'k2147'), (1400, 800, 'k2200');
+INSERT INTO t VALUES (1401, 837, 'k2253'), (1402, 874, 'k2306'), (1403, 911, 'k2359'), (1404, 948, 'k2412'), (1405, 985, 'k2465'), (1406, 22, 'k2518'), (1407, 59, 'k2571'), (1408, 96, 'k2624'), (1409, 133, 'k2677'), (1410, 170, 'k2730'), (1411, 207, 'k2783'), (1412, 244, 'k2836'), (1413, 281, 'k2889'), (1414, 318, 'k2942'), (1415, 355, 'k2995'), (1416, 392, 'k0048'), (1417, 429, 'k0101'), (1418, 466, 'k0154'), (1419, 503, 'k0207'), (1420, 540, 'k0260'), (1421, 577, 'k0313'), (1422, 614, 'k0366'), (1423, 651, 'k0419'), (1424, 688, 'k0472'), (1425, 725, 'k0525');
+INSERT INTO t VALUES (1426, 762, 'k0578'), (1427, 799, 'k0631'), (1428, 836, 'k0684'), (1429, 873, 'k0737'), (1430, 910, 'k0790'), (1431, 947, 'k0843'), (1432, 984, 'k0896'), (1433, 21, 'k0949'), (1434, 58, 'k1002'), (1435, 95, 'k1055'), (1436, 132, 'k1108'), (1437, 169, 'k1161'), (1438, 206, 'k1214'), (1439, 243, 'k1267'), (1440, 280, 'k1320'), (1441, 317, 'k1373'), (1442, 354, 'k1426'), (1443, 391, 'k1479'), (1444, 428, 'k1532'), (1445, 465, 'k1585'), (1446, 502, 'k1638'), (1447, 539, 'k1691'), (1448, 576, 'k1744'), (1449, 613, 'k1797'), (1450, 650, 'k1850');
+INSERT INTO t VALUES (1451, 687, 'k1903'), (1452, 724, 'k1956'), (1453, 761, 'k2009'), (1454, 798, 'k2062'), (1455, 835, 'k2115'), (1456, 872, 'k2168'), (1457, 909, 'k2221'), (1458, 946, 'k2274'), (1459, 983, 'k2327'), (1460, 20, 'k2380'), (1461, 57, 'k2433'), (1462, 94, 'k2486'), (1463, 131, 'k2539'), (1464, 168, 'k2592'), (1465, 205, 'k2645'), (1466, 242, 'k2698'), (1467, 279, 'k2751'), (1468, 316, 'k2804'), (1469, 353, 'k2857'), (1470, 390, 'k2910'), (1471, 427, 'k2963'), (1472, 464, 'k0016'), (1473, 501, 'k0069'), (1474, 538, 'k0122'), (1475, 575, 'k0175');
+INSERT INTO t VALUES (1476, 612, 'k0228'), (1477, 649, 'k0281'), (1478, 686, 'k0334'), (1479, 723, 'k0387'), (1480, 760, 'k0440'), (1481, 797, 'k0493'), (1482, 834, 'k0546'), (1483, 871, 'k0599'), (1484, 908, 'k0652'), (1485, 945, 'k0705'), (1486, 982, 'k0758'), (1487, 19, 'k0811'), (1488, 56, 'k0864'), (1489, 93, 'k0917'), (1490, 130, 'k0970'), (1491, 167, 'k1023'), (1492, 204, 'k1076'), (1493, 241, 'k1129'), (1494, 278, 'k1182'), (1495, 315, 'k1235'), (1496, 352, 'k1288'), (1497, 389, 'k1341'), (1498, 426, 'k1394'), (1499, 463, 'k1447'), (1500, 500, 'k1500');
+INSERT INTO t VALUES (1501, 537, 'k1553'), (1502, 574, 'k1606'), (1503, 611, 'k1659'), (1504, 648, 'k1712'), (1505, 685, 'k1765'), (1506, 722, 'k1818'), (1507, 759, 'k1871'), (1508, 796, 'k1924'), (1509, 833, 'k1977'), (1510, 870, 'k2030'), (1511, 907, 'k2083'), (1512, 944, 'k2136'), (1513, 981, 'k2189'), (1514, 18, 'k2242'), (1515, 55, 'k2295'), (1516, 92, 'k2348'), (1517, 129, 'k2401'), (1518, 166, 'k2454'), (1519, 203, 'k2507'), (1520, 240, 'k2560'), (1521, 277, 'k2613'), (1522, 314, 'k2666'), (1523, 351, 'k2719'), (1524, 388, 'k2772'), (1525, 425, 'k2825');
+INSERT INTO t VALUES (1526, 462, 'k2878'), (1527, 499, 'k2931'), (1528, 536, 'k2984'), (1529, 573, 'k0037'), (1530, 610, 'k0090'), (1531, 647, 'k0143'), (1532, 684, 'k0196'), (1533, 721, 'k0249'), (1534, 758, 'k0302'), (1535, 795, 'k0355'), (1536, 832, 'k0408'), (1537, 869, 'k0461'), (1538, 906, 'k0514'), (1539, 943, 'k0567'), (1540, 980, 'k0620'), (1541, 17, 'k0673'), (1542, 54, 'k0726'), (1543, 91, 'k0779'), (1544, 128, 'k0832'), (1545, 165, 'k0885'), (1546, 202, 'k0938'), (1547, 239, 'k0991'), (1548, 276, 'k1044'), (1549, 313, 'k1097'), (1550, 350, 'k1150');
+INSERT INTO t VALUES (1551, 387, 'k1203'), (1552, 424, 'k1256'), (1553, 461, 'k1309'), (1554, 498, 'k1362'), (1555, 535, 'k1415'), (1556, 572, 'k1468'), (1557, 609, 'k1521'), (1558, 646, 'k1574'), (1559, 683, 'k1627'), (1560, 720, 'k1680'), (1561, 757, 'k1733'), (1562, 794, 'k1786'), (1563, 831, 'k1839'), (1564, 868, 'k1892'), (1565, 905, 'k1945'), (1566, 942, 'k1998'), (1567, 979, 'k2051'), (1568, 16, 'k2104'), (1569, 53, 'k2157'), (1570, 90, 'k2210'), (1571, 127, 'k2263'), (1572, 164, 'k2316'), (1573, 201, 'k2369'), (1574, 238, 'k2422'), (1575, 275, 'k2475');
+INSERT INTO t VALUES (1576, 312, 'k2528'), (1577, 349, 'k2581'), (1578, 386, 'k2634'), (1579, 423, 'k2687'), (1580, 460, 'k2740'), (1581, 497, 'k2793'), (1582, 534, 'k2846'), (1583, 571, 'k2899'), (1584, 608, 'k2952'), (1585, 645, 'k0005'), (1586, 682, 'k0058'), (1587, 719, 'k0111'), (1588, 756, 'k0164'), (1589, 793, 'k0217'), (1590, 830, 'k0270'), (1591, 867, 'k0323'), (1592, 904, 'k0376'), (1593, 941, 'k0429'), (1594, 978, 'k0482'), (1595, 15, 'k0535'), (1596, 52, 'k0588'), (1597, 89, 'k0641'), (1598, 126, 'k0694'), (1599, 163, 'k0747'), (1600, 200, 'k0800');
+INSERT INTO t VALUES (1601, 237, 'k0853'), (1602, 274, 'k0906'), (1603, 311, 'k0959'), (1604, 348, 'k1012'), (1605, 385, 'k1065'), (1606, 422, 'k1118'), (1607, 459, 'k1171'), (1608, 496, 'k1224'), (1609, 533, 'k1277'), (1610, 570, 'k1330'), (1611, 607, 'k1383'), (1612, 644, 'k1436'), (1613, 681, 'k1489'), (1614, 718, 'k1542'), (1615, 755, 'k1595'), (1616, 792, 'k1648'), (1617, 829, 'k1701'), (1618, 866, 'k1754'), (1619, 903, 'k1807'), (1620, 940, 'k1860'), (1621, 977, 'k1913'), (1622, 14, 'k1966'), (1623, 51, 'k2019'), (1624, 88, 'k2072'), (1625, 125, 'k2125');
+INSERT INTO t VALUES (1626, 162, 'k2178'), (1627, 199, 'k2231'), (1628, 236, 'k2284'), (1629, 273, 'k2337'), (1630, 310, 'k2390'), (1631, 347, 'k2443'), (1632, 384, 'k2496'), (1633, 421, 'k2549'), (1634, 458, 'k2602'), (1635, 495, 'k2655'), (1636, 532, 'k2708'), (1637, 569, 'k2761'), (1638, 606, 'k2814'), (1639, 643, 'k2867'), (1640, 680, 'k2920'), (1641, 717, 'k2973'), (1642, 754, 'k0026'), (1643, 791, 'k0079'), (1644, 828, 'k0132'), (1645, 865, 'k0185'), (1646, 902, 'k0238'), (1647, 939, 'k0291'), (1648, 976, 'k0344'), (1649, 13, 'k0397'), (1650, 50, 'k0450');
+INSERT INTO t VALUES (1651, 87, 'k0503'), (1652, 124, 'k0556'), (1653, 161, 'k0609'), (1654, 198, 'k0662'), (1655, 235, 'k0715'), (1656, 272, 'k0768'), (1657, 309, 'k0821'), (1658, 346, 'k0874'), (1659, 383, 'k0927'), (1660, 420, 'k0980'), (1661, 457, 'k1033'), (1662, 494, 'k1086'), (1663, 531, 'k1139'), (1664, 568, 'k1192'), (1665, 605, 'k1245'), (1666, 642, 'k1298'), (1667, 679, 'k1351'), (1668, 716, 'k1404'), (1669, 753, 'k1457'), (1670, 790, 'k1510'), (1671, 827, 'k1563'), (1672, 864, 'k1616'), (1673, 901, 'k1669'), (1674, 938, 'k1722'), (1675, 975, 'k1775');
+INSERT INTO t VALUES (1676, 12, 'k1828'), (1677, 49, 'k1881'), (1678, 86, 'k1934'), (1679, 123, 'k1987'), (1680, 160, 'k2040'), (1681, 197, 'k2093'), (1682, 234, 'k2146'), (1683, 271, 'k2199'), (1684, 308, 'k2252'), (1685, 345, 'k2305'), (1686, 382, 'k2358'), (1687, 419, 'k2411'), (1688, 456, 'k2464'), (1689, 493, 'k2517'), (1690, 530, 'k2570'), (1691, 567, 'k2623'), (1692, 604, 'k2676'), (1693, 641, 'k2729'), (1694, 678, 'k2782'), (1695, 715, 'k2835'), (1696, 752, 'k2888'), (1697, 789, 'k2941'), (1698, 826, 'k2994'), (1699, 863, 'k0047'), (1700, 900, 'k0100');
+INSERT INTO t VALUES (1701, 937, 'k0153'), (1702, 974, 'k0206'), (1703, 11, 'k0259'), (1704, 48, 'k0312'), (1705, 85, 'k0365'), (1706, 122, 'k0418'), (1707, 159, 'k0471'), (1708, 196, 'k0524'), (1709, 233, 'k0577'), (1710, 270, 'k0630'), (1711, 307, 'k0683'), (1712, 344, 'k0736'), (1713, 381, 'k0789'), (1714, 418, 'k0842'), (1715, 455, 'k0895'), (1716, 492, 'k0948'), (1717, 529, 'k1001'), (1718, 566, 'k1054'), (1719, 603, 'k1107'), (1720, 640, 'k1160'), (1721, 677, 'k1213'), (1722, 714, 'k1266'), (1723, 751, 'k1319'), (1724, 788, 'k1372'), (1725, 825, 'k1425');
+INSERT INTO t VALUES (1726, 862, 'k1478'), (1727, 899, 'k1531'), (1728, 936, 'k1584'), (1729, 973, 'k1637'), (1730, 10, 'k1690'), (1731, 47, 'k1743'), (1732, 84, 'k1796'), (1733, 121, 'k1849'), (1734, 158, 'k1902'), (1735, 195, 'k1955'), (1736, 232, 'k2008'), (1737, 269, 'k2061'), (1738, 306, 'k2114'), (1739, 343, 'k2167'), (1740, 380, 'k2220'), (1741, 417, 'k2273'), (1742, 454, 'k2326'), (1743, 491, 'k2379'), (1744, 528, 'k2432'), (1745, 565, 'k2485'), (1746, 602, 'k2538'), (1747, 639, 'k2591'), (1748, 676, 'k2644'), (1749, 713, 'k2697'), (1750, 750, 'k2750');
+INSERT INTO t VALUES (1751, 787, 'k2803'), (1752, 824, 'k2856'), (1753, 861, 'k2909'), (1754, 898, 'k2962'), (1755, 935, 'k0015'), (1756, 972, 'k0068'), (1757, 9, 'k0121'), (1758, 46, 'k0174'), (1759, 83, 'k0227'), (1760, 120, 'k0280'), (1761, 157, 'k0333'), (1762, 194, 'k0386'), (1763, 231, 'k0439'), (1764, 268, 'k0492'), (1765, 305, 'k0545'), (1766, 342, 'k0598'), (1767, 379, 'k0651'), (1768, 416, 'k0704'), (1769, 453, 'k0757'), (1770, 490, 'k0810'), (1771, 527, 'k0863'), (1772, 564, 'k0916'), (1773, 601, 'k0969'), (1774, 638, 'k1022'), (1775, 675, 'k1075');
+INSERT INTO t VALUES (1776, 712, 'k1128'), (1777, 749, 'k1181'), (1778, 786, 'k1234'), (1779, 823, 'k1287'), (1780, 860, 'k1340'), (1781, 897, 'k1393'), (1782, 934, 'k1446'), (1783, 971, 'k1499'), (1784, 8, 'k1552'), (1785, 45, 'k1605'), (1786, 82, 'k1658'), (1787, 119, 'k1711'), (1788, 156, 'k1764'), (1789, 193, 'k1817'), (1790, 230, 'k1870'), (1791, 267, 'k1923'), (1792, 304, 'k1976'), (1793, 341, 'k2029'), (1794, 378, 'k2082'), (1795, 415, 'k2135'), (1796, 452, 'k2188'), (1797, 489, 'k2241'), (1798, 526, 'k2294'), (1799, 563, 'k2347'), (1800, 600, 'k2400');
+INSERT INTO t VALUES (1801, 637, 'k2453'), (1802, 674, 'k2506'), (1803, 711, 'k2559'), (1804, 748, 'k2612'), (1805, 785, 'k2665'), (1806, 822, 'k2718'), (1807, 859, 'k2771'), (1808, 896, 'k2824'), (1809, 933, 'k2877'), (1810, 970, 'k2930'), (1811, 7, 'k2983'), (1812, 44, 'k0036'), (1813, 81, 'k0089'), (1814, 118, 'k0142'), (1815, 155, 'k0195'), (1816, 192, 'k0248'), (1817, 229, 'k0301'), (1818, 266, 'k0354'), (1819, 303, 'k0407'), (1820, 340, 'k0460'), (1821, 377, 'k0513'), (1822, 414, 'k0566'), (1823, 451, 'k0619'), (1824, 488, 'k0672'), (1825, 525, 'k0725');
+INSERT INTO t VALUES (1826, 562, 'k0778'), (1827, 599, 'k0831'), (1828, 636, 'k0884'), (1829, 673, 'k0937'), (1830, 710, 'k0990'), (1831, 747, 'k1043'), (1832, 784, 'k1096'), (1833, 821, 'k1149'), (1834, 858, 'k1202'), (1835, 895, 'k1255'), (1836, 932, 'k1308'), (1837, 969, 'k1361'), (1838, 6, 'k1414'), (1839, 43, 'k1467'), (1840, 80, 'k1520'), (1841, 117, 'k1573'), (1842, 154, 'k1626'), (1843, 191, 'k1679'), (1844, 228, 'k1732'), (1845, 265, 'k1785'), (1846, 302, 'k1838'), (1847, 339, 'k1891'), (1848, 376, 'k1944'), (1849, 413, 'k1997'), (1850, 450, 'k2050');
+INSERT INTO t VALUES (1851, 487, 'k2103'), (1852, 524, 'k2156'), (1853, 561, 'k2209'), (1854, 598, 'k2262'), (1855, 635, 'k2315'), (1856, 672, 'k2368'), (1857, 709, 'k2421'), (1858, 746, 'k2474'), (1859, 783, 'k2527'), (1860, 820, 'k2580'), (1861, 857, 'k2633'), (1862, 894, 'k2686'), (1863, 931, 'k2739'), (1864, 968, 'k2792'), (1865, 5, 'k2845'), (1866, 42, 'k2898'), (1867, 79, 'k2951'), (1868, 116, 'k0004'), (1869, 153, 'k0057'), (1870, 190, 'k0110'), (1871, 227, 'k0163'), (1872, 264, 'k0216'), (1873, 301, 'k0269'), (1874, 338, 'k0322'), (1875, 375, 'k0375');
+INSERT INTO t VALUES (1876, 412, 'k0428'), (1877, 449, 'k0481'), (1878, 486, 'k0534'), (1879, 523, 'k0587'), (1880, 560, 'k0640'), (1881, 597, 'k0693'), (1882, 634, 'k0746'), (1883, 671, 'k0799'), (1884, 708, 'k0852'), (1885, 745, 'k0905'), (1886, 782, 'k0958'), (1887, 819, 'k1011'), (1888, 856, 'k1064'), (1889, 893, 'k1117'), (1890, 930, 'k1170'), (1891, 967, 'k1223'), (1892, 4, 'k1276'), (1893, 41, 'k1329'), (1894, 78, 'k1382'), (1895, 115, 'k1435'), (1896, 152, 'k1488'), (1897, 189, 'k1541'), (1898, 226, 'k1594'), (1899, 263, 'k1647'), (1900, 300, 'k1700');
+INSERT INTO t VALUES (1901, 337, 'k1753'), (1902, 374, 'k1806'), (1903, 411, 'k1859'), (1904, 448, 'k1912'), (1905, 485, 'k1965'), (1906, 522, 'k2018'), (1907, 559, 'k2071'), (1908, 596, 'k2124'), (1909, 633, 'k2177'), (1910, 670, 'k2230'), (1911, 707, 'k2283'), (1912, 744, 'k2336'), (1913, 781, 'k2389'), (1914, 818, 'k2442'), (1915, 855, 'k2495'), (1916, 892, 'k2548'), (1917, 929, 'k2601'), (1918, 966, 'k2654'), (1919, 3, 'k2707'), (1920, 40, 'k2760'), (1921, 77, 'k2813'), (1922, 114, 'k2866'), (1923, 151, 'k2919'), (1924, 188, 'k2972'), (1925, 225, 'k0025');
+INSERT INTO t VALUES (1926, 262, 'k0078'), (1927, 299, 'k0131'), (1928, 336, 'k0184'), (1929, 373, 'k0237'), (1930, 410, 'k0290'), (1931, 447, 'k0343'), (1932, 484, 'k0396'), (1933, 521, 'k0449'), (1934, 558, 'k0502'), (1935, 595, 'k0555'), (1936, 632, 'k0608'), (1937, 669, 'k0661'), (1938, 706, 'k0714'), (1939, 743, 'k0767'), (1940, 780, 'k0820'), (1941, 817, 'k0873'), (1942, 854, 'k0926'), (1943, 891, 'k0979'), (1944, 928, 'k1032'), (1945, 965, 'k1085'), (1946, 2, 'k1138'), (1947, 39, 'k1191'), (1948, 76, 'k1244'), (1949, 113, 'k1297'), (1950, 150, 'k1350');
+INSERT INTO t VALUES (1951, 187, 'k1403'), (1952, 224, 'k1456'), (1953, 261, 'k1509'), (1954, 298, 'k1562'), (1955, 335, 'k1615'), (1956, 372, 'k1668'), (1957, 409, 'k1721'), (1958, 446, 'k1774'), (1959, 483, 'k1827'), (1960, 520, 'k1880'), (1961, 557, 'k1933'), (1962, 594, 'k1986'), (1963, 631, 'k2039'), (1964, 668, 'k2092'), (1965, 705, 'k2145'), (1966, 742, 'k2198'), (1967, 779, 'k2251'), (1968, 816, 'k2304'), (1969, 853, 'k2357'), (1970, 890, 'k2410'), (1971, 927, 'k2463'), (1972, 964, 'k2516'), (1973, 1, 'k2569'), (1974, 38, 'k2622'), (1975, 75, 'k2675');
+INSERT INTO t VALUES (1976, 112, 'k2728'), (1977, 149, 'k2781'), (1978, 186, 'k2834'), (1979, 223, 'k2887'), (1980, 260, 'k2940'), (1981, 297, 'k2993'), (1982, 334, 'k0046'), (1983, 371, 'k0099'), (1984, 408, 'k0152'), (1985, 445, 'k0205'), (1986, 482, 'k0258'), (1987, 519, 'k0311'), (1988, 556, 'k0364'), (1989, 593, 'k0417'), (1990, 630, 'k0470'), (1991, 667, 'k0523'), (1992, 704, 'k0576'), (1993, 741, 'k0629'), (1994, 778, 'k0682'), (1995, 815, 'k0735'), (1996, 852, 'k0788'), (1997, 889, 'k0841'), (1998, 926, 'k0894'), (1999, 963, 'k0947'), (2000, 0, 'k1000');
+INSERT INTO t VALUES (2001, 37, 'k1053'), (2002, 74, 'k1106'), (2003, 111, 'k1159'), (2004, 148, 'k1212'), (2005, 185, 'k1265'), (2006, 222, 'k1318'), (2007, 259, 'k1371'), (2008, 296, 'k1424'), (2009, 333, 'k1477'), (2010, 370, 'k1530'), (2011, 407, 'k1583'), (2012, 444, 'k1636'), (2013, 481, 'k1689'), (2014, 518, 'k1742'), (2015, 555, 'k1795'), (2016, 592, 'k1848'), (2017, 629, 'k1901'), (2018, 666, 'k1954'), (2019, 703, 'k2007'), (2020, 740, 'k2060'), (2021, 777, 'k2113'), (2022, 814, 'k2166'), (2023, 851, 'k2219'), (2024, 888, 'k2272'), (2025, 925, 'k2325');
+INSERT INTO t VALUES (2026, 962, 'k2378'), (2027, 999, 'k2431'), (2028, 36, 'k2484'), (2029, 73, 'k2537'), (2030, 110, 'k2590'), (2031, 147, 'k2643'), (2032, 184, 'k2696'), (2033, 221, 'k2749'), (2034, 258, 'k2802'), (2035, 295, 'k2855'), (2036, 332, 'k2908'), (2037, 369, 'k2961'), (2038, 406, 'k0014'), (2039, 443, 'k0067'), (2040, 480, 'k0120'), (2041, 517, 'k0173'), (2042, 554, 'k0226'), (2043, 591, 'k0279'), (2044, 628, 'k0332'), (2045, 665, 'k0385'), (2046, 702, 'k0438'), (2047, 739, 'k0491'), (2048, 776, 'k0544'), (2049, 813, 'k0597'), (2050, 850, 'k0650');
+INSERT INTO t VALUES (2051, 887, 'k0703'), (2052, 924, 'k0756'), (2053, 961, 'k0809'), (2054, 998, 'k0862'), (2055, 35, 'k0915'), (2056, 72, 'k0968'), (2057, 109, 'k1021'), (2058, 146, 'k1074'), (2059, 183, 'k1127'), (2060, 220, 'k1180'), (2061, 257, 'k1233'), (2062, 294, 'k1286'), (2063, 331, 'k1339'), (2064, 368, 'k1392'), (2065, 405, 'k1445'), (2066, 442, 'k1498'), (2067, 479, 'k1551'), (2068, 516, 'k1604'), (2069, 553, 'k1657'), (2070, 590, 'k1710'), (2071, 627, 'k1763'), (2072, 664, 'k1816'), (2073, 701, 'k1869'), (2074, 738, 'k1922'), (2075, 775, 'k1975');
+INSERT INTO t VALUES (2076, 812, 'k2028'), (2077, 849, 'k2081'), (2078, 886, 'k2134'), (2079, 923, 'k2187'), (2080, 960, 'k2240'), (2081, 997, 'k2293'), (2082, 34, 'k2346'), (2083, 71, 'k2399'), (2084, 108, 'k2452'), (2085, 145, 'k2505'), (2086, 182, 'k2558'), (2087, 219, 'k2611'), (2088, 256, 'k2664'), (2089, 293, 'k2717'), (2090, 330, 'k2770'), (2091, 367, 'k2823'), (2092, 404, 'k2876'), (2093, 441, 'k2929'), (2094, 478, 'k2982'), (2095, 515, 'k0035'), (2096, 552, 'k0088'), (2097, 589, 'k0141'), (2098, 626, 'k0194'), (2099, 663, 'k0247'), (2100, 700, 'k0300');
+INSERT INTO t VALUES (2101, 737, 'k0353'), (2102, 774, 'k0406'), (2103, 811, 'k0459'), (2104, 848, 'k0512'), (2105, 885, 'k0565'), (2106, 922, 'k0618'), (2107, 959, 'k0671'), (2108, 996, 'k0724'), (2109, 33, 'k0777'), (2110, 70, 'k0830'), (2111, 107, 'k0883'), (2112, 144, 'k0936'), (2113, 181, 'k0989'), (2114, 218, 'k1042'), (2115, 255, 'k1095'), (2116, 292, 'k1148'), (2117, 329, 'k1201'), (2118, 366, 'k1254'), (2119, 403, 'k1307'), (2120, 440, 'k1360'), (2121, 477, 'k1413'), (2122, 514, 'k1466'), (2123, 551, 'k1519'), (2124, 588, 'k1572'), (2125, 625, 'k1625');
+INSERT INTO t VALUES (2126, 662, 'k1678'), (2127, 699, 'k1731'), (2128, 736, 'k1784'), (2129, 773, 'k1837'), (2130, 810, 'k1890'), (2131, 847, 'k1943'), (2132, 884, 'k1996'), (2133, 921, 'k2049'), (2134, 958, 'k2102'), (2135, 995, 'k2155'), (2136, 32, 'k2208'), (2137, 69, 'k2261'), (2138, 106, 'k2314'), (2139, 143, 'k2367'), (2140, 180, 'k2420'), (2141, 217, 'k2473'), (2142, 254, 'k2526'), (2143, 291, 'k2579'), (2144, 328, 'k2632'), (2145, 365, 'k2685'), (2146, 402, 'k2738'), (2147, 439, 'k2791'), (2148, 476, 'k2844'), (2149, 513, 'k2897'), (2150, 550, 'k2950');
+INSERT INTO t VALUES (2151, 587, 'k0003'), (2152, 624, 'k0056'), (2153, 661, 'k0109'), (2154, 698, 'k0162'), (2155, 735, 'k0215'), (2156, 772, 'k0268'), (2157, 809, 'k0321'), (2158, 846, 'k0374'), (2159, 883, 'k0427'), (2160, 920, 'k0480'), (2161, 957, 'k0533'), (2162, 994, 'k0586'), (2163, 31, 'k0639'), (2164, 68, 'k0692'), (2165, 105, 'k0745'), (2166, 142, 'k0798'), (2167, 179, 'k0851'), (2168, 216, 'k0904'), (2169, 253, 'k0957'), (2170, 290, 'k1010'), (2171, 327, 'k1063'), (2172, 364, 'k1116'), (2173, 401, 'k1169'), (2174, 438, 'k1222'), (2175, 475, 'k1275');
+INSERT INTO t VALUES (2176, 512, 'k1328'), (2177, 549, 'k1381'), (2178, 586, 'k1434'), (2179, 623, 'k1487'), (2180, 660, 'k1540'), (2181, 697, 'k1593'), (2182, 734, 'k1646'), (2183, 771, 'k1699'), (2184, 808, 'k1752'), (2185, 845, 'k1805'), (2186, 882, 'k1858'), (2187, 919, 'k1911'), (2188, 956, 'k1964'), (2189, 993, 'k2017'), (2190, 30, 'k2070'), (2191, 67, 'k2123'), (2192, 104, 'k2176'), (2193, 141, 'k2229'), (2194, 178, 'k2282'), (2195, 215, 'k2335'), (2196, 252, 'k2388'), (2197, 289, 'k2441'), (2198, 326, 'k2494'), (2199, 363, 'k2547'), (2200, 400, 'k2600');
+INSERT INTO t VALUES (2201, 437, 'k2653'), (2202, 474, 'k2706'), (2203, 511, 'k2759'), (2204, 548, 'k2812'), (2205, 585, 'k2865'), (2206, 622, 'k2918'), (2207, 659, 'k2971'), (2208, 696, 'k0024'), (2209, 733, 'k0077'), (2210, 770, 'k0130'), (2211, 807, 'k0183'), (2212, 844, 'k0236'), (2213, 881, 'k0289'), (2214, 918, 'k0342'), (2215, 955, 'k0395'), (2216, 992, 'k0448'), (2217, 29, 'k0501'), (2218, 66, 'k0554'), (2219, 103, 'k0607'), (2220, 140, 'k0660'), (2221, 177, 'k0713'), (2222, 214, 'k0766'), (2223, 251, 'k0819'), (2224, 288, 'k0872'), (2225, 325, 'k0925');
+INSERT INTO t VALUES (2226, 362, 'k0978'), (2227, 399, 'k1031'), (2228, 436, 'k1084'), (2229, 473, 'k1137'), (2230, 510, 'k1190'), (2231, 547, 'k1243'), (2232, 584, 'k1296'), (2233, 621, 'k1349'), (2234, 658, 'k1402'), (2235, 695, 'k1455'), (2236, 732, 'k1508'), (2237, 769, 'k1561'), (2238, 806, 'k1614'), (2239, 843, 'k1667'), (2240, 880, 'k1720'), (2241, 917, 'k1773'), (2242, 954, 'k1826'), (2243, 991, 'k1879'), (2244, 28, 'k1932'), (2245, 65, 'k1985'), (2246, 102, 'k2038'), (2247, 139, 'k2091'), (2248, 176, 'k2144'), (2249, 213, 'k2197'), (2250, 250, 'k2250');
+INSERT INTO t VALUES (2251, 287, 'k2303'), (2252, 324, 'k2356'), (2253, 361, 'k2409'), (2254, 398, 'k2462'), (2255, 435, 'k2515'), (2256, 472, 'k2568'), (2257, 509, 'k2621'), (2258, 546, 'k2674'), (2259, 583, 'k2727'), (2260, 620, 'k2780'), (2261, 657, 'k2833'), (2262, 694, 'k2886'), (2263, 731, 'k2939'), (2264, 768, 'k2992'), (2265, 805, 'k0045'), (2266, 842, 'k0098'), (2267, 879, 'k0151'), (2268, 916, 'k0204'), (2269, 953, 'k0257'), (2270, 990, 'k0310'), (2271, 27, 'k0363'), (2272, 64, 'k0416'), (2273, 101, 'k0469'), (2274, 138, 'k0522'), (2275, 175, 'k0575');
+INSERT INTO t VALUES (2276, 212, 'k0628'), (2277, 249, 'k0681'), (2278, 286, 'k0734'), (2279, 323, 'k0787'), (2280, 360, 'k0840'), (2281, 397, 'k0893'), (2282, 434, 'k0946'), (2283, 471, 'k0999'), (2284, 508, 'k1052'), (2285, 545, 'k1105'), (2286, 582, 'k1158'), (2287, 619, 'k1211'), (2288, 656, 'k1264'), (2289, 693, 'k1317'), (2290, 730, 'k1370'), (2291, 767, 'k1423'), (2292, 804, 'k1476'), (2293, 841, 'k1529'), (2294, 878, 'k1582'), (2295, 915, 'k1635'), (2296, 952, 'k1688'), (2297, 989, 'k1741'), (2298, 26, 'k1794'), (2299, 63, 'k1847'), (2300, 100, 'k1900');
+INSERT INTO t VALUES (2301, 137, 'k1953'), (2302, 174, 'k2006'), (2303, 211, 'k2059'), (2304, 248, 'k2112'), (2305, 285, 'k2165'), (2306, 322, 'k2218'), (2307, 359, 'k2271'), (2308, 396, 'k2324'), (2309, 433, 'k2377'), (2310, 470, 'k2430'), (2311, 507, 'k2483'), (2312, 544, 'k2536'), (2313, 581, 'k2589'), (2314, 618, 'k2642'), (2315, 655, 'k2695'), (2316, 692, 'k2748'), (2317, 729, 'k2801'), (2318, 766, 'k2854'), (2319, 803, 'k2907'), (2320, 840, 'k2960'), (2321, 877, 'k0013'), (2322, 914, 'k0066'), (2323, 951, 'k0119'), (2324, 988, 'k0172'), (2325, 25, 'k0225');
+INSERT INTO t VALUES (2326, 62, 'k0278'), (2327, 99, 'k0331'), (2328, 136, 'k0384'), (2329, 173, 'k0437'), (2330, 210, 'k0490'), (2331, 247, 'k0543'), (2332, 284, 'k0596'), (2333, 321, 'k0649'), (2334, 358, 'k0702'), (2335, 395, 'k0755'), (2336, 432, 'k0808'), (2337, 469, 'k0861'), (2338, 506, 'k0914'), (2339, 543, 'k0967'), (2340, 580, 'k1020'), (2341, 617, 'k1073'), (2342, 654, 'k1126'), (2343, 691, 'k1179'), (2344, 728, 'k1232'), (2345, 765, 'k1285'), (2346, 802, 'k1338'), (2347, 839, 'k1391'), (2348, 876, 'k1444'), (2349, 913, 'k1497'), (2350, 950, 'k1550');
+INSERT INTO t VALUES (2351, 987, 'k1603'), (2352, 24, 'k1656'), (2353, 61, 'k1709'), (2354, 98, 'k1762'), (2355, 135, 'k1815'), (2356, 172, 'k1868'), (2357, 209, 'k1921'), (2358, 246, 'k1974'), (2359, 283, 'k2027'), (2360, 320, 'k2080'), (2361, 357, 'k2133'), (2362, 394, 'k2186'), (2363, 431, 'k2239'), (2364, 468, 'k2292'), (2365, 505, 'k2345'), (2366, 542, 'k2398'), (2367, 579, 'k2451'), (2368, 616, 'k2504'), (2369, 653, 'k2557'), (2370, 690, 'k2610'), (2371, 727, 'k2663'), (2372, 764, 'k2716'), (2373, 801, 'k2769'), (2374, 838, 'k2822'), (2375, 875, 'k2875');
+INSERT INTO t VALUES (2376, 912, 'k2928'), (2377, 949, 'k2981'), (2378, 986, 'k0034'), (2379, 23, 'k0087'), (2380, 60, 'k0140'), (2381, 97, 'k0193'), (2382, 134, 'k0246'), (2383, 171, 'k0299'), (2384, 208, 'k0352'), (2385, 245, 'k0405'), (2386, 282, 'k0458'), (2387, 319, 'k0511'), (2388, 356, 'k0564'), (2389, 393, 'k0617'), (2390, 430, 'k0670'), (2391, 467, 'k0723'), (2392, 504, 'k0776'), (2393, 541, 'k0829'), (2394, 578, 'k0882'), (2395, 615, 'k0935'), (2396, 652, 'k0988'), (2397, 689, 'k1041'), (2398, 726, 'k1094'), (2399, 763, 'k1147'), (2400, 800, 'k1200');
+INSERT INTO t VALUES (2401, 837, 'k1253'), (2402, 874, 'k1306'), (2403, 911, 'k1359'), (2404, 948, 'k1412'), (2405, 985, 'k1465'), (2406, 22, 'k1518'), (2407, 59, 'k1571'), (2408, 96, 'k1624'), (2409, 133, 'k1677'), (2410, 170, 'k1730'), (2411, 207, 'k1783'), (2412, 244, 'k1836'), (2413, 281, 'k1889'), (2414, 318, 'k1942'), (2415, 355, 'k1995'), (2416, 392, 'k2048'), (2417, 429, 'k2101'), (2418, 466, 'k2154'), (2419, 503, 'k2207'), (2420, 540, 'k2260'), (2421, 577, 'k2313'), (2422, 614, 'k2366'), (2423, 651, 'k2419'), (2424, 688, 'k2472'), (2425, 725, 'k2525');
+INSERT INTO t VALUES (2426, 762, 'k2578'), (2427, 799, 'k2631'), (2428, 836, 'k2684'), (2429, 873, 'k2737'), (2430, 910, 'k2790'), (2431, 947, 'k2843'), (2432, 984, 'k2896'), (2433, 21, 'k2949'), (2434, 58, 'k0002'), (2435, 95, 'k0055'), (2436, 132, 'k0108'), (2437, 169, 'k0161'), (2438, 206, 'k0214'), (2439, 243, 'k0267'), (2440, 280, 'k0320'), (2441, 317, 'k0373'), (2442, 354, 'k0426'), (2443, 391, 'k0479'), (2444, 428, 'k0532'), (2445, 465, 'k0585'), (2446, 502, 'k0638'), (2447, 539, 'k0691'), (2448, 576, 'k0744'), (2449, 613, 'k0797'), (2450, 650, 'k0850');
+INSERT INTO t VALUES (2451, 687, 'k0903'), (2452, 724, 'k0956'), (2453, 761, 'k1009'), (2454, 798, 'k1062'), (2455, 835, 'k1115'), (2456, 872, 'k1168'), (2457, 909, 'k1221'), (2458, 946, 'k1274'), (2459, 983, 'k1327'), (2460, 20, 'k1380'), (2461, 57, 'k1433'), (2462, 94, 'k1486'), (2463, 131, 'k1539'), (2464, 168, 'k1592'), (2465, 205, 'k1645'), (2466, 242, 'k1698'), (2467, 279, 'k1751'), (2468, 316, 'k1804'), (2469, 353, 'k1857'), (2470, 390, 'k1910'), (2471, 427, 'k1963'), (2472, 464, 'k2016'), (2473, 501, 'k2069'), (2474, 538, 'k2122'), (2475, 575, 'k2175');
+INSERT INTO t VALUES (2476, 612, 'k2228'), (2477, 649, 'k2281'), (2478, 686, 'k2334'), (2479, 723, 'k2387'), (2480, 760, 'k2440'), (2481, 797, 'k2493'), (2482, 834, 'k2546'), (2483, 871, 'k2599'), (2484, 908, 'k2652'), (2485, 945, 'k2705'), (2486, 982, 'k2758'), (2487, 19, 'k2811'), (2488, 56, 'k2864'), (2489, 93, 'k2917'), (2490, 130, 'k2970'), (2491, 167, 'k0023'), (2492, 204, 'k0076'), (2493, 241, 'k0129'), (2494, 278, 'k0182'), (2495, 315, 'k0235'), (2496, 352, 'k0288'), (2497, 389, 'k0341'), (2498, 426, 'k0394'), (2499, 463, 'k0447'), (2500, 500, 'k0500');
+INSERT INTO t VALUES (2501, 537, 'k0553'), (2502, 574, 'k0606'), (2503, 611, 'k0659'), (2504, 648, 'k0712'), (2505, 685, 'k0765'), (2506, 722, 'k0818'), (2507, 759, 'k0871'), (2508, 796, 'k0924'), (2509, 833, 'k0977'), (2510, 870, 'k1030'), (2511, 907, 'k1083'), (2512, 944, 'k1136'), (2513, 981, 'k1189'), (2514, 18, 'k1242'), (2515, 55, 'k1295'), (2516, 92, 'k1348'), (2517, 129, 'k1401'), (2518, 166, 'k1454'), (2519, 203, 'k1507'), (2520, 240, 'k1560'), (2521, 277, 'k1613'), (2522, 314, 'k1666'), (2523, 351, 'k1719'), (2524, 388, 'k1772'), (2525, 425, 'k1825');
+INSERT INTO t VALUES (2526, 462, 'k1878'), (2527, 499, 'k1931'), (2528, 536, 'k1984'), (2529, 573, 'k2037'), (2530, 610, 'k2090'), (2531, 647, 'k2143'), (2532, 684, 'k2196'), (2533, 721, 'k2249'), (2534, 758, 'k2302'), (2535, 795, 'k2355'), (2536, 832, 'k2408'), (2537, 869, 'k2461'), (2538, 906, 'k2514'), (2539, 943, 'k2567'), (2540, 980, 'k2620'), (2541, 17, 'k2673'), (2542, 54, 'k2726'), (2543, 91, 'k2779'), (2544, 128, 'k2832'), (2545, 165, 'k2885'), (2546, 202, 'k2938'), (2547, 239, 'k2991'), (2548, 276, 'k0044'), (2549, 313, 'k0097'), (2550, 350, 'k0150');
+INSERT INTO t VALUES (2551, 387, 'k0203'), (2552, 424, 'k0256'), (2553, 461, 'k0309'), (2554, 498, 'k0362'), (2555, 535, 'k0415'), (2556, 572, 'k0468'), (2557, 609, 'k0521'), (2558, 646, 'k0574'), (2559, 683, 'k0627'), (2560, 720, 'k0680'), (2561, 757, 'k0733'), (2562, 794, 'k0786'), (2563, 831, 'k0839'), (2564, 868, 'k0892'), (2565, 905, 'k0945'), (2566, 942, 'k0998'), (2567, 979, 'k1051'), (2568, 16, 'k1104'), (2569, 53, 'k1157'), (2570, 90, 'k1210'), (2571, 127, 'k1263'), (2572, 164, 'k1316'), (2573, 201, 'k1369'), (2574, 238, 'k1422'), (2575, 275, 'k1475');
+INSERT INTO t VALUES (2576, 312, 'k1528'), (2577, 349, 'k1581'), (2578, 386, 'k1634'), (2579, 423, 'k1687'), (2580, 460, 'k1740'), (2581, 497, 'k1793'), (2582, 534, 'k1846'), (2583, 571, 'k1899'), (2584, 608, 'k1952'), (2585, 645, 'k2005'), (2586, 682, 'k2058'), (2587, 719, 'k2111'), (2588, 756, 'k2164'), (2589, 793, 'k2217'), (2590, 830, 'k2270'), (2591, 867, 'k2323'), (2592, 904, 'k2376'), (2593, 941, 'k2429'), (2594, 978, 'k2482'), (2595, 15, 'k2535'), (2596, 52, 'k2588'), (2597, 89, 'k2641'), (2598, 126, 'k2694'), (2599, 163, 'k2747'), (2600, 200, 'k2800');
+INSERT INTO t VALUES (2601, 237, 'k2853'), (2602, 274, 'k2906'), (2603, 311, 'k2959'), (2604, 348, 'k0012'), (2605, 385, 'k0065'), (2606, 422, 'k0118'), (2607, 459, 'k0171'), (2608, 496, 'k0224'), (2609, 533, 'k0277'), (2610, 570, 'k0330'), (2611, 607, 'k0383'), (2612, 644, 'k0436'), (2613, 681, 'k0489'), (2614, 718, 'k0542'), (2615, 755, 'k0595'), (2616, 792, 'k0648'), (2617, 829, 'k0701'), (2618, 866, 'k0754'), (2619, 903, 'k0807'), (2620, 940, 'k0860'), (2621, 977, 'k0913'), (2622, 14, 'k0966'), (2623, 51, 'k1019'), (2624, 88, 'k1072'), (2625, 125, 'k1125');
+INSERT INTO t VALUES (2626, 162, 'k1178'), (2627, 199, 'k1231'), (2628, 236, 'k1284'), (2629, 273, 'k1337'), (2630, 310, 'k1390'), (2631, 347, 'k1443'), (2632, 384, 'k1496'), (2633, 421, 'k1549'), (2634, 458, 'k1602'), (2635, 495, 'k1655'), (2636, 532, 'k1708'), (2637, 569, 'k1761'), (2638, 606, 'k1814'), (2639, 643, 'k1867'), (2640, 680, 'k1920'), (2641, 717, 'k1973'), (2642, 754, 'k2026'), (2643, 791, 'k2079'), (2644, 828, 'k2132'), (2645, 865, 'k2185'), (2646, 902, 'k2238'), (2647, 939, 'k2291'), (2648, 976, 'k2344'), (2649, 13, 'k2397'), (2650, 50, 'k2450');
+INSERT INTO t VALUES (2651, 87, 'k2503'), (2652, 124, 'k2556'), (2653, 161, 'k2609'), (2654, 198, 'k2662'), (2655, 235, 'k2715'), (2656, 272, 'k2768'), (2657, 309, 'k2821'), (2658, 346, 'k2874'), (2659, 383, 'k2927'), (2660, 420, 'k2980'), (2661, 457, 'k0033'), (2662, 494, 'k0086'), (2663, 531, 'k0139'), (2664, 568, 'k0192'), (2665, 605, 'k0245'), (2666, 642, 'k0298'), (2667, 679, 'k0351'), (2668, 716, 'k0404'), (2669, 753, 'k0457'), (2670, 790, 'k0510'), (2671, 827, 'k0563'), (2672, 864, 'k0616'), (2673, 901, 'k0669'), (2674, 938, 'k0722'), (2675, 975, 'k0775');
+INSERT INTO t VALUES (2676, 12, 'k0828'), (2677, 49, 'k0881'), (2678, 86, 'k0934'), (2679, 123, 'k0987'), (2680, 160, 'k1040'), (2681, 197, 'k1093'), (2682, 234, 'k1146'), (2683, 271, 'k1199'), (2684, 308, 'k1252'), (2685, 345, 'k1305'), (2686, 382, 'k1358'), (2687, 419, 'k1411'), (2688, 456, 'k1464'), (2689, 493, 'k1517'), (2690, 530, 'k1570'), (2691, 567, 'k1623'), (2692, 604, 'k1676'), (2693, 641, 'k1729'), (2694, 678, 'k1782'), (2695, 715, 'k1835'), (2696, 752, 'k1888'), (2697, 789, 'k1941'), (2698, 826, 'k1994'), (2699, 863, 'k2047'), (2700, 900, 'k2100');
+INSERT INTO t VALUES (2701, 937, 'k2153'), (2702, 974, 'k2206'), (2703, 11, 'k2259'), (2704, 48, 'k2312'), (2705, 85, 'k2365'), (2706, 122, 'k2418'), (2707, 159, 'k2471'), (2708, 196, 'k2524'), (2709, 233, 'k2577'), (2710, 270, 'k2630'), (2711, 307, 'k2683'), (2712, 344, 'k2736'), (2713, 381, 'k2789'), (2714, 418, 'k2842'), (2715, 455, 'k2895'), (2716, 492, 'k2948'), (2717, 529, 'k0001'), (2718, 566, 'k0054'), (2719, 603, 'k0107'), (2720, 640, 'k0160'), (2721, 677, 'k0213'), (2722, 714, 'k0266'), (2723, 751, 'k0319'), (2724, 788, 'k0372'), (2725, 825, 'k0425');
+INSERT INTO t VALUES (2726, 862, 'k0478'), (2727, 899, 'k0531'), (2728, 936, 'k0584'), (2729, 973, 'k0637'), (2730, 10, 'k0690'), (2731, 47, 'k0743'), (2732, 84, 'k0796'), (2733, 121, 'k0849'), (2734, 158, 'k0902'), (2735, 195, 'k0955'), (2736, 232, 'k1008'), (2737, 269, 'k1061'), (2738, 306, 'k1114'), (2739, 343, 'k1167'), (2740, 380, 'k1220'), (2741, 417, 'k1273'), (2742, 454, 'k1326'), (2743, 491, 'k1379'), (2744, 528, 'k1432'), (2745, 565, 'k1485'), (2746, 602, 'k1538'), (2747, 639, 'k1591'), (2748, 676, 'k1644'), (2749, 713, 'k1697'), (2750, 750, 'k1750');
+INSERT INTO t VALUES (2751, 787, 'k1803'), (2752, 824, 'k1856'), (2753, 861, 'k1909'), (2754, 898, 'k1962'), (2755, 935, 'k2015'), (2756, 972, 'k2068'), (2757, 9, 'k2121'), (2758, 46, 'k2174'), (2759, 83, 'k2227'), (2760, 120, 'k2280'), (2761, 157, 'k2333'), (2762, 194, 'k2386'), (2763, 231, 'k2439'), (2764, 268, 'k2492'), (2765, 305, 'k2545'), (2766, 342, 'k2598'), (2767, 379, 'k2651'), (2768, 416, 'k2704'), (2769, 453, 'k2757'), (2770, 490, 'k2810'), (2771, 527, 'k2863'), (2772, 564, 'k2916'), (2773, 601, 'k2969'), (2774, 638, 'k0022'), (2775, 675, 'k0075');
+INSERT INTO t VALUES (2776, 712, 'k0128'), (2777, 749, 'k0181'), (2778, 786, 'k0234'), (2779, 823, 'k0287'), (2780, 860, 'k0340'), (2781, 897, 'k0393'), (2782, 934, 'k0446'), (2783, 971, 'k0499'), (2784, 8, 'k0552'), (2785, 45, 'k0605'), (2786, 82, 'k0658'), (2787, 119, 'k0711'), (2788, 156, 'k0764'), (2789, 193, 'k0817'), (2790, 230, 'k0870'), (2791, 267, 'k0923'), (2792, 304, 'k0976'), (2793, 341, 'k1029'), (2794, 378, 'k1082'), (2795, 415, 'k1135'), (2796, 452, 'k1188'), (2797, 489, 'k1241'), (2798, 526, 'k1294'), (2799, 563, 'k1347'), (2800, 600, 'k1400');
+INSERT INTO t VALUES (2801, 637, 'k1453'), (2802, 674, 'k1506'), (2803, 711, 'k1559'), (2804, 748, 'k1612'), (2805, 785, 'k1665'), (2806, 822, 'k1718'), (2807, 859, 'k1771'), (2808, 896, 'k1824'), (2809, 933, 'k1877'), (2810, 970, 'k1930'), (2811, 7, 'k1983'), (2812, 44, 'k2036'), (2813, 81, 'k2089'), (2814, 118, 'k2142'), (2815, 155, 'k2195'), (2816, 192, 'k2248'), (2817, 229, 'k2301'), (2818, 266, 'k2354'), (2819, 303, 'k2407'), (2820, 340, 'k2460'), (2821, 377, 'k2513'), (2822, 414, 'k2566'), (2823, 451, 'k2619'), (2824, 488, 'k2672'), (2825, 525, 'k2725');
+INSERT INTO t VALUES (2826, 562, 'k2778'), (2827, 599, 'k2831'), (2828, 636, 'k2884'), (2829, 673, 'k2937'), (2830, 710, 'k2990'), (2831, 747, 'k0043'), (2832, 784, 'k0096'), (2833, 821, 'k0149'), (2834, 858, 'k0202'), (2835, 895, 'k0255'), (2836, 932, 'k0308'), (2837, 969, 'k0361'), (2838, 6, 'k0414'), (2839, 43, 'k0467'), (2840, 80, 'k0520'), (2841, 117, 'k0573'), (2842, 154, 'k0626'), (2843, 191, 'k0679'), (2844, 228, 'k0732'), (2845, 265, 'k0785'), (2846, 302, 'k0838'), (2847, 339, 'k0891'), (2848, 376, 'k0944'), (2849, 413, 'k0997'), (2850, 450, 'k1050');
+INSERT INTO t VALUES (2851, 487, 'k1103'), (2852, 524, 'k1156'), (2853, 561, 'k1209'), (2854, 598, 'k1262'), (2855, 635, 'k1315'), (2856, 672, 'k1368'), (2857, 709, 'k1421'), (2858, 746, 'k1474'), (2859, 783, 'k1527'), (2860, 820, 'k1580'), (2861, 857, 'k1633'), (2862, 894, 'k1686'), (2863, 931, 'k1739'), (2864, 968, 'k1792'), (2865, 5, 'k1845'), (2866, 42, 'k1898'), (2867, 79, 'k1951'), (2868, 116, 'k2004'), (2869, 153, 'k2057'), (2870, 190, 'k2110'), (2871, 227, 'k2163'), (2872, 264, 'k2216'), (2873, 301, 'k2269'), (2874, 338, 'k2322'), (2875, 375, 'k2375');
+INSERT INTO t VALUES (2876, 412, 'k2428'), (2877, 449, 'k2481'), (2878, 486, 'k2534'), (2879, 523, 'k2587'), (2880, 560, 'k2640'), (2881, 597, 'k2693'), (2882, 634, 'k2746'), (2883, 671, 'k2799'), (2884, 708, 'k2852'), (2885, 745, 'k2905'), (2886, 782, 'k2958'), (2887, 819, 'k0011'), (2888, 856, 'k0064'), (2889, 893, 'k0117'), (2890, 930, 'k0170'), (2891, 967, 'k0223'), (2892, 4, 'k0276'), (2893, 41, 'k0329'), (2894, 78, 'k0382'), (2895, 115, 'k0435'), (2896, 152, 'k0488'), (2897, 189, 'k0541'), (2898, 226, 'k0594'), (2899, 263, 'k0647'), (2900, 300, 'k0700');
+INSERT INTO t VALUES (2901, 337, 'k0753'), (2902, 374, 'k0806'), (2903, 411, 'k0859'), (2904, 448, 'k0912'), (2905, 485, 'k0965'), (2906, 522, 'k1018'), (2907, 559, 'k1071'), (2908, 596, 'k1124'), (2909, 633, 'k1177'), (2910, 670, 'k1230'), (2911, 707, 'k1283'), (2912, 744, 'k1336'), (2913, 781, 'k1389'), (2914, 818, 'k1442'), (2915, 855, 'k1495'), (2916, 892, 'k1548'), (2917, 929, 'k1601'), (2918, 966, 'k1654'), (2919, 3, 'k1707'), (2920, 40, 'k1760'), (2921, 77, 'k1813'), (2922, 114, 'k1866'), (2923, 151, 'k1919'), (2924, 188, 'k1972'), (2925, 225, 'k2025');
+INSERT INTO t VALUES (2926, 262, 'k2078'), (2927, 299, 'k2131'), (2928, 336, 'k2184'), (2929, 373, 'k2237'), (2930, 410, 'k2290'), (2931, 447, 'k2343'), (2932, 484, 'k2396'), (2933, 521, 'k2449'), (2934, 558, 'k2502'), (2935, 595, 'k2555'), (2936, 632, 'k2608'), (2937, 669, 'k2661'), (2938, 706, 'k2714'), (2939, 743, 'k2767'), (2940, 780, 'k2820'), (2941, 817, 'k2873'), (2942, 854, 'k2926'), (2943, 891, 'k2979'), (2944, 928, 'k0032'), (2945, 965, 'k0085'), (2946, 2, 'k0138'), (2947, 39, 'k0191'), (2948, 76, 'k0244'), (2949, 113, 'k0297'), (2950, 150, 'k0350');
+INSERT INTO t VALUES (2951, 187, 'k0403'), (2952, 224, 'k0456'), (2953, 261, 'k0509'), (2954, 298, 'k0562'), (2955, 335, 'k0615'), (2956, 372, 'k0668'), (2957, 409, 'k0721'), (2958, 446, 'k0774'), (2959, 483, 'k0827'), (2960, 520, 'k0880'), (2961, 557, 'k0933'), (2962, 594, 'k0986'), (2963, 631, 'k1039'), (2964, 668, 'k1092'), (2965, 705, 'k1145'), (2966, 742, 'k1198'), (2967, 779, 'k1251'), (2968, 816, 'k1304'), (2969, 853, 'k1357'), (2970, 890, 'k1410'), (2971, 927, 'k1463'), (2972, 964, 'k1516'), (2973, 1, 'k1569'), (2974, 38, 'k1622'), (2975, 75, 'k1675');
+INSERT INTO t VALUES (2976, 112, 'k1728'), (2977, 149, 'k1781'), (2978, 186, 'k1834'), (2979, 223, 'k1887'), (2980, 260, 'k1940'), (2981, 297, 'k1993'), (2982, 334, 'k2046'), (2983, 371, 'k2099'), (2984, 408, 'k2152'), (2985, 445, 'k2205'), (2986, 482, 'k2258'), (2987, 519, 'k2311'), (2988, 556, 'k2364'), (2989, 593, 'k2417'), (2990, 630, 'k2470'), (2991, 667, 'k2523'), (2992, 704, 'k2576'), (2993, 741, 'k2629'), (2994, 778, 'k2682'), (2995, 815, 'k2735'), (2996, 852, 'k2788'), (2997, 889, 'k2841'), (2998, 926, 'k2894'), (2999, 963, 'k2947'), (3000, 0, 'k0000');
+-- about nine rows in ten go, the trees are rebuilt after the delete
+DELETE FROM t WHERE a >= 100;
+SELECT NUM(id), SUM(a) FROM t;
+SELECT id, a, s FROM t WHERE a = 37;
+SELECT id, a, s FROM t WHERE a = 500;
+SELECT NUM(a), SUM(id) FROM t WHERE a >= 20 AND a < 60;
+SELECT id, s FROM t WHERE s = 'k0053';
+SELECT id, s FROM t WHERE s = 'k1000';
+SELECT id, a FROM t WHERE id = 2990;
+SELECT id, a FROM t WHERE id = 1001;
+CREATE INDEX t("a REBUILD");
+CREATE INDEX t("s REBUILD");
+SELECT NUM(id), SUM(a) FROM t;
+SELECT id, a, s FROM t WHERE a = 37;
+SELECT id, a, s FROM t WHERE a = 500;
+SELECT NUM(a), SUM(id) FROM t WHERE a >= 20 AND a < 60;
+SELECT id, s FROM t WHERE s = 'k0053';
+SELECT id, s FROM t WHERE s = 'k1000';
+SELECT id, a FROM t WHERE id = 2990;
+SELECT id, a FROM t WHERE id = 1001;
+-- keys deleted before the rebuild come back
+INSERT INTO t VALUES (3001, 37, 'k0053'), (3002, 74, 'k0106'), (3003, 111, 'k0159'), (3004, 148, 'k0212'), (3005, 185, 'k0265'), (3006, 222, 'k0318'), (3007, 259, 'k0371'), (3008, 296, 'k0424'), (3009, 333, 'k0477'), (3010, 370, 'k0530'), (3011, 407, 'k0583'), (3012, 444, 'k0636'), (3013, 481, 'k0689'), (3014, 518, 'k0742'), (3015, 555, 'k0795'), (3016, 592, 'k0848'), (3017, 629, 'k0901'), (3018, 666, 'k0954'), (3019, 703, 'k1007'), (3020, 740, 'k1060'), (3021, 777, 'k1113'), (3022, 814, 'k1166'), (3023, 851, 'k1219'), (3024, 888, 'k1272'), (3025, 925, 'k1325');
+INSERT INTO t VALUES (3026, 962, 'k1378'), (3027, 999, 'k1431'), (3028, 36, 'k1484'), (3029, 73, 'k1537'), (3030, 110, 'k1590'), (3031, 147, 'k1643'), (3032, 184, 'k1696'), (3033, 221, 'k1749'), (3034, 258, 'k1802'), (3035, 295, 'k1855'), (3036, 332, 'k1908'), (3037, 369, 'k1961'), (3038, 406, 'k2014'), (3039, 443, 'k2067'), (3040, 480, 'k2120'), (3041, 517, 'k2173'), (3042, 554, 'k2226'), (3043, 591, 'k2279'), (3044, 628, 'k2332'), (3045, 665, 'k2385'), (3046, 702, 'k2438'), (3047, 739, 'k2491'), (3048, 776, 'k2544'), (3049, 813, 'k2597'), (3050, 850, 'k2650');
+INSERT INTO t VALUES (3051, 887, 'k2703'), (3052, 924, 'k2756'), (3053, 961, 'k2809'), (3054, 998, 'k2862'), (3055, 35, 'k2915'), (3056, 72, 'k2968'), (3057, 109, 'k0021'), (3058, 146, 'k0074'), (3059, 183, 'k0127'), (3060, 220, 'k0180'), (3061, 257, 'k0233'), (3062, 294, 'k0286'), (3063, 331, 'k0339'), (3064, 368, 'k0392'), (3065, 405, 'k0445'), (3066, 442, 'k0498'), (3067, 479, 'k0551'), (3068, 516, 'k0604'), (3069, 553, 'k0657'), (3070, 590, 'k0710'), (3071, 627, 'k0763'), (3072, 664, 'k0816'), (3073, 701, 'k0869'), (3074, 738, 'k0922'), (3075, 775, 'k0975');
+INSERT INTO t VALUES (3076, 812, 'k1028'), (3077, 849, 'k1081'), (3078, 886, 'k1134'), (3079, 923, 'k1187'), (3080, 960, 'k1240'), (3081, 997, 'k1293'), (3082, 34, 'k1346'), (3083, 71, 'k1399'), (3084, 108, 'k1452'), (3085, 145, 'k1505'), (3086, 182, 'k1558'), (3087, 219, 'k1611'), (3088, 256, 'k1664'), (3089, 293, 'k1717'), (3090, 330, 'k1770'), (3091, 367, 'k1823'), (3092, 404, 'k1876'), (3093, 441, 'k1929'), (3094, 478, 'k1982'), (3095, 515, 'k2035'), (3096, 552, 'k2088'), (3097, 589, 'k2141'), (3098, 626, 'k2194'), (3099, 663, 'k2247'), (3100, 700, 'k2300');
+INSERT INTO t VALUES (3101, 500, 'k1000'), (3102, 37, 'k0053');
+SELECT NUM(id), SUM(a) FROM t;
+SELECT id, a, s FROM t WHERE a = 37;
+SELECT id, a, s FROM t WHERE a = 500;
+SELECT NUM(a), SUM(id) FROM t WHERE a >= 20 AND a < 60;
+SELECT id, s FROM t WHERE s = 'k0053';
+SELECT id, s FROM t WHERE s = 'k1000';
+SELECT id, a FROM t WHERE id = 2990;
+SELECT id, a FROM t WHERE id = 1001;
+DELETE FROM t WHERE a < 50;
+CREATE INDEX t("a REBUILD");
+SELECT NUM(id), SUM(a) FROM t;
+SELECT id, a, s FROM t WHERE a = 37;
+SELECT id, a, s FROM t WHERE a = 500;
+SELECT NUM(a), SUM(id) FROM t WHERE a >= 20 AND a < 60;
+SELECT id, s FROM t WHERE s = 'k0053';
+SELECT id, s FROM t WHERE s = 'k1000';
+SELECT id, a FROM t WHERE id = 2990;
+SELECT id, a FROM t WHERE id = 1001;
@@ -0,0 +1,74 @@
+-- LIMIT read off an index in key order, see run_sql.sh; k is NOT NULL and
+-- has twenty rows per key, rows are inserted out of id order
+CREATE DATABASE li;
+USE DATABASE li;
+CREATE TABLE t(id int(10) NOT NULL, k int(10) NOT NULL, v int(10), PRIMARY KEY(id));
+CREATE INDEX t(k);
+INSERT INTO t VALUES (1, 7, 11), (338, 16, 718), (675, 25, NULL), (12, 34, 132), (349, 43, 839), (686, 2, 546), (23, 11, 253), (360, 20, NULL), (697, 29, 667), (34, 38, 374), (371, 47, 81), (708, 6, 788), (45, 15, NULL), (382, 24, 202), (719, 33, 909), (56, 42, 616), (393, 1, 323), (730, 10, 30), (67, 19, 737), (404, 28, 444), (741, 37, 151), (78, 46, 858), (415, 5, 565), (752, 14, 272), (89, 23, 979);
+INSERT INTO t VALUES (426, 32, 686), (763, 41, 393), (100, 0, 100), (437, 9, 807), (774, 18, NULL), (111, 27, 221), (448, 36, 928), (785, 45, 635), (122, 4, 342), (459, 13, NULL), (796, 22, 756), (133, 31, 463), (470, 40, 170), (807, 49, 877), (144, 8, NULL), (481, 17, 291), (818, 26, 998), (155, 35, 705), (492, 44, 412), (829, 3, 119), (166, 12, 826), (503, 21, 533), (840, 30, 240), (177, 39, 947), (514, 48, 654);
+INSERT INTO t VALUES (851, 7, 361), (188, 16, 68), (525, 25, 775), (862, 34, 482), (199, 43, 189), (536, 2, 896), (873, 11, NULL), (210, 20, 310), (547, 29, 17), (884, 38, 724), (221, 47, 431), (558, 6, NULL), (895, 15, 845), (232, 24, 552), (569, 33, 259), (906, 42, 966), (243, 1, NULL), (580, 10, 380), (917, 19, 87), (254, 28, 794), (591, 37, 501), (928, 46, 208), (265, 5, 915), (602, 14, 622), (939, 23, 329);
+INSERT INTO t VALUES (276, 32, 36), (613, 41, 743), (950, 0, 450), (287, 9, 157), (624, 18, 864), (961, 27, 571), (298, 36, 278), (635, 45, 985), (972, 4, NULL), (309, 13, 399), (646, 22, 106), (983, 31, 813), (320, 40, 520), (657, 49, NULL), (994, 8, 934), (331, 17, 641), (668, 26, 348), (5, 35, 55), (342, 44, NULL), (679, 3, 469), (16, 12, 176), (353, 21, 883), (690, 30, 590), (27, 39, NULL), (364, 48, 4);
+INSERT INTO t VALUES (701, 7, 711), (38, 16, 418), (375, 25, 125), (712, 34, 832), (49, 43, 539), (386, 2, 246), (723, 11, 953), (60, 20, 660), (397, 29, 367), (734, 38, 74), (71, 47, 781), (408, 6, 488), (745, 15, 195), (82, 24, 902), (419, 33, 609), (756, 42, NULL), (93, 1, 23), (430, 10, 730), (767, 19, 437), (104, 28, 144), (441, 37, NULL), (778, 46, 558), (115, 5, 265), (452, 14, 972), (789, 23, 679);
+INSERT INTO t VALUES (126, 32, NULL), (463, 41, 93), (800, 0, 800), (137, 9, 507), (474, 18, 214), (811, 27, 921), (148, 36, 628), (485, 45, 335), (822, 4, 42), (159, 13, 749), (496, 22, 456), (833, 31, 163), (170, 40, 870), (507, 49, 577), (844, 8, 284), (181, 17, 991), (518, 26, 698), (855, 35, NULL), (192, 44, 112), (529, 3, 819), (866, 12, 526), (203, 21, 233), (540, 30, NULL), (877, 39, 647), (214, 48, 354);
+INSERT INTO t VALUES (551, 7, 61), (888, 16, 768), (225, 25, NULL), (562, 34, 182), (899, 43, 889), (236, 2, 596), (573, 11, 303), (910, 20, 10), (247, 29, 717), (584, 38, 424), (921, 47, 131), (258, 6, 838), (595, 15, 545), (932, 24, 252), (269, 33, 959), (606, 42, 666), (943, 1, 373), (280, 10, 80), (617, 19, 787), (954, 28, NULL), (291, 37, 201), (628, 46, 908), (965, 5, 615), (302, 14, 322), (639, 23, NULL);
+INSERT INTO t VALUES (976, 32, 736), (313, 41, 443), (650, 0, 150), (987, 9, 857), (324, 18, NULL), (661, 27, 271), (998, 36, 978), (335, 45, 685), (672, 4, 392), (9, 13, NULL), (346, 22, 806), (683, 31, 513), (20, 40, 220), (357, 49, 927), (694, 8, 634), (31, 17, 341), (368, 26, 48), (705, 35, 755), (42, 44, 462), (379, 3, 169), (716, 12, 876), (53, 21, 583), (390, 30, 290), (727, 39, 997), (64, 48, 704);
+INSERT INTO t VALUES (401, 7, 411), (738, 16, NULL), (75, 25, 825), (412, 34, 532), (749, 43, 239), (86, 2, 946), (423, 11, NULL), (760, 20, 360), (97, 29, 67), (434, 38, 774), (771, 47, 481), (108, 6, NULL), (445, 15, 895), (782, 24, 602), (119, 33, 309), (456, 42, 16), (793, 1, 723), (130, 10, 430), (467, 19, 137), (804, 28, 844), (141, 37, 551), (478, 46, 258), (815, 5, 965), (152, 14, 672), (489, 23, 379);
+INSERT INTO t VALUES (826, 32, 86), (163, 41, 793), (500, 0, 500), (837, 9, NULL), (174, 18, 914), (511, 27, 621), (848, 36, 328), (185, 45, 35), (522, 4, NULL), (859, 13, 449), (196, 22, 156), (533, 31, 863), (870, 40, 570), (207, 49, NULL), (544, 8, 984), (881, 17, 691), (218, 26, 398), (555, 35, 105), (892, 44, 812), (229, 3, 519), (566, 12, 226), (903, 21, 933), (240, 30, 640), (577, 39, 347), (914, 48, 54);
+INSERT INTO t VALUES (251, 7, 761), (588, 16, 468), (925, 25, 175), (262, 34, 882), (599, 43, 589), (936, 2, NULL), (273, 11, 3), (610, 20, 710), (947, 29, 417), (284, 38, 124), (621, 47, NULL), (958, 6, 538), (295, 15, 245), (632, 24, 952), (969, 33, 659), (306, 42, NULL), (643, 1, 73), (980, 10, 780), (317, 19, 487), (654, 28, 194), (991, 37, 901), (328, 46, 608), (665, 5, 315), (2, 14, 22), (339, 23, 729);
+INSERT INTO t VALUES (676, 32, 436), (13, 41, 143), (350, 0, 850), (687, 9, 557), (24, 18, 264), (361, 27, 971), (698, 36, 678), (35, 45, 385), (372, 4, 92), (709, 13, 799), (46, 22, 506), (383, 31, 213), (720, 40, NULL), (57, 49, 627), (394, 8, 334), (731, 17, 41), (68, 26, 748), (405, 35, NULL), (742, 44, 162), (79, 3, 869), (416, 12, 576), (753, 21, 283), (90, 30, NULL), (427, 39, 697), (764, 48, 404);
+INSERT INTO t VALUES (101, 7, 111), (438, 16, 818), (775, 25, 525), (112, 34, 232), (449, 43, 939), (786, 2, 646), (123, 11, 353), (460, 20, 60), (797, 29, 767), (134, 38, 474), (471, 47, 181), (808, 6, 888), (145, 15, 595), (482, 24, 302), (819, 33, NULL), (156, 42, 716), (493, 1, 423), (830, 10, 130), (167, 19, 837), (504, 28, NULL), (841, 37, 251), (178, 46, 958), (515, 5, 665), (852, 14, 372), (189, 23, NULL);
+INSERT INTO t VALUES (526, 32, 786), (863, 41, 493), (200, 0, 200), (537, 9, 907), (874, 18, 614), (211, 27, 321), (548, 36, 28), (885, 45, 735), (222, 4, 442), (559, 13, 149), (896, 22, 856), (233, 31, 563), (570, 40, 270), (907, 49, 977), (244, 8, 684), (581, 17, 391), (918, 26, NULL), (255, 35, 805), (592, 44, 512), (929, 3, 219), (266, 12, 926), (603, 21, NULL), (940, 30, 340), (277, 39, 47), (614, 48, 754);
+INSERT INTO t VALUES (951, 7, 461), (288, 16, NULL), (625, 25, 875), (962, 34, 582), (299, 43, 289), (636, 2, 996), (973, 11, 703), (310, 20, 410), (647, 29, 117), (984, 38, 824), (321, 47, 531), (658, 6, 238), (995, 15, 945), (332, 24, 652), (669, 33, 359), (6, 42, 66), (343, 1, 773), (680, 10, 480), (17, 19, 187), (354, 28, 894), (691, 37, 601), (28, 46, 308), (365, 5, 15), (702, 14, NULL), (39, 23, 429);
+INSERT INTO t VALUES (376, 32, 136), (713, 41, 843), (50, 0, 550), (387, 9, NULL), (724, 18, 964), (61, 27, 671), (398, 36, 378), (735, 45, 85), (72, 4, NULL), (409, 13, 499), (746, 22, 206), (83, 31, 913), (420, 40, 620), (757, 49, 327), (94, 8, 34), (431, 17, 741), (768, 26, 448), (105, 35, 155), (442, 44, 862), (779, 3, 569), (116, 12, 276), (453, 21, 983), (790, 30, 690), (127, 39, 397), (464, 48, 104);
+INSERT INTO t VALUES (801, 7, NULL), (138, 16, 518), (475, 25, 225), (812, 34, 932), (149, 43, 639), (486, 2, NULL), (823, 11, 53), (160, 20, 760), (497, 29, 467), (834, 38, 174), (171, 47, NULL), (508, 6, 588), (845, 15, 295), (182, 24, 2), (519, 33, 709), (856, 42, 416), (193, 1, 123), (530, 10, 830), (867, 19, 537), (204, 28, 244), (541, 37, 951), (878, 46, 658), (215, 5, 365), (552, 14, 72), (889, 23, 779);
+INSERT INTO t VALUES (226, 32, 486), (563, 41, 193), (900, 0, NULL), (237, 9, 607), (574, 18, 314), (911, 27, 21), (248, 36, 728), (585, 45, NULL), (922, 4, 142), (259, 13, 849), (596, 22, 556), (933, 31, 263), (270, 40, NULL), (607, 49, 677), (944, 8, 384), (281, 17, 91), (618, 26, 798), (955, 35, 505), (292, 44, 212), (629, 3, 919), (966, 12, 626), (303, 21, 333), (640, 30, 40), (977, 39, 747), (314, 48, 454);
+INSERT INTO t VALUES (651, 7, 161), (988, 16, 868), (325, 25, 575), (662, 34, 282), (999, 43, NULL), (336, 2, 696), (673, 11, 403), (10, 20, 110), (347, 29, 817), (684, 38, NULL), (21, 47, 231), (358, 6, 938), (695, 15, 645), (32, 24, 352), (369, 33, NULL), (706, 42, 766), (43, 1, 473), (380, 10, 180), (717, 19, 887), (54, 28, NULL), (391, 37, 301), (728, 46, 8), (65, 5, 715), (402, 14, 422), (739, 23, 129);
+INSERT INTO t VALUES (76, 32, 836), (413, 41, 543), (750, 0, 250), (87, 9, 957), (424, 18, 664), (761, 27, 371), (98, 36, 78), (435, 45, 785), (772, 4, 492), (109, 13, 199), (446, 22, 906), (783, 31, NULL), (120, 40, 320), (457, 49, 27), (794, 8, 734), (131, 17, 441), (468, 26, NULL), (805, 35, 855), (142, 44, 562), (479, 3, 269), (816, 12, 976), (153, 21, NULL), (490, 30, 390), (827, 39, 97), (164, 48, 804);
+INSERT INTO t VALUES (501, 7, 511), (838, 16, 218), (175, 25, 925), (512, 34, 632), (849, 43, 339), (186, 2, 46), (523, 11, 753), (860, 20, 460), (197, 29, 167), (534, 38, 874), (871, 47, 581), (208, 6, 288), (545, 15, 995), (882, 24, NULL), (219, 33, 409), (556, 42, 116), (893, 1, 823), (230, 10, 530), (567, 19, NULL), (904, 28, 944), (241, 37, 651), (578, 46, 358), (915, 5, 65), (252, 14, NULL), (589, 23, 479);
+INSERT INTO t VALUES (926, 32, 186), (263, 41, 893), (600, 0, 600), (937, 9, 307), (274, 18, 14), (611, 27, 721), (948, 36, 428), (285, 45, 135), (622, 4, 842), (959, 13, 549), (296, 22, 256), (633, 31, 963), (970, 40, 670), (307, 49, 377), (644, 8, 84), (981, 17, NULL), (318, 26, 498), (655, 35, 205), (992, 44, 912), (329, 3, 619), (666, 12, NULL), (3, 21, 33), (340, 30, 740), (677, 39, 447), (14, 48, 154);
+INSERT INTO t VALUES (351, 7, NULL), (688, 16, 568), (25, 25, 275), (362, 34, 982), (699, 43, 689), (36, 2, NULL), (373, 11, 103), (710, 20, 810), (47, 29, 517), (384, 38, 224), (721, 47, 931), (58, 6, 638), (395, 15, 345), (732, 24, 52), (69, 33, 759), (406, 42, 466), (743, 1, 173), (80, 10, 880), (417, 19, 587), (754, 28, 294), (91, 37, 1), (428, 46, 708), (765, 5, NULL), (102, 14, 122), (439, 23, 829);
+INSERT INTO t VALUES (776, 32, 536), (113, 41, 243), (450, 0, NULL), (787, 9, 657), (124, 18, 364), (461, 27, 71), (798, 36, 778), (135, 45, NULL), (472, 4, 192), (809, 13, 899), (146, 22, 606), (483, 31, 313), (820, 40, 20), (157, 49, 727), (494, 8, 434), (831, 17, 141), (168, 26, 848), (505, 35, 555), (842, 44, 262), (179, 3, 969), (516, 12, 676), (853, 21, 383), (190, 30, 90), (527, 39, 797), (864, 48, NULL);
+INSERT INTO t VALUES (201, 7, 211), (538, 16, 918), (875, 25, 625), (212, 34, 332), (549, 43, NULL), (886, 2, 746), (223, 11, 453), (560, 20, 160), (897, 29, 867), (234, 38, NULL), (571, 47, 281), (908, 6, 988), (245, 15, 695), (582, 24, 402), (919, 33, 109), (256, 42, 816), (593, 1, 523), (930, 10, 230), (267, 19, 937), (604, 28, 644), (941, 37, 351), (278, 46, 58), (615, 5, 765), (952, 14, 472), (289, 23, 179);
+INSERT INTO t VALUES (626, 32, 886), (963, 41, NULL), (300, 0, 300), (637, 9, 7), (974, 18, 714), (311, 27, 421), (648, 36, NULL), (985, 45, 835), (322, 4, 542), (659, 13, 249), (996, 22, 956), (333, 31, NULL), (670, 40, 370), (7, 49, 77), (344, 8, 784), (681, 17, 491), (18, 26, NULL), (355, 35, 905), (692, 44, 612), (29, 3, 319), (366, 12, 26), (703, 21, 733), (40, 30, 440), (377, 39, 147), (714, 48, 854);
+INSERT INTO t VALUES (51, 7, 561), (388, 16, 268), (725, 25, 975), (62, 34, 682), (399, 43, 389), (736, 2, 96), (73, 11, 803), (410, 20, 510), (747, 29, NULL), (84, 38, 924), (421, 47, 631), (758, 6, 338), (95, 15, 45), (432, 24, NULL), (769, 33, 459), (106, 42, 166), (443, 1, 873), (780, 10, 580), (117, 19, NULL), (454, 28, 994), (791, 37, 701), (128, 46, 408), (465, 5, 115), (802, 14, 822), (139, 23, 529);
+INSERT INTO t VALUES (476, 32, 236), (813, 41, 943), (150, 0, 650), (487, 9, 357), (824, 18, 64), (161, 27, 771), (498, 36, 478), (835, 45, 185), (172, 4, 892), (509, 13, 599), (846, 22, NULL), (183, 31, 13), (520, 40, 720), (857, 49, 427), (194, 8, 134), (531, 17, NULL), (868, 26, 548), (205, 35, 255), (542, 44, 962), (879, 3, 669), (216, 12, NULL), (553, 21, 83), (890, 30, 790), (227, 39, 497), (564, 48, 204);
+INSERT INTO t VALUES (901, 7, 911), (238, 16, 618), (575, 25, 325), (912, 34, 32), (249, 43, 739), (586, 2, 446), (923, 11, 153), (260, 20, 860), (597, 29, 567), (934, 38, 274), (271, 47, 981), (608, 6, 688), (945, 15, NULL), (282, 24, 102), (619, 33, 809), (956, 42, 516), (293, 1, 223), (630, 10, NULL), (967, 19, 637), (304, 28, 344), (641, 37, 51), (978, 46, 758), (315, 5, NULL), (652, 14, 172), (989, 23, 879);
+INSERT INTO t VALUES (326, 32, 586), (663, 41, 293), (1000, 0, 0), (337, 9, 707), (674, 18, 414), (11, 27, 121), (348, 36, 828), (685, 45, 535), (22, 4, 242), (359, 13, 949), (696, 22, 656), (33, 31, 363), (370, 40, 70), (707, 49, 777), (44, 8, 484), (381, 17, 191), (718, 26, 898), (55, 35, 605), (392, 44, 312), (729, 3, NULL), (66, 12, 726), (403, 21, 433), (740, 30, 140), (77, 39, 847), (414, 48, NULL);
+INSERT INTO t VALUES (751, 7, 261), (88, 16, 968), (425, 25, 675), (762, 34, 382), (99, 43, NULL), (436, 2, 796), (773, 11, 503), (110, 20, 210), (447, 29, 917), (784, 38, 624), (121, 47, 331), (458, 6, 38), (795, 15, 745), (132, 24, 452), (469, 33, 159), (806, 42, 866), (143, 1, 573), (480, 10, 280), (817, 19, 987), (154, 28, 694), (491, 37, 401), (828, 46, NULL), (165, 5, 815), (502, 14, 522), (839, 23, 229);
+INSERT INTO t VALUES (176, 32, 936), (513, 41, NULL), (850, 0, 350), (187, 9, 57), (524, 18, 764), (861, 27, 471), (198, 36, NULL), (535, 45, 885), (872, 4, 592), (209, 13, 299), (546, 22, 6), (883, 31, 713), (220, 40, 420), (557, 49, 127), (894, 8, 834), (231, 17, 541), (568, 26, 248), (905, 35, 955), (242, 44, 662), (579, 3, 369), (916, 12, 76), (253, 21, 783), (590, 30, 490), (927, 39, NULL), (264, 48, 904);
+INSERT INTO t VALUES (601, 7, 611), (938, 16, 318), (275, 25, 25), (612, 34, NULL), (949, 43, 439), (286, 2, 146), (623, 11, 853), (960, 20, 560), (297, 29, NULL), (634, 38, 974), (971, 47, 681), (308, 6, 388), (645, 15, 95), (982, 24, 802), (319, 33, 509), (656, 42, 216), (993, 1, 923), (330, 10, 630), (667, 19, 337), (4, 28, 44), (341, 37, 751), (678, 46, 458), (15, 5, 165), (352, 14, 872), (689, 23, 579);
+INSERT INTO t VALUES (26, 32, 286), (363, 41, 993), (700, 0, 700), (37, 9, 407), (374, 18, 114), (711, 27, NULL), (48, 36, 528), (385, 45, 235), (722, 4, 942), (59, 13, 649), (396, 22, NULL), (733, 31, 63), (70, 40, 770), (407, 49, 477), (744, 8, 184), (81, 17, NULL), (418, 26, 598), (755, 35, 305), (92, 44, 12), (429, 3, 719), (766, 12, 426), (103, 21, 133), (440, 30, 840), (777, 39, 547), (114, 48, 254);
+INSERT INTO t VALUES (451, 7, 961), (788, 16, 668), (125, 25, 375), (462, 34, 82), (799, 43, 789), (136, 2, 496), (473, 11, 203), (810, 20, NULL), (147, 29, 617), (484, 38, 324), (821, 47, 31), (158, 6, 738), (495, 15, NULL), (832, 24, 152), (169, 33, 859), (506, 42, 566), (843, 1, 273), (180, 10, NULL), (517, 19, 687), (854, 28, 394), (191, 37, 101), (528, 46, 808), (865, 5, 515), (202, 14, 222), (539, 23, 929);
+INSERT INTO t VALUES (876, 32, 636), (213, 41, 343), (550, 0, 50), (887, 9, 757), (224, 18, 464), (561, 27, 171), (898, 36, 878), (235, 45, 585), (572, 4, 292), (909, 13, NULL), (246, 22, 706), (583, 31, 413), (920, 40, 120), (257, 49, 827), (594, 8, NULL), (931, 17, 241), (268, 26, 948), (605, 35, 655), (942, 44, 362), (279, 3, NULL), (616, 12, 776), (953, 21, 483), (290, 30, 190), (627, 39, 897), (964, 48, 604);
+INSERT INTO t VALUES (301, 7, 311), (638, 16, 18), (975, 25, 725), (312, 34, 432), (649, 43, 139), (986, 2, 846), (323, 11, 553), (660, 20, 260), (997, 29, 967), (334, 38, 674), (671, 47, 381), (8, 6, 88), (345, 15, 795), (682, 24, 502), (19, 33, 209), (356, 42, 916), (693, 1, NULL), (30, 10, 330), (367, 19, 37), (704, 28, 744), (41, 37, 451), (378, 46, NULL), (715, 5, 865), (52, 14, 572), (389, 23, 279);
+INSERT INTO t VALUES (726, 32, 986), (63, 41, NULL), (400, 0, 400), (737, 9, 107), (74, 18, 814), (411, 27, 521), (748, 36, 228), (85, 45, 935), (422, 4, 642), (759, 13, 349), (96, 22, 56), (433, 31, 763), (770, 40, 470), (107, 49, 177), (444, 8, 884), (781, 17, 591), (118, 26, 298), (455, 35, 5), (792, 44, NULL), (129, 3, 419), (466, 12, 126), (803, 21, 833), (140, 30, 540), (477, 39, NULL), (814, 48, 954);
+INSERT INTO t VALUES (151, 7, 661), (488, 16, 368), (825, 25, 75), (162, 34, NULL), (499, 43, 489), (836, 2, 196), (173, 11, 903), (510, 20, 610), (847, 29, 317), (184, 38, 24), (521, 47, 731), (858, 6, 438), (195, 15, 145), (532, 24, 852), (869, 33, 559), (206, 42, 266), (543, 1, 973), (880, 10, 680), (217, 19, 387), (554, 28, 94), (891, 37, NULL), (228, 46, 508), (565, 5, 215), (902, 14, 922), (239, 23, 629);
+INSERT INTO t VALUES (576, 32, NULL), (913, 41, 43), (250, 0, 750), (587, 9, 457), (924, 18, 164), (261, 27, NULL), (598, 36, 578), (935, 45, 285), (272, 4, 992), (609, 13, 699), (946, 22, 406), (283, 31, 113), (620, 40, 820), (957, 49, 527), (294, 8, 234), (631, 17, 941), (968, 26, 648), (305, 35, 355), (642, 44, 62), (979, 3, 769), (316, 12, 476), (653, 21, 183), (990, 30, NULL), (327, 39, 597), (664, 48, 304);
+SELECT id, k FROM t ORDER BY k LIMIT 5;
+SELECT id, k FROM t ORDER BY k LIMIT 5 OFFSET 18;
+SELECT id, k FROM t ORDER BY k DESC LIMIT 3;
+SELECT id, k FROM t ORDER BY k DESC LIMIT 4 OFFSET 998;
+SELECT id, k FROM t ORDER BY k LIMIT 5 OFFSET 1000;
+SELECT id, k FROM t ORDER BY id LIMIT 3;
+SELECT id, k FROM t ORDER BY id DESC LIMIT 3;
+SELECT id, k FROM t WHERE k >= 10 AND k < 12 ORDER BY k LIMIT 4 OFFSET 38;
+SELECT id, k FROM t WHERE k = 49 ORDER BY k DESC LIMIT 3;
+SELECT id, k FROM t WHERE id > 995 ORDER BY id LIMIT 20;
+SELECT id, k, v FROM t WHERE k = 7 AND v > 500 ORDER BY k LIMIT 3;
+SELECT id, k FROM t WHERE v >= 500 ORDER BY k LIMIT 3;
+SELECT id, v FROM t ORDER BY v LIMIT 3;
+DELETE FROM t WHERE k < 3;
+INSERT INTO t VALUES (1001, 0, 1), (1002, 2, 2), (1003, 1, NULL);
+SELECT id, k FROM t ORDER BY k LIMIT 5;
+SELECT id, k FROM t ORDER BY k LIMIT 5 OFFSET 18;
+SELECT id, k FROM t ORDER BY k DESC LIMIT 3;
+SELECT id, k FROM t ORDER BY k DESC LIMIT 4 OFFSET 998;
+SELECT id, k FROM t ORDER BY k LIMIT 5 OFFSET 1000;
+SELECT id, k FROM t ORDER BY id LIMIT 3;
+SELECT id, k FROM t ORDER BY id DESC LIMIT 3;
+SELECT id, k FROM t WHERE k >= 10 AND k < 12 ORDER BY k LIMIT 4 OFFSET 38;
+SELECT id, k FROM t WHERE k = 49 ORDER BY k DESC LIMIT 3;
+SELECT id, k FROM t WHERE id > 995 ORDER BY id LIMIT 20;
+SELECT id, k, v FROM t WHERE k = 7 AND v > 500 ORDER BY k LIMIT 3;
+SELECT id, k FROM t WHERE v >= 500 ORDER BY k LIMIT 3;
+SELECT id, v FROM t ORDER BY v LIMIT 3;
@@ -0,0 +1,95 @@
+// g++ -std=c++11 -O2 -pthread -Isrc -Isrc/include test/lsm_bench.cpp -o lsm_bench
+// lsm_bench [keys] [lookups]
+#include <bufmanager/BufPageManager.h>
+#include <fileio/FileManager.h>
+#include <utils/pagedef.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unistd.h>
+#include "ix_manager.h"
+using namespace std;
+
+double since(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+/* keys inserted in random order, as rows of a table with an index on a
+ * column it isn't sorted by, then lookups of random inserted keys */
+void run(const char *name, IX_Kind kind, const char *path, int keys, int lookups)
+{
+    MyBitMap::initConst();
+    FileManager *fm = new FileManager();
+    BufPageManager *bpm = new BufPageManager(fm);
+    system((string("rm -rf ") + path).c_str());
+    IX_Manager *index = new IX_Manager(fm, bpm, path, new Type_int(false, 0), kind);
+    IX_Build *build = index->OpenBuild();
+
+    if (build)
+    {
+        build->Finish();
+        delete build;
+    }
+
+    vector<int> order(keys);
+    mt19937 rng(1);
+
+    for (int i = 0; i < keys; ++i)
+        order[i] = i;
+
+    shuffle(order.begin(), order.end(), rng);
+    Type_int data(false, 0);
+    auto start = chrono::steady_clock::now();
+    auto step = start;
+
+    for (int i = 0; i < keys; ++i)
+    {
+        data.set(order[i]);
+        index->InsertEntry(&data, RID(order[i] + 1, 0));
+
+        // the rate over each tenth, to see it hold up as the index grows
+        if ((i + 1) % (keys / 10) == 0)
+        {
+            printf("%s: %d keys, %.0f inserts/s\n", name, i + 1, (keys / 10) / since(step));
+            step = chrono::steady_clock::now();
+        }
+    }
+
+    double inserts = since(start);
+    start = chrono::steady_clock::now();
+
+    for (int i = 0; i < lookups; ++i)
+    {
+        int k = rng() % keys;
+        data.set(k);
+        vector<RID> rids = index->SearchEntry(&data);
+
+        if (rids.size() != 1 || rids[0].pageId != k + 1)
+        {
+            printf("%s: lost key %d\n", name, k);
+            exit(1);
+        }
+    }
+
+    double search = since(start);
+    start = chrono::steady_clock::now();
+    delete index;
+    bpm->close();
+    double close = since(start);
+    printf("%s: %.0f inserts/s overall, %.1f us per lookup, %.2f s to close\n",
+           name, keys / inserts, search * 1e6 / lookups, close);
+    delete bpm;
+    delete fm;
+    system((string("rm -rf ") + path).c_str());
+}
+
+int main(int argc, char **argv)
+{
+    int keys = argc > 1 ? atoi(argv[1]) : 2000000;
+    int lookups = argc > 2 ? atoi(argv[2]) : 100000;
+    run("btree", IX_BTREE, "lsm_bench.db", keys, lookups);
+    run("lsm", IX_LSM, "lsm_bench.lsm", keys, lookups);
+    return 0;
+}
@@ -0,0 +1,152 @@
+// g++ -std=c++11 -O2 -pthread -DLSM_BUFFER=16 -Isrc -Isrc/include test/lsm_test.cpp -o lsm_test
+// lsm_test [keys]
+// a buffer of 16 entries makes the tree write a run every few inserts and
+// merge runs in the background while it is checked against a std::set
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <utility>
+#include "lsm_tree.h"
+using namespace std;
+
+typedef pair<int, int> entry;
+
+const char *PATH = "lsm_test.lsm";
+int checks = 0, failures = 0;
+
+string key(int k)
+{
+    Type_int data(false, k);
+    string s;
+    bptree::tuple_codec::put_type(s, &data);
+    return s;
+}
+
+void fail(const char *what, int k)
+{
+    if (failures++ < 10)printf("FAIL %s %d\n", what, k);
+}
+
+/* the rids of one key, and every entry of a range in order */
+void check(const lsmidx::lsm_tree &tree, const set<entry> &model, int keys, mt19937 &rng)
+{
+    for (int i = 0; i < 50; ++i)
+    {
+        int k = rng() % keys;
+        vector<RID> rids = tree.search(key(k));
+        auto it = model.lower_bound(entry(k, 0));
+        size_t j = 0;
+
+        for (; it != model.end() && it->first == k; ++it, ++j)
+            if (j >= rids.size() || rids[j].pageId != it->second)break;
+
+        if (it != model.end() && it->first == k)fail("missing", k);
+        else if (j != rids.size())fail("extra", k);
+
+        checks++;
+    }
+
+    int low = rng() % keys, high = low + rng() % 200;
+    lsmidx::lsm_tree::range entries = tree.find(key(low), key(high));
+    auto it = model.lower_bound(entry(low, 0));
+    string bytes;
+
+    while (entries.next(bytes))
+    {
+        RID rid = bptree::entry_codec::rid_of(bytes);
+
+        if (it == model.end() || it->first >= high || rid.pageId != it->second)
+        {
+            fail("range", low);
+            break;
+        }
+
+        ++it;
+    }
+
+    if (it != model.end() && it->first < high)fail("range end", low);
+
+    checks++;
+}
+
+int main(int argc, char **argv)
+{
+    int keys = argc > 1 ? atoi(argv[1]) : 2000;
+    mt19937 rng(1);
+    set<entry> model;
+    system((string("rm -rf ") + PATH).c_str());
+    lsmidx::lsm_tree *tree = new lsmidx::lsm_tree(PATH);
+    size_t most = 0, hiding = 0;
+
+    // a new index is built before it is used, which makes the tree trusted
+    tree->clear();
+
+    // three rows per key, inserted in random order
+    vector<entry> rows;
+
+    for (int i = 0; i < 3 * keys; ++i)
+        rows.push_back(entry(i % keys, i + 1));
+
+    shuffle(rows.begin(), rows.end(), rng);
+
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        tree->insert(key(rows[i].first), RID(rows[i].second, 0));
+        model.insert(rows[i]);
+        most = max(most, tree->get_meta().run_num);
+
+        if (i % 500 == 499)check(*tree, model, keys, rng);
+    }
+
+    printf("%zu entries, at most %zu runs\n", rows.size(), most);
+
+    if (most < 2)fail("no runs were written", (int)most);
+
+    // deletions hide entries that older runs still hold, and entries
+    // inserted again after their deletion are live
+    shuffle(rows.begin(), rows.end(), rng);
+
+    for (size_t i = 0; i < rows.size() / 2; ++i)
+    {
+        tree->remove(key(rows[i].first), RID(rows[i].second, 0));
+        model.erase(rows[i]);
+        hiding = max(hiding, tree->get_meta().dead_num);
+
+        if (i % 500 == 499)check(*tree, model, keys, rng);
+    }
+
+    if (hiding == 0)fail("no deletion was held over an older run", 0);
+
+    for (size_t i = 0; i < rows.size() / 8; ++i)
+    {
+        tree->insert(key(rows[i].first), RID(rows[i].second, 0));
+        model.insert(rows[i]);
+    }
+
+    check(*tree, model, keys, rng);
+    lsmidx::lsm_tree::meta_t meta = tree->get_meta();
+    printf("after deletes: %zu runs, %zu live, at most %zu deletions held\n", meta.run_num, meta.live_num, hiding);
+
+    // closed cleanly, the runs are read back
+    delete tree;
+    tree = new lsmidx::lsm_tree(PATH);
+
+    if (tree->initialized_empty())fail("reopened empty", 0);
+
+    check(*tree, model, keys, rng);
+
+    // one run without deletions is left
+    tree->rebuild();
+    meta = tree->get_meta();
+    printf("after rebuild: %zu runs, %zu live, %zu deletions\n", meta.run_num, meta.live_num, meta.dead_num);
+
+    if (meta.run_num != 1 || meta.dead_num != 0 || meta.live_num != model.size())
+        fail("rebuild", (int)meta.run_num);
+
+    check(*tree, model, keys, rng);
+    delete tree;
+    system((string("rm -rf ") + PATH).c_str());
+    printf("%d checks, %d failures\n", checks, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,45 @@
+#!/bin/sh
+# run_sql.sh <dbms> [script.sql ...]
+# runs each script, by default every test/*.sql that has a .out, in a scratch
+# directory as written and again without its CREATE and DROP INDEX lines, so
+# the answers through the indexes are checked against those of a scan; the
+# first run must print the .out next to the script, the second the same lines
+# in any order, since a scan may return rows in another order than an index
+[ $# -ge 1 ] || { echo "usage: $0 <dbms> [script.sql ...]" >&2; exit 2; }
+dbms=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+shift
+dir=$(cd "$(dirname "$0")" && pwd)
+[ $# -eq 0 ] && set -- "$dir"/*.sql
+failed=0
+
+for sql in "$@"; do
+    expected=${sql%.sql}.out
+    [ -f "$expected" ] || continue
+
+    for variant in indexed plain; do
+        scratch=$(mktemp -d)
+
+        if [ $variant = indexed ]; then
+            cp "$sql" "$scratch/run.sql"
+            cp "$expected" "$scratch/expected"
+        else
+            grep -v -i '^\(CREATE\|DROP\) INDEX' "$sql" > "$scratch/run.sql"
+            sort "$expected" > "$scratch/expected"
+        fi
+
+        (cd "$scratch" && "$dbms" run.sql > out 2> err)
+        [ $variant = plain ] && sort -o "$scratch/out" "$scratch/out"
+
+        if cmp -s "$scratch/out" "$scratch/expected"; then
+            echo "ok   $(basename "$sql") $variant"
+        else
+            echo "FAIL $(basename "$sql") $variant"
+            diff "$scratch/expected" "$scratch/out" | head -20
+            failed=1
+        fi
+
+        rm -rf "$scratch"
+    done
+done
+
+exit $failed
@@ -0,0 +1,127 @@
+// g++ -std=c++11 -O2 -pthread -Isrc -Isrc/include test/where_bench.cpp src/parser/*.cpp -o where_bench -lboost_filesystem -lboost_system
+// where_bench [rows] [passes]
+// the rows are read into memory first, so only the checks are timed; the
+// database is made in a new directory under /tmp
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unistd.h>
+#include "SQLParser.h"
+#include "parser.h"
+using namespace std;
+
+double since(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+void run(const string &sql)
+{
+    hsql::SQLParserResult *result = hsql::SQLParser::parseSQLString(sql);
+
+    if (!result->isValid)
+    {
+        printf("bad statement: %s\n", sql.c_str());
+        exit(1);
+    }
+
+    for (hsql::SQLStatement *stmt : result->statements)
+        parseStatement(stmt);
+}
+
+/* check() and the compiled predicate over every row, with the same answers */
+void time(TM_Manager *table, vector<pair<RID, RM_Record> > &data, const char *text, int passes)
+{
+    hsql::SQLParserResult *result = hsql::SQLParser::parseSQLString(string("SELECT * FROM t WHERE ") + text + ";");
+    const hsql::Expr &expr = *((hsql::SelectStatement *)result->statements[0])->whereClause;
+    map<string, int> st = table->makeHeadMap();
+    vector<char> passed(data.size());
+    size_t count = 0;
+    bool flag;
+
+    auto start = chrono::steady_clock::now();
+
+    for (int p = 0; p < passes; ++p)
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            table->check(expr, st, data[i].second, flag);
+            passed[i] = flag;
+        }
+
+    double checked = since(start);
+    // split at the top ANDs, as a statement's WHERE is
+    vector<const hsql::Expr *> terms;
+    TM_Manager::termsOf(&expr, terms);
+    TM_Predicate pass = table->where(terms, st);
+    start = chrono::steady_clock::now();
+
+    for (int p = 0; p < passes; ++p)
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            pass(data[i].second, flag);
+
+            if (flag != bool(passed[i]))
+            {
+                printf("%s: row %zu differs\n", text, i);
+                exit(1);
+            }
+
+            count += flag;
+        }
+
+    double compiled = since(start);
+    double rows = double(data.size()) * passes;
+    printf("%s: %zu pass, check %.0f ns/row, compiled %.0f ns/row, %.1fx\n",
+           text, count / passes, checked * 1e9 / rows, compiled * 1e9 / rows, checked / compiled);
+}
+
+int main(int argc, char **argv)
+{
+    int rows = argc > 1 ? atoi(argv[1]) : 100000;
+    int passes = argc > 2 ? atoi(argv[2]) : 5;
+    char dir[] = "/tmp/where_bench.XXXXXX";
+
+    if (!mkdtemp(dir) || chdir(dir) != 0)
+    {
+        printf("no scratch directory\n");
+        return 1;
+    }
+
+    run("CREATE DATABASE wb; USE DATABASE wb; CREATE TABLE t(a int(10), b char(8), c int(10));");
+
+    FileManager *fm = new FileManager();
+    BufPageManager *bpm = new BufPageManager(fm);
+    TM_Manager *table = new TM_Manager(fm, bpm, bf::current_path() / "wb" / "t");
+    mt19937 rng(1);
+
+    for (int i = 0; i < rows; ++i)
+    {
+        char b[16];
+        sprintf(b, "x%d", int(rng() % 10));
+        vector<hsql::Expr *> values;
+        values.push_back(hsql::Expr::makeLiteral(int64_t(i)));
+        values.push_back(hsql::Expr::makeLiteral(strdup(b)));
+        values.push_back(hsql::Expr::makeLiteral(int64_t(rng() % 1000)));
+        RC rc = table->insertRecord(values);
+
+        for (hsql::Expr *value : values)
+            delete value;
+
+        if (rc != Success)return 1;
+    }
+
+    vector<pair<RID, RM_Record> > data = table->rmfh->ListRec();
+    printf("%zu rows in memory, %d passes\n", data.size(), passes);
+    time(table, data, "c < 100", passes);
+    time(table, data, "NOT (c < 100 OR c > 900) AND b <> 'x1'", passes);
+    time(table, data, "b > 'x4' AND c > a", passes);
+    time(table, data, "c = 5 OR b = 'x3' OR a < 10", passes);
+
+    delete table;
+    bpm->close();
+    delete bpm;
+    delete fm;
+    system((string("rm -rf ") + dir).c_str());
+    return 0;
+}
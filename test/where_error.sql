@@ -0,0 +1,19 @@
+-- a WHERE that fails on a row, here comparing two NULL columns, stops the
+-- statement there: rows streamed to the output before it stay printed,
+-- while sorting, adding up, DELETE and UPDATE read every row first and
+-- print or change nothing; see run_sql.sh
+CREATE DATABASE we;
+USE DATABASE we;
+CREATE TABLE t(id int(10), a int(10), b int(10));
+INSERT INTO t VALUES (1, 1, 2), (50, 3, 2), (68, 9, 4), (70, NULL, NULL), (80, 5, 1);
+SELECT id FROM t WHERE a > b;
+SELECT id FROM t WHERE a > b ORDER BY id;
+SELECT NUM(id) FROM t WHERE a > b;
+DELETE FROM t WHERE a > b;
+UPDATE t SET a = 0 WHERE a > b;
+SELECT id, a FROM t;
+-- without the NULL row every statement runs
+DELETE FROM t WHERE id = 70;
+SELECT id FROM t WHERE a > b;
+DELETE FROM t WHERE a > b;
+SELECT id, a FROM t;